@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////
+// adpcm.c : IMA ADPCM sample decoding for the drum engine
+//
+// This must match the encoder in tools/adpcm_encode.py
+///////////////////////////////////////////////////////////////////////
+#include "adpcm.h"
+
+static const int8_t index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static const int16_t step_table[89] = {
+       7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+      19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+      50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+     130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+     337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+     876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+   15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static inline int decode_step(int *pred, int *index, int nibble) {
+   int step = step_table[*index];
+   int diff = step >> 3;
+   if(nibble & 1) diff += step >> 2;
+   if(nibble & 2) diff += step >> 1;
+   if(nibble & 4) diff += step;
+   if(nibble & 8) diff = -diff;
+
+   int p = *pred + diff;
+   if(p > 32767)  p = 32767;
+   if(p < -32768) p = -32768;
+   *pred = p;
+
+   int i = *index + index_table[nibble & 7];
+   if(i < 0)  i = 0;
+   if(i > 88) i = 88;
+   *index = i;
+   return p;
+}
+
+static inline const uint8_t *block_start(const uint8_t *data, uint32_t pos) {
+   return data + (pos / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_BYTES;
+}
+
+void adpcm_seek(struct adpcm_state *st, const uint8_t *data, uint32_t pos) {
+   const uint8_t *b = block_start(data, pos);
+   int pred  = (int16_t)(b[0] | (b[1] << 8));
+   int index = b[2];
+   const uint8_t *nibbles = b + 4;
+
+   for(uint32_t i = 0; i < pos % ADPCM_BLOCK_SAMPLES; i++)
+      decode_step(&pred, &index, (nibbles[i/2] >> ((i & 1) * 4)) & 0xF);
+
+   st->pred  = pred;
+   st->index = index;
+}
+
+void adpcm_decode(struct adpcm_state *st, const uint8_t *data, uint32_t pos,
+                  int16_t *dst, int n) {
+   int pred  = st->pred;
+   int index = st->index;
+
+   while(n > 0) {
+      const uint8_t *b = block_start(data, pos);
+      uint32_t i = pos % ADPCM_BLOCK_SAMPLES;
+      if(i == 0) {
+         pred  = (int16_t)(b[0] | (b[1] << 8));
+         index = b[2];
+      }
+      const uint8_t *nibbles = b + 4;
+
+      int run = ADPCM_BLOCK_SAMPLES - i;
+      if(run > n)
+         run = n;
+      for(int k = 0; k < run; k++, i++)
+         *dst++ = decode_step(&pred, &index, (nibbles[i/2] >> ((i & 1) * 4)) & 0xF);
+
+      pos += run;
+      n   -= run;
+   }
+
+   st->pred  = pred;
+   st->index = index;
+}
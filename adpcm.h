@@ -0,0 +1,28 @@
+///////////////////////////////////////////////////////////////////////
+// adpcm.h : IMA ADPCM sample decoding for the drum engine
+//
+// The blocks are made at build time by tools/adpcm_encode.py. Each
+// block of ADPCM_BLOCK_SAMPLES starts with a header holding the decoder
+// state, so decoding can start at any block.
+///////////////////////////////////////////////////////////////////////
+#ifndef ADPCM_H
+#define ADPCM_H
+#include <stdint.h>
+
+#define ADPCM_BLOCK_SAMPLES 256
+#define ADPCM_BLOCK_BYTES   (4 + ADPCM_BLOCK_SAMPLES/2)
+
+struct adpcm_state {
+   int16_t pred;
+   uint8_t index;
+};
+
+// Set up the state to decode from sample 'pos' onwards
+void adpcm_seek(struct adpcm_state *st, const uint8_t *data, uint32_t pos);
+
+// Decode n samples starting at sample 'pos' into dst. The state must be
+// the one left by adpcm_seek() or the previous call for the same 'pos'.
+void adpcm_decode(struct adpcm_state *st, const uint8_t *data, uint32_t pos,
+                  int16_t *dst, int n);
+
+#endif
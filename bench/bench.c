@@ -0,0 +1,252 @@
+///////////////////////////////////////////////////////////////////////
+// bench.c : host benchmark for the drum machine's sequencer and mixer
+//
+// Renders the bars[] loop the same way the firmware does, one block at
+// a time, and reports the speed along with a checksum of the output so
+// that changes to the mixer can be checked for both speed and results.
+//
+//    drummer_bench [-w out.wav] [seconds] [block frames] [sample rate] [song.bin] [library.bin]
+//
+// 0 seconds renders once through the song's bars. With -w the output is
+// also written to a WAV file, a channel pair for each output, exactly as
+// the firmware would send it to the DACs, for comparing against golden
+// renders or listening to. It is the same for any block size up to the
+// sequencer's lookahead (50ms), which songs/demo.txt is there to check.
+//
+// A song image (tools/song_pack.py) plays from the start, which is how to
+// measure pitched rows. A sample library
+// (tools/library_pack.py) stands in for the external flash.
+//
+// It also counts sign flips, where a channel jumps most of the way across
+// the full range from one frame to the next. Real audio doesn't, but a
+// mix that wraps instead of clipping does, so any flip fails the run.
+// songs/loud.txt overloads the bus to check for them.
+//
+///////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "drum_engine.h"
+#include "prefetch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_CYCLES
+static uint64_t cycles(void) { return __rdtsc(); }
+#endif
+
+uint32_t engine_cycles(void) {
+#ifdef HAVE_CYCLES
+   return (uint32_t)cycles();
+#else
+   return 0;
+#endif
+}
+
+// The firmware's default rate: 127MHz / 45 / 64, the nearest it gets to
+// 44.1kHz (see clock_plan.c)
+#define DEFAULT_SAMPLE_RATE 44097
+
+static uint64_t now_ns(void) {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Read a file into buf, returning its length or 0 if it can't be read
+static uint32_t load(const char *path, uint8_t *buf, uint32_t size) {
+   FILE *f = fopen(path, "rb");
+   if(f == NULL) {
+      perror(path);
+      return 0;
+   }
+   uint32_t len = fread(buf, 1, size, f);
+   fclose(f);
+   return len;
+}
+
+static void put16(FILE *f, uint32_t v) {
+   fputc(v & 0xFF, f);
+   fputc((v >> 8) & 0xFF, f);
+}
+
+static void put32(FILE *f, uint32_t v) {
+   put16(f, v);
+   put16(f, v >> 16);
+}
+
+// A plain PCM WAV header for 'frames' frames, with each output's left
+// and right as a pair of channels at the slot width
+static void wav_header(FILE *f, int sample_rate, uint32_t frames) {
+   int channels = 2 * I2S_OUTPUTS;
+   int bytes    = I2S_SLOT_BITS / 8;
+   uint32_t data = frames * channels * bytes;
+   fwrite("RIFF", 1, 4, f);
+   put32(f, 36 + data);
+   fwrite("WAVEfmt ", 1, 8, f);
+   put32(f, 16);
+   put16(f, 1);                 // PCM
+   put16(f, channels);
+   put32(f, sample_rate);
+   put32(f, sample_rate * channels * bytes);
+   put16(f, channels * bytes);
+   put16(f, I2S_SLOT_BITS);
+   fwrite("data", 1, 4, f);
+   put32(f, data);
+}
+
+// The top 16 bits of channel 'ch' (0 left, 1 right) of frame i
+static int16_t slot_sample(const uint32_t *buf, int i, int ch) {
+#if I2S_WORDS_PER_FRAME == 1
+   return ch == 0 ? buf[i] >> 16 : buf[i] & 0xFFFF;
+#else
+   return buf[2*i + ch] >> 16;
+#endif
+}
+
+#define FLIP_JUMP 49152   // Three quarters of the 16 bit range
+
+// Count the frames of the block where a channel jumped by over FLIP_JUMP,
+// carrying each channel's last sample on in 'last'
+static uint32_t sign_flips(uint32_t *const buf[I2S_OUTPUTS], int frames,
+                           int32_t last[I2S_OUTPUTS][2]) {
+   uint32_t flips = 0;
+   for(int o = 0; o < I2S_OUTPUTS; o++) {
+      for(int ch = 0; ch < 2; ch++) {
+         for(int i = 0; i < frames; i++) {
+            int32_t x = slot_sample(buf[o], i, ch);
+            if(abs(x - last[o][ch]) > FLIP_JUMP)
+               flips++;
+            last[o][ch] = x;
+         }
+      }
+   }
+   return flips;
+}
+
+// Write 'frames' of every output's block, interleaved
+static void wav_frames(FILE *f, uint32_t *const buf[I2S_OUTPUTS], int frames) {
+   for(int i = 0; i < frames; i++) {
+      for(int o = 0; o < I2S_OUTPUTS; o++) {
+#if I2S_WORDS_PER_FRAME == 1
+         put16(f, buf[o][i] >> 16);   // Left is the top half
+         put16(f, buf[o][i]);
+#else
+         put32(f, buf[o][2*i]);
+         put32(f, buf[o][2*i+1]);
+#endif
+      }
+   }
+}
+
+int main(int argc, char *argv[]) {
+   const char *name = argv[0];
+   const char *wav_path = NULL;
+   if(argc > 2 && strcmp(argv[1], "-w") == 0) {
+      wav_path = argv[2];
+      argc -= 2;
+      argv += 2;
+   }
+   int seconds     = argc > 1 ? atoi(argv[1]) : 60;
+   int block       = argc > 2 ? atoi(argv[2]) : 49;
+   int sample_rate = argc > 3 ? atoi(argv[3]) : DEFAULT_SAMPLE_RATE;
+   if(seconds < 0 || block <= 0 || sample_rate <= 0) {
+      fprintf(stderr, "usage: %s [-w out.wav] [seconds] [block frames] [sample rate] [song.bin] "
+              "[library.bin]\n", name);
+      return 1;
+   }
+
+   static uint8_t song[64*1024];
+   static uint8_t library[16*1024*1024];
+   uint32_t song_len = 0, library_len = 0;
+   if(argc > 4 && (song_len = load(argv[4], song, sizeof(song))) == 0)
+      return 1;
+   if(argc > 5 && (library_len = load(argv[5], library, sizeof(library))) == 0)
+      return 1;
+   prefetch_host_library(library, library_len);
+
+   uint32_t *buf[I2S_OUTPUTS];
+   for(int o = 0; o < I2S_OUTPUTS; o++)
+      buf[o] = malloc(block * I2S_WORDS_PER_FRAME * sizeof(uint32_t));
+   uint64_t total = (uint64_t)seconds * sample_rate;
+   uint64_t ns = 0, cyc = 0, fx[N_FX] = {0};
+   uint32_t blocks = 0, hits = 0, flips = 0;
+   int32_t last[I2S_OUTPUTS][2] = {{0}};
+   uint32_t checksum = 2166136261u;   // FNV-1a over the output words
+
+   prefetch_init();
+   engine_init(sample_rate);
+   if(song_len && !song_load(song, song_len)) {
+      fprintf(stderr, "%s isn't a valid song\n", argv[4]);
+      return 1;
+   }
+   if(seconds == 0) {
+      sequencer_poll();              // Which puts the song on
+      total = sequencer_song_frames();
+   }
+   FILE *wav = NULL;
+   if(wav_path) {
+      wav = fopen(wav_path, "wb");
+      if(!wav) {
+         perror(wav_path);
+         return 1;
+      }
+      wav_header(wav, sample_rate, total);
+   }
+   for(uint64_t done = 0; done < total; done += block) {
+      int n = total - done < (uint64_t)block ? (int)(total - done) : block;
+
+      uint64_t t = now_ns();
+#ifdef HAVE_CYCLES
+      uint64_t c = cycles();
+#endif
+      sequencer_poll();
+      render_block(buf, n);
+#ifdef HAVE_CYCLES
+      cyc += cycles() - c;
+#endif
+      ns += now_ns() - t;
+      for(int i = 0; i < N_FX; i++)
+         fx[i] += fxCycles[i];
+      blocks++;
+      const struct block_event *events;
+      hits += render_events(&events);
+
+      for(int o = 0; o < I2S_OUTPUTS; o++) {
+         for(int i = 0; i < n * I2S_WORDS_PER_FRAME; i++) {
+            checksum ^= buf[o][i];
+            checksum *= 16777619u;
+         }
+      }
+      flips += sign_flips(buf, n, last);
+      if(wav)
+         wav_frames(wav, buf, n);
+      trace_flush();
+   }
+   if(wav && fclose(wav) != 0) {
+      perror(wav_path);
+      return 1;
+   }
+
+   printf("Rendered %llu frames (%.1f s at %d Hz) in blocks of %d\n",
+          (unsigned long long)total, (double)total / sample_rate, sample_rate, block);
+   printf("  %.1f Mframes/s, %.1fx real time\n",
+          total * 1e3 / ns, total * 1e9 / ns / sample_rate);
+#ifdef HAVE_CYCLES
+   printf("  %.1f cycles/frame, %.1f cycles/voice frame\n", (double)cyc / total,
+          voiceFrames ? (double)cyc / voiceFrames : 0.0);
+   printf("  filters %.1f, delay %.1f cycles/block\n",
+          (double)fx[FX_FILTER] / blocks, (double)fx[FX_DELAY] / blocks);
+#endif
+   printf("  %u hits, peak %d voices, %u stolen, %u clipped\n", (unsigned)hits, voicesPeak,
+          (unsigned)voicesStolen, (unsigned)busClipped);
+   printf("  checksum %08x\n", (unsigned)checksum);
+   for(int o = 0; o < I2S_OUTPUTS; o++)
+      free(buf[o]);
+   if(flips) {
+      printf("  %u sign flips, the mix wrapped\n", (unsigned)flips);
+      return 1;
+   }
+   return 0;
+}
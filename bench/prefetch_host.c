@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////
+// prefetch_host.c : host stand-in for prefetch_dma.c, where every copy
+// lands straight away, and the external flash is an image in memory
+///////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "prefetch.h"
+
+void prefetch_init(void) {
+}
+
+bool prefetch_start(int16_t *dst, const int16_t *src, uint32_t count,
+                    volatile uint32_t *done, uint32_t tag) {
+   memcpy(dst, src, count * sizeof(int16_t));
+   *done = tag;
+   return true;
+}
+
+static const uint8_t *library;
+static uint32_t library_len = 0;
+
+void prefetch_host_library(const uint8_t *image, uint32_t len) {
+   library     = image;
+   library_len = len;
+}
+
+bool prefetch_read_ext(void *dst, uint32_t addr, uint32_t bytes) {
+   if(addr > library_len || bytes > library_len - addr)
+      return false;
+   memcpy(dst, library + addr, bytes);
+   return true;
+}
+
+bool prefetch_start_ext(int16_t *dst, uint32_t addr, uint32_t count,
+                        volatile uint32_t *done, uint32_t tag) {
+   if(!prefetch_read_ext(dst, addr, count * sizeof(int16_t)))
+      return false;
+   *done = tag;
+   return true;
+}
@@ -0,0 +1,10 @@
+///////////////////////////////////////////////////////////////////////
+// Host stand-in for the Pico SDK's hardware/sync.h, just enough for
+// the drum engine to build for the bench
+///////////////////////////////////////////////////////////////////////
+#ifndef BENCH_HARDWARE_SYNC_H
+#define BENCH_HARDWARE_SYNC_H
+
+#define __dmb() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#endif
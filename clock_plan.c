@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////
+// clock_plan.c : choosing the system clock for an exact audio rate
+//
+// clk_sys = 12MHz * FBDIV / POSTDIV1 / POSTDIV2, with the VCO between
+// 750MHz and 1600MHz. The sample rate is then clk_sys / pio_div /
+// cycles_per_frame. An integer PIO divider is used so the bit clock has
+// no fractional divider jitter for the DAC's PLL to follow.
+//
+// 48kHz comes out exactly (1536MHz / 5 / 2 = 153.6MHz, divide by 50 at
+// 16 bit slots). 44.1kHz can't be made exactly from a 12MHz crystal
+// with the VCO in range (it needs FBDIV to be a multiple of 147), so it
+// gets the nearest, which is 44097Hz (127MHz / 45), 63ppm slow.
+///////////////////////////////////////////////////////////////////////
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "clock_plan.h"
+
+#define XOSC_HZ     12000000u
+#define VCO_MIN_HZ  750000000u
+#define VCO_MAX_HZ  1600000000u
+#define FBDIV_MIN   16
+#define FBDIV_MAX   320
+
+bool clock_plan_find(uint32_t rate, uint32_t cycles_per_frame,
+                     uint32_t min_sys_hz, uint32_t max_sys_hz,
+                     struct clock_plan *plan) {
+    uint64_t frame_hz = (uint64_t)rate * cycles_per_frame;
+    bool found = false;
+
+    for(uint32_t fbdiv = FBDIV_MIN; fbdiv <= FBDIV_MAX; fbdiv++) {
+        uint32_t vco = XOSC_HZ * fbdiv;
+        if(vco < VCO_MIN_HZ || vco > VCO_MAX_HZ)
+            continue;
+        for(uint32_t pd1 = 1; pd1 <= 7; pd1++) {
+            for(uint32_t pd2 = 1; pd2 <= pd1; pd2++) {
+                uint32_t sys = vco / (pd1 * pd2);
+                if(sys < min_sys_hz || sys > max_sys_hz || vco % (pd1 * pd2) != 0)
+                    continue;
+
+                // Nearest integer divider, and how far off that leaves us
+                uint32_t div = (sys + frame_hz/2) / frame_hz;
+                if(div < 1 || div > 65535)
+                    continue;
+                uint64_t made = (uint64_t)div * frame_hz;
+                uint64_t diff = made > sys ? made - sys : sys - made;
+                uint32_t ppm  = (uint32_t)((diff * 1000000u + made/2) / made);
+
+                // For the same clk_sys the faster VCO has the lower jitter
+                if(found && (ppm > plan->error_ppm ||
+                             (ppm == plan->error_ppm && sys > plan->sys_hz) ||
+                             (ppm == plan->error_ppm && sys == plan->sys_hz &&
+                              vco <= plan->vco_hz)))
+                    continue;
+
+                plan->vco_hz    = vco;
+                plan->post_div1 = pd1;
+                plan->post_div2 = pd2;
+                plan->sys_hz    = sys;
+                plan->pio_div   = div;
+                plan->error_ppm = ppm;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+void clock_plan_apply(const struct clock_plan *plan) {
+    set_sys_clock_pll(plan->vco_hz, plan->post_div1, plan->post_div2);
+}
+
+uint32_t clock_plan_sample_rate(uint32_t pio_div, uint32_t cycles_per_frame) {
+    uint32_t frame_clk = pio_div * cycles_per_frame;
+    return (clock_get_hz(clk_sys) + frame_clk/2) / frame_clk;
+}
@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////
+// clock_plan.h : choosing the system clock for an exact audio rate
+//
+// The I2S bit clock is the system clock divided down by the PIO, and the
+// DAC's PLL runs from the bit clock, so the sample rate is only as good
+// as those two dividers. This picks a PLL setting for clk_sys and an
+// integer PIO divider that give the wanted rate exactly where that's
+// possible, and as near as can be otherwise.
+///////////////////////////////////////////////////////////////////////
+#ifndef CLOCK_PLAN_H
+#define CLOCK_PLAN_H
+#include <stdint.h>
+#include <stdbool.h>
+
+struct clock_plan {
+    uint32_t vco_hz;      // PLL_SYS VCO
+    uint8_t  post_div1;
+    uint8_t  post_div2;
+    uint32_t sys_hz;      // vco_hz / post_div1 / post_div2
+    uint32_t pio_div;     // Integer PIO clock divider
+    uint32_t error_ppm;   // How far the resulting rate is from the one asked for
+};
+
+// Find the best plan for 'rate' frames per second when the PIO takes
+// 'cycles_per_frame' of its clock cycles for each frame, with clk_sys
+// between min_sys_hz and max_sys_hz. Exact rates win, then the smallest
+// error, then the slowest clk_sys. Returns false if no setting is in
+// range at all.
+bool clock_plan_find(uint32_t rate, uint32_t cycles_per_frame,
+                     uint32_t min_sys_hz, uint32_t max_sys_hz,
+                     struct clock_plan *plan);
+
+// Switch clk_sys over to the plan. Peripherals clocked from it
+// (including the UART) need setting up again afterwards.
+void clock_plan_apply(const struct clock_plan *plan);
+
+// The sample rate the PIO really produces from the current clk_sys
+uint32_t clock_plan_sample_rate(uint32_t pio_div, uint32_t cycles_per_frame);
+
+#endif
@@ -0,0 +1,312 @@
+///////////////////////////////////////////////////////////////////////
+// dac.c : bringing up the PCM5242 DAC over I2C
+//
+// The init sequence is a table of register writes, sent at 400kHz.
+// Define DAC_INIT_DMA to have a DMA channel feed it to the I2C block so
+// main() can get on with rendering the first buffers while it goes out.
+// Only debug builds read the registers back to check them.
+//
+// With DAC_MONITOR defined a few status registers are then watched from
+// the other core, one short read at a time.
+//
+// There is a DAC for each I2S output, all sent the same table. The
+// PCM5242's ADR pins can only put it at 0x4C to 0x4F, so output n's DAC
+// is at dac_addrs[n]: the first stays at 0x4D, with the others on the
+// other three.
+///////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "pico/mutex.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "drum_engine.h"
+#include "dac.h"
+
+#define DAC_I2C      i2c1
+#define N_DACS       I2S_OUTPUTS
+#define DAC_SDA_PIN  10
+#define DAC_SCL_PIN  11
+#define DAC_I2C_HZ   (400 * 1000)
+
+//#define DAC_INIT_DMA
+
+static const struct dac_reg {
+   uint8_t reg;
+   uint8_t value;
+} dac_init_table[] = {
+   { 0x00, 0x00 },   // Page 0
+
+// Extracted from the reference register sequences from TI at
+//   https://e2e.ti.com/support/audio-group/audio/f/audio-forum/428281/pcm5242-slac622-code-example-for-using-non-audio-clock-sources-to-generate-audio-clocks
+//
+//  The PLL and divider parameters are modified to the specific values for this app.
+//  i.e. Sample Frequency is 44.1kHz, BCK frequency is 1.4204MHz. From table this means using the line where K*R/P is 64.
+   { 0x25, 0x1A },   // Auto divider setting : disable auto config and ignore SCK losses
+   { 0x14, 0x00 },   // PLL P=1
+   // PLL J. The PLL runs from BCK, which doubles with 32 bit slots, so J
+   // halves to keep the PLL at the same rate
+#if I2S_SLOT_BITS == 16
+   { 0x15, 0x32 },
+#else
+   { 0x15, 0x19 },
+#endif
+   { 0x16, 0x00 },   // PLL D1 and D2 are 0
+   { 0x17, 0x00 },
+   { 0x18, 0x01 },   // PLL R=2
+   { 0x1B, 0x01 },   // miniDSP CLK divider NMAC=2
+   { 0x1C, 0x0F },   // DAC CLK divider NDAC=16
+   { 0x1D, 0x04 },   // NCP CLK divider NCP=4
+   { 0x1E, 0x07 },   // OSR=8
+   { 0x22, 0x00 },   // FS setting single rate speed (48kHZ)
+   { 0x23, 0x04 },   // IDAC1 sets the number of miniDSP instructions per clock (1024)
+   { 0x24, 0x00 },   // IDAC2
+   { 0x0D, 0x10 },   // PLL Clock Source is BCK instead of SCK
+
+   // I2S with 16 or 32 bit word length
+#if I2S_SLOT_BITS == 16
+   { 40,   0x00 },
+#else
+   { 40,   0x03 },
+#endif
+   { 61,   0x00 },   // Digital volume to zero (0dB), left
+   { 62,   0x00 },   // and right
+   { 65,   0x00 },   // Disable auto mute
+
+   { 0x02, 0x10 },   // Stand-by request
+   { 0x02, 0x00 },   // Stand-by release
+};
+
+#define DAC_INIT_LEN (sizeof(dac_init_table)/sizeof(dac_init_table[0]))
+
+// Each output's DAC, by how its ADR pins are strapped
+static const uint8_t dac_addrs[4] = { 0x4D, 0x4C, 0x4E, 0x4F };
+#if N_DACS > 4
+#error Only four DAC addresses are available
+#endif
+
+// The DAC the register functions below talk to
+static uint8_t dac_addr = 0x4D;
+
+void WriteRegister (int reg, int value)
+{
+   unsigned char cmd[2];
+
+   cmd[0] = reg;
+   cmd[1] = value;
+   i2c_write_blocking(DAC_I2C, dac_addr, cmd, 2, false);
+}
+
+unsigned char ReadRegister (unsigned char reg)
+{
+   unsigned char val;
+   i2c_write_blocking(DAC_I2C, dac_addr, &reg, 1, true); // true to keep master control of bus
+   if (i2c_read_blocking(DAC_I2C, dac_addr, &val, 1, false) != 1)
+   {
+      printf("Couldn't read register %d \n\r", reg);
+   }
+   printf ("Register %d is %x\n\r", reg, val);
+   return val;
+}
+
+void CheckRegister(unsigned char reg, unsigned char check)
+{
+   unsigned char val;
+   i2c_write_blocking(DAC_I2C, dac_addr, &reg, 1, true); // true to keep master control of bus
+   if (i2c_read_blocking(DAC_I2C, dac_addr, &val, 1, false) != 1)
+   {
+      printf("Couldn't read register %d \n\r", reg);
+   }
+   if (val != check)
+   {
+      printf ("Register %d is %x, expected %x\n\r", reg, val, check);
+   }
+}
+
+void SelectPage (unsigned char page)
+{
+   WriteRegister(0, page);
+}
+
+// Set once init is over, so the monitor can have the bus
+static volatile bool dac_ready = false;
+
+#define DAC_STATUS_LEN 6
+// Last value read from each status register of each DAC, -1 until the
+// first read
+static int16_t status_seen[N_DACS*DAC_STATUS_LEN];
+
+#ifdef DAC_INIT_DMA
+// The table as I2C command words: each register write is the register
+// number, then the value with a STOP so the next starts a new transfer
+static uint32_t dac_cmds[2*DAC_INIT_LEN];
+static int dac_chan;
+#endif
+static bool dac_acked;
+
+// Write the table to the DAC at 'addr' and return whether it took it all
+static bool dac_write_table(uint8_t addr) {
+    bool acked = true;
+    for(unsigned i = 0; i < DAC_INIT_LEN; i++) {
+        uint8_t cmd[2] = { dac_init_table[i].reg, dac_init_table[i].value };
+        if(i2c_write_blocking(DAC_I2C, addr, cmd, 2, false) != 2)
+            acked = false;
+    }
+    return acked;
+}
+
+void dac_init_start(void) {
+    i2c_init(DAC_I2C, DAC_I2C_HZ);
+    gpio_set_function(DAC_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(DAC_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(DAC_SDA_PIN);
+    gpio_pull_up(DAC_SCL_PIN);
+
+#ifdef DAC_INIT_DMA
+    for(unsigned i = 0; i < DAC_INIT_LEN; i++) {
+        dac_cmds[2*i]   = dac_init_table[i].reg;
+        dac_cmds[2*i+1] = dac_init_table[i].value | I2C_IC_DATA_CMD_STOP_BITS;
+    }
+
+    // Every write goes to the first DAC, so the target address is set
+    // just once. Any others are sent theirs by dac_init_finish().
+    i2c_get_hw(DAC_I2C)->enable = 0;
+    i2c_get_hw(DAC_I2C)->tar = dac_addrs[0];
+    i2c_get_hw(DAC_I2C)->enable = 1;
+
+    dac_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dac_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(DAC_I2C, true));
+    dma_channel_configure(dac_chan, &c,
+                          &i2c_get_hw(DAC_I2C)->data_cmd,
+                          dac_cmds, 2*DAC_INIT_LEN, true);
+#else
+    dac_acked = true;
+    for(int n = 0; n < N_DACS; n++)
+        if(!dac_write_table(dac_addrs[n]))
+            dac_acked = false;
+#endif
+}
+
+// Read back each register the table set, against the last value written
+static void dac_verify(void) {
+    for(unsigned i = 0; i < DAC_INIT_LEN; i++) {
+        bool last = true;
+        for(unsigned j = i+1; j < DAC_INIT_LEN; j++)
+            if(dac_init_table[j].reg == dac_init_table[i].reg)
+                last = false;
+        if(last)
+            CheckRegister(dac_init_table[i].reg, dac_init_table[i].value);
+    }
+}
+
+bool dac_init_finish(void) {
+#ifdef DAC_INIT_DMA
+    dma_channel_wait_for_finish_blocking(dac_chan);
+    dma_channel_unclaim(dac_chan);
+    // Then for the last byte to leave the FIFO and the STOP to go out
+    i2c_hw_t *hw = i2c_get_hw(DAC_I2C);
+    while(!(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_ACTIVITY_BITS))
+        tight_loop_contents();
+    // A NAK aborts the transfer and anything after it is flushed
+    dac_acked = !(hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS);
+    (void)hw->clr_tx_abrt;
+    for(int n = 1; n < N_DACS; n++)
+        if(!dac_write_table(dac_addrs[n]))
+            dac_acked = false;
+#endif
+    bool acked = dac_acked;
+    if(!acked)
+        printf("DAC didn't acknowledge its init sequence\n\r");
+#ifndef NDEBUG
+    else
+        for(int n = 0; n < N_DACS; n++) {
+            dac_addr = dac_addrs[n];
+            dac_verify();
+        }
+    dac_addr = dac_addrs[0];
+#endif
+    for(unsigned i = 0; i < N_DACS*DAC_STATUS_LEN; i++)
+        status_seen[i] = -1;
+    dac_ready = true;
+    return acked;
+}
+
+///////////////////////////////////////////////////////////////////////
+// Health monitor. The status registers are read round robin, one every
+// DAC_MONITOR_US, with a timeout so a DAC that has gone away can't hang
+// the core. The first read of each is taken as its normal value.
+///////////////////////////////////////////////////////////////////////
+#define DAC_MONITOR_US      100000
+#define DAC_I2C_TIMEOUT_US  2000
+
+static const struct dac_status {
+   uint8_t reg;
+   const char *name;
+} dac_status[DAC_STATUS_LEN] = {
+   {   4, "PLL lock" },
+   {  91, "detected clock ratio" },
+   {  94, "clock error" },
+   {  95, "clock status" },
+   { 108, "mute monitor" },
+   { 118, "power state" },
+};
+
+auto_init_mutex(dac_bus);
+
+bool dac_bus_try_claim(void) {
+    return mutex_try_enter(&dac_bus, NULL);
+}
+
+void dac_bus_release(void) {
+    mutex_exit(&dac_bus);
+}
+
+static unsigned status_next = 0;
+static uint32_t status_due  = 0;
+static bool     status_failed[N_DACS];
+
+volatile uint32_t dacAlerts = 0;
+
+void dac_monitor_poll(void) {
+#ifdef DAC_MONITOR
+    if(!dac_ready)
+        return;
+
+    uint32_t now = time_us_32();
+    if((int32_t)(now - status_due) < 0)
+        return;
+    status_due = now + DAC_MONITOR_US;
+
+    // Each DAC's registers in turn
+    unsigned k = status_next;
+    int n = k / DAC_STATUS_LEN;
+    const struct dac_status *s = &dac_status[k % DAC_STATUS_LEN];
+    uint8_t addr = dac_addrs[n];
+    uint8_t reg = s->reg, val;
+    status_next = (k + 1) % (N_DACS*DAC_STATUS_LEN);
+    mutex_enter_blocking(&dac_bus);
+    bool ok = i2c_write_timeout_us(DAC_I2C, addr, &reg, 1, true, DAC_I2C_TIMEOUT_US) == 1 &&
+              i2c_read_timeout_us(DAC_I2C, addr, &val, 1, false, DAC_I2C_TIMEOUT_US) == 1;
+    mutex_exit(&dac_bus);
+
+    if(!ok) {
+        if(!status_failed[n]) {
+            printf("DAC %d alert: no answer reading %s (register %d)\n\r", n, s->name, reg);
+            dacAlerts++;
+        }
+        status_failed[n] = true;
+        return;
+    }
+    status_failed[n] = false;
+
+    if(status_seen[k] >= 0 && status_seen[k] != val) {
+        printf("DAC %d alert: %s (register %d) changed from %02x to %02x\n\r",
+               n, s->name, reg, status_seen[k], val);
+        dacAlerts++;
+    }
+    status_seen[k] = val;
+#endif
+}
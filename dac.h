@@ -0,0 +1,36 @@
+///////////////////////////////////////////////////////////////////////
+// dac.h : bringing up the PCM5242 DAC over I2C
+///////////////////////////////////////////////////////////////////////
+#ifndef DAC_H
+#define DAC_H
+#include <stdbool.h>
+#include <stdint.h>
+
+// Start writing the init sequence. With DAC_INIT_DMA defined this only
+// queues it on a DMA channel and returns straight away.
+void dac_init_start(void);
+
+// Wait for the init sequence to go out. Returns false if the DAC didn't
+// acknowledge it. Debug builds then read the registers back to check.
+bool dac_init_finish(void);
+
+// With DAC_MONITOR defined: read one of the DAC's status registers if
+// it's time to, and print an alert if one has changed. Call as often as
+// you like from the non-audio core.
+void dac_monitor_poll(void);
+
+// The monitor holds the I2C bus while it reads, and a transfer mustn't
+// see clk_sys (which the I2C block runs from) change under it. Returns
+// false if the monitor has the bus, otherwise it's held until released.
+bool dac_bus_try_claim(void);
+void dac_bus_release(void);
+
+// Alerts raised by the monitor so far
+extern volatile uint32_t dacAlerts;
+
+void WriteRegister(int reg, int value);
+unsigned char ReadRegister(unsigned char reg);
+void CheckRegister(unsigned char reg, unsigned char check);
+void SelectPage(unsigned char page);
+
+#endif
@@ -0,0 +1,1766 @@
+///////////////////////////////////////////////////////////////////////
+// drum_engine.c : the sequencer and mixer for the drum machine
+//
+// (c) 2021 Mike Field <hamster@snap.net.nz>
+//
+// Nothing in here touches the hardware, so it also builds for the
+// host (see bench/).
+///////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include "hardware/sync.h"
+#include "drum_engine.h"
+#include "adpcm.h"
+#include "prefetch.h"
+
+// The mixer's inner loops run from SRAM on the Pico, so they never stall
+// on an XIP cache miss. On the host they are just functions.
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#include "pico/platform.h"
+#endif
+#ifndef __not_in_flash_func
+#define __not_in_flash_func(func) func
+#endif
+
+// Drum samples, trimmed and given their metadata by tools/sample_prep.py.
+// With ADPCM_SAMPLES defined the build generates IMA ADPCM copies of these
+// (tools/adpcm_samples.cmake) and only those are linked in, at about a
+// quarter of the flash.
+#ifdef ADPCM_SAMPLES
+#include "samples/drum_clap_adpcm.h"
+#include "samples/drum_hihat_adpcm.h"
+#include "samples/drum_kick_adpcm.h"
+#include "samples/drum_perc_adpcm.h"
+#include "samples/drum_snare_adpcm.h"
+#define SOUND(name) { NULL, name##_adpcm, 0, name##_adpcm_len, \
+                      name##_peak, name##_gain, name##_loop_start, name##_loop_end }
+#else
+#include "samples/drum_clap.h"
+#include "samples/drum_hihat.h"
+#include "samples/drum_kick.h"
+#include "samples/drum_perc.h"
+#include "samples/drum_snare.h"
+#define SOUND(name) { name, NULL, 0, sizeof(name)/sizeof(int16_t), \
+                      name##_peak, name##_gain, name##_loop_start, name##_loop_end }
+#endif
+
+#define N_ROWS 6   // Rows in each pattern, each with its own sound and mix settings
+
+// Size of the voice pool. Each hit takes a free voice, or steals one when
+// they are all busy, so a hit can ring on under the next one on its row.
+#ifndef N_VOICES
+#define N_VOICES 16
+#endif
+#if PREFETCH_QUEUE_LEN < 2 * N_VOICES
+#error The prefetch queue needs room for two stream chunks from every voice
+#endif
+// Define VOICE_STEAL_QUIETEST to steal the quietest voice rather than the
+// oldest when the pool runs out
+//#define VOICE_STEAL_QUIETEST
+
+#define BPM            155     // Starting tempo, see sequencer_set_tempo()
+#define BEATS_PER_BAR  4
+#define BAR_LEN        72
+#define LOOP_BARS      10
+
+#define EVENT_QUEUE_LEN 64   // Must be a power of two
+
+// SRAM budget for caching the start of each sound, and how much of each
+// sound to cache while the budget lasts. The attacks are where the most
+// voices overlap, so reading those from SRAM keeps the XIP cache for
+// everything else.
+#ifndef SAMPLE_CACHE_BYTES
+#define SAMPLE_CACHE_BYTES (32*1024)
+#endif
+#ifndef SAMPLE_CACHE_MS
+#define SAMPLE_CACHE_MS    50
+#endif
+
+// Past the cached start, raw sounds are streamed per voice from flash in
+// chunks of this many samples, two chunks per voice
+#define STREAM_CHUNK 256
+
+// Counters for where we are in time. The sequencer side (core 1) owns
+// bar, barStep, tick and tickTime, the mixer (core 0) owns framesRendered.
+//
+// tickTime is the frame the current tick starts on as 32.32 fixed point,
+// and each tick adds tickLength to it, so the fraction of a frame left
+// over by each tick is carried into the next and the beat never drifts.
+static int bar = 0;
+static int barStep = 0;          // Next step of the bar's compiled pattern
+static int tick = 0;             // Tick of the bar that tickTime is for
+static uint64_t tickTime = 0;
+static uint64_t tickLength;
+static uint32_t songTick = 0;    // Ticks since the start of the song
+static int sampleRate;
+volatile uint32_t framesRendered = 0;
+
+// Transport and external clock sync, all on the sequencer side. While
+// following a 24 ppqn clock, pulse n since syncTick should line up with
+// song tick syncTick + n*TICKS_PER_BEAT/24.
+#define TICKS_PER_BEAT   (BAR_LEN/BEATS_PER_BAR)
+#define CLOCK_PPQN       24
+#define CLOCK_PHASE_GAIN 8       // Correct 1/8th of the phase error per pulse
+static bool running = true;
+static uint32_t syncTick = 0;
+static uint32_t clockPulses = 0;
+static uint32_t clockHistory[CLOCK_PPQN];   // Frames of the last beat's pulses
+// How far ahead of the mixer the sequencer schedules hits (~50ms)
+static int seqLookahead;
+
+
+// Define NORMALISE_SOUNDS to scale every sound by its suggested gain, so
+// they all peak at -1dBFS before the row volumes are applied
+//#define NORMALISE_SOUNDS
+
+struct Sounds {
+    const int16_t *samples;   // Raw samples, or NULL if ADPCM coded
+    const uint8_t *adpcm;     // IMA ADPCM blocks (see adpcm.h)
+    uint32_t ext_addr;        // With both NULL, where the raw samples are
+                              // in the external sample library
+    size_t   len;
+    int peak;                 // Largest magnitude in the sound
+    int gain;                 // Q12 gain to bring the peak to -1dBFS
+    uint32_t loop_start;      // Plays loop_start to loop_end over and over
+    uint32_t loop_end;        // until the envelope ends it, 0 for no loop
+};
+
+static const struct Sounds builtin_sounds[] = {
+   SOUND(drum_kick),
+   SOUND(drum_clap),
+   SOUND(drum_snare),
+   SOUND(drum_hihat),
+   SOUND(drum_perc)
+};
+
+#define N_BUILTIN_SOUNDS (sizeof(builtin_sounds)/sizeof(builtin_sounds[0]))
+
+// The built in sounds, then any from the sample library in external
+// flash (see library_load())
+#ifdef EXT_FLASH
+#define MAX_SOUNDS 32
+#else
+#define MAX_SOUNDS N_BUILTIN_SOUNDS
+#endif
+static struct Sounds sounds[MAX_SOUNDS];
+static int n_sounds;
+
+static inline bool sound_is_ext(const struct Sounds *s) {
+#ifdef EXT_FLASH
+   return s->samples == NULL && s->adpcm == NULL;
+#else
+   (void)s;
+   return false;
+#endif
+}
+
+// The start of each built in sound, copied (or decoded) into SRAM by
+// engine_init(). The arena is ordinary striped main SRAM, so the voices
+// reading from it are spread across all four banks.
+static int16_t cache_arena[SAMPLE_CACHE_BYTES/sizeof(int16_t)];
+struct sound_head {
+    const int16_t *samples;
+    uint32_t len;
+};
+static struct sound_head heads[N_BUILTIN_SOUNDS];
+
+#ifdef EXT_FLASH
+// Library sounds can't be read in place, so they are streamed from the
+// start. The mixer gets their heads into one of these slots ahead of time
+// by watching the event queues for hits on them (ext_prime()), and the
+// sequencer's look-ahead is plenty for a head to land. A hit whose head
+// isn't there streams it instead, and most likely starts with a missed
+// chunk of silence.
+#define EXT_SLOTS        8
+#define EXT_HEAD_SAMPLES 1024   // 23ms at 44.1kHz, for the first chunks to land
+static int16_t ext_head_buf[EXT_SLOTS][EXT_HEAD_SAMPLES];
+static struct ext_slot {
+    int sound;                // -1 if free
+    uint32_t used;            // voice_starts when it was last wanted
+    uint32_t want;            // The tag of its load
+    volatile uint32_t tag;    // Set to 'want' once it has landed
+} ext_slots[EXT_SLOTS];
+static int8_t sound_slot[MAX_SOUNDS];   // Slot of each library sound, or -1
+static uint32_t ext_loads = 0;
+#endif
+// Read when a library sound's chunk hasn't landed
+static const int16_t silence[STREAM_CHUNK];
+
+volatile uint32_t streamMisses = 0;
+
+// Playback rates are Q16.16, so a sound can be played at other pitches
+// without another copy of it in flash. RATE_1 plays it as recorded, and
+// anything else goes through the interpolating mixer (mix_pitched()).
+#define RATE_1   0x10000
+#define RATE_MAX (4*RATE_1)   // Two octaves up
+// Define PITCH_INTERP_4POINT for cubic (Catmull-Rom) interpolation of
+// pitched voices, rather than linear
+//#define PITCH_INTERP_4POINT
+
+// Envelopes, levels as Q30. A row can decay exponentially from the start
+// of each hit, close a gate after a while, and choke the other rows in
+// its group when it plays. Gated and choked voices fade out over
+// RELEASE_MS, and any voice that falls below ENV_FLOOR is let go so the
+// mixer stops spending time on it.
+//
+// Envelopes move on at every ENV_STEP'th frame of the render, with the
+// gains ramping in a straight line in between, so a voice sounds the
+// same however the blocks and hits split the timeline. Gates and chokes
+// take effect at the next of those frames.
+#define ENV_ONE    (1u << 30)
+#define ENV_FLOOR  (ENV_ONE >> 10)   // -60dB
+#define RELEASE_MS 5
+#define ENV_STEP   32
+
+// Mix settings for each pattern row, as the built in song has them
+struct row_params {
+    int pan;      // 32 is hard left, 0 is hard right
+    int volume;
+    int sample;   // Index into sounds[], or -1 for none
+    uint32_t rate;
+    uint32_t decay;   // Envelope multiplier per frame (Q30), or 0 for none
+    int32_t  gate;    // Frames until the gate closes, or -1 for none
+    int choke;        // Choke group, 0 for none
+    uint32_t lowpass; // Filter coefficient (Q10), or 0 for none
+    int output;       // Which I2S output the row plays on
+};
+
+static const struct row_params default_rows[N_ROWS] = {
+   { 16,  192, 0, RATE_1, 0, -1, 0, 0, 0},
+   {  8,    0, 1, RATE_1, 0, -1, 0, 0, 0},
+   { 16,   40, 2, RATE_1, 0, -1, 0, 0, 0},
+   { 18,   80, 3, RATE_1, 0, -1, 0, 0, 0},
+   { 28,   30, 4, RATE_1, 0, -1, 0, 0, 0},
+   {  4,   30, 0, RATE_1, 0, -1, 0, 0, 0}
+};
+
+// The state of the voice pool as parallel arrays, so the mixer only
+// touches what it needs. The gains are Q15 (the mix is shifted down by 15
+// bits) and are only worked out again when a voice is triggered or its
+// parameters change.
+static int      voice_sound[N_VOICES];
+static uint32_t voice_pos[N_VOICES];
+static int      voice_row[N_VOICES];
+static struct row_params voice_params[N_VOICES];   // Copied from the hit's song row
+static int      voice_emph[N_VOICES];
+static int32_t  voice_gain_l[N_VOICES];
+static int32_t  voice_gain_r[N_VOICES];
+static uint32_t voice_age[N_VOICES];     // When the voice was started, for stealing
+static uint32_t voice_rate[N_VOICES];
+// Pitched voices only: the last four samples fetched (those before
+// voice_pos), and the read point into them as Q16.16, always at least 1
+static int16_t  voice_hist[N_VOICES][4];
+static uint32_t voice_phase[N_VOICES];
+// Voices with an envelope only, worked out every ENV_STEP frames (see
+// above). The ramps are the gains << 8, moving by the steps each frame
+// for the voice_env_left frames to the next envelope frame.
+static bool     voice_shaped[N_VOICES];
+static uint32_t voice_env[N_VOICES];       // Where the ramp is heading
+static int32_t  voice_ramp_l[N_VOICES];
+static int32_t  voice_ramp_r[N_VOICES];
+static int32_t  voice_step_l[N_VOICES];
+static int32_t  voice_step_r[N_VOICES];
+static int      voice_env_left[N_VOICES];
+static uint32_t voice_decay[N_VOICES];
+static int32_t  voice_gate[N_VOICES];
+static uint32_t voice_release[N_VOICES];   // Fall per frame once released, or 0
+static uint32_t releaseStep;               // ENV_ONE over RELEASE_MS
+// Low-pass filter state for voices on filtered rows, as 16.4
+static int32_t  voice_lp[N_VOICES];
+
+// The first n_active entries are the voices that are playing, the rest
+// are free. Only the playing ones are visited by the mixer.
+static uint8_t active[N_VOICES];
+static int n_active = 0;
+static uint32_t voice_starts = 0;
+
+volatile int voicesActive = 0;
+volatile int voicesPeak = 0;
+volatile uint32_t voicesStolen = 0;
+volatile uint32_t voiceFrames = 0;
+
+// Decoding and streaming state, only used outside the inner mix loop
+static struct voice_stream {
+    struct adpcm_state adpcm;   // Decoder state at pos for ADPCM sounds
+    uint16_t hits;              // Tags this hit's stream chunks
+    struct sound_head head;     // The start of the sound, in SRAM
+    int16_t  stream[2][STREAM_CHUNK];   // Chunk k of the tail is in stream[k&1]
+    volatile uint32_t stream_tag[2];    // Set by the prefetch when a chunk lands
+#ifdef EXT_FLASH
+    uint32_t retry[2];          // Chunk+1 of a library chunk the queue had
+                                // no room for, 0 for none (stream_retry())
+#endif
+} streams[N_VOICES];
+
+
+struct Pattern {
+   char pattern[N_ROWS][BAR_LEN];
+};
+
+
+const static struct Pattern pattern0 = {{
+//"012345678901234567890123456789012345678901234567890123456789012345678901"
+  "1        1                     1    1        1                          ",
+  "                                                                        ",
+  "                  1                                   1                 ",
+  "                                                                        ",
+  "1        1        1        1        1        1        1        1        ",
+  "                                                                        "
+}};
+
+const static struct Pattern pattern1 = {{
+//"012345678901234567890123456789012345678901234567890123456789012345678901"
+  "9                                   1                                   ",
+  "                                                                        ",
+  "4        1        1        1        3        1        1        1        ",
+  "                                                                        ",
+  "                                                                        ",
+  "                                                                        "
+}};
+
+const static struct Pattern pattern2 = {{
+//"012345678901234567890123456789012345678901234567890123456789012345678901"
+  "9                                   1                                   ",
+  "         1                 1                 1                 1        ",
+  "1                 1                 1                 1                 ",
+  "5        1        1        1        1        1                 1        ",
+  "5                          1                 1                          ",
+  "         1                          4                          1        "
+}};
+
+
+static const struct Pattern *patterns[] = {
+   &pattern0,
+   &pattern1,
+   &pattern2
+};
+#define N_PATTERNS (sizeof(patterns)/sizeof(patterns[0]))
+
+// The patterns compiled into the hits they contain, in tick order, so the
+// sequencer never has to scan the empty cells
+#define MAX_STEPS 512
+
+struct step {
+   uint16_t tick;
+   uint8_t  row;
+   uint8_t  vel;    // 0 to 8, from the '1' to '9' in the pattern
+};
+
+struct compiled_pattern {
+   const struct step *steps;
+   int n_steps;
+};
+
+static const int bars[LOOP_BARS] = { 0,0,0,2,2,2,2,2,1,0};
+
+///////////////////////////////////////////////////////////////////////
+// Songs. Everything the sequencer plays from, and the mix settings the
+// mixer starts voices with, are in a struct song. There are two: the one
+// playing, and a spare that song_load() parses the next one into. The
+// sequencer swaps them over by pointer at the next bar line, and each
+// note event says which song it came from so the mixer uses the right
+// row settings across the change.
+///////////////////////////////////////////////////////////////////////
+#define MAX_SONG_PATTERNS 16
+#define MAX_SONG_BARS     128
+
+static struct song {
+   struct row_params rows[N_ROWS];
+   struct compiled_pattern patterns[MAX_SONG_PATTERNS];
+   struct step steps[MAX_STEPS];
+   uint8_t bars[MAX_SONG_BARS];   // Pattern for each bar of the loop
+   int n_patterns;
+   int n_bars;
+   uint32_t centibpm;             // Tempo to switch to, or 0 to keep it
+} songs[2];
+
+static struct song *song = &songs[0];        // Playing, sequencer side only
+static struct song *next_song = NULL;        // Starts at the next bar line
+static uint32_t songSwapFrame = 0;           // When the last swap happened
+
+typedef union 
+{
+   /* data */
+   uint32_t d1;
+   int16_t d2[2];
+} smpl_data;
+
+// Define OUTPUT_TEST_TONE to replace the drum mix with a sine wave, which is
+// handy for checking the I2S and DAC setup
+//#define OUTPUT_TEST_TONE
+#define TEST_TONE_HZ    440
+#define TEST_TONE_LEVEL 15000
+
+#ifdef OUTPUT_TEST_TONE
+// One cycle of a full scale sine. The top 8 bits of the phase accumulator
+// index it, so each step of the accumulator is 1/2^32 of a cycle.
+static const int16_t sine_table[256] = {
+        0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+    12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,  18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+    23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+    30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+    32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,  32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+    30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+    23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+    12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,   6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+        0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+   -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+   -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+   -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+   -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+   -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+   -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+   -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+};
+static uint32_t tone_phase = 0;
+static uint32_t tone_step;
+
+static void render_test_tone(uint32_t *dst, int frames) {
+   for(int i = 0; i < frames; i++) {
+      smpl_data smpl;
+      smpl.d2[0] = sine_table[tone_phase >> 24] * TEST_TONE_LEVEL / 32768;
+      smpl.d2[1] = smpl.d2[0];
+#if I2S_WORDS_PER_FRAME == 1
+      dst[i] = smpl.d1;
+#else
+      dst[2*i]   = (uint32_t)smpl.d2[0] << 16;
+      dst[2*i+1] = (uint32_t)smpl.d2[1] << 16;
+#endif
+      tone_phase += tone_step;
+   }
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////
+// Master bus. The voices sum into 32 bit accumulators at MIX_FRAC bits
+// above the 16 bit output, so loud overlapping hits can go well past 16
+// bits. A voice's samples times its gains (at most 2^14) come to under
+// 2^29, and the mixer drops MIX_SUM_SHIFT bits of the gains so that
+// N_VOICES of them still fit in 2^30, with a bit to spare for the cubic's
+// overshoot and the bus delay. The sum can't wrap, however loud.
+// The bus works at 24 bits: it drops MIX_HEADROOM extra bits to leave
+// room for them, optionally eases the peaks down with a soft knee, and
+// saturates anything still too big. 16 bit slots then just take the top
+// 16 of the 24 bits.
+///////////////////////////////////////////////////////////////////////
+#if N_VOICES <= 2
+#define MIX_SUM_SHIFT 0
+#elif N_VOICES <= 4
+#define MIX_SUM_SHIFT 1
+#elif N_VOICES <= 8
+#define MIX_SUM_SHIFT 2
+#elif N_VOICES <= 16
+#define MIX_SUM_SHIFT 3
+#elif N_VOICES <= 32
+#define MIX_SUM_SHIFT 4
+#else
+#error No more than 32 voices fit in the mix accumulators
+#endif
+#define MIX_FRAC (15 - MIX_SUM_SHIFT)
+
+#ifndef MIX_HEADROOM
+#define MIX_HEADROOM 0      // Extra bits of attenuation on the bus, each 6dB
+#endif
+// Define MIX_SOFT_LIMIT to compress everything above LIMIT_KNEE by 4:1
+//#define MIX_SOFT_LIMIT
+#define LIMIT_KNEE (24576 << 8)
+#define BUS_MAX    0x7FFFFF
+
+volatile uint32_t busClipped = 0;
+
+static inline int32_t bus_sample(int32_t x) {
+   x >>= MIX_FRAC - 8 + MIX_HEADROOM;
+#ifdef MIX_SOFT_LIMIT
+   if(x > LIMIT_KNEE)
+      x = LIMIT_KNEE + ((x - LIMIT_KNEE) >> 2);
+   else if(x < -LIMIT_KNEE)
+      x = -LIMIT_KNEE + ((x + LIMIT_KNEE) >> 2);
+#endif
+   // Two compares, nothing to do in the usual case (the M0+ has no SSAT)
+   if(x > BUS_MAX) {
+      busClipped++;
+      x = BUS_MAX;
+   } else if(x < -BUS_MAX-1) {
+      busClipped++;
+      x = -BUS_MAX-1;
+   }
+   return x;
+}
+
+// Scratch accumulators for the block being mixed, a pair for each output
+static int32_t mix_l[I2S_OUTPUTS][MAX_BLOCK_FRAMES];
+static int32_t mix_r[I2S_OUTPUTS][MAX_BLOCK_FRAMES];
+// Samples of the voice being mixed, when they have to be decoded first
+static int16_t fetch_buf[MAX_BLOCK_FRAMES];
+// and once they have been filtered
+static int16_t filter_buf[MAX_BLOCK_FRAMES];
+
+///////////////////////////////////////////////////////////////////////
+// Effects. Rows can low-pass filter their voices, and the bus can have
+// a stereo delay (BUS_DELAY_MS), its line taken from fx_arena. Each
+// effect's cost is counted with engine_cycles() into fxCycles[] for
+// every render_block(), so the platform can check them against the time
+// it has for a block before turning them up.
+///////////////////////////////////////////////////////////////////////
+#define CYCLE_MASK 0xFFFFFF   // engine_cycles() only has to count 24 bits
+
+volatile uint32_t fxCycles[N_FX];
+static uint32_t fxBlock[N_FX];   // Counting up for the block being rendered
+
+static inline void fx_cost(int fx, uint32_t since) {
+   fxBlock[fx] += (engine_cycles() - since) & CYCLE_MASK;
+}
+
+// Run 'n' samples of voice i through its row's one pole low-pass, from
+// src into dst (which may be the same). The state keeps 4 bits below the
+// samples and the coefficient is Q10, so the product stays inside 31 bits.
+static void voice_filter(int i, int16_t *dst, const int16_t *src, int n) {
+   uint32_t t = engine_cycles();
+   int32_t a = voice_params[i].lowpass;
+   int32_t s = voice_lp[i];
+   for(int k = 0; k < n; k++) {
+      s += ((((int32_t)src[k] << 4) - s) * a) >> 10;
+      dst[k] = s >> 4;
+   }
+   voice_lp[i] = s;
+   fx_cost(FX_FILTER, t);
+}
+
+// Define BUS_DELAY_MS to echo the mix back after that long, fed back by
+// BUS_DELAY_FEEDBACK and mixed in at BUS_DELAY_LEVEL (both percent). The
+// line is 16 bit stereo, so FX_ARENA_BYTES/4 frames is the longest it can
+// be (186ms at 44.1kHz for the default 32KB).
+#ifndef BUS_DELAY_MS
+#define BUS_DELAY_MS 0
+#endif
+#ifndef BUS_DELAY_FEEDBACK
+#define BUS_DELAY_FEEDBACK 35
+#endif
+#ifndef BUS_DELAY_LEVEL
+#define BUS_DELAY_LEVEL 30
+#endif
+#ifndef FX_ARENA_BYTES
+#define FX_ARENA_BYTES (32*1024)
+#endif
+
+#if BUS_DELAY_MS > 0
+static int16_t fx_arena[FX_ARENA_BYTES/sizeof(int16_t)];
+static uint32_t fx_arena_used = 0;
+
+// Take 'bytes' of fx_arena (rounded up to words) for good, or return NULL
+// if it's gone
+static void *fx_alloc(uint32_t bytes) {
+   bytes = (bytes + 3) & ~3u;
+   if(bytes > sizeof(fx_arena) - fx_arena_used)
+      return NULL;
+   void *p = (uint8_t *)fx_arena + fx_arena_used;
+   fx_arena_used += bytes;
+   return p;
+}
+
+static int16_t *delay_line;   // Left and right for each frame
+static uint32_t delay_frames;
+static uint32_t delay_pos = 0;
+
+static inline int16_t sat16(int32_t x) {
+   return x > 32767 ? 32767 : x < -32768 ? -32768 : x;
+}
+
+// Mix the delay into the block and feed the block into the line. Only
+// the first output has it.
+static void bus_delay(int32_t *mix_l, int32_t *mix_r, int frames) {
+   uint32_t t = engine_cycles();
+   const int32_t feedback = BUS_DELAY_FEEDBACK * 32768 / 100;
+   const int32_t level    = BUS_DELAY_LEVEL * 32768 / 100;
+   for(int i = 0; i < frames; i++) {
+      int16_t *d = &delay_line[2*delay_pos];
+      int32_t dl = d[0], dr = d[1];
+      d[0] = sat16((mix_l[i] >> MIX_FRAC) + ((dl * feedback) >> 15));
+      d[1] = sat16((mix_r[i] >> MIX_FRAC) + ((dr * feedback) >> 15));
+      mix_l[i] += (dl * level) >> MIX_SUM_SHIFT;
+      mix_r[i] += (dr * level) >> MIX_SUM_SHIFT;
+      if(++delay_pos == delay_frames)
+         delay_pos = 0;
+   }
+   fx_cost(FX_DELAY, t);
+}
+
+static void bus_delay_init(int sample_rate) {
+   delay_frames = (uint32_t)sample_rate * BUS_DELAY_MS / 1000;
+   if(delay_frames > FX_ARENA_BYTES/4)
+      delay_frames = FX_ARENA_BYTES/4;
+   delay_line = fx_alloc(delay_frames * 4);
+   memset(delay_line, 0, delay_frames * 4);
+}
+#endif
+
+// Convert a mixed block to output frames, see render_block()
+static void __not_in_flash_func(mix_bus)(uint32_t *dst, const int32_t *mix_l, const int32_t *mix_r, int frames) {
+   for(int i = 0; i < frames; i++) {
+#if I2S_WORDS_PER_FRAME == 1
+      smpl_data smpl;
+      smpl.d2[1] = bus_sample(mix_l[i]) >> 8;
+      smpl.d2[0] = bus_sample(mix_r[i]) >> 8;
+      dst[i] = smpl.d1;
+#else
+      dst[2*i]   = (uint32_t)bus_sample(mix_l[i]) << 8;
+      dst[2*i+1] = (uint32_t)bus_sample(mix_r[i]) << 8;
+#endif
+   }
+}
+
+///////////////////////////////////////////////////////////////////////
+// Note events are passed from the sequencer side to the mixer through
+// single producer, single consumer rings in shared RAM. Only core 1
+// writes a queue's head and only core 0 writes its tail. The pattern
+// hits and live hits (MIDI) have a queue each, as they are scheduled
+// different distances ahead and so aren't in time order with each other.
+//
+// Pattern hits are queued up to seqLookahead ahead on the sequencer's
+// timeline. When that timeline is moved (Start, Continue, or a jump to
+// an external clock) the sequencer bumps patternGen, and the mixer drops
+// any queued hits tagged with an older one instead of playing them.
+///////////////////////////////////////////////////////////////////////
+struct note_event {
+   uint32_t frame;     // Absolute frame the hit starts on
+   uint8_t  song;      // Index into songs[] for the row's settings
+   uint8_t  row;
+   int16_t  emph;
+   uint8_t  gen;       // patternGen when it was queued
+};
+
+static volatile uint8_t patternGen = 0;
+
+static struct event_queue {
+   struct note_event events[EVENT_QUEUE_LEN];
+   volatile uint32_t head;
+   volatile uint32_t tail;
+} pattern_events, live_events;
+
+static int event_queue_space(struct event_queue *q) {
+   return EVENT_QUEUE_LEN - (int)(q->head - q->tail);
+}
+
+static void event_push(struct event_queue *q, int song, int row, int emph, uint32_t frame) {
+   struct note_event *e = &q->events[q->head & (EVENT_QUEUE_LEN-1)];
+   e->frame = frame;
+   e->song  = song;
+   e->row   = row;
+   e->emph  = emph;
+   e->gen   = patternGen;
+   // Make sure the event is in memory before the mixer can see it
+   __dmb();
+   q->head++;
+}
+
+static const struct note_event *event_peek(struct event_queue *q) {
+   if(q->tail == q->head)
+      return NULL;
+   __dmb();
+   return &q->events[q->tail & (EVENT_QUEUE_LEN-1)];
+}
+
+static void event_pop(struct event_queue *q) {
+   __dmb();
+   q->tail++;
+}
+
+// The queue holding the earliest waiting event, or NULL if both are empty.
+// Pattern hits from a timeline the sequencer has since left are dropped.
+static struct event_queue *next_event(void) {
+   const struct note_event *p;
+   while((p = event_peek(&pattern_events)) != NULL && p->gen != patternGen)
+      event_pop(&pattern_events);
+   const struct note_event *l = event_peek(&live_events);
+   if(p == NULL)
+      return l ? &live_events : NULL;
+   if(l == NULL || (int32_t)(p->frame - l->frame) <= 0)
+      return &pattern_events;
+   return &live_events;
+}
+
+///////////////////////////////////////////////////////////////////////
+// Diagnostics from the audio path go into this trace ring rather than
+// straight to printf. Core 0 writes entries without ever waiting (they
+// are dropped if the ring is full) and core 1 prints them at leisure.
+///////////////////////////////////////////////////////////////////////
+#define TRACE_LEN 32   // Must be a power of two
+
+struct trace_entry {
+   const char *fmt;    // printf format taking the two values
+   int32_t a, b;
+};
+
+static struct trace_entry trace_ring[TRACE_LEN];
+static volatile uint32_t traceHead = 0;
+static volatile uint32_t traceTail = 0;
+volatile uint32_t traceDropped = 0;
+
+void trace(const char *fmt, int32_t a, int32_t b) {
+   uint32_t head = traceHead;
+   if(head - traceTail == TRACE_LEN) {
+      traceDropped++;
+      return;
+   }
+   struct trace_entry *t = &trace_ring[head & (TRACE_LEN-1)];
+   t->fmt = fmt;
+   t->a   = a;
+   t->b   = b;
+   __dmb();
+   traceHead = head + 1;
+}
+
+// Print everything waiting in the trace ring
+void trace_flush(void) {
+   while(traceTail != traceHead) {
+      __dmb();
+      struct trace_entry t = trace_ring[traceTail & (TRACE_LEN-1)];
+      __dmb();
+      traceTail++;
+      printf(t.fmt, t.a, t.b);
+   }
+}
+
+// Compile the built in patterns into a song, each into its list of steps
+static void compile_patterns(struct song *s) {
+   int n = 0;
+   for(unsigned p = 0; p < N_PATTERNS; p++) {
+      s->patterns[p].steps = &s->steps[n];
+      for(int tick = 0; tick < BAR_LEN; tick++) {
+         for(int row = 0; row < N_ROWS; row++) {
+            char c = patterns[p]->pattern[row][tick];
+            if(c == ' ' || n == MAX_STEPS)
+               continue;
+            s->steps[n].tick = tick;
+            s->steps[n].row  = row;
+            s->steps[n].vel  = c - '1';
+            n++;
+         }
+      }
+      s->patterns[p].n_steps = &s->steps[n] - s->patterns[p].steps;
+   }
+   s->n_patterns = N_PATTERNS;
+
+   for(int b = 0; b < LOOP_BARS; b++)
+      s->bars[b] = bars[b];
+   s->n_bars = LOOP_BARS;
+
+   for(int r = 0; r < N_ROWS; r++)
+      s->rows[r] = default_rows[r];
+   s->centibpm = BPM * 100;
+}
+
+// The per frame envelope multiplier that halves the level every
+// 'half_ms', or 0 for no decay. 1 - ln(2)/n is near enough to 2^(-1/n)
+// for anything longer than a few frames.
+static uint32_t decay_factor(int half_ms) {
+   if(half_ms == 0)
+      return 0;
+   uint32_t frames = (uint32_t)half_ms * sampleRate / 1000;
+   if(frames < 2)
+      frames = 2;
+   return ENV_ONE - (uint32_t)(744261118u / frames);   // ln(2) * 2^30
+}
+
+// The one pole low-pass coefficient (Q10) for a cutoff of 'hz', or 0 for
+// none. It should be 1 - e^-w for w = 2 pi hz / rate, and 2w / (2 + w) is
+// close to that all the way up.
+static uint32_t lowpass_coef(int hz) {
+   if(hz == 0)
+      return 0;
+   uint32_t w = 6434u * hz / sampleRate;   // 2 pi * 2^10
+   uint32_t a = (w << 11) / (2048 + w);
+   return a < 1 ? 1 : a > 1023 ? 1023 : a;
+}
+
+static int get16(const uint8_t *p) {
+   return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p) {
+   return get16(p) | (uint32_t)get16(p + 2) << 16;
+}
+
+// Parse a song image (see drum_engine.h) into s, or return false if it
+// isn't a valid one
+static bool parse_song(struct song *s, const uint8_t *data, uint32_t len) {
+   const uint8_t *p = data, *end = data + len;
+
+   if(len < SONG_HEADER_BYTES || get16(p) != SONG_MAGIC || p[2] != SONG_VERSION)
+      return false;
+   int n_rows = p[3];
+   s->n_patterns = p[4];
+   s->n_bars     = p[5];
+   s->centibpm   = get16(p + 6);
+   p += SONG_HEADER_BYTES;
+   if(n_rows != N_ROWS || s->n_patterns == 0 || s->n_patterns > MAX_SONG_PATTERNS ||
+      s->n_bars == 0 || s->n_bars > MAX_SONG_BARS)
+      return false;
+
+   if(end - p < SONG_ROW_BYTES*N_ROWS + s->n_bars)
+      return false;
+   for(int r = 0; r < N_ROWS; r++, p += SONG_ROW_BYTES) {
+      int sample = (int8_t)p[2];
+      uint32_t rate = get32(p + 3);
+      int decay_ms = get16(p + 7), gate_ms = get16(p + 9);
+      if(p[0] > 32 || sample >= n_sounds || rate == 0 || rate > RATE_MAX)
+         return false;
+      s->rows[r].pan    = p[0];
+      s->rows[r].volume = p[1];
+      s->rows[r].sample = sample < 0 ? -1 : sample;
+      s->rows[r].rate   = rate;
+      s->rows[r].decay  = decay_factor(decay_ms);
+      s->rows[r].gate   = gate_ms ? (int32_t)((uint32_t)gate_ms * sampleRate / 1000) : -1;
+      s->rows[r].choke  = p[11];
+      s->rows[r].lowpass = lowpass_coef(get16(p + 12));
+      // A row for an output this build doesn't have plays on the first
+      s->rows[r].output  = p[14] < I2S_OUTPUTS ? p[14] : 0;
+   }
+   for(int b = 0; b < s->n_bars; b++, p++) {
+      if(*p >= s->n_patterns)
+         return false;
+      s->bars[b] = *p;
+   }
+
+   int n = 0;
+   for(int i = 0; i < s->n_patterns; i++) {
+      if(end - p < 2)
+         return false;
+      int n_steps = get16(p);
+      p += 2;
+      if(n + n_steps > MAX_STEPS || end - p < 2*n_steps)
+         return false;
+
+      s->patterns[i].steps   = &s->steps[n];
+      s->patterns[i].n_steps = n_steps;
+      int last = 0;
+      for(int j = 0; j < n_steps; j++, p += 2, n++) {
+         // In tick order, which is what the sequencer relies on
+         if(p[0] >= BAR_LEN || p[0] < last || (p[1] >> 4) >= N_ROWS || (p[1] & 15) > 8)
+            return false;
+         s->steps[n].tick = last = p[0];
+         s->steps[n].row  = p[1] >> 4;
+         s->steps[n].vel  = p[1] & 15;
+      }
+   }
+   return true;
+}
+
+bool song_load(const uint8_t *data, uint32_t len) {
+   // Only the spare is free, and only once the mixer has moved past the
+   // last of the hits from before the previous swap
+   if(next_song != NULL || (int32_t)(framesRendered - songSwapFrame) < 0)
+      return false;
+
+   struct song *spare = song == &songs[0] ? &songs[1] : &songs[0];
+   if(data == NULL)
+      compile_patterns(spare);
+   else if(!parse_song(spare, data, len))
+      return false;
+   next_song = spare;
+   return true;
+}
+
+// Change over to next_song, from the top, where the playing song has
+// got to a bar line
+static void song_swap(void) {
+   song          = next_song;
+   next_song     = NULL;
+   bar           = 0;
+   songSwapFrame = (uint32_t)(tickTime >> 32);
+   if(song->centibpm)
+      sequencer_set_tempo(song->centibpm);
+}
+
+// Queue the hits that start before frame 'until'
+static void sequencer_run(uint32_t until) {
+   // Sitting on a bar line with nothing of the bar queued yet (at the
+   // start, say) counts as the next one
+   if(next_song != NULL && tick == 0 && barStep == 0)
+      song_swap();
+
+   while(running && event_queue_space(&pattern_events) > 0) {
+      const struct compiled_pattern *p = &song->patterns[song->bars[bar]];
+      int next = barStep < p->n_steps ? p->steps[barStep].tick : BAR_LEN;
+
+      // Step the tick clock up to the next hit, or the end of the bar
+      while(tick < next) {
+         if((int32_t)((uint32_t)(tickTime >> 32) - until) >= 0)
+            return;
+         tickTime += tickLength;
+         tick++;
+         songTick++;
+      }
+
+      if(tick == BAR_LEN) {
+         tick    = 0;
+         barStep = 0;
+         bar++;
+         if(bar == song->n_bars)
+            bar = 0;
+         // Change songs on the bar line, from the top of the new one
+         if(next_song != NULL)
+            song_swap();
+         continue;
+      }
+
+      // Start the hit on the nearest frame
+      uint32_t frame = (tickTime + 0x80000000u) >> 32;
+      if((int32_t)(frame - until) >= 0)
+         return;
+      event_push(&pattern_events, song - songs, p->steps[barStep].row,
+                 p->steps[barStep].vel * 12, frame);
+      barStep++;
+   }
+}
+
+void sequencer_set_tempo(uint32_t centibpm) {
+   // Frames per tick, as 32.32 fixed point
+   tickLength = ((uint64_t)sampleRate * 60 * 100 * BEATS_PER_BAR << 32)
+              / ((uint64_t)centibpm * BAR_LEN);
+}
+
+uint32_t sequencer_song_frames(void) {
+   return (uint32_t)(((uint64_t)song->n_bars * BAR_LEN * tickLength) >> 32);
+}
+
+void sequencer_start(uint32_t frame) {
+   bar      = 0;
+   barStep  = 0;
+   tick     = 0;
+   songTick = 0;
+   sequencer_continue(frame);
+}
+
+void sequencer_stop(void) {
+   running = false;
+   patternGen++;   // And nothing already queued plays after the Stop
+}
+
+void sequencer_continue(uint32_t frame) {
+   // Carry on from the current tick, which may be part way through a bar.
+   // Anything already queued was timed for the old timeline.
+   patternGen++;
+   tickTime    = (uint64_t)frame << 32;
+   syncTick    = songTick;
+   clockPulses = 0;
+   running     = true;
+}
+
+void sequencer_clock(uint32_t frame) {
+   uint32_t n = clockPulses++;
+
+   // Follow the tempo, from the length of the last beat
+   uint32_t *oldest = &clockHistory[n % CLOCK_PPQN];
+   if(n >= CLOCK_PPQN) {
+      uint64_t measured = ((uint64_t)(frame - *oldest) << 32) / TICKS_PER_BEAT;
+      tickLength += ((int64_t)(measured - tickLength)) / 4;
+   }
+   *oldest = frame;
+
+   if(!running)
+      return;
+
+   // Where the next tick should start, going by this pulse, in quarters of
+   // a tick from the pulse so it stays in whole numbers
+   int64_t quarters = 4 * (int64_t)(int32_t)(songTick - syncTick)
+                    - 4 * (int64_t)n * TICKS_PER_BEAT / CLOCK_PPQN;
+   uint64_t target = ((uint64_t)frame << 32) + quarters * (int64_t)tickLength / 4;
+   int64_t error = (int64_t)(target - tickTime);
+
+   // Pull the phase in gently, but jump straight there if it is way out
+   if(error > (int64_t)tickLength * TICKS_PER_BEAT || -error > (int64_t)tickLength * TICKS_PER_BEAT) {
+      patternGen++;
+      tickTime = target;
+   } else
+      tickTime += error / CLOCK_PHASE_GAIN;
+}
+
+void live_hit(int row, int emph, uint32_t frame) {
+   if(row < 0 || row >= N_ROWS || event_queue_space(&live_events) == 0)
+      return;
+   event_push(&live_events, song - songs, row, emph, frame);
+}
+
+void sequencer_poll(void) {
+   sequencer_run(framesRendered + seqLookahead);
+}
+
+static inline uint32_t stream_tag(struct voice_stream *vs, uint32_t chunk) {
+   return ((uint32_t)vs->hits << 16) | (chunk + 1);
+}
+
+// Ask for chunk 'chunk' of the voice's tail to be prefetched
+static void stream_request(int i, uint32_t chunk) {
+   const struct Sounds *s   = &sounds[voice_sound[i]];
+   struct voice_stream *vs  = &streams[i];
+   uint32_t start = vs->head.len + chunk * STREAM_CHUNK;
+   if(start >= s->len)
+      return;
+   uint32_t count = s->len - start;
+   if(count > STREAM_CHUNK)
+      count = STREAM_CHUNK;
+#ifdef EXT_FLASH
+   // A library sound has nothing to fall back on, so if the queue is full
+   // the chunk is asked for again on the next block
+   if(sound_is_ext(s)) {
+      bool queued = prefetch_start_ext(vs->stream[chunk & 1], s->ext_addr + start * sizeof(int16_t),
+                                       count, &vs->stream_tag[chunk & 1], stream_tag(vs, chunk));
+      vs->retry[chunk & 1] = queued ? 0 : chunk + 1;
+      return;
+   }
+#endif
+   // If the queue is full the mixer just reads that chunk from flash
+   prefetch_start(vs->stream[chunk & 1], s->samples + start, count,
+                  &vs->stream_tag[chunk & 1], stream_tag(vs, chunk));
+}
+
+static void voice_update_gains(int i) {
+   const struct row_params *p = &voice_params[i];
+   int vol = voice_emph[i] + p->volume;
+   voice_gain_l[i] = vol * p->pan;
+   voice_gain_r[i] = vol * (32 - p->pan);
+#ifdef NORMALISE_SOUNDS
+   // Can't overflow the mix, as no sample times its gain is over -1dBFS
+   int gain = sounds[voice_sound[i]].gain;
+   voice_gain_l[i] = (voice_gain_l[i] * gain) >> 12;
+   voice_gain_r[i] = (voice_gain_r[i] * gain) >> 12;
+#endif
+   if(voice_shaped[i]) {
+      // Gains are at most 2^14, so this keeps 15 bits of the level
+      uint32_t env = voice_env[i] >> 15;
+      voice_gain_l[i] = (voice_gain_l[i] * env) >> 15;
+      voice_gain_r[i] = (voice_gain_r[i] * env) >> 15;
+   }
+}
+
+// x^n for Q30 x, by squaring
+static uint32_t env_power(uint32_t x, int n) {
+   uint32_t result = ENV_ONE;
+   while(n) {
+      if(n & 1)
+         result = ((uint64_t)result * x) >> 30;
+      x = ((uint64_t)x * x) >> 30;
+      n >>= 1;
+   }
+   return result;
+}
+
+// Move voice i's envelope on by 'frames', to the next envelope frame,
+// and set its gains to where it will be then
+static void voice_envelope(int i, int frames) {
+   if(voice_gate[i] == 0 && !voice_release[i])
+      voice_release[i] = releaseStep;
+   if(voice_gate[i] > 0)
+      voice_gate[i] = voice_gate[i] > frames ? voice_gate[i] - frames : 0;
+
+   uint32_t env = voice_env[i];
+   if(voice_release[i]) {
+      uint32_t fall = voice_release[i] * frames;
+      env = env > fall ? env - fall : 0;
+   } else if(voice_decay[i]) {
+      env = ((uint64_t)env * env_power(voice_decay[i], frames)) >> 30;
+   }
+   voice_env[i] = env;
+   voice_update_gains(i);
+}
+
+// Start voice i ramping from where it is to its envelope at the next
+// envelope frame after 'frame'
+static void voice_env_segment(int i, uint32_t frame) {
+   int n = ENV_STEP - frame % ENV_STEP;
+   voice_envelope(i, n);
+   voice_step_l[i]   = ((voice_gain_l[i] << 8) - voice_ramp_l[i]) / n;
+   voice_step_r[i]   = ((voice_gain_r[i] << 8) - voice_ramp_r[i]) / n;
+   voice_env_left[i] = n;
+}
+
+// Give voice i an envelope from its gains now, next time it is mixed
+static void voice_env_begin(int i) {
+   voice_shaped[i]   = true;
+   voice_ramp_l[i]   = voice_gain_l[i] << 8;
+   voice_ramp_r[i]   = voice_gain_r[i] << 8;
+   voice_env_left[i] = 0;
+}
+
+// Fade out every playing voice in the choke group
+static void voice_choke(int group) {
+   for(int j = 0; j < n_active; j++) {
+      int i = active[j];
+      if(voice_params[i].choke == group && !voice_release[i]) {
+         if(!voice_shaped[i])
+            voice_env_begin(i);
+         voice_release[i] = releaseStep;
+      }
+   }
+}
+
+// Is anything playing sound s?
+static bool sound_playing(int s) {
+   for(int j = 0; j < n_active; j++)
+      if(voice_sound[active[j]] == s)
+         return true;
+   return false;
+}
+
+#ifdef EXT_FLASH
+// Start the head of library sound s loading into a slot, if it isn't
+// in one already. The slot taken is a free one, or else the one wanted
+// longest ago that no voice is playing from.
+static void ext_head_load(int s) {
+   if(sound_slot[s] >= 0) {
+      ext_slots[sound_slot[s]].used = voice_starts;
+      return;
+   }
+   struct ext_slot *slot = NULL;
+   for(int k = 0; k < EXT_SLOTS; k++) {
+      struct ext_slot *e = &ext_slots[k];
+      if(e->sound < 0) {
+         slot = e;
+         break;
+      }
+      // Leave ones wanted since the last hit started, they are coming up
+      if(e->used == voice_starts || sound_playing(e->sound))
+         continue;
+      if(slot == NULL || (int32_t)(e->used - slot->used) < 0)
+         slot = e;
+   }
+   if(slot == NULL)
+      return;
+
+   int k = slot - ext_slots;
+   uint32_t len = sounds[s].len < EXT_HEAD_SAMPLES ? sounds[s].len : EXT_HEAD_SAMPLES;
+   if(slot->sound >= 0)
+      sound_slot[slot->sound] = -1;
+   slot->sound = -1;
+   slot->want  = ++ext_loads;
+   if(!prefetch_start_ext(ext_head_buf[k], sounds[s].ext_addr, len, &slot->tag, slot->want))
+      return;   // Try again on the next block
+   slot->sound   = s;
+   slot->used    = voice_starts;
+   sound_slot[s] = k;
+}
+
+// The head of library sound s, as far as it has landed: all of it or
+// none
+static struct sound_head ext_head(int s) {
+   struct sound_head h = { NULL, 0 };
+   int k = sound_slot[s];
+   if(k >= 0 && ext_slots[k].tag == ext_slots[k].want) {
+      h.samples = ext_head_buf[k];
+      h.len     = sounds[s].len < EXT_HEAD_SAMPLES ? sounds[s].len : EXT_HEAD_SAMPLES;
+   }
+   return h;
+}
+
+// Load the heads of the library sounds that queued hits are for
+static void ext_prime(void) {
+   struct event_queue *queues[2] = { &pattern_events, &live_events };
+   for(int n = 0; n < 2; n++) {
+      struct event_queue *q = queues[n];
+      uint32_t head = q->head;
+      __dmb();
+      for(uint32_t k = q->tail; k != head; k++) {
+         const struct note_event *e = &q->events[k & (EVENT_QUEUE_LEN-1)];
+         int s = songs[e->song].rows[e->row].sample;
+         if(s >= (int)N_BUILTIN_SOUNDS)
+            ext_head_load(s);
+      }
+   }
+}
+
+// Ask again for the library chunks the prefetch queue had no room for
+static void stream_retry(void) {
+   for(int j = 0; j < n_active; j++) {
+      int i = active[j];
+      for(int k = 0; k < 2; k++)
+         if(streams[i].retry[k] != 0)
+            stream_request(i, streams[i].retry[k] - 1);
+   }
+}
+#endif
+
+// Where voice i goes back to its sound's loop start, or 0 if it plays
+// through. Only voices with an envelope loop, as nothing else would end
+// them, and one choked after it got past the loop just plays out.
+static inline uint32_t voice_loop_end(int i) {
+   uint32_t loop_end = sounds[voice_sound[i]].loop_end;
+   return voice_shaped[i] && voice_pos[i] < loop_end ? loop_end : 0;
+}
+
+// Move voice i to sample 'pos', and set the ADPCM decoder or the tail
+// prefetch going from there
+static void voice_seek(int i, uint32_t pos) {
+   const struct Sounds *s     = &sounds[voice_sound[i]];
+   const struct sound_head *h = &streams[i].head;
+   voice_pos[i] = pos;
+#ifdef EXT_FLASH
+   streams[i].retry[0] = streams[i].retry[1] = 0;
+#endif
+   if(s->adpcm) {
+      if(pos >= h->len)
+         adpcm_seek(&streams[i].adpcm, s->adpcm, pos);
+   } else if(s->len > h->len) {
+      // The chunk holding pos and the one after are in flight, old ones
+      // are dropped by the new tag
+      uint32_t chunk = pos < h->len ? 0 : (pos - h->len) / STREAM_CHUNK;
+      streams[i].hits++;
+      stream_request(i, chunk);
+      stream_request(i, chunk + 1);
+   }
+}
+
+// Take a free voice, or steal one if the pool is in use
+static int voice_alloc(void) {
+   if(n_active < N_VOICES) {
+      int i = active[n_active++];
+      if(n_active > voicesPeak)
+         voicesPeak = n_active;
+      return i;
+   }
+
+   int victim = active[0];
+   for(int j = 1; j < N_VOICES; j++) {
+      int i = active[j];
+#ifdef VOICE_STEAL_QUIETEST
+      int32_t level   = voice_gain_l[i] + voice_gain_r[i];
+      int32_t quietest = voice_gain_l[victim] + voice_gain_r[victim];
+      if(level < quietest || (level == quietest &&
+                              (int32_t)(voice_age[i] - voice_age[victim]) < 0))
+         victim = i;
+#else
+      if((int32_t)(voice_age[i] - voice_age[victim]) < 0)
+         victim = i;
+#endif
+   }
+   voicesStolen++;
+   return victim;
+}
+
+// Start a hit on the given pattern row
+static void voice_start(int song, int row, int emph) {
+   const struct row_params *p = &songs[song].rows[row];
+   if(p->sample < 0)
+      return;
+
+   if(p->choke)
+      voice_choke(p->choke);
+
+   int i = voice_alloc();
+   voice_sound[i]  = p->sample;
+   voice_row[i]    = row;
+   voice_params[i] = *p;   // The song may be reloaded while it plays
+   voice_emph[i]  = emph;
+   voice_age[i]   = voice_starts++;
+   voice_rate[i]  = p->rate;
+   voice_shaped[i]  = false;
+   voice_env[i]     = ENV_ONE;
+   voice_decay[i]   = p->decay;
+   voice_gate[i]    = p->gate;
+   voice_release[i] = 0;
+   voice_lp[i]      = 0;
+   voice_update_gains(i);
+   if(p->decay != 0 || p->gate >= 0)
+      voice_env_begin(i);
+
+   if(p->rate != RATE_1) {
+      // Reading starts at sample 0, after four samples of silence
+      memset(voice_hist[i], 0, sizeof(voice_hist[i]));
+      voice_phase[i] = 4 * RATE_1;
+   }
+#ifdef EXT_FLASH
+   if(sound_is_ext(&sounds[p->sample]))
+      streams[i].head = ext_head(p->sample);
+   else
+#endif
+      streams[i].head = heads[p->sample];
+   voice_seek(i, 0);
+}
+
+// Point *src at the next samples of voice i, at most 'max' of them, and
+// return how many there are. They come from the SRAM head, the voice's
+// stream chunks, or are decoded into fetch_buf.
+static int voice_fetch(int i, int max, const int16_t **src) {
+   const struct Sounds *s      = &sounds[voice_sound[i]];
+   struct voice_stream *vs     = &streams[i];
+   const struct sound_head *h  = &vs->head;
+   uint32_t pos = voice_pos[i];
+   int n;
+
+   if(pos < h->len) {
+      n = h->len - pos;
+      *src = h->samples + pos;
+   } else if(s->adpcm) {
+      if(pos == h->len)
+         adpcm_seek(&vs->adpcm, s->adpcm, pos);
+      n = max;
+      adpcm_decode(&vs->adpcm, s->adpcm, pos, fetch_buf, n);
+      *src = fetch_buf;
+   } else {
+      uint32_t chunk  = (pos - h->len) / STREAM_CHUNK;
+      uint32_t offset = (pos - h->len) % STREAM_CHUNK;
+      // Starting a chunk frees the buffer of the one before it
+      if(offset == 0 && chunk > 0)
+         stream_request(i, chunk + 1);
+
+      n = STREAM_CHUNK - offset;
+      if(vs->stream_tag[chunk & 1] == stream_tag(vs, chunk)) {
+         *src = vs->stream[chunk & 1] + offset;
+      } else {
+         // The prefetch hasn't landed, so read straight from flash
+         streamMisses++;
+         *src = s->samples ? s->samples + pos : silence;
+      }
+   }
+   return n < max ? n : max;
+}
+
+// Fetch the next 'count' samples of voice i into dst, and move the voice
+// on past them, round the loop if it has one. Past the end of the sound
+// they are silence. Returns how many came from the sound.
+static int voice_gather(int i, int16_t *dst, int count) {
+   uint32_t loop_end = voice_loop_end(i);
+   uint32_t end = loop_end ? loop_end : sounds[voice_sound[i]].len;
+   int total = count;
+   while(count > 0 && voice_pos[i] < end) {
+      const int16_t *src;
+      int max = end - voice_pos[i];
+      if(max > count)
+         max = count;
+      if(max > MAX_BLOCK_FRAMES)
+         max = MAX_BLOCK_FRAMES;   // Decoding is into fetch_buf
+      int run = voice_fetch(i, max, &src);
+      memcpy(dst, src, run * sizeof(int16_t));
+      dst   += run;
+      count -= run;
+      voice_pos[i] += run;
+      if(voice_pos[i] == loop_end)
+         voice_seek(i, sounds[voice_sound[i]].loop_start);
+   }
+   int got = total - count;
+   if(count > 0) {
+      memset(dst, 0, count * sizeof(int16_t));
+      voice_pos[i] += count;
+   }
+   return got;
+}
+
+///////////////////////////////////////////////////////////////////////
+// Mixer kernels. Each adds a run of one voice's samples into an output's
+// accumulators, with either fixed gains or gains ramping by a step each
+// frame (<< 8, for the envelope), both MIX_SUM_SHIFT bits down on the
+// voice's gains, and in a centred version for when both
+// sides are the same, which needs half the multiplies. Each comes for 16
+// bit samples and for the 32 bit ones a retuned voice is resampled to (the
+// cubic can overshoot 16 bits). They are unrolled by four, and picked from
+// mix_kernels[] once per voice for each span rather than branching on the
+// voice's settings inside the loop.
+///////////////////////////////////////////////////////////////////////
+struct mix_gains {
+   int32_t l, r;             // Carried on from run to run
+   int32_t step_l, step_r;
+};
+
+typedef void (*mix_kernel)(int32_t *l, int32_t *r, const void *src, int n,
+                           struct mix_gains *g);
+
+#define MIX_KERNEL(name, type, FRAME)                                     \
+static void __not_in_flash_func(name)(int32_t *l, int32_t *r,             \
+                                      const void *samples, int n,         \
+                                      struct mix_gains *g) {              \
+   const type *src = samples;                                             \
+   int32_t gain_l = g->l, gain_r = g->r;                                  \
+   int32_t step_l = g->step_l, step_r = g->step_r;                        \
+   (void)step_l; (void)step_r;                                            \
+   int k = 0;                                                             \
+   for(; k + 4 <= n; k += 4) {                                            \
+      FRAME(k); FRAME(k+1); FRAME(k+2); FRAME(k+3);                       \
+   }                                                                      \
+   for(; k < n; k++)                                                      \
+      FRAME(k);                                                           \
+   g->l = gain_l;                                                         \
+   g->r = gain_r;                                                         \
+}
+
+#define RAMP_SHIFT (8 + MIX_SUM_SHIFT)
+#define SUM_ROUND  ((1 << MIX_SUM_SHIFT) >> 1)   // Rounds off the gain bits dropped
+
+#define FLAT_PANNED(k)  do { int32_t x = src[k];                          \
+                             l[k] += x * gain_l;                          \
+                             r[k] += x * gain_r; } while(0)
+#define FLAT_CENTRED(k) do { int32_t y = src[k] * gain_l;                 \
+                             l[k] += y;                                   \
+                             r[k] += y; } while(0)
+#define RAMP_PANNED(k)  do { int32_t x = src[k];                          \
+                             l[k] += x * (gain_l >> RAMP_SHIFT);          \
+                             r[k] += x * (gain_r >> RAMP_SHIFT);          \
+                             gain_l += step_l;                            \
+                             gain_r += step_r; } while(0)
+#define RAMP_CENTRED(k) do { int32_t y = src[k] * (gain_l >> RAMP_SHIFT); \
+                             l[k] += y;                                   \
+                             r[k] += y;                                   \
+                             gain_l += step_l;                            \
+                             gain_r  = gain_l; } while(0)
+
+MIX_KERNEL(mix_flat_panned_16,  int16_t, FLAT_PANNED)
+MIX_KERNEL(mix_flat_centred_16, int16_t, FLAT_CENTRED)
+MIX_KERNEL(mix_ramp_panned_16,  int16_t, RAMP_PANNED)
+MIX_KERNEL(mix_ramp_centred_16, int16_t, RAMP_CENTRED)
+MIX_KERNEL(mix_flat_panned_32,  int32_t, FLAT_PANNED)
+MIX_KERNEL(mix_flat_centred_32, int32_t, FLAT_CENTRED)
+MIX_KERNEL(mix_ramp_panned_32,  int32_t, RAMP_PANNED)
+MIX_KERNEL(mix_ramp_centred_32, int32_t, RAMP_CENTRED)
+
+enum { SRC_16, SRC_32 };
+
+// By [sample size][shaped][centred]
+static const mix_kernel mix_kernels[2][2][2] = {
+   { { mix_flat_panned_16, mix_flat_centred_16 },
+     { mix_ramp_panned_16, mix_ramp_centred_16 } },
+   { { mix_flat_panned_32, mix_flat_centred_32 },
+     { mix_ramp_panned_32, mix_ramp_centred_32 } },
+};
+
+// Shaped voices' gains are << 8 and ramp, the others' are as they are
+static inline mix_kernel pick_kernel(int size, bool shaped, const struct mix_gains *g) {
+   return mix_kernels[size][shaped][g->l == g->r && g->step_l == g->step_r];
+}
+
+// Samples of a pitched voice once they've been resampled
+static int32_t resample_buf[MAX_BLOCK_FRAMES];
+
+// The input samples for one span of a pitched voice: its history, then
+// as many as it reads at RATE_MAX
+static int16_t pitch_buf[4 + RATE_MAX/RATE_1*MAX_BLOCK_FRAMES + 4];
+
+// Mix 'frames' of pitched voice i into l and r at the gains g, resampling
+// into resample_buf by stepping the read point through pitch_buf by the
+// voice's rate. Each output reads
+// the samples around the point, b[n-1] to b[n+2], so the buffer is filled
+// to where the point ends up plus two, and the last four are kept for the
+// next span.
+static void __not_in_flash_func(mix_pitched)(int i, int32_t *l, int32_t *r, int frames,
+                                             struct mix_gains *g) {
+   uint32_t rate  = voice_rate[i];
+   uint32_t q     = voice_phase[i];
+   uint32_t q_end = q + rate * frames;
+   int n_end      = q_end >> 16;
+   int16_t *b     = pitch_buf;
+
+   memcpy(b, voice_hist[i], sizeof(voice_hist[i]));
+   int got = voice_gather(i, b + 4, n_end - 1);
+   // Filtered before it's retuned, so the cutoff moves with the pitch.
+   // Like an unpitched voice, it stops at the end of the sound rather than
+   // ringing on for however far this span read past it.
+   if(voice_params[i].lowpass)
+      voice_filter(i, b + 4, b + 4, got);
+
+   for(int k = 0; k < frames; k++, q += rate) {
+      const int16_t *x = b + (q >> 16);
+#ifdef PITCH_INTERP_4POINT
+      // Catmull-Rom with the coefficients doubled to stay in integers,
+      // and an 11 bit fraction so nothing can overflow
+      int32_t f  = (q >> 5) & 0x7FF;
+      int32_t c1 = x[1] - x[-1];
+      int32_t c2 = 2*x[-1] - 5*x[0] + 4*x[1] - x[2];
+      int32_t c3 = (x[2] - x[-1]) + 3*(x[0] - x[1]);
+      int32_t y  = x[0] + ((((((c3 * f) >> 11) + c2) * f >> 11) + c1) * f >> 12);
+#else
+      int32_t f  = (q >> 1) & 0x7FFF;
+      int32_t y  = x[0] + (((x[1] - x[0]) * f) >> 15);
+#endif
+      resample_buf[k] = y;
+   }
+   pick_kernel(SRC_32, voice_shaped[i], g)(l, r, resample_buf, frames, g);
+
+   memcpy(voice_hist[i], b + n_end - 1, sizeof(voice_hist[i]));
+   voice_phase[i] = q_end - ((uint32_t)(n_end - 1) << 16);
+}
+
+// Mix the next 'frames' of voice i into l and r at the gains g, which a
+// shaped voice carries on from run to run
+static void __not_in_flash_func(mix_voice)(int i, int32_t *l, int32_t *r, int frames,
+                                           struct mix_gains *g) {
+   if(voice_rate[i] != RATE_1) {
+      mix_pitched(i, l, r, frames, g);
+      return;
+   }
+
+   // A looping voice plays to the loop end and round again until its
+   // envelope ends it
+   uint32_t len = sounds[voice_sound[i]].len;
+   uint32_t loop_end = voice_loop_end(i);
+   int left = frames;
+   if(!loop_end && left > (int)(len - voice_pos[i]))
+      left = len - voice_pos[i];
+
+   mix_kernel kernel = pick_kernel(SRC_16, voice_shaped[i], g);
+   while(left > 0) {
+      const int16_t *src;
+      int run = left;
+      if(loop_end && run > (int)(loop_end - voice_pos[i]))
+         run = loop_end - voice_pos[i];
+      run = voice_fetch(i, run, &src);
+      if(voice_params[i].lowpass) {
+         voice_filter(i, filter_buf, src, run);
+         src = filter_buf;
+      }
+      kernel(l, r, src, run, g);
+      l    += run;
+      r    += run;
+      left -= run;
+      voice_pos[i] += run;
+      if(voice_pos[i] == loop_end)
+         voice_seek(i, sounds[voice_sound[i]].loop_start);
+   }
+}
+
+// Mix all playing voices into mix_l/mix_r[output][first..first+frames-1],
+// each on the output its row is for.
+// The span never crosses a note event, so no voice can be started part
+// way through and each voice is a few straight runs up to its end. Shaped
+// voices are mixed a piece at a time between envelope frames.
+static void __not_in_flash_func(mix_span)(int first, int frames) {
+   uint32_t frame = framesRendered + first;
+   // Backwards, so a finished voice can be swapped with the last one
+   voiceFrames += n_active * frames;
+   for(int j = n_active-1; j >= 0; j--) {
+      int i = active[j];
+      uint32_t len = sounds[voice_sound[i]].len;
+      int32_t *l = mix_l[voice_params[i].output] + first;
+      int32_t *r = mix_r[voice_params[i].output] + first;
+      bool audible = true;
+
+      if(!voice_shaped[i]) {
+         struct mix_gains g = { (voice_gain_l[i] + SUM_ROUND) >> MIX_SUM_SHIFT,
+                                (voice_gain_r[i] + SUM_ROUND) >> MIX_SUM_SHIFT, 0, 0 };
+         mix_voice(i, l, r, frames, &g);
+      } else {
+         for(int done = 0; done < frames; ) {
+            if(voice_env_left[i] == 0)
+               voice_env_segment(i, frame + done);
+            int n = frames - done;
+            if(n > voice_env_left[i])
+               n = voice_env_left[i];
+            // Offset by half of what the kernels drop, so they round
+            struct mix_gains g = { voice_ramp_l[i] + (SUM_ROUND << 8),
+                                   voice_ramp_r[i] + (SUM_ROUND << 8),
+                                   voice_step_l[i], voice_step_r[i] };
+            mix_voice(i, l + done, r + done, n, &g);
+            voice_ramp_l[i] = g.l - (SUM_ROUND << 8);
+            voice_ramp_r[i] = g.r - (SUM_ROUND << 8);
+            voice_env_left[i] -= n;
+            done += n;
+            // Gone once it has ramped down to below the floor
+            if(voice_env_left[i] == 0 && voice_env[i] < ENV_FLOOR) {
+               audible = false;
+               break;
+            }
+         }
+      }
+
+      // Pitched voices are done once the read point, three samples back,
+      // is past the end
+      uint32_t end = voice_rate[i] != RATE_1 ? len + 3 : len;
+      if(voice_pos[i] >= end || !audible) {
+         n_active--;
+         active[j] = active[n_active];
+         active[n_active] = i;
+      }
+   }
+}
+
+// Copy the start of each sound into cache_arena, as far as it will go
+static void cache_heads(int sample_rate) {
+   uint32_t want = (uint32_t)sample_rate * SAMPLE_CACHE_MS / 1000;
+   uint32_t free = sizeof(cache_arena)/sizeof(cache_arena[0]);
+   int16_t *next = cache_arena;
+
+   for(unsigned i = 0; i < N_BUILTIN_SOUNDS; i++) {
+      const struct Sounds *s = &sounds[i];
+      uint32_t len = s->len < want ? s->len : want;
+      if(len > free)
+         len = free;
+
+      if(s->adpcm) {
+         struct adpcm_state st;
+         adpcm_seek(&st, s->adpcm, 0);
+         adpcm_decode(&st, s->adpcm, 0, next, len);
+      } else {
+         memcpy(next, s->samples, len * sizeof(int16_t));
+      }
+      heads[i].samples = next;
+      heads[i].len     = len;
+      next += len;
+      free -= len;
+   }
+}
+
+// The hits in the block being rendered, in frame order, with their
+// offsets from the start of it. Both queues full is as many as there can
+// be, unless the sequencer adds more during the block, and those wait
+// for the next one.
+#define MAX_BLOCK_EVENTS (2*EVENT_QUEUE_LEN)
+static struct block_event blockEvents[MAX_BLOCK_EVENTS];
+static int nBlockEvents = 0;
+static int blockFrames = 0;   // Rendered so far in this block
+
+// Pop the queued hits due before start + frames (or already late) into
+// out, at most max of them, with their offsets from start. Returns how
+// many there are.
+static int schedule_events(uint32_t start, int frames, struct block_event *out, int max) {
+   int n = 0;
+   struct event_queue *q;
+   while(n < max && (q = next_event()) != NULL) {
+      const struct note_event *e = event_peek(q);
+      int32_t at = (int32_t)(e->frame - start);
+      if(at >= frames)
+         break;
+      if(at < 0) {
+         trace("Row %d hit started %d frames late\n\r", e->row, -at);
+         at = 0;
+      }
+      out[n].offset = at;
+      out[n].song   = e->song;
+      out[n].row    = e->row;
+      out[n].emph   = e->emph;
+      n++;
+      event_pop(q);
+   }
+   return n;
+}
+
+int render_events(const struct block_event **events) {
+   *events = blockEvents;
+   return nBlockEvents;
+}
+
+// Render 'frames' (at most MAX_BLOCK_FRAMES) stereo frames into each
+// output's dst, splitting the block wherever a queued note event starts
+// a voice. All the outputs are mixed together in the one pass.
+static void render_chunk(uint32_t *const dst[I2S_OUTPUTS], int frames) {
+   for(int o = 0; o < I2S_OUTPUTS; o++) {
+      memset(mix_l[o], 0, frames * sizeof(mix_l[o][0]));
+      memset(mix_r[o], 0, frames * sizeof(mix_r[o][0]));
+   }
+#ifdef EXT_FLASH
+   if(n_sounds > (int)N_BUILTIN_SOUNDS) {
+      stream_retry();
+      ext_prime();
+   }
+#endif
+
+   // Take this chunk's hits off the queues first, then mix straight runs
+   // between them
+   uint32_t start = framesRendered;
+   int base = blockFrames;
+   struct block_event *list = &blockEvents[nBlockEvents];
+   int n = schedule_events(start, frames, list, MAX_BLOCK_EVENTS - nBlockEvents);
+
+   int done = 0;
+   for(int k = 0; k < n; k++) {
+      int at = list[k].offset;   // Under 'frames', from schedule_events()
+      if(at > done) {
+         mix_span(done, at - done);
+         done = at;
+      }
+      voice_start(list[k].song, list[k].row, list[k].emph);
+      list[k].offset += base;
+   }
+   if(done < frames)
+      mix_span(done, frames - done);
+   nBlockEvents += n;
+   blockFrames  += frames;
+   framesRendered = start + frames;
+#if BUS_DELAY_MS > 0
+   bus_delay(mix_l[0], mix_r[0], frames);
+#endif
+
+   for(int o = 0; o < I2S_OUTPUTS; o++) {
+#ifdef OUTPUT_TEST_TONE
+      if(o == 0)
+         render_test_tone(dst[0], frames);
+      else
+         memcpy(dst[o], dst[0], frames * I2S_WORDS_PER_FRAME * sizeof(uint32_t));
+#else
+      mix_bus(dst[o], mix_l[o], mix_r[o], frames);
+#endif
+   }
+}
+
+void render_block(uint32_t *const dst[I2S_OUTPUTS], int frames) {
+   uint32_t *out[I2S_OUTPUTS];
+   for(int o = 0; o < I2S_OUTPUTS; o++)
+      out[o] = dst[o];
+
+   nBlockEvents = 0;
+   blockFrames  = 0;
+   while(frames > 0) {
+      int n = frames < MAX_BLOCK_FRAMES ? frames : MAX_BLOCK_FRAMES;
+      render_chunk(out, n);
+      for(int o = 0; o < I2S_OUTPUTS; o++)
+         out[o] += n * I2S_WORDS_PER_FRAME;
+      frames -= n;
+   }
+   for(int fx = 0; fx < N_FX; fx++) {
+      fxCycles[fx] = fxBlock[fx];
+      fxBlock[fx]  = 0;
+   }
+   voicesActive = n_active;
+}
+
+#ifdef EXT_FLASH
+// Add the sounds in the sample library (see drum_engine.h), if there is
+// one in the external flash
+static void library_load(void) {
+   uint8_t header[LIBRARY_HEADER_BYTES];
+   if(!prefetch_read_ext(header, 0, sizeof(header)) ||
+      get16(header) != LIBRARY_MAGIC || header[2] != LIBRARY_VERSION)
+      return;
+
+   for(int k = 0; k < header[3] && n_sounds < MAX_SOUNDS; k++) {
+      uint8_t e[LIBRARY_ENTRY_BYTES];
+      if(!prefetch_read_ext(e, LIBRARY_HEADER_BYTES + k*LIBRARY_ENTRY_BYTES, sizeof(e)))
+         return;
+      struct Sounds *s = &sounds[n_sounds++];
+      s->samples    = NULL;
+      s->adpcm      = NULL;
+      s->ext_addr   = get32(e);
+      s->len        = get32(e + 4);
+      s->loop_start = get32(e + 8);
+      s->loop_end   = get32(e + 12);
+      s->peak       = get16(e + 16);
+      s->gain       = get16(e + 18);
+      if(s->loop_end > s->len || s->loop_start >= s->loop_end)
+         s->loop_start = s->loop_end = 0;
+   }
+}
+#endif
+
+void engine_init(int sample_rate) {
+   sampleRate     = sample_rate;
+   sequencer_set_tempo(BPM * 100);
+   seqLookahead   = sample_rate/20;
+#ifdef OUTPUT_TEST_TONE
+   tone_step      = (uint32_t)(((uint64_t)TEST_TONE_HZ << 32) / sample_rate);
+#endif
+   releaseStep    = ENV_ONE / ((uint32_t)sample_rate * RELEASE_MS / 1000);
+   for(unsigned i = 0; i < N_BUILTIN_SOUNDS; i++)
+      sounds[i] = builtin_sounds[i];
+   n_sounds = N_BUILTIN_SOUNDS;
+#ifdef EXT_FLASH
+   library_load();
+   for(int i = 0; i < MAX_SOUNDS; i++)
+      sound_slot[i] = -1;
+   for(int k = 0; k < EXT_SLOTS; k++)
+      ext_slots[k].sound = -1;
+#endif
+   cache_heads(sample_rate);
+#if BUS_DELAY_MS > 0
+   bus_delay_init(sample_rate);
+#endif
+   compile_patterns(&songs[0]);
+
+   for(int i = 0; i < N_VOICES; i++)
+      active[i] = i;
+}
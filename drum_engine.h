@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////
+// drum_engine.h : the sequencer and mixer for the drum machine
+//
+// The sequencer side (sequencer_poll()) and the mixer side
+// (render_block()) may run on different cores. They only share the
+// note event queue and framesRendered.
+///////////////////////////////////////////////////////////////////////
+#ifndef DRUM_ENGINE_H
+#define DRUM_ENGINE_H
+#include <stdint.h>
+#include <stdbool.h>
+
+// Longest run render_block() mixes in one go, larger blocks are split
+#define MAX_BLOCK_FRAMES 256
+
+// Bits in each I2S slot: 16 packs a stereo frame into one word, 32 gives
+// each channel its own word, left justified, carrying 24 bits of the mix
+#ifndef I2S_SLOT_BITS
+#define I2S_SLOT_BITS 16
+#endif
+#if I2S_SLOT_BITS == 16
+#define I2S_WORDS_PER_FRAME 1
+#elif I2S_SLOT_BITS == 32
+#define I2S_WORDS_PER_FRAME 2
+#else
+#error I2S_SLOT_BITS must be 16 or 32
+#endif
+
+// Separate stereo I2S outputs, each with its own PIO state machine and
+// DAC. Song rows say which one they play on.
+#ifndef I2S_OUTPUTS
+#define I2S_OUTPUTS 1
+#endif
+#if I2S_OUTPUTS < 1 || I2S_OUTPUTS > 4
+#error I2S_OUTPUTS must be 1 to 4
+#endif
+
+// Frames the mixer has rendered so far
+extern volatile uint32_t framesRendered;
+// Trace entries lost because the trace ring was full
+extern volatile uint32_t traceDropped;
+// Reads of a sound's tail that had to go to flash because the prefetch
+// hadn't landed
+extern volatile uint32_t streamMisses;
+// Voices still playing at the end of the last render_block()
+extern volatile int voicesActive;
+// Most voices playing at once, and hits that had to steal a voice
+extern volatile int voicesPeak;
+extern volatile uint32_t voicesStolen;
+// Output samples the master bus had to clip
+extern volatile uint32_t busClipped;
+// Frames mixed, summed over every playing voice, for the cost per voice
+extern volatile uint32_t voiceFrames;
+// Cycles each effect took in the last render_block(), by engine_cycles()
+enum { FX_FILTER, FX_DELAY, N_FX };
+extern volatile uint32_t fxCycles[N_FX];
+
+// Supplied by the platform: a count of CPU cycles on the core that
+// renders, of which only the low 24 bits need to be good
+uint32_t engine_cycles(void);
+
+// Set up the tempo and timing for the given output sample rate, and fill
+// the sample cache. Call after prefetch_init().
+void engine_init(int sample_rate);
+
+// Queue note events for the mixer up to the look-ahead time
+void sequencer_poll(void);
+
+// The rest of these are for the sequencer side only. Frames are on the
+// same timeline as framesRendered, and hits for frames the mixer has
+// already rendered start as soon as possible.
+
+// Change the tempo, in hundredths of a beat per minute, from the next tick
+// on
+void sequencer_set_tempo(uint32_t centibpm);
+
+// Frames that one time through the playing song's bars takes, at the
+// current tempo
+uint32_t sequencer_song_frames(void);
+
+// Transport: start from the top of the song, stop, or carry on from where
+// it stopped, at the given frame
+void sequencer_start(uint32_t frame);
+void sequencer_stop(void);
+void sequencer_continue(uint32_t frame);
+
+// A 24 ppqn external clock pulse at the given frame. The tempo follows the
+// clock and the tick phase is pulled in line with it.
+void sequencer_clock(uint32_t frame);
+
+// Play a hit on a pattern row at the given frame, outside of the pattern
+void live_hit(int row, int emph, uint32_t frame);
+
+// Song images, as made by tools/song_pack.py. All values are bytes, or
+// little endian 16 bit:
+//
+//    header   magic (16), version, rows, patterns, bars, tempo (16, in
+//             hundredths of a BPM, 0 to keep the current one)
+//    rows     pan (0 to 32), volume, sound (-1 for none), playback rate
+//             (32, Q16.16, up to 4.0), decay half life in ms (16, 0 for
+//             none), gate in ms (16, 0 for none), choke group (0 for
+//             none), low-pass cutoff in Hz (16, 0 for none), output,
+//             for each row
+//    bars     the pattern for each bar of the loop
+//    patterns steps (16), then for each step in tick order: tick,
+//             row << 4 | velocity (0 to 8)
+#define SONG_MAGIC        0x4D44   // "DM"
+#define SONG_VERSION      5
+#define SONG_HEADER_BYTES 8
+#define SONG_ROW_BYTES    15
+
+// The sample library, at address 0 of the external flash, as made by
+// tools/library_pack.py. Its sounds are numbered on from the built in ones.
+//
+//    header   magic (16), version, sounds
+//    sounds   address of the samples (32, bytes from the start of the
+//             library), length (32, in samples), loop start and end (32
+//             each, 0 for no loop), peak (16) and gain (16, Q12), for each
+//    samples  16 bit, little endian
+#define LIBRARY_MAGIC        0x4C44   // "DL"
+#define LIBRARY_VERSION      1
+#define LIBRARY_HEADER_BYTES 4
+#define LIBRARY_ENTRY_BYTES  20
+
+// Parse a song image (or the built in song, if data is NULL) and switch
+// to it from the top at the next bar line. Returns false if the image
+// isn't valid, or if a change is still under way.
+bool song_load(const uint8_t *data, uint32_t len);
+
+// Mix the next 'frames' stereo frames into dst[0] to dst[I2S_OUTPUTS-1],
+// I2S_WORDS_PER_FRAME words each. With 16 bit slots the left channel is
+// in the top 16 bits of each word, otherwise the words are left then
+// right.
+void render_block(uint32_t *const dst[I2S_OUTPUTS], int frames);
+
+// The hits render_block() started, each at 'offset' frames into the
+// block, for anything that has to follow along with the mix (MIDI out,
+// syncing other units)
+struct block_event {
+   uint32_t offset;
+   uint8_t  song;
+   uint8_t  row;
+   int16_t  emph;
+};
+
+// The hits of the last render_block(), in frame order. Returns how many
+// there are and points *events at them, until the next render_block().
+int render_events(const struct block_event **events);
+
+// Non-blocking diagnostics from the audio path, printed by trace_flush()
+void trace(const char *fmt, int32_t a, int32_t b);
+void trace_flush(void);
+
+#endif
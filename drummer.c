@@ -14,455 +14,623 @@
 #include <memory.h>
 #include "hardware/dma.h"
 #include "hardware/irq.h"
-#include "hardware/i2c.h"
+#include "hardware/clocks.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+#include "pico/multicore.h"
 #include "pio_i2s.pio.h"
-#include "math.h"
+#include "drum_engine.h"
+#include "prefetch.h"
+#include "midi_usb.h"
+#include "clock_plan.h"
+#include "dac.h"
+
+// Each bit takes two PIO cycles, and a frame is two slots of
+// I2S_SLOT_BITS (see drum_engine.h)
+#define PIO_CYCLES_PER_FRAME (2*2*I2S_SLOT_BITS)
+
+// The sample rate asked for, and the range of clk_sys allowed to get it.
+// clock_plan_find() picks clk_sys and the PIO divider, see clock_plan.c.
+// Nothing slower than the SDK's 125MHz, so the mixer keeps its budget.
+#ifndef AUDIO_SAMPLE_RATE
+#define AUDIO_SAMPLE_RATE 44100
+#endif
+#define SYS_CLK_MIN_HZ 125000000
+#define SYS_CLK_MAX_HZ 200000000
+
+// Define DYNAMIC_CLOCK to run clk_sys at half speed while only a few
+// voices are playing (CLOCK_SLOW_VOICES or fewer), to save power on
+// battery. The PIO divider halves with it, so the sample rate doesn't
+// move, and the plan is chosen with an even divider so it can. clk_peri
+// is taken straight from PLL_SYS so the UART and SPI keep their rates.
+// The I2C block runs from clk_sys itself, so the DAC monitor's SCL halves
+// too (200kHz), and the clock is never changed while it has the bus.
+// The two dividers are written back to back with interrupts off, so the
+// bit clock is only wrong for a few cycles at each change, and changes
+// are kept apart to spare the DAC's PLL: the clock only drops after
+// CLOCK_HOLD_MS of light load, and only goes back up once there are
+// CLOCK_FAST_VOICES voices or a block is taking most of its time.
+//#define DYNAMIC_CLOCK
+#ifdef DYNAMIC_CLOCK
+#define CLOCK_SCALE 2
+#else
+#define CLOCK_SCALE 1
+#endif
+#ifndef CLOCK_SLOW_VOICES
+#define CLOCK_SLOW_VOICES 4
+#endif
+#define CLOCK_FAST_VOICES (CLOCK_SLOW_VOICES + 3)
+#define CLOCK_HOLD_MS     250
+
+static struct clock_plan plan;
+// The rate the PIO really runs at, worked out from the clocks
+static int sample_rate;
+// clk_sys now, which clock_get_hz() doesn't follow once it's scaled
+static volatile uint32_t sys_hz;
+
+// Latency profiles. Each one sets the block size (BUFFER_SIZE frames) and
+// the depth of the ring (N_BUFFERS) together. Audio is queued up to
+// (N_BUFFERS-1)*BUFFER_SIZE frames ahead of the DAC, and in the IRQ
+// playback mode dma_handler() runs once per block.
+#define LATENCY_LOW        0   // 3 x 32 frames:  ~1.5ms queued, IRQ every 0.7ms
+#define LATENCY_DEFAULT    1   // 4 x 49 frames:  ~3.3ms queued, IRQ every 1.1ms
+#define LATENCY_THROUGHPUT 2   // 4 x 256 frames: ~17ms queued,  IRQ every 5.8ms
+
+#ifndef LATENCY_PROFILE
+#define LATENCY_PROFILE LATENCY_DEFAULT
+#endif
 
-#define PIO_I2S_CLKDIV 44.25F
+#if LATENCY_PROFILE == LATENCY_LOW
+#define LATENCY_NAME "low-latency"
+#define N_BUFFERS 3
+#define BUFFER_SIZE 32
+#elif LATENCY_PROFILE == LATENCY_DEFAULT
+#define LATENCY_NAME "default"
 #define N_BUFFERS 4
 #define BUFFER_SIZE 49
+#elif LATENCY_PROFILE == LATENCY_THROUGHPUT
+#define LATENCY_NAME "large-block"
+#define N_BUFFERS 4
+#define BUFFER_SIZE 256
+#else
+#error Unknown LATENCY_PROFILE
+#endif
 
-static int dma_chan;
-static uint32_t buffer[N_BUFFERS][BUFFER_SIZE];
-static volatile int buffer_playing = 0;
+// Define DMA_CHAINED to feed the PIO from a pair of chained DMA channels
+// rather than re-arming the channel from dma_handler() after each buffer.
+// The buffers are then played as one ring with no CPU involvement at all.
+//#define DMA_CHAINED
+
+// Each I2S output (I2S_OUTPUTS, see drum_engine.h) is its own state
+// machine on pio0, SM n for output n, with its data on the pin here and
+// BCK and LRCK on the two after it. They all run off the one divider and
+// are started together, so they stay in step, and each has its own DMA
+// channel and ring of buffers.
+static const uint i2s_pins[4] = { 26, 20, 6, 2 };
+
+static int dma_chan[I2S_OUTPUTS];
+// All the buffers come from this one arena, so each output's ring is
+// contiguous for the chained mode and every block starts on a word
+// boundary for the DMA.
+// Words in each buffer, one or two per frame depending on the slot width
+#define BUFFER_WORDS (BUFFER_SIZE*I2S_WORDS_PER_FRAME)
+
+static uint32_t buffer[I2S_OUTPUTS][N_BUFFERS][BUFFER_WORDS] __attribute__((aligned(4)));
 static int buffer_to_fill = 0;
 
+// Counters kept by core 0 (including dma_handler()) and reported by core 1
+#define PIO_FIFO_DEPTH 8   // Joined TX FIFO, in words
+static volatile struct {
+    uint32_t underruns;      // Buffers that started playing without being refilled
+    uint32_t blocks;         // Blocks rendered
+    uint32_t fill_us_max;    // Worst time taken to render a block
+    uint32_t fill_us_total;  // Total time spent rendering blocks
+    int      slack_min;      // Fewest buffers queued ahead of the DMA when a fill started
+    int      fifo_min;       // Fewest frames left in the PIO FIFO when dma_handler() re-armed
+    uint64_t fx_total[N_FX]; // Cycles each effect took over all the blocks
+    uint32_t fx_max[N_FX];   // and in the worst block
+    uint64_t since_us;       // When the counters were last cleared
+    uint64_t idle_us;        // Time core 0 has spent asleep since then
+    uint32_t slow_blocks;    // Blocks rendered with clk_sys scaled down
+    bool     reset;          // Set by core 1 to have core 0 clear the counters
+} stats = { .slack_min = N_BUFFERS, .fifo_min = PIO_FIFO_DEPTH };
+
+#ifdef DMA_CHAINED
+static int ctrl_chan[I2S_OUTPUTS];
+// Each control channel copies one of these into its data channel's read
+// address
+static uint32_t *ring_start[I2S_OUTPUTS];
+
+// Work out which buffer the DMA is reading from its remaining transfer
+// count. The outputs all play in step, so the first speaks for them all.
+static inline int buffer_playing(void) {
+    uint32_t played = N_BUFFERS*BUFFER_WORDS - dma_hw->ch[dma_chan[0]].transfer_count;
+    int b = played / BUFFER_WORDS;
+    // Briefly reads as the end of the ring while the control channel reloads
+    return b < N_BUFFERS ? b : N_BUFFERS-1;
+}
+#else
+// The buffer each output's DMA is currently reading from. They move on
+// together, give or take an interrupt, so the first speaks for them all.
+static volatile int playing[I2S_OUTPUTS];
+
+static inline int buffer_playing(void) {
+    return playing[0];
+}
+
 static void dma_handler() {
-    // Clear the interrupt request.
-    dma_hw->ints0 = 1u << dma_chan;
-    // Give the channel a new wave table entry to read from, and re-trigger it
-    dma_channel_set_read_addr(dma_chan, buffer[buffer_playing], true);
-    if(buffer_playing == N_BUFFERS-1) 
-       buffer_playing = 0;
-    else
-       buffer_playing++;
+    for(int o = 0; o < I2S_OUTPUTS; o++) {
+       if(!(dma_hw->ints0 & (1u << dma_chan[o])))
+          continue;
+       // Clear the interrupt request.
+       dma_hw->ints0 = 1u << dma_chan[o];
+       int p = playing[o] == N_BUFFERS-1 ? 0 : playing[o] + 1;
+       playing[o] = p;
+       // Whatever the PIO has drained from its FIFO since the channel finished
+       // is how long it took us to get here
+       int fifo = pio_sm_get_tx_fifo_level(pio0, o);
+       // Give the channel the next buffer to read from, and re-trigger it
+       dma_channel_set_read_addr(dma_chan[o], buffer[o][p], true);
+       if(fifo < stats.fifo_min)
+          stats.fifo_min = fifo;
+    }
+    // Wake the fill loop, and make sure it doesn't go to sleep if it
+    // was just about to
+    __sev();
 }
+#endif
 
 
 int setup_dma(void) {
      
     //////////////////////////////////////////////////////
-    // Set up a PIO state machine to serialise our bits
+    // Set up a PIO state machine for each output to serialise our bits.
+    // They all run the same program, and are left stopped for start_dma().
+#if I2S_SLOT_BITS == 16
     uint offset = pio_add_program(pio0, &pio_i2s_program);
-    pio_i2s_program_init(pio0, 0, offset, 26, PIO_I2S_CLKDIV);
+#else
+    uint offset = pio_add_program(pio0, &pio_i2s_wide_program);
+#endif
+    for(int o = 0; o < I2S_OUTPUTS; o++) {
+#if I2S_SLOT_BITS == 16
+       pio_i2s_program_init(pio0, o, offset, i2s_pins[o], plan.pio_div);
+#else
+       pio_i2s_wide_program_init(pio0, o, offset, i2s_pins[o], plan.pio_div, I2S_SLOT_BITS);
+#endif
+    }
 
-    //////////////////////////////////////////////////////
-    // Configure a channel to write the buffers to PIO0 SM0's TX FIFO, 
-    // paced by the data request signal from that peripheral.
-    dma_chan = dma_claim_unused_channel(true);
-    dma_channel_config c = dma_channel_get_default_config(dma_chan);
-    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
-    channel_config_set_read_increment(&c, 1); 
-    channel_config_set_dreq(&c, DREQ_PIO0_TX0);
-
-    dma_channel_configure(
-        dma_chan,
-        &c,
-        &pio0_hw->txf[0], // Write address (only need to set this once)
-        NULL,
-        BUFFER_SIZE,        
-        false             // Don't start yet
-    );
-
-    // Tell the DMA to raise IRQ line 0 when the channel finishes a block
-    dma_channel_set_irq0_enabled(dma_chan, true);
+    for(int o = 0; o < I2S_OUTPUTS; o++) {
+       //////////////////////////////////////////////////////
+       // Configure a channel to write the buffers to the state machine's
+       // TX FIFO, paced by the data request signal from that peripheral.
+       dma_chan[o] = dma_claim_unused_channel(true);
+       dma_channel_config c = dma_channel_get_default_config(dma_chan[o]);
+       channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+       channel_config_set_read_increment(&c, 1); 
+       channel_config_set_dreq(&c, DREQ_PIO0_TX0 + o);
+
+#ifdef DMA_CHAINED
+       //////////////////////////////////////////////////////
+       // The data channel plays the whole ring and then chains to a control
+       // channel, which writes the start of the ring back into the data
+       // channel's read address trigger register to start it all again.
+       ring_start[o] = &buffer[o][0][0];
+       ctrl_chan[o] = dma_claim_unused_channel(true);
+       channel_config_set_chain_to(&c, ctrl_chan[o]);
+
+       dma_channel_configure(
+           dma_chan[o],
+           &c,
+           &pio0_hw->txf[o], // Write address (only need to set this once)
+           ring_start[o],
+           N_BUFFERS*BUFFER_WORDS, // Reloaded each time the channel is triggered
+           false             // Don't start yet
+       );
+
+       dma_channel_config cc = dma_channel_get_default_config(ctrl_chan[o]);
+       channel_config_set_transfer_data_size(&cc, DMA_SIZE_32);
+       channel_config_set_read_increment(&cc, false);
+       channel_config_set_write_increment(&cc, false);
+
+       dma_channel_configure(
+           ctrl_chan[o],
+           &cc,
+           &dma_hw->ch[dma_chan[o]].al3_read_addr_trig,
+           &ring_start[o],
+           1,
+           false
+       );
+#else
+       dma_channel_configure(
+           dma_chan[o],
+           &c,
+           &pio0_hw->txf[o], // Write address (only need to set this once)
+           buffer[o][0],
+           BUFFER_WORDS,
+           false             // Don't start yet
+       );
+
+       // Tell the DMA to raise IRQ line 0 when the channel finishes a block
+       dma_channel_set_irq0_enabled(dma_chan[o], true);
+#endif
+    }
 
+#ifndef DMA_CHAINED
     // Configure the processor to run dma_handler() when DMA IRQ 0 is asserted
     irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
     irq_set_enabled(DMA_IRQ_0, true);
+#endif
 
 }
 
+// Start playing from the first buffer. Every channel fills its state
+// machine's FIFO first, then the state machines start on the same cycle
+// so the outputs' LRCKs line up.
+static void start_dma(void) {
+    uint32_t chans = 0, sms = 0;
+    for(int o = 0; o < I2S_OUTPUTS; o++) {
+       chans |= 1u << dma_chan[o];
+       sms   |= 1u << o;
+    }
+    dma_start_channel_mask(chans);
+    for(int o = 0; o < I2S_OUTPUTS; o++)
+       while(!pio_sm_is_tx_fifo_full(pio0, o))
+          tight_loop_contents();
+    pio_enable_sm_mask_in_sync(pio0, sms);
+}
 
 ///////////////////////////////////////////////////////////////////////////////////
-// Everything from here down is non-h/w specific
+// Keeping the buffers filled from the drum engine (drum_engine.c)
 ///////////////////////////////////////////////////////////////////////////////////
-// Drum samples
-#include "samples/drum_clap.h"
-#include "samples/drum_hihat.h"
-#include "samples/drum_kick.h"
-#include "samples/drum_perc.h"
-#include "samples/drum_snare.h"
-
-#define N_VOICES 6
-
-#define BPM            155
-#define SAMPLE_RATE    ((int)(125000000/PIO_I2S_CLKDIV/32/2))
-#define BEATS_PER_BAR  4
-#define BAR_LEN        72
-#define LOOP_BARS      10
-
-// Counters for where we are in time
-static int bar = 0;
-static int tickOfBar = 0;
-static int sampleOfTick = 0;
-static int samplesPerBeat;
-static int samplesPerTick;
-
-
-const struct Sounds {
-    const int16_t *samples;
-    const size_t  len;
-} sounds[] = {
-   {drum_kick,  sizeof(drum_kick)/sizeof(int16_t)},
-   {drum_clap,  sizeof(drum_clap)/sizeof(int16_t)},
-   {drum_snare, sizeof(drum_snare)/sizeof(int16_t)},
-   {drum_hihat, sizeof(drum_hihat)/sizeof(int16_t)},
-   {drum_perc,  sizeof(drum_perc)/sizeof(int16_t)}
-};
-
-// Parameters for volume and pan
-static struct voice {
-    int pan;
-    int volume;
-    int sample;
-    int pos;
-    int emph;
-} voices[N_VOICES] = {
-   { 16,  192, 0, 0, 0},
-   {  8,    0, 1, 0, 0},
-   { 16,   40, 2, 0, 0},
-   { 18,   80, 3, 0, 0},
-   { 28,   30, 4, 0, 0},
-   {  4,   30, 0, 0, 0}
-};
-
-
-struct Pattern {
-   char pattern[N_VOICES][BAR_LEN];
-};
-
-
-const static struct Pattern pattern0 = {{
-//"012345678901234567890123456789012345678901234567890123456789012345678901"
-  "1        1                     1    1        1                          ",
-  "                                                                        ",
-  "                  1                                   1                 ",
-  "                                                                        ",
-  "1        1        1        1        1        1        1        1        ",
-  "                                                                        "
-}};
-
-const static struct Pattern pattern1 = {{
-//"012345678901234567890123456789012345678901234567890123456789012345678901"
-  "9                                   1                                   ",
-  "                                                                        ",
-  "4        1        1        1        3        1        1        1        ",
-  "                                                                        ",
-  "                                                                        ",
-  "                                                                        "
-}};
-
-const static struct Pattern pattern2 = {{
-//"012345678901234567890123456789012345678901234567890123456789012345678901"
-  "9                                   1                                   ",
-  "         1                 1                 1                 1        ",
-  "1                 1                 1                 1                 ",
-  "5        1        1        1        1        1                 1        ",
-  "5                          1                 1                          ",
-  "         1                          4                          1        "
-}};
-
-
-static const struct Pattern *patterns[LOOP_BARS] = {
-   &pattern0,
-   &pattern1,
-   &pattern2
-};
-
-
-static const int bars[LOOP_BARS] = { 0,0,0,2,2,2,2,2,1,0};
-
-static int index1 = 0;
-typedef union 
-{
-   /* data */
-   uint32_t d1;
-   int16_t d2[2];
-} smpl_data;
-
-static smpl_data s1[] = { 
-   {.d2[0] = 0, .d2[1] = 0},
-   {.d2[0] = 6000, .d2[1] = 1000},
-   {.d2[0] = 12000, .d2[1] = 2000},
-   {.d2[0] = 18000, .d2[1] = 3000},   
-   {.d2[0] = 24000, .d2[1] = 4000},   
-   {.d2[0] = 30000, .d2[1] = 5000},   
-   {.d2[0] = 24000, .d2[1] = 4000},   
-   {.d2[0] = 18000, .d2[1] = 3000},   
-   {.d2[0] = 12000, .d2[1] = 2000},   
-   {.d2[0] = 6000, .d2[1] = 1000},   
-   {.d2[0] = 0000, .d2[1] = 0000},   
-   {.d2[0] = -6000, .d2[1] = -1000},
-   {.d2[0] = -12000, .d2[1] = -2000},
-   {.d2[0] = -18000, .d2[1] = -3000},   
-   {.d2[0] = -24000, .d2[1] = -4000},   
-   {.d2[0] = -30000, .d2[1] = -5000},   
-   {.d2[0] = -24000, .d2[1] = -4000},   
-   {.d2[0] = -18000, .d2[1] = -3000},   
-   {.d2[0] = -12000, .d2[1] = -2000},   
-   {.d2[0] = -6000, .d2[1] = -1000}   
-};
-
-static uint32_t generate_sample(void) {
-   int32_t samples[N_VOICES];
-   int32_t output[2];
-
-   // Start of new tick?
-   if(sampleOfTick == 0) {
-      for(int i = 0; i < N_VOICES; i++) {
-         if(patterns[bars[bar]]->pattern[i][tickOfBar] != ' ') {
-            voices[i].pos  = 1;
-            voices[i].emph = (patterns[bars[bar]]->pattern[i][tickOfBar]-'1') * 12;
-         }
-      }
-   }
-
-   for(int i = 0; i < N_VOICES; i++) {
-      samples[i] = 0;
-      if(voices[i].sample >= 0) {
-         samples[i] = sounds[voices[i].sample].samples[voices[i].pos ];
-         if(voices[i].pos != 0) {
-            voices[i].pos++;
-            if(voices[i].pos  >= sounds[voices[i].sample].len) {
-               voices[i].pos  = 0;
-            }
-         }
-      }
-   }
+// Set when a buffer is filled and cleared once the DMA starts playing it,
+// so a buffer that starts playing while still clear is an underrun
+static bool buffer_fresh[N_BUFFERS];
+// Blocks the DMA has been seen to finish, so the one it's playing is
+// buffer blocks_played % N_BUFFERS (or further on, until the next fill)
+static volatile uint32_t blocks_played = 0;
+
+// Render the next block into buffer b of every output
+static void render_buffer(int b) {
+    uint32_t *dst[I2S_OUTPUTS];
+    for(int o = 0; o < I2S_OUTPUTS; o++)
+       dst[o] = buffer[o][b];
+    render_block(dst, BUFFER_SIZE);
+}
 
-   output[0] = 0;
-   output[1] = 0;
-   for(int i = 0; i < N_VOICES; i++) {
-      int vol = voices[i].emph + voices[i].volume;
-      output[0] += vol * samples[i]*(voices[i].pan);
-      output[1] += vol * samples[i]*(32-voices[i].pan);
-   }
+// SysTick counts down, so this counts up (in the low 24 bits). Only
+// called on core 0, whose SysTick main() starts.
+uint32_t engine_cycles(void) {
+    return -systick_hw->cvr;
+}
 
-   sampleOfTick++;
-   if(sampleOfTick == samplesPerTick) {
-      sampleOfTick = 0;
-      tickOfBar++;
-      if(tickOfBar == BAR_LEN) {
-         tickOfBar = 0;
-         bar++;
-         if(bar == LOOP_BARS)
-            bar = 0;
-      }
-   }
+#ifdef DYNAMIC_CLOCK
+static bool clock_slow = false;
+
+static uint32_t clock_light = 0;   // Blocks in a row light enough to slow down for
+
+// Divide clk_sys, and the PIO with it, by CLOCK_SCALE or not at all.
+// Returns false, leaving it for the next block, if the DAC monitor has
+// the I2C bus.
+static bool set_clock_slow(bool slow) {
+    if(!dac_bus_try_claim())
+       return false;
+    int div = slow ? CLOCK_SCALE : 1;
+    uint32_t irq = save_and_disable_interrupts();
+    clocks_hw->clk[clk_sys].div = div << CLOCKS_CLK_SYS_DIV_INT_LSB;
+    for(int o = 0; o < I2S_OUTPUTS; o++)
+       pio_sm_set_clkdiv_int_frac(pio0, o, plan.pio_div / div, 0);
+    // Line the dividers up again, so the outputs' LRCKs stay in step
+    pio_clkdiv_restart_sm_mask(pio0, (1u << I2S_OUTPUTS) - 1);
+    restore_interrupts(irq);
+    dac_bus_release();
+    sys_hz = plan.sys_hz / div;
+    clock_slow = slow;
+    return true;
+}
 
-   // Convert samples back to 16 bit
-
-   //return (((output[0] >> 15)&0xFFFF) << 16) + ((output[1] >> 15) & 0xFFFF);
-   if (index1 >= 400)
-      index1 = 0;
-   smpl_data smpl;
-
-   int16_t ret;
-   double arg = (index1++ * 2.0 * 3.142)/400.0;
-   ret = (15000.0 * sin(arg)) + 15000.0;
-   smpl.d2[0] = ret;
-   smpl.d2[1] = ret;
-   printf("%d %d %d %d\n\r", index1, smpl.d1, smpl.d2[0], smpl.d2[1]);
-   return smpl.d1;
-   // if (index1 > 30)
-   // {
-   //       return 0xffffffff;
-   // }
-   // else
-   //    return 0x7fff7fff;
-   // return s1[index1++].d1;
-   //return (((ret)&0xFFFF) << 16) + ((ret) & 0xFFFF);
-   //return s1[index1++];
-   //return 0x2020;
+// Slow down once the mixer has had little to do for CLOCK_HOLD_MS, going
+// by the voices playing and what the block would take at the lower
+// clock. Speed back up when the voices pass CLOCK_FAST_VOICES or a slowed
+// block takes over three quarters of its time.
+static void clock_follow_load(uint32_t fill_us) {
+    uint32_t block_us = BUFFER_SIZE*1000000LL/sample_rate;
+    if(clock_slow) {
+       if(voicesActive >= CLOCK_FAST_VOICES || fill_us > block_us*3/4)
+          set_clock_slow(false);
+       return;
+    }
+    if(voicesActive <= CLOCK_SLOW_VOICES && fill_us * CLOCK_SCALE < block_us/2)
+       clock_light++;
+    else
+       clock_light = 0;
+    if(clock_light * block_us >= CLOCK_HOLD_MS * 1000 && set_clock_slow(true))
+       clock_light = 0;
 }
+#endif
 
+// Refill buffers up to, but never including, the one being played.
+// Returns false if there was nothing to fill.
+static bool drum_fill_buffer(void) {
+    int playing = buffer_playing();
+
+    if(stats.reset) {
+       stats.underruns     = 0;
+       stats.blocks        = 0;
+       stats.fill_us_max   = 0;
+       stats.fill_us_total = 0;
+       stats.slack_min     = N_BUFFERS;
+       stats.fifo_min      = PIO_FIFO_DEPTH;
+       for(int fx = 0; fx < N_FX; fx++) {
+          stats.fx_total[fx] = 0;
+          stats.fx_max[fx]   = 0;
+       }
+       stats.since_us      = time_us_64();
+       stats.idle_us       = 0;
+       stats.slow_blocks   = 0;
+       stats.reset         = false;
+    }
 
-static void drum_fill_buffer(void) {
-    if(buffer_playing == buffer_to_fill)
-       return;
+    // Check every buffer the DMA has moved on to since the last call
+    while(blocks_played % N_BUFFERS != playing) {
+       int b = (blocks_played+1) % N_BUFFERS;
+       if(!buffer_fresh[b])
+          stats.underruns++;
+       buffer_fresh[b] = false;
+       blocks_played++;
+    }
 
-    for(int i = 0; i < BUFFER_SIZE; i++) {
-       buffer[buffer_to_fill][i] = generate_sample();
+    if(playing == buffer_to_fill)
+       return false;
+
+    // Buffers still queued for the DMA after the one it is playing
+    int slack = (buffer_to_fill - playing - 1 + N_BUFFERS) % N_BUFFERS;
+    if(slack < stats.slack_min)
+       stats.slack_min = slack;
+
+    uint32_t t = time_us_32();
+    render_buffer(buffer_to_fill);
+    t = time_us_32() - t;
+    stats.blocks++;
+    stats.fill_us_total += t;
+    if(t > stats.fill_us_max)
+       stats.fill_us_max = t;
+    for(int fx = 0; fx < N_FX; fx++) {
+       stats.fx_total[fx] += fxCycles[fx];
+       if(fxCycles[fx] > stats.fx_max[fx])
+          stats.fx_max[fx] = fxCycles[fx];
     }
+#ifdef DYNAMIC_CLOCK
+    if(clock_slow)
+       stats.slow_blocks++;
+    clock_follow_load(t);
+#endif
+
+    buffer_fresh[buffer_to_fill] = true;
     buffer_to_fill = (buffer_to_fill+1)%N_BUFFERS;
+    return true;
 }
 
-void WriteRegister (int reg, int value)
-{
-   unsigned char cmd[2];
-
-   cmd[0] = reg; // Register 40
-   cmd[1] = value; // Ignore SYS CLK Halt
-   i2c_write_blocking(i2c1, 0x4D, cmd, 2, false);
+// Sleep until the DMA is done with the buffer it is playing. In IRQ mode
+// dma_handler() wakes us with __sev(), which also covers the interrupt
+// landing between drum_fill_buffer() finding nothing to do and the __wfe().
+// The chained ring has no interrupt per buffer, so there a timer wakes us
+// when the buffer should have finished.
+static void drum_idle(void) {
+    uint64_t t = time_us_64();
+#ifdef DMA_CHAINED
+    uint32_t left = (dma_hw->ch[dma_chan[0]].transfer_count + BUFFER_WORDS-1) % BUFFER_WORDS + 1;
+    uint32_t us = (uint64_t)left * 1000000 / I2S_WORDS_PER_FRAME / sample_rate;
+    best_effort_wfe_or_timeout(make_timeout_time_us(us + 1));
+#else
+    __wfe();
+#endif
+    stats.idle_us += time_us_64() - t;
+}
 
+// The frame being played right now, on the same timeline as
+// framesRendered. Block n of the render goes into buffer n % N_BUFFERS,
+// so this is the block being played plus how far the DMA is through it.
+static uint32_t audio_frame_now(void) {
+    uint32_t blocks, count;
+    int playing;
+    // The count has to be for the buffer read as playing, so try again if
+    // dma_handler() moved the DMA on while they were being read
+    do {
+       blocks  = blocks_played;
+       count   = dma_hw->ch[dma_chan[0]].transfer_count;
+       playing = buffer_playing();
+    } while(dma_hw->ch[dma_chan[0]].transfer_count > count ||
+            blocks_played != blocks || buffer_playing() != playing);
+#ifdef DMA_CHAINED
+    int offset = (N_BUFFERS*BUFFER_WORDS - count) % BUFFER_WORDS;
+#else
+    int offset = BUFFER_WORDS - count;
+#endif
+    offset /= I2S_WORDS_PER_FRAME;
+    // Catch up on any blocks the fill loop hasn't noticed yet
+    blocks += (playing - (int)(blocks % N_BUFFERS) + N_BUFFERS) % N_BUFFERS;
+    return blocks * BUFFER_SIZE + offset;
 }
 
-unsigned char ReadRegister (unsigned char reg)
-{
-   unsigned char val;
-   i2c_write_blocking(i2c1, 0x4D, &reg, 1, true); // true to keep master control of bus
-   if (i2c_read_blocking(i2c1, 0x4D, &val, 1, false) != 1)
-   {
-      printf("Couldn't read register %d \n\r", val);
+///////////////////////////////////////////////////////////////////////
+// Core 1 runs the sequencer and anything else that is not audio, so
+// core 0 only has to render buffers and service dma_handler()
+///////////////////////////////////////////////////////////////////////
+#define REPORT_INTERVAL_US 10000000
+
+static const char *const fx_names[N_FX] = { "filters", "bus delay" };
+
+static void report_stats(void) {
+   int block_us = (int)(BUFFER_SIZE*1000000LL/sample_rate);
+   uint32_t blocks = stats.blocks;
+
+   printf("%s profile (%d x %d frames, %d us queued)\n\r",
+          LATENCY_NAME, N_BUFFERS, BUFFER_SIZE, (N_BUFFERS-1)*block_us);
+   printf("  %u blocks, %u underruns, %u traces dropped\n\r",
+          (unsigned)blocks, (unsigned)stats.underruns, (unsigned)traceDropped);
+   printf("  fill time max %u us, average %u us of %d us per block\n\r",
+          (unsigned)stats.fill_us_max,
+          (unsigned)(blocks ? stats.fill_us_total / blocks : 0), block_us);
+   // How much of the time core 0 is awake, rendering or in dma_handler()
+   uint64_t elapsed = time_us_64() - stats.since_us;
+   unsigned busy = elapsed ? (unsigned)(1000 - stats.idle_us * 1000 / elapsed) : 0;
+   printf("  core 0 busy %u.%u%% of the time\n\r", busy / 10, busy % 10);
+#ifdef DYNAMIC_CLOCK
+   printf("  clk_sys %u Hz now, %u blocks at the lower clock\n\r",
+          (unsigned)sys_hz, (unsigned)stats.slow_blocks);
+#endif
+   // What the effects cost, against all the cycles there are for a block
+   uint32_t block_cycles = (uint32_t)((uint64_t)sys_hz * BUFFER_SIZE / sample_rate);
+   for(int fx = 0; fx < N_FX; fx++) {
+      if(stats.fx_max[fx] == 0)
+         continue;
+      printf("  %s average %u, max %u of %u cycles per block\n\r", fx_names[fx],
+             (unsigned)(blocks ? stats.fx_total[fx] / blocks : 0),
+             (unsigned)stats.fx_max[fx], (unsigned)block_cycles);
    }
-   printf ("Register %d is %x\n\r", reg, val);
-   return val;
+   printf("  min slack %d buffers, %u sample stream misses\n\r",
+          stats.slack_min, (unsigned)streamMisses);
+   printf("  peak %d voices playing, %u voices stolen, %u samples clipped\n\r",
+          voicesPeak, (unsigned)voicesStolen, (unsigned)busClipped);
+#ifdef DAC_MONITOR
+   printf("  %u DAC status alerts\n\r", (unsigned)dacAlerts);
+#endif
+#ifndef DMA_CHAINED
+   printf("  min PIO FIFO at re-arm %d frames (worst IRQ latency ~%d us)\n\r",
+          stats.fifo_min / I2S_WORDS_PER_FRAME,
+          (int)((PIO_FIFO_DEPTH - stats.fifo_min)*1000000LL/sample_rate/I2S_WORDS_PER_FRAME));
+#endif
+}
 
+///////////////////////////////////////////////////////////////////////
+// Song banks, kept at the top of flash where the program doesn't reach.
+// Each is a song image from tools/song_pack.py, read straight through
+// XIP, and song_load() checks it before it is used.
+///////////////////////////////////////////////////////////////////////
+#define SONG_BANKS      8     // song_banks.ld keeps the firmware out of these
+#define SONG_BANK_BYTES 4096
+#define SONG_BANK_BASE  (XIP_BASE + PICO_FLASH_SIZE_BYTES - SONG_BANKS*SONG_BANK_BYTES)
+
+// Bank 0 is the built in song, 1 to SONG_BANKS are in flash
+static void select_song(int bank) {
+   const uint8_t *image = NULL;
+   if(bank > 0)
+      image = (const uint8_t *)(SONG_BANK_BASE + (bank-1)*SONG_BANK_BYTES);
+
+   if(song_load(image, SONG_BANK_BYTES))
+      printf("Song %d starts at the next bar\n\r", bank);
+   else
+      printf("Song %d not loaded (no song there, or still changing)\n\r", bank);
 }
 
-void CheckRegister(unsigned char reg, unsigned char check)
-{
-   unsigned char val;
-   i2c_write_blocking(i2c1, 0x4D, &reg, 1, true); // true to keep master control of bus
-   if (i2c_read_blocking(i2c1, 0x4D, &val, 1, false) != 1)
-   {
-      printf("Couldn't read register %d \n\r", val);
-   }
-   if (val != check)
-   {
-      printf ("Register %d is %x\n\r", reg, val);
-   }
+// Serial commands: 's' prints the stats now, 'r' resets them, '0' to '8'
+// change song
+static void poll_commands(void) {
+   int c = getchar_timeout_us(0);
+   if(c == 's')
+      report_stats();
+   else if(c == 'r')
+      stats.reset = true;
+   else if(c >= '0' && c <= '0' + SONG_BANKS)
+      select_song(c - '0');
 }
 
-void SelectPage (unsigned char page)
-{
-   WriteRegister(0, page);
+static void core1_main(void) {
+   uint32_t last_report = time_us_32();
+
+   // USB (and its interrupt) lives on this core, away from the audio
+   midi_init();
+
+   while (true) {
+      // Live MIDI is timed a whole ring ahead of what is being played, which
+      // is always past anything the mixer has already rendered
+      midi_task(audio_frame_now() + N_BUFFERS*BUFFER_SIZE);
+      sequencer_poll();
+      trace_flush();
+      poll_commands();
+#ifdef DAC_MONITOR
+      dac_monitor_poll();
+#endif
+
+      if(time_us_32() - last_report >= REPORT_INTERVAL_US) {
+         last_report += REPORT_INTERVAL_US;
+         report_stats();
+      }
+   }
 }
 
 #define I2CCONTROL
 int main(void) {
+   // Retune clk_sys for the sample rate before anything is clocked from it.
+   // With DYNAMIC_CLOCK the PIO divider has to divide by CLOCK_SCALE too.
+   bool planned = clock_plan_find(AUDIO_SAMPLE_RATE, PIO_CYCLES_PER_FRAME*CLOCK_SCALE,
+                                  SYS_CLK_MIN_HZ, SYS_CLK_MAX_HZ, &plan);
+   if(planned) {
+      clock_plan_apply(&plan);
+      plan.pio_div *= CLOCK_SCALE;
+   } else {
+      plan.sys_hz  = clock_get_hz(clk_sys);
+      plan.pio_div = (plan.sys_hz + AUDIO_SAMPLE_RATE*PIO_CYCLES_PER_FRAME*CLOCK_SCALE/2)
+                   / (AUDIO_SAMPLE_RATE*PIO_CYCLES_PER_FRAME*CLOCK_SCALE) * CLOCK_SCALE;
+   }
+   sys_hz = plan.sys_hz;
+   sample_rate = clock_plan_sample_rate(plan.pio_div, PIO_CYCLES_PER_FRAME);
+#ifdef DYNAMIC_CLOCK
+   // Keep the peripherals' clock steady while clk_sys moves
+   clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS,
+                   plan.sys_hz, plan.sys_hz);
+#endif
+
    stdio_init_all();
+   printf("clk_sys %u Hz, PIO divider %u, %d Hz (%u ppm from %d Hz)\n\r",
+          (unsigned)clock_get_hz(clk_sys), (unsigned)plan.pio_div, sample_rate,
+          (unsigned)plan.error_ppm, AUDIO_SAMPLE_RATE);
 
-    i2c_init(i2c1, 100 * 1000);
-    gpio_set_function(10, GPIO_FUNC_I2C);
-    gpio_set_function(11, GPIO_FUNC_I2C);
-    gpio_pull_up(10);
-    gpio_pull_up(11);    
 #ifdef I2CCONTROL
-   SelectPage(0);
-
-// Extracted from the reference register sequences from TI at
-//   https://e2e.ti.com/support/audio-group/audio/f/audio-forum/428281/pcm5242-slac622-code-example-for-using-non-audio-clock-sources-to-generate-audio-clocks
-//
-//  The PLL and divider parameters are modified to the specific values for this app.
-//  i.e. Sample Frequency is 44.1kHz, BCK frequency is 1.4204MHz. From table this means using the line where K*R/P is 64.
-// # Auto divider setting : disable auto config and ignore SCK losses
-// w 98 25 1A
-   WriteRegister(0x25, 0x1A);
-// # PLL P divider to 3
-// w 98 14 01     
-   WriteRegister(0x14, 0x00); // P=1
-// # PLL J divider to 16.D1D2
-// w 98 15 10    
-   WriteRegister(0x15, 0x32); // J=32
-// # PLL D1 divider to J.00
-// w 98 16 00     
-   WriteRegister(0x16, 0x00); // D1 and D2 are 0
-// # PLL D2 divider to J.00
-// w 98 17 00
-   WriteRegister(0x17, 0x00);
-// # PLL R divider to 2
-// w 98 18 01
-   WriteRegister(0x18, 0x01); // R=2
-// # miniDSP CLK divider (NMAC) to 2
-// w 98 1B 01
-   WriteRegister(0x1B, 0x01); // NMAC=2
-// # DAC CLK divider to 16
-// w 98 1C 0F
-   WriteRegister(0x1C, 0x0F); // NDAC=16
-// # NCP CLK divider to 4
-// w 98 1D 03
-   WriteRegister(0x1D, 0x04); // NCP=4
-// # OSC CLK divider is set to one (as its based on the output from the DAC CLK, which is already PLL/16)
-// w 98 1E 00
-   WriteRegister(0x1E, 0x07); // OSR=8
-// # FS setting should be set to single rate speed (48kHZ).
-// w 98 22 00
-   WriteRegister(0x22, 0x00);
-// # IDAC1  sets the number of miniDSP instructions per clock. (set to 1024)
-// w 98 23 04
-   WriteRegister(0x23, 0x04);
-// # IDAC2  
-// w 98 24 00
-   WriteRegister(0x24, 0x00);
-
-// #############################################
-
-
-// # Set PLL Clock Source to be BCK instead of SCK
-// w 98 0D 10
-   WriteRegister(0x0D, 0x10);
-
-   // I2S with 16 bit word length
-   WriteRegister(40, 00);
-
-   // Set digital volume to zero
-   WriteRegister(61, 0x00);
-
-   // Set digital volume to zero
-   WriteRegister(62,0x00);
-
-   // Disable auto mute
-   WriteRegister(65, 0x00);
-
-// #### Stand-by request and release ############
-// # Stand-by request
-// w 98 02 10
-   WriteRegister(0x02, 0x10);
-// # Stand-by release
-// w 98 02 00
-   WriteRegister(0x02, 0x00);
-// ##############################################
-
-   unsigned char reg;
-   for (reg = 0; reg < 255; reg++)
-   {
-      ReadRegister(reg);
-   }
+   // With DAC_INIT_DMA the DAC's init goes out while the first buffers
+   // are rendered, otherwise it is all sent here
+   dac_init_start();
 #endif
 
 
     ////////////////////////////////////////////////////////////
     // Calculate the timing parameters and fill all the buffers
     ////////////////////////////////////////////////////////////
-    samplesPerBeat = SAMPLE_RATE*60/BPM;
-    samplesPerTick = samplesPerBeat * BEATS_PER_BAR / BAR_LEN;
-    buffer_playing = -1; // To stop the filling routine from stalling
+    // SysTick counts core 0's cycles, for engine_cycles()
+    systick_hw->rvr = 0xFFFFFF;
+    systick_hw->csr = 0x5;   // Processor clock, no interrupt, enabled
+    prefetch_init();
+    engine_init(sample_rate);
+
+    ////////////////////////////////////////////////////////////
+    // Queue the first hits, then hand the sequencer to core 1
+    ////////////////////////////////////////////////////////////
+    sequencer_poll();
+    multicore_launch_core1(core1_main);
+
     for(int i = 0; i < N_BUFFERS; i++) {
-       drum_fill_buffer();
+       render_buffer(i);
+       buffer_fresh[i] = true;
     }
-    buffer_playing = N_BUFFERS-1;
+    buffer_fresh[0] = false; // About to start playing
+
+#ifdef I2CCONTROL
+    dac_init_finish();
+#endif
 
     ////////////////////////////////////////////////////////////
-    // Set up the DMA transfers, then call the 
-    // handler to trigger the first transfer
+    // Set up the DMA transfers, then trigger the first transfer
     ////////////////////////////////////////////////////////////
     setup_dma();
-    dma_handler();
+    start_dma();
 
     ////////////////////////////////////////////////////////////
     // Fill buffers with new samples as they are consumed
     // by the DMA transfers
     ////////////////////////////////////////////////////////////
+    stats.since_us = time_us_64();
     while (true) {
-      drum_fill_buffer();
-
-      // CheckRegister(90, 0);
-      // CheckRegister(91, 0x30);
-      // CheckRegister(93, 0x20);
-      // CheckRegister(94, 0x40);
-      // CheckRegister(95, 0x10);
-      // CheckRegister(108, 0x33);
-      // CheckRegister(109, 0);   
-      // //CheckRegister(114, 0);
-      // CheckRegister(115, 0);   
-      // CheckRegister(118, 0x85);
-      // //CheckRegister(119, 0);
-      // CheckRegister(120, 0);
-      // CheckRegister(4, 0x01);      
-      // SelectPage(44);
-      // CheckRegister(1, 0xff);
-      // sleep_ms(100);
+      if(!drum_fill_buffer())
+         drum_idle();
     }
 }
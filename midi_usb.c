@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////
+// midi_usb.c : USB MIDI input for clock, transport and live hits
+//
+// The Pico shows up as a USB MIDI device (TinyUSB). Everything here runs
+// on the sequencer core and only reaches the mixer as note events.
+//
+//   - Timing clock (24 ppqn) sets the tempo and pulls the tick phase in
+//   - Start, Stop and Continue drive the pattern sequencer
+//   - Note On plays the matching pattern row at the note's velocity
+///////////////////////////////////////////////////////////////////////
+#include "pico/stdlib.h"
+#include "tusb.h"
+#include "midi_usb.h"
+#include "drum_engine.h"
+
+#define MIDI_NOTE_ON  0x90
+#define MIDI_CLOCK    0xF8
+#define MIDI_START    0xFA
+#define MIDI_CONTINUE 0xFB
+#define MIDI_STOP     0xFC
+
+// General MIDI drum notes for each pattern row, or -1
+static int note_row(int note) {
+   switch(note) {
+      case 36: return 0;   // Bass drum 1
+      case 39: return 1;   // Hand clap
+      case 38: return 2;   // Acoustic snare
+      case 42: return 3;   // Closed hi-hat
+      case 37: return 4;   // Side stick
+      case 35: return 5;   // Acoustic bass drum
+      default: return -1;
+   }
+}
+
+static void midi_message(const uint8_t *msg, uint32_t frame) {
+   switch(msg[0]) {
+      case MIDI_CLOCK:    sequencer_clock(frame);    return;
+      case MIDI_START:    sequencer_start(frame);    return;
+      case MIDI_CONTINUE: sequencer_continue(frame); return;
+      case MIDI_STOP:     sequencer_stop();          return;
+   }
+
+   // Note on, on any channel. Velocity 0 is a note off, which drums ignore
+   if((msg[0] & 0xF0) == MIDI_NOTE_ON && msg[2] != 0) {
+      // Velocity 1 to 127 onto the same 0 to 96 emphasis as the patterns
+      live_hit(note_row(msg[1]), (msg[2]-1) * 96 / 126, frame);
+   }
+}
+
+void midi_init(void) {
+   tusb_init();
+}
+
+void midi_task(uint32_t frame) {
+   tud_task();
+
+   uint8_t packet[4];
+   while(tud_midi_available() && tud_midi_packet_read(packet)) {
+      // Byte 0 is the cable number and code index, the MIDI message follows
+      midi_message(&packet[1], frame);
+   }
+}
@@ -0,0 +1,15 @@
+///////////////////////////////////////////////////////////////////////
+// midi_usb.h : USB MIDI input for clock, transport and live hits
+///////////////////////////////////////////////////////////////////////
+#ifndef MIDI_USB_H
+#define MIDI_USB_H
+#include <stdint.h>
+
+// Bring up the USB MIDI device. Call on the core that runs midi_task().
+void midi_init(void);
+
+// Service USB and hand any MIDI received to the sequencer, timestamped
+// with 'frame'. Call often from the sequencer side.
+void midi_task(uint32_t frame);
+
+#endif
@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////
+// prefetch.h : background copies of sample data into SRAM
+//
+// On the Pico this is done with a DMA channel (prefetch_dma.c), on the
+// host it's just a memcpy (bench/prefetch_host.c). The same queue reads
+// the sample library from external SPI flash, when there is one.
+///////////////////////////////////////////////////////////////////////
+#ifndef PREFETCH_H
+#define PREFETCH_H
+#include <stdint.h>
+#include <stdbool.h>
+
+// Requests that can wait at once, a power of two. Each voice keeps two
+// stream chunks in flight, and the pool is 16 (N_VOICES in drum_engine.c).
+#define PREFETCH_QUEUE_LEN 32
+
+void prefetch_init(void);
+
+// Start copying 'count' samples from src to dst, then write 'tag' to
+// *done once they have landed. Copies complete in the order they were
+// started. Returns false, without copying anything, if too many are
+// already waiting.
+bool prefetch_start(int16_t *dst, const int16_t *src, uint32_t count,
+                    volatile uint32_t *done, uint32_t tag);
+
+// The same, but from byte address 'addr' of the external flash. Returns
+// false if the queue is full or there is no external flash.
+bool prefetch_start_ext(int16_t *dst, uint32_t addr, uint32_t count,
+                        volatile uint32_t *done, uint32_t tag);
+
+// Read 'bytes' from the external flash, waiting for them. Only for
+// setting up, before anything has been queued. Returns false if there
+// is no external flash.
+bool prefetch_read_ext(void *dst, uint32_t addr, uint32_t bytes);
+
+// Host only: the image the bench reads as the external flash
+void prefetch_host_library(const uint8_t *image, uint32_t len);
+
+#endif
@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////
+// prefetch_dma.c : background copies of sample data using a DMA channel
+//
+// Requests queue up and are run one after another from the channel's
+// completion interrupt (DMA IRQ 1), so the mixer never waits on them.
+// Flash is read through the non-allocating XIP alias so that streaming
+// doesn't evict anything from the XIP cache.
+//
+// With EXT_FLASH defined, requests can also read a sample library from a
+// 25 series SPI NOR flash on spi0, with a pair of DMA channels clocking
+// bytes through the SPI, and take their turn in the same queue.
+///////////////////////////////////////////////////////////////////////
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#ifdef EXT_FLASH
+#include "hardware/spi.h"
+#endif
+#include "prefetch.h"
+
+#ifdef EXT_FLASH
+#define EXT_SPI       spi0
+#define EXT_MISO_PIN  16
+#define EXT_CS_PIN    17
+#define EXT_SCK_PIN   18
+#define EXT_MOSI_PIN  19
+#define EXT_SPI_HZ    31250000   // Plain READ (0x03) is good to 50MHz
+#define EXT_CMD_READ  0x03
+
+static int ext_tx_chan, ext_rx_chan;
+static const uint8_t ext_dummy = 0;   // Clocked out while reading
+#endif
+
+static struct prefetch_request {
+    int16_t *dst;
+    const int16_t *src;         // NULL to read ext_addr of the external flash
+    uint32_t ext_addr;
+    uint32_t count;
+    volatile uint32_t *done;
+    uint32_t tag;
+} queue[PREFETCH_QUEUE_LEN];
+
+static uint32_t queue_head = 0;
+static uint32_t queue_tail = 0;
+static bool busy = false;
+static int prefetch_chan;
+
+static void start_next(void) {
+    if(queue_tail == queue_head) {
+       busy = false;
+       return;
+    }
+    struct prefetch_request *r = &queue[queue_tail & (PREFETCH_QUEUE_LEN-1)];
+    busy = true;
+#ifdef EXT_FLASH
+    if(r->src == NULL) {
+       // The command and address go out by hand (a few hundred ns), then
+       // the DMA clocks the data in
+       uint8_t cmd[4] = { EXT_CMD_READ, r->ext_addr >> 16, r->ext_addr >> 8, r->ext_addr };
+       gpio_put(EXT_CS_PIN, 0);
+       spi_write_blocking(EXT_SPI, cmd, sizeof(cmd));
+       uint32_t bytes = r->count * sizeof(int16_t);
+       dma_channel_set_write_addr(ext_rx_chan, r->dst, false);
+       dma_channel_set_trans_count(ext_rx_chan, bytes, false);
+       dma_channel_set_read_addr(ext_tx_chan, &ext_dummy, false);
+       dma_channel_set_trans_count(ext_tx_chan, bytes, false);
+       dma_start_channel_mask((1u << ext_rx_chan) | (1u << ext_tx_chan));
+       return;
+    }
+#endif
+    const int16_t *src = r->src;
+    if((uintptr_t)src >= XIP_BASE && (uintptr_t)src < XIP_NOCACHE_NOALLOC_BASE)
+       src = (const int16_t *)((uintptr_t)src - XIP_BASE + XIP_NOCACHE_NOALLOC_BASE);
+    dma_channel_set_write_addr(prefetch_chan, r->dst, false);
+    dma_channel_set_trans_count(prefetch_chan, r->count, false);
+    dma_channel_set_read_addr(prefetch_chan, src, true);
+}
+
+static void prefetch_handler(void) {
+    struct prefetch_request *r = &queue[queue_tail & (PREFETCH_QUEUE_LEN-1)];
+    dma_hw->ints1 = 1u << prefetch_chan;
+#ifdef EXT_FLASH
+    // Only the receive side interrupts, once the last byte is in
+    dma_hw->ints1 = 1u << ext_rx_chan;
+    if(r->src == NULL)
+       gpio_put(EXT_CS_PIN, 1);
+#endif
+    *r->done = r->tag;
+    queue_tail++;
+    start_next();
+}
+
+void prefetch_init(void) {
+    prefetch_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(prefetch_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_configure(prefetch_chan, &c, NULL, NULL, 0, false);
+
+#ifdef EXT_FLASH
+    spi_init(EXT_SPI, EXT_SPI_HZ);
+    gpio_set_function(EXT_MISO_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(EXT_SCK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(EXT_MOSI_PIN, GPIO_FUNC_SPI);
+    gpio_init(EXT_CS_PIN);
+    gpio_put(EXT_CS_PIN, 1);
+    gpio_set_dir(EXT_CS_PIN, GPIO_OUT);
+
+    // TX sends the same dummy byte over and over, RX fills the buffer
+    ext_tx_chan = dma_claim_unused_channel(true);
+    c = dma_channel_get_default_config(ext_tx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, spi_get_dreq(EXT_SPI, true));
+    dma_channel_configure(ext_tx_chan, &c, &spi_get_hw(EXT_SPI)->dr, NULL, 0, false);
+
+    ext_rx_chan = dma_claim_unused_channel(true);
+    c = dma_channel_get_default_config(ext_rx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, spi_get_dreq(EXT_SPI, false));
+    dma_channel_configure(ext_rx_chan, &c, NULL, &spi_get_hw(EXT_SPI)->dr, 0, false);
+    dma_channel_set_irq1_enabled(ext_rx_chan, true);
+#endif
+
+    // The handler runs on the core that calls this, which must be the mixer's
+    dma_channel_set_irq1_enabled(prefetch_chan, true);
+    irq_set_exclusive_handler(DMA_IRQ_1, prefetch_handler);
+    irq_set_enabled(DMA_IRQ_1, true);
+}
+
+static bool queue_request(int16_t *dst, const int16_t *src, uint32_t ext_addr,
+                          uint32_t count, volatile uint32_t *done, uint32_t tag) {
+    uint32_t irq = save_and_disable_interrupts();
+    if(queue_head - queue_tail == PREFETCH_QUEUE_LEN) {
+       restore_interrupts(irq);
+       return false;
+    }
+    struct prefetch_request *r = &queue[queue_head & (PREFETCH_QUEUE_LEN-1)];
+    r->dst   = dst;
+    r->src   = src;
+    r->ext_addr = ext_addr;
+    r->count = count;
+    r->done  = done;
+    r->tag   = tag;
+    queue_head++;
+    if(!busy)
+       start_next();
+    restore_interrupts(irq);
+    return true;
+}
+
+bool prefetch_start(int16_t *dst, const int16_t *src, uint32_t count,
+                    volatile uint32_t *done, uint32_t tag) {
+    return queue_request(dst, src, 0, count, done, tag);
+}
+
+bool prefetch_start_ext(int16_t *dst, uint32_t addr, uint32_t count,
+                        volatile uint32_t *done, uint32_t tag) {
+#ifdef EXT_FLASH
+    return queue_request(dst, NULL, addr, count, done, tag);
+#else
+    return false;
+#endif
+}
+
+bool prefetch_read_ext(void *dst, uint32_t addr, uint32_t bytes) {
+#ifdef EXT_FLASH
+    uint8_t cmd[4] = { EXT_CMD_READ, addr >> 16, addr >> 8, addr };
+    gpio_put(EXT_CS_PIN, 0);
+    spi_write_blocking(EXT_SPI, cmd, sizeof(cmd));
+    spi_read_blocking(EXT_SPI, 0, dst, bytes);
+    gpio_put(EXT_CS_PIN, 1);
+    return true;
+#else
+    return false;
+#endif
+}
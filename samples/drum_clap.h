@@ -1,589 +1,592 @@
-const int16_t drum_clap[] = { 0, 
-
-  21169, -16016, -27243,  -5595, -23004,  -9093,  17418, -16011,   -247,  26931, -10680,   5074,  21518,  22632,  28487,
-  11739,  13593,  -5544, -27452,   4184,  -6248, -16240,  -2468, -21194, -29783,  -6027, -10665,  -4608,  26489,   8736,    930,
-  -4032, -21020,  14936,  16386, -19401, -12684,  -6976, -12046,  11877,  28081,  29590,  32767,  24160,  17871,  18923,  26496,
-  17243,   4806,   4635,  -2270,  18605,  23191,   8330,  19819,  27653,  29975,   6266,  -6018, -14120, -29315, -28506, -26307,
- -26870, -31603, -31097, -30373, -26150, -11723,  -6525,  11663,  13112,  -2206, -25464, -28594, -18795,  -2394,  11310,   4555,
-   9631,  -1979, -15780,  -7423, -10533, -12894,   1025,   9684,   7632,   3494,   1757,  -3831,   -576,   6179,   -366,   3296,
-  -6776, -14645,  -1614,  -1988, -10596,  -1866,   9063,  13267,  26052,  24618,  30350,  18075,  -8870,  -3310,  -5671,   3454,
-   6481,   8010,  16813,   3129, -10054, -14868, -13144, -17303, -20100, -17267, -21334, -22650, -13315,  -5966,    801,  -6879,
- -19154, -19319, -16852,  -6959,  -6754,  -4166,  -3273,  -6533, -10109,  -5877,   9377,  15843,  28215,  22859,  15157,  25356,
-  25246,  24476,  27336,  14704,  16344,  16490,  -6550,   2702,   3236,   1329,  12493,   5964,   -491,  -4954,  -1167,  10430,
-  23941,  17490,  19510,  19115,  11737,  20835,   7543,   3876,   2552, -13660, -10244,   4767,   6721,   3757,  -1064, -19794,
- -20253,  -9328,    513,  13100,   9532,  -7227, -13150,    436,   9102,  14871,  12958,   6442,   1843,  -5534,   1115,   -935,
- -13999, -17912,  -8837,   -765,   1957,   3660,   -410,  -1602,   9932,  23155,  21651,  16342,   8793,  -4148,  -3477,   5225,
-  -2024,  -4966, -12790, -23974, -17030, -16670, -16462,  -5503,  -6341, -11570,  -4506,  -5201,  -8167,  -8495, -10185,  -3115,
-  -2762, -11283, -18362, -21409, -19125,  -9806,  -2889,  -6080,  -7782,  -9180, -10186,  -5693,  -3322,  -1569,   -358,  -3729,
-  -2712,  -2319,  -6232,  -6850,   -691,   5479,   2320,   6326,  11014,   3395,   -160,  -3915, -12491, -12767,  -6176,  -4503,
-  -4453,   -959,   6435,   9032,   3172,   2355,   9281,  18161,  18277,  11653,   7831,   6613,   4123,   6897,  12601,   9097,
-   7114,   9917,  15015,  12814,   1352,  -2928,   3048,   8776,   2293,  -2911,  -1058,   2751,   6484,   3453,   3017,  -1257,
-  -8110,   -886,   5983,   5468,   4482,    -89,   -767,    784,  -6593,  -8886,  -2463,   -893,  -6749,  -8517,   -424,  -2389,
- -11075,  -9906,  -8757,  -6938,  -2977,  -4733,  -7998, -11049,  -9529,  -4115,  -4311,  -3777,  -5341,  -8878,  -2774,   -838,
-  -2925,   2617,    411,  -5076,  -1680,  -6498, -11503,  -4006,  -5546,  -8206,   1512,  -1432,  -3225,   7669,  -2495,  -8313,
-  -2184,  -4587,   7519,  11909,   1528,    393,    -82,   4365,  15598,  14051,  -2908,  -8196,  -1901,  -1296,   3022,   8629,
-  12668,  16506,  14792,  10608,   1977,   1234,  17371,  25849,  23110,  20806,  16351,  15244,  13598,   8553,   7958,   4851,
-   2068,   3046,   3791,   4170,   1032,   -960,   2079,   7077,   8420,   8107,  11250,  13335,   8244,   7278,  18093,  17748,
-   6645,  -1651,  -6731,  -3623,  -2935,  -5987,  -2088,   -451,  -3676,   -485,    310,  -4522,  -8761, -13154,  -9627,    115,
-   2798,  -1262,   1293,   4686,   -625,  -1606,   -720,  -1933,   2136,   4045,    591,   -501,   -103,   -758,   -918,  -2658,
-   1490,   3947,  -6233, -11350,  -8387,  -8686,  -7872,  -6619, -11596, -16120, -16776, -15909, -13500, -10418,  -6982,  -8554,
- -10862, -13622, -21440, -22391, -14797, -10772,  -5151,   5626,   1347,  -4506,  -4223,  -8763,  -8478,  -7073,  -7267,  -6763,
-  -4987,  -9848, -14815, -12611,  -6317,  -2253,  -4101,   -504,  -3885,  -5317,  12016,  24926,  19210,  14183,   1319, -25434,
- -27052, -22861, -29680, -29385, -26211, -25645, -29189, -21940,   8516,  23278,   9240, -11389, -28114, -31167, -15802, -11978,
- -16069, -20824, -31280, -18941, -10543,  11463,  24595,  15761,  15897,  13061,  19961,  30596,  30652,  29840,  32068,  32546,
-  30949,  24123,  21019,  18753,  14571,  12650,   8260,    107,  -1786,   2762,   3299,  -9738, -12790, -12437, -21256, -14804,
-  -5525,  -5328, -15645, -19225,  -8661,   4579,   6329,   3411,  10824,  19973,  19980,   1856,   -977,  15498,   8823,   1252,
-  13463,  26974,  31083,  32546,  25215,   6933,   6943,  20082,  31296,  30917,  24092,   7804,  -5775, -18085, -15669,  -5682,
-   3009,   2696,   3556,   5111,   3923,   4207,   7626,   6347,  13046,  26008,  18625,   8063,  -4573, -16676, -14731, -15960,
- -19921, -12493,  -1052,   9468,  10594,   3668,   2046,  -7466,  -4075,  10105,  20056,  26840,  18815,   4434,  -9970, -12785,
-   5228,  17411,   5107,  -5755,  -4635,  -4368, -15266, -28741, -17780,    668,   8827,   7542,    303,  -8778, -10049,  -9726,
-  -2786,  12332,   6543,   5985,  10744,   7836,  12624,  13999,  10496,  -1004,  -5039,  -4505,  -7463,   8203,  13385,    237,
-   1635,   7322,  13245,  21920,  12584,  -3825,  -8729, -21141, -30387, -27122, -17920,  -5832,    682,  -1163,    -67,  -2093,
- -12411, -12221,  -2377,  15047,  16195,   2017,    595,   2021,   2534,  -3345, -18559, -29634, -32730, -31198, -22317, -17096,
- -14311, -13077, -15375, -20950, -13558,   3881,   7684,   4370,    728,  -4235,   3284,  15460,  13532,   5182,  -1410, -10679,
- -11237,  -4157,  -3890,  -6289, -15241, -24202, -24839, -24628, -21874, -18197, -13748,  -5948,  -4487,  -7117, -10993, -11861,
-  -8653,  -9607, -13264, -11744,  -9093,  -7293,   -758,   2266,   3602,   2068,   6484,  11346,   8125,   8279,   5645,   2157,
-   -240,  -6622, -10824, -13956, -15569, -12737, -16910, -14946, -10138,  -8480,  -3750,  -5224,  -9984, -11185,  -6726,  -4758,
-  -5854,  -4574,  -5957,  -6189,  -1090,  -2399,   3205,  12945,   9837,   8983,   4296,  -3785,  -2822,    -72,   2412,  -1474,
-  -5588,  -3071,   1373,   6654,   9767,  10356,   7979,   6214,   9498,   7465,   -666,    457,   5347,   7697,   3382,   5606,
-   1876,  -3573,   6537,   2048,   4214,   9391,  -1991,  -6543,  -3227,  -2255,  -6566,  -1994,   5706,   4502,   6349,   4890,
-   4314,   2638,  -3722,  -2541,   1956,   2267,   -573,   3564,    223,    -90,  10105,   7767,  10583,   7025,   -158,   -615,
-  -1022,    918,  -3480,   5846,  12134,  18237,  21680,  15710,  19022,   9134,   8050,  13485,  11235,  15576,  17487,   9706,
-   4401,   8942,   7153,  14601,  18829,   8180,   7745,  -1873,  -5117,  -5835, -14489,  -5824,   5008,  20329,  19905,  18469,
-  20478,  12114,  21515,  20090,  11231,  19782,  22696,  11914,  11248,  15923,  17837,  21396,  21381,   5794, -14862, -17787,
-  -4687,  10086,  11984,   9041,   5311,  -1927,  -4142, -10068,  -7592,  -1788,  -6458, -15400, -18398, -11439, -14693, -15825,
-  -8987, -10603, -21179, -17531,  -7928,  -2939,   4601,   4506,  10306,  23708,  29856,  31356,  29847,  30228,  29563,  27523,
-  29496,  27973,  26653,  22366,  13181,   5441,   4718,   1067,  -8679, -14202, -21388, -20432, -20967, -22712, -20629, -18079,
- -14304, -10279,   2589,   4836,    -74,  -8797, -13760,  -5756, -17151, -17922,  -6979, -17646, -19087, -15834, -19264, -18343,
- -10474,  -4643,  -4662,  -7335,  -1611,   8893,  10500,  12796,  15683,  17060,  14791,  11755,   5288,   8544,   7210,   4484,
-   6130,  -6327,  -6227, -11661, -14325, -16266, -26253, -21654, -19459, -15272, -10119, -10665,  -5058,  -1300,  -5162,  -4060,
-  -2560,  -2655,   4273,   3445,    164,  -3778,  -7022,  -8735,  -2351,   5785,   3942,   7266,   4193,   2310,  -5737,  -4999,
- -12293, -12160,  -5422, -11317,   7629,   1528,  -7207, -15163, -23035,    516,   7228,   3367,  -4872, -20960, -22188, -14064,
- -18305, -20753, -11653, -25548, -18573,    268,    592,  -3374,   4138,   9261, -11143, -11331,  -2545,   2240,   7477,  -7745,
- -10345,  -1926,   -703,  -4975,  -4260,   5441,  -6582,  -5461,  -2245, -12265,  -6905,   2795,  13793,   5932,    832,   5233,
-  13052,  14673,  12610,  -5380, -29118, -16540, -18030, -23734, -17988, -26107, -30031, -28059, -26171, -25918, -22065, -13479,
-  -1513,   7427,   8389,  22108,  28795,  12769,   1125,  -3083,   6510,   3549,   1002,  -2246,  -7719,   -741,     73,   9431,
-   9253,   5661,  18428,  24873,  23732,  18657,  13499,   6735,    245, -10660, -16345,   -598,  -2004,   9013,  -7109, -31092,
- -29883,  -7922,  13069, -11306, -17929, -16346, -14092,  -7809,   6595,   2465, -24527, -26447, -20589,  -9659,   2770,   4842,
-   7724,   8206,  -2784, -15036, -14951,  -4013,   6412,   7565,  17559,   7875,  -7811,  -2206, -14648, -17537, -20136, -22244,
-  -8998,  -6539,  -9790,   2481,   2351,  14761,  25419,  25062,  22396,   1791,   -155,   1812,   7401,  16587,  18746,  26249,
-  25267,  26682,  21636,  14463,  12749,   3666,   2365,  12394,  22850,  17191,  12419,  15137,   3663,   2023,   7358,   5807,
-   7591,   1689,  -1238,  10268,   9715,   1921,  -1586,  -4414,  -5016,  -7421,  -2860,   -719,  -1581,   1326,   4811,  12950,
-   7189,   1974,   2120,  -2152,   6399,   6542,   1798,  10127,   9379,   8607,  11668,  12710,  13626,  10295,  12364,  17929,
-  20972,  19586,  16218,  16543,  11660,  13880,   7820,   1814,   3561,   -291,  -2119,  -1604,   6960,   4539,   1810,   4427,
-   6919,   7241,   5617,   5615,   5905,  12173,  13429,  10661,   6406,  -6572, -10489, -10639, -10036,  -7118,  -9029, -12317,
- -12283,  -7293,  -7392,  -8917, -11785,  -5403,    720,   3991,   2198,   4569,   6075,    -21,   2754,  13738,  15535,    273,
-   -845,    524,  -5786,   4993,  -5730, -13214, -16713, -14202,  -8636, -10565,  -4463,  -7500, -14544, -17958, -14049, -15144,
- -14603,  -8044,   6364,   8471,   1511,   1215,  -6167, -10250, -12333, -15080, -13156,  -1773,   -184,   1549,   9269,  13200,
-  11335,  10107,  15679,  18649,  19815,  17237,  19820,  16154,   4150,   4672,  -4289, -14812, -17393, -11900, -12485, -14391,
- -13840, -12004,  -8671, -14187,  -5441,  -2430,  -8074,  -6907,   -424,   2904,   1050,  -1845,  -8360,  -9092,  -9197,  -8751,
-  -8850,  -6157,  -7052, -15330, -15786, -16515, -13707,  -5976,  -9031,  -9329, -10393, -13274,  -8519,  -2177,  -1283,  -2999,
-      2,  -6037,  -4915,  -1869,  -1242,   2188,  -2842,   1118,  -5631, -12377,  -8609,  -5804,  -8919,  -5201,   -983,  -3642,
-   -598,  -9021, -10867,  -7124,  -7979,  -5007, -10202,  -9322,  -8651, -11241, -11784,  -8544,  -8361,  -9876,   2171,   6046,
-  -1695,  -9207, -14755, -11866,   1156,  10978,  14323,  10980,  14373,  12341,   2083,     75,      1,   4780,   4072,   7275,
-   4304,   -927,   1919,   1718,   1315,  -4266,    -24,  -6628,  -6875,   7853,  11271,  13629,  10642,  12331,   9985,   6551,
-   7296,   6410,   7403,    908,   1265,   3594,      5,  -6058, -14446, -14338,  -9481,  -1543,    627,  -1211,  -5221,  -8114,
-   -634,   3696,   5168,    985,  -6246,  -4995,   1940,   5779,   3357,    561,  -3024,  -7065,  -2129,    866,  -6976, -12772,
- -14341, -15733,  -6621,   4604,  16390,  22968,  23269,  20836,  14151,  16127,  20588,  20831,  22226,  20990,  14319,   7984,
-   4243,   4477,   9783,  12126,  14200,  15142,  13956,  13875,  14233,   8624,   5553,   9939,  12579,   7452,   2301,   4446,
-     -3, -10384, -10851,  -5192,  -3195,   1823,  10313,   5519,   8779,  13039,   1259, -15773, -20075,  -5186,   6656,   9486,
-   4798,   6132,  14370,  14289,   9747,   9778,   9978,   1097,  -6968,  -6293,    295,   5180,   6558,   5834,  -1893,  -6305,
-  -1636,   4348,   8714,  11359,   9629,   6482,   1490,  -7355, -16394, -17984,  -1006,  14116,  10677,   8036,   4506,  -3488,
-    202,   3365,   1053,  -5579, -13601, -10946,  -3314,  -4589,  -5335,    125,    847,    107,    985,   4674,   4518,  -1505,
-   -706,   6528,  15433,  22468,  21649,   9486,   3869,   6842,   4666,   7010,  11963,  11999,  11600,  14098,   7986,  -6582,
- -18471, -22539, -18416, -16930, -15407, -12350, -11915, -11753, -10139,  -7564,  -9684, -14318,  -9690,    219,  -1063,  -3490,
-  -2747,  -1446,  11508,  22550,  18606,   9267,   4876,    148,  -1147,   1902,  -1562,  -7672, -14040,  -8109,   9483,  14735,
-   7180,   3096,    -28,  -4011,  -6027,  -8197,  -7137, -11483, -19776, -20111, -19311, -25260, -28394, -24927, -20936, -14656,
- -10051,  -5043,  10776,  19304,  16257,  15182,  10762,   4402,   -690,  -4702,   1104,  11376,   6728,   2929,   2351,  -7674,
-  -7863,  -3756,  -2599,   1076,  -3264,  -3883,  -5283, -11895, -15235, -12103,  -4695,  -3185,  -8779,  -8725,  -3414,  -3965,
-  -6994,  -1066,   7147,   7476,   4984,    132,  -1631,   4019,   9412,  14278,  10741,   4928,   3429,    855,  -3738,  -9348,
- -11463, -15280, -15480, -16797, -15234,  -9744,  -6543,  -5406,  -1526,   4601,   3632,  -1198,  -5911,  -6929,  -7563,  -5328,
-   3728,   8620,  15074,  18089,   9762,    923,  -1245,  -2511,   1769,  10600,  14471,  15227,  10254,   7645,   8278,   5111,
-   -649,  -2188,  -5146, -11727, -13270, -13431, -12878, -17510, -18374, -11711,  -7923,  -8631, -10611,  -7166,  -1780,   3523,
-   2123,  -2308,   3386,  10152,  15850,  25375,  26479,  24039,  21477,  16657,   8895,  -2460, -12703, -16013,  -6185,   1861,
-   4366,   1478,  -4706,  -8794,  -7599,     20,   -982,  -1847,   -185,   2966,   9367,  10685,   7325,   3224,   1837,   1315,
-   4931,   7206,   2262,  -8206, -15528, -14687,  -8843,   -214,   3075,   8172,   7847,   6667,   9254,   5412,   9280,  12673,
-  10711,   3890,  -4768,  -4683,  -3711,  -1460,   2862,  10635,  19079,  20535,  15149,  14608,  11093,   2738,  -1432,   -705,
-  10339,  11062,   8063,   4280,  -6516, -13885, -18190,  -6600,   5466,  14724,  20981,  16405,  17769,  15989,   6350,   -125,
-  -6452,  -8281,  -1447,   2684,    408,  -5951,  -6526,  -2743,  -4028,   2434,   8436,   2879,   2092,   7187,   7439,   5164,
-   3822,   4757,   2107,   -862,   5428,  11571,  16793,  16608,   5979,   -312,   -627,   1145,  -2608, -12022,  -5640,    330,
-  -6404,  -8458,  -6237,  -2208,    456,   3385,   3844,   5410,    903,  -3129,   3331,   2230,   1400,   -990,  -2615,  -5310,
-  -7780,  -3581,  -3916,  -9344, -17083, -16055,  -8897,   1532,   3345,   3043,   -371, -11447,  -7961,  -3969,  -1764,   2365,
-   1502,   -877,   -126,  -2885,  -2449,   3463,   3080,   9253,   7817,   7352,   6640,   2192,  -3408, -13276,  -5601,   1253,
-   3550,   2401,   7415,  11960,   8457,   4239,  -2376,  -1850,  -2589,   4023,   5885,  -5709,  -9179,  -3703,    763,   -788,
- -11010, -19399, -18544, -16569, -13877,  -8876,  -4740,  -4886,  -7786,  -9652,  -1392,   4123,   6218,  11163,  10779,   6132,
-   3777,   1472,  -6339, -14488, -12329,  -5923,   4654,  15851,   7830,    941,    293,  -3834, -12152, -16011,  -3560,   1083,
-  -7000,  -9469, -14764, -19700, -16121,  -6116,  -3536,  -3515,    345,    748,    -69,  -1896,   4046,   6046,   1080,  -2898,
-  -7810, -10191, -11067, -12022, -18554, -21671, -12339,  -1029,   2669,   3338,   4295,   4214,   5905,   6173,   6680,   4736,
-     16,  -2186,  -3142,  -5370,  -3460,  -1498,  -2107,   2013,   5014,   8176,   8419,   6903,   5433,   2651,   4424,   5723,
-   3240,   3917,    248,  -9567,  -7224,  -4842, -10692, -13664, -14784,  -8694,  -2830,  -3071,  -4762,  -3766,   6507,   9134,
-  -3152, -11754, -11183, -11700, -12941,  -8188,   -147,   4134,  -2452, -10702, -11209,  -5358,    -73,   6432,   7929,   3953,
-   5519,   4436,   6307,   9210,  11999,  11178,   4747,   2340,   1526,   1230,  -1278,  -1446,   3822,   7006,   8156,  12504,
-  12032,    -57,  -5613,  -1058,   1162,   6523,   1722,  -9034, -10896,  -7012,   -735,    986,   -735,    245,  -2456,  -7381,
-  -4664,    908,   2642,   4222,   9314,   6862,  10358,  18132,  23533,  25724,  26076,  26568,  22698,  12772,   5097,   4324,
-   3822,   1524,  -2455,  -6295,  -4974,  -4690, -11812, -13065, -11777, -10869, -10949, -13243, -17087, -15341,  -2597,   2488,
-   1695,   5011,   5980,   5028,   6880,   4324,   2726,   6171,   7318,   6241,   8877,  13568,   8364,   1995,   4551,  10368,
-  10152,  10609,  15217,  14207,  13097,  12443,   5910,   4492,  11611,  18880,  25006,  21873,  13626,   8059,   4603,   4712,
-   7649,   5220,  -3814,  -2319,   4330,   9625,  12813,   4809,  -4682,  -7319,  -3509,   2014,   2510,   5880,   6507,  -2476,
-  -2822,  -2029,  -5951,  -6361,  -4703,   4165,  10745,   6847,  -5105, -12792, -14114, -16701, -14348,  -8180,    421,   6287,
-  11535,  14354,   5926,   -142,   3829,  10936,  13858,   7977,   1145,    809,    851,    150,   7704,  20003,  23196,  16684,
-   7578,   3964,   3885,    519,  -1880,  -3505,  -4852,  -1787,   2038,   4712,   6955,   5479,   1965,  -3310,  -8615, -12533,
- -15721, -13927, -13532, -12746,  -5723,  -3888,  -6716,  -1802,   4623,   1348,  -3227,  -4994,  -5907,  -4333,  -1251,   1293,
-  -3328, -12043, -20194, -26637, -27271, -24711, -18352,  -7591,   2688,   9338,   7604,   -177,  -3253,  -2360,  -5011, -10547,
-  -8030,  -1070,   2004,   -235,  -8891,  -9287,  -2217,    290,  -1005,  -5551, -10703, -12514, -11393,  -5896,  -3083,  -7057,
-  -9306,  -6466,  -2300,  -5146,  -9128,  -1816,  12014,  19555,  15406,   9263,   4854,  -6406, -17060, -15450,  -6886,   -533,
-  -2281,  -9334, -11585,  -7236,  -9461, -17818, -20091, -19649, -10087,   3209,   3296,  -4707, -13204, -15965, -11717,  -6058,
-  -4620,  -6949,  -2262,   5920,   3232,  -7468, -13353, -11255,  -7833,  -2726,   -273,  -1211,   -398,  -3027,  -3522,  -1385,
-  -1872,  -1695,  -2778,  -5464,  -6745,  -9806, -15364, -19740, -13891,  -5132,  -4064,  -5957,  -5659,   2846,  10350,  16093,
-  17036,  13372,  10495,   4199,  -3233,  -4750,   1661,   5284,   3613,   3205,  -1557, -10651, -12644, -12748, -10262,  -6470,
-  -6203, -10032, -11731,  -9885, -12706,  -9657,  -2387,  -1708,   1794,   5163,  10653,   9688,   7850,  10411,     49,  -6329,
-  -4997,   -767,   3985,   9566,  11742,   5657,    423,  -1188,  -5329,  -3737,    938,   1406,   8403,   9879,   7194,   4729,
-   -266,  -1243,  -1230,     78,   4156,  10698,  14625,  23378,  28880,  25134,  20808,  11178,   3967,  -6334, -10465,  -5584,
-  -1156,   -253,  -4413,  -9870,  -9574,  -6950, -11250,  -8053,   3033,   6459,   4409,   2227,    835,   6073,  13089,  18166,
-  20930,  14604,   5220,   3151,  10548,  14747,  12452,  16110,  17005,  12029,  10169,   9454,  11870,  12750,  13449,  15107,
-  15724,  15438,  12592,  14183,   7456,  -3646,   -635,   -288, -14768, -22133, -14997, -10351,  -4430,   -564,    449,   1324,
-  -8970, -14758,  -3005,   4854,   7090,   7175,   7452,   7215,   7506,  10124,  14397,  18702,  14400,  17651,  15623,  10170,
-   7399,   7086,  13922,  18768,  18239,  14702,  15170,  16790,  15868,  15071,  14544,  14789,  11582,   7673,   2149,  -3436,
-  -7698,  -9236,  -3612,  -2704,  -5250,   -415,   3075,   6312,  10885,  11993,   6585,  -1853,  -4233,  -2918,  -6693,  -7524,
-  -1976,  -6655,  -9328,  -7301, -15019, -16931,  -7589,   1899,   2333,  -1417,   2546,   -423,  -5584,  -3917,  -3184,   -250,
-   -761,   -474,   7788,  12598,  14762,  11488,   7264,   6130,   5320,   3814,   -853,   2007,   4537,   6568,   2607,  -4766,
-  -2741,   1621,    -22,  -8042,  -6180,  -2420,  -2979,  -5505, -11083, -11993, -10013,  -8260,  -8862,  -7503,  -3634,   2210,
-   3055,   4840,   9911,   5905,   8431,   7680,   3980,    105,  -6935, -10180, -12570, -14207, -13637, -10461,  -8736,  -8176,
-  -7157,  -4455, -11975, -16985, -16807, -16782,  -6141,  -2926,  -3769,  -2483,  -2528,   -137,  -6688, -10459, -10529, -10197,
-  -8195, -12401,  -8630,  -1391,   2891,   -965,  -4629,   1237,   4314,   1222,   1165,   4024,   -718,  -7366, -12931, -10521,
-  -9807, -11559, -14362, -10816,  -2165,  -4362,  -9019, -13448, -13874, -15148, -13721, -11241,  -9871, -10619, -12617, -13455,
- -11690,  -6656,  -4559,  -1092,  -3470,   1052,  10794,   7318,  -1780,  -6506,  -4779,  -1210,   -996,  -4192,  -6108,  -2199,
-   5015,   5890,   1988,  -7097, -12376, -12797, -18523, -17628, -13018, -12263,  -8462,  -4799,   -378,    761,    292,   1453,
-   -153,    868,   -416,  -3127,  -4090,  -3433,  -7174,  -5836,   -191,   2267,   3883,  -1062,    142,   2197,   3943,   5609,
-   3145,  -1786,  -5025,  -4175,  -6392, -10902,  -9242,  -4025,  -7231,  -5392,  -2462,  -4740,  -2998,  -3542,  -4358,    686,
-   7293,   4752,   -105,   1973,   4055,   3367,   3495,   7805,  11855,  12563,   7828,   -172,  -3334,  -4176,  -6881, -10431,
-  -9492,  -8417,  -7553,  -3312,  -3939,  -6736,  -7810,  -5906,   1329,   3504,   3442,   4758,   3060,   8919,  16567,  20171,
-  19389,  17110,  20572,  19522,  18046,  19379,  15500,  14144,  13913,   8993,   6246,   4698,   2590,   3080,   9369,  12941,
-   8584,   6252,   6468,   4398,  -3743,  -9652,  -6568,   -337,   7721,  11486,  11063,  11800,  10982,   4793,   -988,  -1177,
-    242,   5251,   9483,  10248,  12354,  12401,   8658,   2753,  -3189,   -102,   9337,  14017,  11783,   9529,  10981,  15766,
-  18796,  12989,   5158,   1082,   2298,  11255,  17333,  14692,  12104,   7292,   4218,   3658,    274,    834,   5157,   4399,
-   1958,  -2822,  -8998,  -5347,   -116,     64,    -26,  -2365,  -5853,  -3471,  -1136,  -2208,  -2767,  -1085,   -922,   1886,
-   6806,   5354,   1554,   -885,   1746,   3100,   2605,   5638,   7972,   5450,     23,  -3192,   1614,   8845,   7058,   1428,
-   -812,   2967,   6351,   7704,  11055,  12334,  12118,  11506,   8105,   3674,   1566,     93,  -1154,  -5386,  -7507,    355,
-   6286,   6286,   3701,   -853,  -3810,  -4688,   -444,   4342,   4007,   3460,   5058,   3365,     20,   1163,  -2513,  -7234,
-  -6003,  -8477,  -9291,  -5019,  -2402,  -1930,  -4630,  -5700,  -4461,  -7401,  -9623,  -7962,  -8146,  -9087,  -4297,   -231,
-   -764,     19,    837,  -1451,  -5128,  -8248,  -5661,   -489,  -1687,  -2652,  -2391,  -3500,  -3650,  -4445,  -8603, -12375,
-  -8438,    328,   1275,  -2677,  -2057,  -3458,  -5535,  -3781,  -2709,  -4213,  -7703, -13715, -15768, -13453, -10374,  -5545,
-  -4447,  -5896,  -8821, -10768,  -9594, -10542,  -6788,  -1354,  -3532,  -6961,  -6112,  -1346,    274,   2114,   5716,   2856,
-    524,  -1526,  -5156,  -4558,  -2479,  -5510, -11067, -14516, -14051, -11428,  -9125,  -6321,  -8539, -10367,  -7680,  -7743,
-  -6360,  -2984,  -4469,  -8417,  -8264,  -1777,    776,    285,   1539,   -986,  -3123,    121,   5763,   8385,   4480,  -3819,
-  -9263, -12243, -13035,  -8537,  -3062,  -2463,  -6858, -12333, -11971,  -8293,  -4136,   1405,   2225,  -1480,  -5535,  -1526,
-   6500,   8337,   7576,   4930,    540,   -274,   2724,   1278,  -4049,  -5994,  -5056,  -3973,  -1567,   3296,   7389,   6027,
-   2358,   4906,   3796,  -2401,  -4571,  -3832,  -2648,  -3020,  -3258,  -2337,  -3703,  -4767,  -6327, -13034, -14857,  -8986,
-  -9558,  -9828,   2717,  11019,  13705,  13541,   8838,   8100,   8112,   5975,   5024,   3929,  -1119,    -34,   6298,    870,
-  -3794,    538,      3,  -2328,   1240,   6477,   8358,   6963,   -814,  -8699,  -8718,  -4685,  -2415,   -709,   4426,   7151,
-   6884,   7093,   5516,   5600,   5606,   8029,  14759,  14391,  11982,   9414,   7350,   8971,   8966,   7287,   5491,   5098,
-   6314,   7379,   8408,   9105,  10408,   8589,   4821,   5132,   2365,   -588,   -570,   2490,   1507,   -835,   4765,   4719,
-   1864,   4757,   7771,   8615,  10507,  12205,  11955,  11419,   8406,   4474,   3230,    875,  -3316,  -5605,  -4703,  -1176,
-  -4258,  -7491,  -5873,  -8884,  -9372,  -2206,   4073,   3964,   3937,   5574,   5324,   3458,    696,   -695,   1646,   5754,
-   9684,   7997,   5202,   6206,   2966,   2992,   6401,   5357,   6979,  10042,  10078,  10580,   7749,   3287,    462,  -4033,
-  -4545,  -2479,   -133,   1353,    -79,   1019,   2788,   3801,   6469,   7632,   4897,   6231,   6706,   7830,  12780,  13044,
-  10316,   1151,  -5267,  -4042,    588,   4078,   2477,   2494,     79,  -6528,  -7868,  -7139, -11267, -11281,  -9769,  -8486,
-  -9175, -12628, -11615, -10664,  -6516,  -1963,   -793,    494,   2842,    572,    363,   4376,   3098,   6421,  11969,  13465,
-  12881,   8148,   2447,   1142,   2994,    787,  -2470,   1038,   3993,     65,  -4593,  -3847,  -6478,  -7752,  -4137,  -2657,
-    561,  -1162,  -4336,  -6473,  -8220,  -3960,   -528,  -2203,  -4513,  -5435,  -4046,   -715,  -2005,  -2755,  -3332,  -5159,
-   2689,   3397,  -5206,  -6722,  -7094, -10537,  -9260,  -6203,  -4303,  -2178,  -2835,  -1855,  -1663,  -1070,   -688,   -973,
-  -4359, -10461,  -9614,  -7450,  -4362,  -6567, -10849, -11605, -16157, -15611, -12271,  -9753,  -5515,  -3454,  -4424,  -7204,
-  -7007,  -3706,    304,   2540,   -349,   2442,   4613,   3286,   6060,   6039,   6906,   2697,  -4423,  -4170,  -1466,  -1767,
-  -1799,   1947,    995,  -1181,  -5338, -10395,  -6985,  -5457,  -6100,  -5547,  -7608,  -8313,  -7715,  -9327,  -9485, -11185,
- -11710,  -8043,  -6295,  -2344,    870,    192,   -674,   1140,   3924,   3472,   3254,   3675,   1864,   1271,    884,   -478,
-   1529,   3898,   2204,   2584,   3175,   4302,   7073,   2463,   1411,   3606,   2578,    227,  -3060,  -3214,  -1243,   2932,
-   3649,    538,  -2707,    631,   4435,   -844,  -6844,  -8525,  -5940,  -4885,  -6126,  -5981,  -5438,  -6795,  -6966,  -2627,
-    418,  -1049,  -1831,   -317,   -465,    779,   3277,   1781,   1812,   2461,   4158,   8400,  11119,  10606,   8574,  10549,
-  10861,  10851,  11247,   7356,   7344,  10256,  10762,   7678,   5073,   4597,   2197,   3062,   5111,   3996,   3363,   2074,
-   1064,    -85,  -1752,  -2894,  -2005,    195,  -1269,  -1483,   1804,   5555,   4978,   2208,   2299,   3279,   3712,   4987,
-   6432,   5040,    831,   1247,   5623,   9228,  10503,   5205,   2747,   4232,   3782,   2197,   -377,   -751,   1717,     65,
-  -3104,  -2003,    369,   1840,   1335,   1181,   1246,   2712,   5517,   3408,   1898,   2599,   5297,   8910,   8627,   7891,
-   6580,   4734,   3606,   3688,   4540,   6185,   6591,   3726,   -284,  -1003,   1102,     -7,   -931,   2022,   2888,   3449,
-   4595,   1612,    827,   3804,   5009,   6064,   2924,   -795,   3054,   7233,   8569,   6811,   5952,   3771,   -242,   2280,
-   2849,   1817,   2242,    227,   1327,    181,  -2890,  -4452,  -3322,  -3263,  -5912,  -4769,  -5513,  -3375,  -1789,  -4271,
-  -4953,  -2302,   -286,  -1961,  -5088,  -7827,  -5892,  -2887,  -4270,  -8491,  -9422,  -7556,  -1281,   4444,   2526,   1612,
-   2508,   2036,   1232,   1897,   2714,  -1088,  -2809,  -2023,  -3562,  -3278,  -1175,   -798,    -35,   1796,   1110,    875,
-   -119,  -4046,  -1953,   -380,  -3173,  -3110,  -5197,  -6321,  -6361,  -8206,  -6347,  -1549,  -3846,  -8640,  -9762, -10599,
-  -8445,  -4384,   1174,   4881,   3710,   -157,   -656,  -1032,  -4102,  -2777,  -1068,  -1475,  -1904,  -5316,  -6900,  -3424,
-  -2678,  -4807,  -4193,  -4568,  -5465,  -2933,   -132,   3102,   3464,   -795,  -4189,  -5740,  -6267,  -6238,  -5732,  -3069,
-  -3293,  -2734,   -655,  -2109,  -1960,  -1211,  -3351,  -2758,    350,   -924,    273,   1139,   -425,    289,  -1111,  -6709,
- -12074,  -9519,  -6893,  -5884,  -1381,   -958,  -2564,  -1911,  -2572,  -5171,  -7718,  -8738,  -7307,  -6229,  -4441,  -3256,
-  -3851,  -2382,   -308,   2142,   1812,    587,    424,  -2145,  -3558,  -2152,   -601,   2244,   5286,   4357,   1544,  -2424,
-  -3494,   1870,   4950,   3753,   2676,     57,  -1897,   4471,   6884,   -831,  -4154,  -3296,  -7642,  -8596,  -4683,  -5629,
-  -4908,  -3198,     61,   2263,   1013,    278,    318,    105,   -989,   -767,  -1501,  -3504,  -4027,  -3484,  -2012,    493,
-   1301,   3670,   5502,   2740,   -220,    429,   2174,   2593,   5719,   6578,   2747,    937,    957,   1145,   1171,   2923,
-   3672,   2701,   3375,   3757,   4266,   3909,   2293,   4200,   5585,   3710,   4037,   3224,   2863,   6490,   5496,   2479,
-   1487,    625,   1233,   1679,   1641,    238,    739,   1016,    424,    586,  -1188,   -464,   1430,   2253,   2663,   1102,
-    -94,   -877,    917,   4075,   2696,   3006,   6054,   7569,   7712,   7173,   5241,   2605,   3167,   2155,   3306,   5228,
-   3075,   3338,   2620,   3470,   5462,   5823,   8197,   7819,   5801,   4455,   3988,   3956,   2888,   2738,   3047,   4419,
-   6823,   8594,   7188,   6250,   6014,   2723,   3785,   5242,    831,   -784,   -101,   -139,   -270,   -262,    788,    769,
-    905,   2793,   2881,   2028,   1469,   1916,   4125,   4504,   4129,   4314,   1664,   -526,   2166,   1951,   2125,   3720,
-      0,  -3245,  -4226,  -1022,    969,    911,   1449,    763,   1357,  -1354,  -2238,   -689,  -2058,   -941,    367,   2918,
-   4719,   3509,   1997,   1571,   2455,    826,   1721,   1605,   -920,  -1778,  -2843,  -5289,  -7551,  -3828,  -2562,  -3773,
-   1135,   2854,   1460,   3591,   3236,   -361,    803,   4720,   4072,   1945,   3406,   1101,  -2261,   -779,  -1772,  -2790,
-  -3115,  -3947,  -5214,  -4624,  -1936,  -2553,  -1747,  -1811,  -2406,   1110,   3223,   4092,   4143,   2681,   1615,   1180,
-   2597,   3999,   3857,    851,  -2310,  -2787,  -3450,  -7334, -10968,  -8877,  -8834,  -7932,  -3940,  -7465, -12519, -10169,
-  -6863,  -7212,  -7460,  -5969,  -3353,  -2378,  -3378,  -1596,  -1595,  -5060,  -3378,   -524,   -664,    224,   1419,   4362,
-   3851,   2145,   5424,   3779,     10,  -2350,  -2214,  -1746,  -2374,  -2050,  -2476,  -2604,  -2339,  -3741,  -6767,  -3952,
-  -1856,  -2757,  -4528,  -6916,  -4730,  -2022,  -1961,  -4402,  -4781,  -3604,  -5084,  -4788,  -4737,  -6160,  -4465,  -2972,
-  -5431,  -7429,  -7489,  -6845,  -4130,  -2656,  -1008,  -1941,  -1020,   1337,    662,   -221,  -1684,  -3001,  -2265,    954,
-     75,  -1185,  -2184,  -2682,   -454,   -598,  -2333,   -881,    843,   -514,  -1705,   -810,   1071,    374,   -667,   -960,
-  -4419,  -6183,  -3957,   -239,   1720,   -503,   -329,   1479,    841,   -445,  -3244,  -2421,   1526,    829,   -238,   -528,
-  -1621,    420,   3309,   5396,   3353,   -102,    978,     -9,   -603,   3989,   3049,   1096,   3690,   1252,    180,   2819,
-   2764,   5025,   5596,   2069,   3319,   2836,    930,   3548,   4594,   3502,   1547,  -1019,  -1500,   -355,   2245,   3757,
-   5091,   4198,   1457,   -582,  -3027,  -2261,   -390,   1350,   2651,   1995,   -270,  -1125,  -1975,   -970,    803,   -178,
-    -44,   1010,    449,   -333,   1006,   3372,   5952,   3490,   2122,   3363,   3672,   5869,   6760,   7301,   5637,   3081,
-   2628,   4575,   6151,   5302,   1523,   1428,   3670,   2208,   2258,   3405,   6211,   5184,   1363,   2339,   3994,   2866,
-    590,  -1136,   -269,    986,   -352,   -619,  -1067,  -1526,    993,   2385,   3149,   5938,   2797,    266,   4230,   2499,
-    195,   2377,   2937,   2585,   2416,   1218,     79,   1487,     65,  -4587,  -3175,  -1118,  -2822,  -1501,    255,  -2337,
-    433,   2137,   -474,   -575,    655,   1956,   -957,  -1001,   -261,    752,   2115,    760,    955,   -251,  -2920,   -340,
-   3103,   1887,   -814,  -1721,  -1069,    378,    -22,    383,   1768,    396,    988,   -402,  -3334,  -3291,  -2220,  -2272,
-  -1989,   -613,   -618,  -4723,  -5508,  -1889,    160,   1822,    179,  -2061,  -3014,  -1679,   -150,    103,   1246,  -1113,
-  -3388,  -2989,  -3365,  -1928,    433,   -437,   -982,  -1921,  -4231,  -3019,  -2025,   -929,   1995,   2323,   -983,  -2325,
-  -2096,  -1394,   2800,   3628,    363,    539,   1631,    255,    -72,   -728,  -2253,  -1210,   1956,   3360,   2879,   2066,
-   -645,  -4109,  -3881,  -1929,  -1310,    844,    -71,  -3274,  -3250,  -4201,  -4723,  -5581,  -5324,  -1009,  -1830,  -3006,
-  -2226,  -4876,  -3705,    754,    644,    448,   2275,   1503,   1111,   -691,    -18,   1595,  -1086,  -1474,  -2846,  -5303,
-  -3321,   -426,   -902,  -1065,   -159,    -97,   -905,  -2776,   -650,   2258,    153,  -1603,   -318,  -1398,  -2182,    414,
-    689,   -316,    550,   -206,  -1214,  -2733,  -4493,  -1365,  -1626,  -4661,  -3833,  -3803,  -3281,  -1885,   -587,   3582,
-   4318,   1446,   2081,   2632,    554,   -480,   2361,   2996,    595,   1079,   2024,   1817,    264,   1093,    985,  -1902,
-  -1200,    353,   1081,   1494,    794,   -677,   -371,    135,  -1788,  -4835,  -4011,     -6,   2005,   1784,   1425,   3329,
-   4783,   4380,   4349,   4169,   3981,   4940,   2958,   -821,  -1463,  -1873,  -2255,  -2148,   -333,   2630,   2003,    566,
-   -163,    862,   2975,    723,  -2481,  -2771,  -2545,   -673,    757,    416,   1412,   1569,   1793,    806,  -2452,  -2830,
-    168,   1866,    134,   -487,    723,   2287,   3341,   2116,   1081,   2495,   3559,   4107,   5185,   3919,   2224,    474,
-  -1203,      7,    687,    522,   2191,   1994,    342,   -211,    -98,  -1183,  -4805,  -5385,  -4083,  -4431,  -4668,  -4603,
-  -3281,  -2241,  -1088,    468,   1373,   1358,   1917,   3229,   1988,   2430,   4907,   5172,   3521,   3821,   5476,   5425,
-   4756,   3701,   4862,   4448,   1954,   1555,   1432,   1533,   2092,   2175,    252,  -1914,  -2815,  -1866,  -1681,  -2895,
-  -1869,   -700,  -1214,  -2554,  -1665,  -2009,  -3386,  -1608,   -743,   -215,    426,  -1414,  -2884,   -352,   1330,    166,
-   -679,   -552,  -1069,  -1493,    808,    453,   -782,   1396,   1675,   -227,   -396,  -1556,  -4133,  -3216,   -349,   1093,
-    490,    785,   2396,   1880,   1318,   3267,   5171,   5983,   4881,   1504,   1480,   2602,    836,    912,   2479,   2142,
-    587,  -2909,  -5689,  -4736,  -5316,  -4744,  -2136,  -1336,   -997,  -2566,  -4138,  -2760,  -2261,  -3100,   -183,    306,
-  -2481,  -3250,  -2548,    241,   2436,   2234,    937,   1658,   2593,    470,   -881,   -950,   -900,   1717,   3042,   2938,
-   4442,   3517,    236,  -1015,  -1316,   -851,      9,  -1812,  -3310,  -3230,  -2823,  -2163,   -745,  -1865,  -5395,  -3153,
-     38,   -608,    177,    450,    275,   1959,   2716,   1524,   -326,  -1801,  -3573,  -4225,  -2378,  -2280,  -3700,  -2233,
-  -1613,  -3022,  -2357,  -2013,  -1334,    706,   1519,    830,  -1986,  -3395,  -1694,   -665,    169,     71,    554,   4166,
-   4743,   4107,   4146,   3323,   4421,   4626,   4620,   3004,   -930,  -1586,  -2086,  -2801,  -2691,  -1985,    468,    885,
-   -576,  -1322,  -2185,  -3008,  -2520,  -4043,  -3873,  -1499,  -1847,   -740,   1226,   2481,   2443,   1046,    523,    806,
-   1485,   1890,   2285,   1003,    -75,    413,  -2123,  -4012,  -2828,  -1827,  -1263,    106,   1055,    309,    711,   1150,
-    726,   1690,   2718,   1450,    783,   1073,     84,    260,    265,   -535,    159,    415,    113,  -1186,  -2507,  -1429,
-    317,   3894,   6446,   4099,   2931,   4773,   4389,   4283,   5884,   5023,   1936,    250,   -431,   -738,   -844,  -2016,
-  -1930,  -1253,  -1260,  -2977,  -2891,  -2353,  -4618,  -2451,    205,  -1537,  -1087,    507,    655,   1155,    358,   -183,
-    542,   1040,   2212,   3427,   3723,   3353,   2171,   2753,   3827,   3120,   3079,   1169,  -1381,   -334,  -1122,  -3682,
-  -3648,  -3230,   -598,   1386,    869,    291,     15,   1725,   3652,   4009,   3378,   2873,   1556,   2643,   3342,   2332,
-   3518,   1494,   -938,     -8,   -850,  -1886,    135,   -480,  -2592,  -2740,  -2973,  -2495,  -3063,  -3446,  -1762,   -928,
-  -1577,   -752,   1169,    240,   -506,    980,   1045,   1247,   2240,   1532,    843,    461,   -352,   -756,  -2189,  -4851,
-  -4784,  -2150,  -1857,  -2297,  -2788,  -4519,  -6400,  -5495,  -1789,   -265,    -17,    443,    827,    126,    967,   3379,
-   3666,   5170,   7084,   5048,    584,  -1613,     -2,    652,    536,   1335,    100,  -1702,  -3887,  -4685,  -4971,  -5170,
-  -2413,   -676,  -1966,  -4901,  -5010,  -3473,  -3707,  -2580,  -1399,  -2508,  -1853,   -120,  -1047,  -1450,      0,   1949,
-   2515,   1724,    163,   -620,    342,    955,   1216,     32,    708,   2242,    703,     72,   -468,   -710,   2546,   4053,
-    208,  -2839,  -3975,  -4139,  -3275,  -3844,  -3618,  -3138,  -2851,  -2727,  -3102,  -2501,  -1591,  -1948,  -3599,  -3015,
-  -1342,  -1835,  -1237,    623,   -139,   -314,   1382,   1578,    999,   1022,     28,   -341,   1525,   1947,   1083,    432,
-   1218,   2497,   3260,   3668,   2068,    958,   1770,   1465,    890,    512,  -1331,  -1037,    473,    799,   -388,  -1669,
-  -1512,  -1844,   -986,     16,    282,    -58,   -904,    854,   2661,   2353,   3486,   3287,    212,     44,   1252,   1367,
-    421,    -25,    860,    160,    -45,    159,   -756,  -1262,   -964,   -708,   -363,   -727,   -743,    206,    239,    654,
-    778,     69,  -1422,   -160,   1973,   1711,   1457,    804,   1387,   2415,    765,  -1409,    670,    729,   -361,   1341,
-    862,    348,    468,    839,   1308,   1761,   2005,   1617,   1131,   3079,   3445,   -788,  -1364,   -184,  -2164,  -2705,
-  -2069,  -4009,  -2288,    -42,  -2008,     99,   2395,   1824,   2245,   3214,   3718,   3907,   4811,   4252,   2521,   2036,
-   2294,   1467,   1147,    931,     59,    -82,    275,   2026,   1705,    975,   2064,   1845,   1506,   2778,   2155,   -944,
-  -1752,      0,   1325,    159,   -628,  -2105,  -2866,  -2218,  -1985,  -1242,  -2352,  -2044,  -1280,    -53,    963,    543,
-    244,    758,   3172,   4289,   3916,    796,   -102,    893,     47,   -321,   -952,   -469,   -272,   -269,   -468,   -496,
-   -471,   -465,   -562,   -385,   1470,   3883,   6594,   5529,   3300,   1286,   1898,   3312,    824,   2008,   2198,    588,
-   -325,   -355,  -1772,  -4240,  -2635,  -2885,  -2634,  -1440,  -1424,   -895,    297,   -247,  -1550,  -1733,   -963,   1262,
-    648,    855,    976,    -28,    682,   1552,   1615,   2092,   1471,  -1570,   -233,   1780,   1649,    241,     64,    757,
-   -733,   -747,  -1623,  -2028,  -2227,  -2237,  -2274,  -2051,  -2480,  -3083,   -110,   -280,   -968,    212,   1053,   1696,
-   2416,   3100,   2492,   1951,    136,  -1563,    802,   2570,    127,     54,    -89,   -783,    318,     12,    435,    985,
-   1124,   1389,    846,   -452,   -937,  -1261,   -688,   1331,   1760,   1388,   -282,   -583,   1692,    545,  -1687,     42,
-   1260,    993,   1431,    753,    166,   -543,  -1055,  -1937,  -2825,  -1097,    -55,  -1546,  -1864,  -1758,  -4785,  -5476,
-  -4031,  -3602,  -2208,  -2499,  -3355,  -2479,  -1568,  -1662,   -814,    540,    444,    626,    959,   1094,   1603,   2168,
-   2189,   2986,   3904,   3611,   3800,   2771,   1381,    425,  -2145,  -4000,  -5055,  -5654,  -5322,  -5183,  -5335,  -5378,
-  -4327,  -4753,  -5205,  -3904,  -3810,  -4127,  -4351,  -3909,  -1649,    351,     14,    433,   1111,   -706,  -1889,  -1475,
-   -818,    734,   1858,   -517,  -2897,  -1400,   -251,  -1042,   -248,    568,   -468,  -1469,  -2385,  -2856,  -2162,   -665,
-    653,    742,   -535,   -526,  -1218,  -3406,  -2559,  -3111,  -3685,  -2132,  -1778,   -384,   -580,  -1911,   -239,   1082,
-    656,    349,   -907,  -1155,   -213,    819,   1045,   -590,   -633,   -587,     44,    830,    929,   1511,    811,    716,
-    645,   -477,  -1545,   -986,    -79,    755,   1029,    155,    166,    500,     46,   -343,    781,   1059,    613,    444,
-   -685,  -1129,    820,   1910,     16,  -1250,    456,    628,  -1056,     20,     49,    282,   2219,   1318,    232,   1596,
-   1111,    232,    853,    284,   1100,   1406,   2978,   5623,   4430,   2885,   1797,   1342,    974,   -168,  -1075,  -1101,
-     21,    -68,  -1006,  -1270,   -613,    841,   1891,   2838,   3361,   2718,   2578,   2291,   1842,   2776,   2941,   3099,
-   2606,   1540,   2510,   2746,   2548,   2822,    985,   -412,    990,   1607,    383,   -277,    901,      5,  -1797,  -1173,
-   -281,   1339,   2436,   2318,   2145,   3552,   4399,   3250,   2383,   1951,    652,  -1033,  -1183,  -1692,  -2176,  -3174,
-  -3331,  -1632,  -1838,  -1476,    476,   1283,   1853,   2520,   2528,   3672,   3914,   2630,   2859,   1778,   -454,   -141,
-    488,   -625,  -1239,  -1529,  -1859,  -1782,  -2259,  -2556,  -1419,     50,    417,   1450,   2341,   2185,   1258,    851,
-   1897,   2327,   3225,   4324,   3997,   3286,   3830,   4103,   3933,   3824,   3379,   2184,    613,   1082,   1807,   2349,
-   1445,   -210,  -1018,  -2049,  -1479,  -1476,  -1949,   -570,    877,   1182,    660,  -1185,  -2561,  -2102,  -2245,  -1959,
-  -1562,  -1549,   -767,   -542,    507,   2846,   2635,    904,   1088,    260,  -1518,  -1479,  -1392,  -1655,   -906,     51,
-    324,   -145,   -265,   -117,    175,    943,   -348,  -1020,    232,     69,  -1168,  -2523,  -3093,  -3424,  -3902,  -2808,
-  -2601,  -4222,  -4001,  -4181,  -3834,  -1476,   -664,    195,   1075,    243,    487,   1398,    435,    387,   1046,   1160,
-    356,  -1228,  -1058,  -1271,  -1512,   -679,   -943,  -1544,  -1246,   -521,   -563,   -606,   -386,   -778,   -810,   -800,
-    244,   2064,   1808,   1831,   1862,    531,   1069,   1296,    129,  -1170,  -3268,  -3197,  -2700,  -3996,  -3063,  -2086,
-  -2854,  -1983,  -1351,   -985,      6,   -361,  -1072,   -907,    -37,    897,   1108,    630,   -229,   -819,   1040,   1668,
-   -736,  -1479,  -1923,  -1985,   -585,   -248,   -485,  -1015,  -1794,  -1010,     42,    169,    830,    597,   -792,  -1236,
-  -2754,  -3264,  -1824,  -2443,  -2443,  -1729,  -1999,  -1534,  -1097,  -2372,  -3347,  -2485,  -2469,  -1941,    412,   1466,
-   1737,   1468,   1182,   3194,   4800,   4371,   3242,   2100,   2311,   3049,   2750,   2437,   1323,    -58,   -723,  -1573,
-   -890,   1012,   1044,   -334,  -1129,  -1050,   1097,   2470,    805,   -338,   -344,   -368,    431,    563,   -262,    531,
-    893,    812,   1604,   1133,   -577,   -867,    694,   1394,   1817,   1826,    566,   -195,   -483,     64,    798,    497,
-   1425,   1875,    970,   1396,   1850,   1904,   1955,   2038,   1918,   1071,  -1238,  -2336,  -1212,  -1170,   -912,   -143,
-    472,    287,   -533,   -365,   -304,  -1034,   -870,    344,   -779,  -3465,  -4005,  -3122,  -2835,  -2395,   -647,   1206,
-   1587,    851,   1791,   3309,   1992,   1662,   2124,   1226,   1990,   1851,   1022,   1842,   2292,   1676,    864,    435,
-    195,    490,    184,    -36,   -770,  -2600,  -2184,  -1587,  -2654,  -3116,  -3406,  -3353,  -2643,  -2096,  -1729,  -1647,
-  -1532,  -2780,  -2640,   -261,    514,   1269,   2276,   2028,   2764,   3087,   1224,   1662,   3398,   3122,   2094,   1791,
-   2363,   2482,   1170,    335,    636,    838,    993,   1023,    373,  -2235,  -3901,  -2715,  -2109,  -2144,  -2681,  -3380,
-  -2054,  -1374,   -649,    298,   -783,   -345,    752,    161,    815,   1529,    578,   1017,   1811,   2107,   2522,   2082,
-   1484,   1233,    670,    282,    168,   -636,   -611,   -364,   -944,  -1296,  -2478,  -3856,  -3648,  -1821,   -846,  -2769,
-  -3271,  -1474,   -621,    910,   2087,    731,    966,   2469,   1646,   1412,   1932,   1647,   1080,    499,    371,   -894,
-  -1172,   -397,  -2398,  -3262,  -1620,  -1666,  -2429,  -2213,  -1868,   -810,    654,    190,   -890,     84,    900,    343,
-    199,    533,    738,   1058,   1694,   1823,   1355,    805,    403,    133,    514,    814,   -595,  -1879,  -1130,   -728,
-  -1380,   -734,   -127,   -801,  -1351,  -1110,   -736,   -218,    404,   -149,  -1127,  -1128,  -1292,  -2801,  -2699,   -601,
-   -631,  -1850,  -1904,  -1864,  -1598,   -806,    377,   1402,   -144,  -1411,    238,   1373,   1797,   1455,   -424,   -736,
-    719,   1652,   2063,   1827,   1439,    970,    923,   1532,    852,   -149,   -529,   -428,    553,    279,   -564,   -689,
-  -1350,   -188,    983,    839,   1574,    398,   -923,   -184,    -81,    804,   2290,   1492,    564,      6,  -1101,   -804,
-   -341,  -1147,  -1022,     62,    320,     48,    125,    799,   1188,    619,    366,    476,    326,    127,   -798,  -1234,
-   -295,    388,    759,    897,    469,    528,    -16,  -1275,  -1407,  -1313,   -135,   1382,    549,     56,    534,    744,
-   1571,   1599,   1044,   1172,   1543,   2480,   2891,   1474,   1001,   1422,    415,    399,   1143,   -416,  -1968,  -1222,
-   -678,   -684,   -956,  -1671,   -830,    641,   1043,   1377,   1381,    424,   -370,   -265,    262,    625,   1650,   2224,
-    743,   -114,    763,   1160,    569,     98,    335,   1146,   1297,    560,    502,   1762,   1993,    977,   1063,    886,
-   1156,   2686,   2708,   2536,   2479,   1296,   1329,   1221,   -211,   -242,    625,    812,   1277,   1360,    614,    547,
-    317,   -471,   -339,    705,   1331,   1553,    589,   -958,   -530,    440,    541,    496,    778,   1346,   1361,   1771,
-   2463,   1750,   2225,   3148,   2633,   2689,    758,  -1998,   -962,    440,    569,   1591,   1469,    354,    403,    607,
-    408,    -45,   -683,  -1213,  -2149,  -1845,   -324,   -436,   -626,    331,    493,    495,    784,    965,   1193,   1551,
-   2338,   1779,    984,   1432,    810,    282,    857,   -614,  -1345,    129,   -846,  -1751,   -478,   -666,  -2197,  -3315,
-  -4070,  -3760,  -3208,  -2581,  -1932,  -2255,  -2177,  -1427,  -1304,  -1594,  -1223,    -87,    523,    102,    588,   1343,
-   1107,    367,    242,    900,    400,   -249,     20,    184,    -73,   -511,   -722,   -858,  -1447,  -1547,  -1313,  -2088,
-  -3327,  -3594,  -2681,  -2673,  -3518,  -3073,  -2782,  -3571,  -2718,  -1526,  -1849,  -1373,    338,   1048,     93,   -767,
-   -383,    248,    341,    581,   -272,  -1849,  -1994,  -2197,  -2804,  -2371,  -2366,  -3598,  -4213,  -3592,  -3609,  -4015,
-  -3663,  -3557,  -2860,  -1355,   -673,   -417,     10,   -206,    492,   1369,    800,   1126,   1031,    235,   1163,   1129,
-   -568,   -635,    -38,   -496,  -1017,  -1392,  -2260,  -2040,  -1580,  -2943,  -3583,  -3170,  -3845,  -3842,  -3236,  -3434,
-  -2877,  -2392,  -2490,  -2720,  -2874,  -2186,  -1405,  -1583,   -532,    830,    482,    191,    895,   2123,   2470,   2520,
-   1799,    889,   1722,   1933,    390,   -541,   -564,    931,    889,  -1742,  -2084,  -1788,  -2221,  -1764,   -668,   -705,
-  -1709,   -838,    937,    779,    670,    188,   -858,   -118,    168,    535,   1336,    908,    -84,   -415,    231,    814,
-    872,    884,    -88,  -1091,    128,   1302,    936,    646,   1190,   1716,   2255,   2512,   2285,   2045,   1974,   2086,
-   1578,   1090,    797,   1257,   1399,    560,   1448,   2626,   2071,   2646,   3739,   3166,   3054,   2591,   2000,   2675,
-   2797,   1849,   1252,   1311,    821,    169,    474,    681,    368,   1346,   1666,    757,   1933,   2764,   1942,   2886,
-   3746,   3157,   3278,   3465,   3315,   2438,   1441,   1865,   1636,    742,   1077,   1683,   1055,   -667,  -1260,   -539,
-   -667,   -824,     -9,    353,    -15,    -66,    134,   -962,  -1478,   -507,   -445,    -60,   1551,   2209,   2220,   2792,
-   2959,   3228,   3330,   2550,   1723,   1496,   1636,   1860,   2050,   1846,    816,    343,   1145,    602,    289,    594,
-   -381,   -595,    698,   1754,    858,   -774,   -420,    516,    668,   1321,   1332,   1066,   1501,   1244,    545,    285,
-    201,    298,    288,    -71,    246,    394,   -170,    223,    174,   -932,  -1035,  -1629,  -2643,  -2042,  -1630,  -1637,
-   -895,   -371,    365,   1120,    670,    492,    736,     31,    133,   1880,   2813,   2631,   3099,   3364,   2703,   2326,
-   2247,   1682,    807,    565,    161,   -861,  -1499,  -1615,  -1612,  -1692,  -1885,  -1857,  -1116,    198,    493,   -157,
-    119,   -650,  -1883,   -942,    -19,    223,    658,    100,  -1157,  -1658,   -845,   -127,   -563,   -424,   -640,  -1646,
-   -840,   -351,  -1496,  -1439,  -1482,  -1523,   -335,  -1098,  -2301,  -2138,  -2530,  -2295,  -1678,  -1036,    448,    601,
-    -45,    609,   1027,     -3,  -1189,  -1628,  -1699,  -1055,   -686,  -1601,  -1712,  -1554,  -1964,   -988,   -279,   -492,
-   -222,   -788,  -1487,  -1384,   -914,   -365,   -669,  -1502,  -2112,  -1970,  -1311,   -696,   -163,   -332,   -849,   -929,
-   -623,   -192,   -917,  -1962,  -1519,   -733,   -244,    -90,   -524,  -1112,  -1633,  -1377,   -536,   -753,  -2227,  -2841,
-  -1945,  -2383,  -2956,  -1783,  -1708,  -2162,  -1922,  -1789,  -1944,  -2847,  -3333,  -3065,  -2912,  -2093,  -1073,   -952,
-   -999,   -440,   -652,  -1033,    147,     82,  -1179,  -1007,   -795,  -1329,  -1797,  -2004,  -2436,  -2939,  -2169,  -1308,
-  -1236,  -1131,  -1164,   -829,   -133,    154,    435,   1623,   2324,   1863,   2120,   2233,   1322,    997,   1133,   1125,
-   1434,   1875,   1548,    529,   -332,  -1380,  -1730,  -1483,  -2072,  -1796,  -1271,  -1565,  -1080,   -989,  -2106,  -2398,
-  -1537,  -1687,  -2138,   -881,    -22,    241,    999,    731,    863,   1314,    802,   1168,   1229,    782,   1650,   1757,
-   1008,    948,    923,    713,    788,   1728,   1307,    311,   1669,   1810,    928,   1414,   1539,   2356,   2694,   1492,
-   1736,   1844,    778,    461,    216,    202,     10,  -1030,  -1134,   -508,     74,    604,    707,   1052,   1152,    501,
-   1029,   1881,   1204,   1121,   1551,   1259,    906,   -156,  -1039,  -1037,  -1208,   -543,    272,   -486,   -665,   -245,
-  -1309,  -1675,   -609,    114,   1092,   2575,   2801,   1709,   1936,   2943,   2677,   2198,   2526,   2688,   1863,   1757,
-   2476,   2351,   2365,   2585,   2119,   1641,   1612,   1525,   1124,   1827,   2651,   1955,   1904,   2269,   1502,   1133,
-   1444,   1240,    357,   -890,  -1244,   -382,   -671,  -1525,   -847,   -538,   -895,   -725,   -465,    -56,    415,   1016,
-   1516,   2099,   2605,   1791,   1310,   1821,   1788,   1726,   1463,   1045,   1052,    322,    225,   1269,    715,     67,
-    681,    543,     98,   -110,   -318,    285,    877,    696,    273,     85,    553,    619,    424,    663,    489,    792,
-   1441,   1125,    227,   -503,    -76,    581,    165,    -51,    646,   1082,   -183,  -1378,   -955,  -1137,  -1376,   -852,
-   -813,   -671,   -479,   -682,   -805,   -834,   -801,   -539,   -360,   -222,    147,    472,    619,    788,    726,    -16,
-   -625,   -820,   -906,  -1154,  -1847,  -2117,  -1840,  -1190,   -966,  -1750,  -1439,   -412,   -882,  -1353,  -1386,  -1862,
-  -1356,   -273,   -270,  -1176,  -1068,   -152,   -666,   -601,    235,   -895,  -1774,  -1039,   -317,    -99,   -229,   -769,
-  -2375,  -2249,   -783,  -2418,  -2768,  -1209,  -1916,  -1360,    -97,   -315,   -132,   -139,   -473,   -791,  -1151,   -846,
-     20,   1029,    799,    117,    780,    854,    533,    735,    800,    778,   -152,   -600,   -356,   -787,   -412,    678,
-    783,   -650,  -1882,  -1499,  -1200,  -1719,  -2279,  -2191,  -1727,  -2144,  -2146,  -1012,   -999,  -1520,   -956,   -428,
-   -486,   -608,     85,   1204,    514,  -1016,   -976,   -286,    -75,    318,    628,     68,   -558,   -285,    466,    464,
-    325,    929,    735,    305,    837,    527,   -387,   -638,   -813,   -198,   1033,   1487,   1447,   1462,   1947,   1705,
-    424,   -137,   -856,  -1600,  -1006,   -841,  -1952,  -2095,   -677,   -440,  -1022,   -582,   -683,   -754,   -367,   -568,
-   -456,   -890,  -1498,   -396,    270,   -532,   -720,   -165,    287,    291,     53,   -161,    309,   1505,   1596,   1559,
-   2075,   1372,    336,     48,    193,    670,   1086,   1569,   1743,    923,    616,    814,    319,    387,    856,    265,
-   -302,   -166,   -258,   -468,   -330,    155,   -109,   -499,    485,    905,     -1,   -328,    409,    829,   1182,   1974,
-   1839,   1267,   1545,   1901,   1440,   1672,   2149,   1087,    541,   1048,   1243,   1601,   2044,   2017,    905,   -531,
-    440,   1272,   -163,   -337,   -635,  -1455,   -992,  -1399,  -1558,   -732,   -344,   -125,   -154,   -111,   -254,   -138,
-    768,    826,    585,   1104,   1295,   1120,   1449,   1232,     59,     84,    332,   -315,    102,    669,    195,   -292,
-   -240,     29,    -32,    263,    449,     75,    105,   -395,   -784,   -207,     -1,     12,    207,    395,    354,    -96,
-   -293,    -17,    619,   1603,   1392,    354,    229,    245,   -353,  -1274,   -575,   1085,     98,  -1298,   -523,   -290,
-   -257,    167,    210,    507,   -260,   -253,    685,    292,    532,   1147,    782,    415,   1058,    514,  -1281,  -1332,
-   -794,   -571,   -463,   -536,   -933,  -1755,  -2073,  -2540,  -2775,  -1813,  -1938,  -2452,  -1097,   -388,   -643,   -897,
-  -1794,  -1340,    371,    422,     79,   1015,    664,   -272,    256,    814,    873,   1053,   1528,   1319,    164,  -1302,
-  -2434,  -2197,  -1202,   -680,   -944,  -1042,   -671,  -1086,  -1498,  -1239,  -1520,  -1535,   -853,   -790,   -816,   -260,
-   -125,   -760,   -664,   -266,   -710,   -765,   -260,    924,   1667,    963,   1031,   1632,   1209,     93,   -187,    237,
-   -337,   -888,   -440,    -67,   -550,  -1143,   -685,   -389,  -1426,  -1383,   -255,    -50,    320,    537,    228,   -347,
-   -736,   -261,   -741,   -873,    -51,    -95,    301,   -245,  -1413,  -1031,   -953,   -875,   -602,    103,    715,   -373,
-   -498,   -283,   -494,     63,    267,    757,   1112,    977,    912,    594,    709,    182,  -1390,  -1343,   -984,  -1371,
-   -824,   -897,  -1388,  -1353,   -779,    568,   1223,   1274,   1184,    584,    851,   1365,     50,   -322,    435,     76,
-    344,    547,      9,   -380,   -243,    351,    692,   1546,   1532,    473,    412,     33,   -377,    110,    616,    910,
-    484,    341,    691,   1048,   2140,   2340,   1546,   1099,    814,   1139,    931,     66,    466,   1553,   2370,   2269,
-   1272,    807,    999,    872,    539,   1248,   1344,    506,   1801,   2826,   2094,   1876,   1111,   -159,    -59,   1019,
-    693,    357,   1738,   1640,   1299,   1708,    875,    649,    990,   1267,   1769,   1544,   1417,   1199,    686,   1099,
-    667,     -7,    507,    422,    674,    453,   -604,    -72,   -148,  -1045,   -602,   -955,  -1550,   -907,  -1122,  -1490,
-  -1132,   -771,   -476,   -221,   -468,  -1307,  -1688,  -1501,   -480,    355,    544,    390,     -2,    -91,   -664,     30,
-   1256,   1062,    854,    825,    503,    484,   1249,   1074,   1085,   1496,   1064,   1418,   1482,   1157,   1007,    708,
-    730,    635,    300,     60,    287,    -91,   -679,   -838,  -2005,  -2225,  -1723,  -2488,  -2099,  -1244,  -1595,  -1600,
-  -1085,   -442,   -271,   -566,   -497,    -93,    486,    685,    451,    100,   -243,   -296,   -386,   -661,   -400,     56,
-     75,    199,   -504,   -808,    -70,   -725,   -294,    573,   -383,   -637,   -823,  -1149,   -784,   -830,  -1878,  -2639,
-  -2222,  -2433,  -2809,  -2383,  -2062,  -1872,  -1624,  -1213,  -1180,   -924,   -607,  -1010,   -628,    -75,    -77,   -382,
-  -1044,  -1211,  -1223,  -1037,   -811,   -711,   -674,  -1403,  -1064,    -41,   -930,  -1503,   -958,  -1769,  -2253,  -1699,
-  -2003,  -2066,  -1990,  -1678,   -494,   -562,   -782,    -97,   -426,   -945,  -1024,  -1084,   -762,   -576,   -311,     94,
-    132,     93,   -361,   -846,   -613,    -86,    457,    825,    472,   -440,   -435,      1,   -717,  -1078,   -337,   -287,
-   -824,   -863,   -942,   -974,   -501,   -325,   -527,   -904,  -1398,  -1494,  -1307,   -720,   -174,   -308,   -214,     11,
-      6,    352,    779,    848,    460,     14,   -140,   -490,   -720,   -590,   -280,     92,    -65,    169,    598,    456,
-    783,    789,    438,    612,    713,    767,    891,    887,    939,    956,   1006,   1443,   1384,   1212,   1280,    952,
-   1024,   1151,   1276,   1406,   1075,    564,     87,    526,    896,    -73,   -615,   -244,   -603,   -743,    -16,    -91,
-   -211,    754,   1222,    867,    959,    482,    363,   1345,    922,    395,    892,    970,    713,    647,    612,    623,
-    405,   -383,     60,    876,    586,   1354,   2199,   2141,   2153,   1888,   2029,   1991,   1784,   1700,   1041,   1239,
-   1597,   1568,   1897,   1764,   1482,   1307,   1481,   1678,   1536,   1850,   2009,   1950,   2097,   1994,   1475,    734,
-    395,    255,     84,    365,    473,    145,    285,    252,    -59,    711,   1257,    956,   1482,   2409,   2164,   1615,
-   2313,   1958,    802,   1241,   1384,    917,    757,    789,    810,    373,    -26,    -91,    -82,   -148,     56,    246,
-    398,    733,    622,    221,   -167,     -7,    368,    543,   1138,   1564,   1488,   1126,   1413,   1998,   1118,    813,
-   1365,    602,    452,    683,    -80,    -96,   -485,  -1512,  -1582,  -1339,   -369,    298,   -163,    324,    880,    165,
-   -137,    409,    662,    347,     97,    682,    801,    198,    718,    556,   -574,   -712,   -558,   -286,   -595,   -908,
-   -887,  -1894,  -2012,  -1721,  -1701,   -334,    178,   -286,   -120,    152,    501,    285,    -59,    332,    682,    822,
-    104,  -1515,  -1905,  -1152,  -1012,  -1570,  -1522,   -717,  -1170,  -2011,  -1633,  -1361,  -1327,   -718,    343,    131,
-  -1143,   -617,    523,    125,   -548,   -699,   -718,   -786,   -784,  -1246,  -2226,  -1687,   -732,  -1836,  -2179,  -1234,
-  -1743,  -2265,  -1673,  -1122,  -1485,  -1215,     20,   -753,  -1166,    -12,   -588,  -1382,   -659,     -1,   -689,  -1506,
-  -1049,  -1025,  -1549,  -1281,  -1660,  -2289,  -1685,  -1784,  -2606,  -2106,  -1599,  -1931,  -1342,   -386,   -675,  -1169,
-   -945,   -749,   -656,   -481,   -642,   -323,    545,     94,   -785,   -443,    -21,   -348,   -708,   -639,  -1244,  -2177,
-  -1869,  -1346,  -1864,  -2099,  -1077,   -884,  -1587,  -1761,  -1947,  -1465,   -397,     57,   -302,   -507,   -289,   -671,
-  -1090,  -1449,  -1419,   -693,   -286,   -511,  -1045,   -556,    -92,   -796,   -843,   -534,   -568,   -324,   -118,   -342,
-   -484,   -406,   -227,    457,    433,    -78,    349,    404,    -24,    -80,    148,    279,     44,     48,    704,   1704,
-   1327,    189,      5,   -667,  -1141,   -577,   -668,   -844,     98,    630,    185,     84,    -58,    -93,     45,   -153,
-   -499,  -1139,  -1137,   -701,   -554,   -487,   -223,    320,    416,    404,    337,    161,    134,     22,     65,     28,
-     69,    272,     84,   -341,   -623,   -725,   -697,   -458,     43,    941,   1211,    795,   1150,   1396,    907,    744,
-    797,    613,    816,   1369,   1291,    725,    587,    575,    225,    365,    793,    689,    621,    615,    156,   -366,
-    -79,    815,   1001,    985,   1541,   1952,   1925,   1468,   1056,    790,    498,    436,    268,    255,    428,    604,
-    972,   1091,   1191,   1502,   1711,   1783,   1397,    655,    666,    706,    305,    978,   1698,   1701,   1902,   1745,
-   1319,    931,    524,    628,   1017,    843,    456,    597,    611,    725,   1167,   1321,   1497,   1313,    740,    491,
-    791,   1438,   1571,   1664,   2010,   1928,   1842,   1872,   1664,   1276,    866,    409,    171,     35,   -119,     65,
-     11,    291,   1363,   1847,   1798,   1711,   1409,    879,    355,    368,    467,    369,    532,    528,    297,    433,
-    747,    836,   1005,   1167,   1158,    973,    534,    588,    741,    446,    456,    512,    371,    230,    154,    294,
-    249,    510,    843,    464,    359,    235,    -28,    106,     81,    233,    521,    418,    125,   -228,   -513,   -720,
-   -814,   -611,   -511,   -507,   -435,   -482,   -440,   -479,   -509,   -447,   -450,   -222,    -32,    207,    659,    689,
-    406,    182,     15,    108,    220,     18,   -104,   -406,   -793,   -764,   -675,   -489,   -237,     13,    185,     11,
-   -487,  -1021,  -1193,  -1181,  -1012,   -656,   -670,   -980,  -1156,  -1364,  -1519,  -1301,   -972,   -844,   -999,  -1080,
-   -895,   -766,   -656,   -616,   -523,   -286,      9,    250,    187,    108,   -133,   -505,   -517,   -488,   -544,   -596,
-   -715,   -974,  -1229,  -1061,   -750,   -553,   -515,   -583,   -715,   -928,   -764,   -601,   -652,   -596,   -712,   -825,
-   -672,   -395,   -163,   -215,   -356,   -477,   -360,     29,    250,    367,    230,     61,    175,    320,    524,    798,
-    880,    768,    572,    287,    120,     48,   -205,   -561,   -766,   -916,  -1028,   -912,   -740,   -662,   -566,   -544,
-   -527,   -534,   -751,   -866,   -894,   -916,   -920,  -1030,  -1014,   -997,  -1086,  -1070,   -938,   -675,   -264,     69,
-     11,   -184,   -371,   -532,   -354,     22,    405,    523,    191,    -84,   -200,   -346,   -201,    222,    460,    536,
-    587,    476,    282,    199,    244,    307,    192,    -51,   -345,   -701,   -707,   -552,   -616,   -787,  -1005,   -986,
-   -821,   -693,   -669,   -847,   -871,   -586,   -171,     47,    -46,   -369,   -754,   -818,   -529,   -221,   -219,   -386,
-   -552,   -828,  -1002,   -856,   -720,   -784,   -790,   -619,   -277,    115,    291,    208,    -24,   -281,   -284,   -120,
-    102,    622,   1097,   1200,   1088,    726,    364,    335,    339,    201,    114,      6,   -268,   -674,  -1048,  -1221,
-  -1067,   -512,     35,    289,    405,    475,    618,    743,    956,   1159,    962,    525,     60,    -94,    200,    576,
-    697,    386,    -45,   -405,   -612,   -457,   -231,   -140,    -32,    181,    417,    557,    499,    140,   -202,   -124,
-    230,    584,    622,    179,   -343,   -547,   -449,   -173,    225,    442,    271,   -113,   -405,   -319,     88,    684,
-   1165,   1097,    714,    464,    418,    408,    296,    213,    111,     60,    124,    -47,   -348,   -511,   -609,   -628,
-   -291,    280,    515,    288,    -90,   -202,    -40,    201,    359,    238,    133,    157,     53,   -193,   -488,   -674,
-   -628,   -353,   -127,   -223,   -485,   -590,   -282,    354,    909,   1000,    652,    303,    174,    181,    298,    558,
-    528,   -126,   -945,  -1473,  -1370,   -670,     69,    429,    480,    595,    686,    537,    292,     96,    254,    679,
-    748,    489,    280,     58,   -284,   -651,   -812,   -418,    275,    635,    569,    223,    -28,    165,    520,    950,
-   1466,   1534,    960,    140,   -367,   -125,    682,   1231,    991,    279,   -347,   -730,   -734,   -292,    265,    667,
-    734,    579,    532,    464,    172,   -207,   -463,   -403,    -93,    146,    101,   -165,   -450,   -477,   -185,    285,
-    729,    859,    788,    632,    360,    228,    352,    618,    788,    684,    391,     61,     36,    421,    685,    656,
-    628,    525,    315,    235,    263,    114,   -177,   -307,   -206,    -44,     27,    162,    279,    132,   -129,   -414,
-   -623,   -542,   -268,    140,    676,   1098,   1302,   1133,    603,     62,   -275,   -349,   -198,     29,     11,    -98,
-    -74,   -271,   -483,   -354,    -49,    339,    685,    665,    336,    208,    403,    695,    926,    945,    861,    759,
-    679,    857,   1069,   1130,   1016,    729,    439,     57,   -320,   -479,   -415,   -162,    270,    669,    631,    173,
-   -326,   -709,   -870,   -682,   -548,   -713,   -867,   -927,   -775,   -313,    250,    756,    994,    898,    852,    904,
-    837,    760,    534,    170,      7,     66,    294,    649,    971,   1170,   1106,    746,    304,    -92,   -218,   -119,
-    -12,    169,    304,    397,    508,    534,    498,    315,    127,    -78,   -536,   -903,  -1051,  -1121,   -949,   -512,
-    -18,    393,    686,    676,    505,    537,    571,    368,    -17,   -488,   -876,  -1007,   -881,   -546,    -80,    294,
-    406,    294,    131,      6,      6,    192,    367,    362,    174,   -145,   -403,   -456,   -332,   -220,   -150,    -60,
-   -160,   -406,   -608,   -738,   -719,   -536,   -230,    -10,   -145,   -533,   -802,   -779,   -471,    -49,    -35,   -480,
-   -900,  -1031,   -976,   -876,   -768,   -792,   -835,   -793,   -689,   -507,   -325,   -103,    154,    350,    375,    222,
-     91,    -86,   -386,   -580,   -704,   -712,   -509,   -392,   -478,   -563,   -620,   -802,   -864,   -701,   -657,   -692,
-   -527,   -355,   -403,   -440,   -439,   -481,   -511,   -548,   -535,   -514,   -593,   -573,   -512,   -546,   -450,   -286,
-     -2,    379,    523,    470,    315,     51,   -307,   -518,   -506,   -625,   -855,  -1007,  -1093,  -1081,   -904,   -665,
-   -502,   -347,   -159,    -30,   -110,   -367,   -574,   -729,   -858,   -910,   -850,   -881,  -1111,  -1203,  -1236,  -1330,
-  -1270,  -1087,   -909,   -804,   -764,   -698,   -520,   -322,   -346,   -563,   -697,   -808,  -1045,  -1174,  -1092,   -818,
-   -415,   -189,   -219,   -457,   -766,   -837,   -740,   -630,   -553,   -594,   -578,   -418,   -279,   -255,   -161,    -58,
-   -140,   -187,   -208,   -289,   -438,   -595,   -569,   -277,     93,    238,    113,   -131,   -216,    -97,     20,     48,
-    143,    390,    567,    675,    676,    517,    443,    473,    486,    424,    370,    339,    191,     12,   -217,   -450,
-   -581,   -683,   -625,   -324,   -103,   -128,    -72,     42,     51,    105,     94,     67,     88,    -24,   -177,   -181,
-    120,    448,    540,    596,    558,    440,    525,    783,    997,   1085,   1117,   1197,   1260,   1218,   1050,    822,
-    573,    371,    254,    122,    -36,   -245,   -300,    -45,    322,    668,    868,    977,   1047,   1002,    975,    897,
-    838,    928,    976,    926,    739,    564,    549,    550,    565,    549,    539,    701,    927,   1121,   1251,   1221,
-   1082,    976,    846,    646,    451,    280,    287,    292,    117,    118,    298,    474,    627,    814,    907,    821,
-    801,    890,    995,    944,    903,   1091,   1294,   1383,   1249,    943,    717,    630,    630,    620,    769,   1077,
-   1167,   1194,   1224,   1137,   1044,   1087,   1219,   1140,    970,    844,    604,    474,    558,    532,    361,    289,
-    157,    -98,   -153,    -16,    153,    217,    202,    283,    461,    747,    963,    815,    609,    563,    515,    470,
-    310,     67,    -43,     19,    136,    183,    192,    217,    284,    404,    464,    341,    158,     76,    124,    296,
-    561,    656,    541,    587,    690,    698,    738,    828,    909,    756,    509,    339,    145,     29,     15,     93,
-    113,     21,    -76,   -157,    -82,     57,     81,     -1,   -104,    -74,     19,    -20,    -56,    -24,    -34,     24,
-    172,    201,    173,    206,    222,    263,    429,    610,    606,    462,    293,    107,     -2,    -36,   -231,   -505,
-   -596,   -669,   -884,  -1065,  -1198,  -1255,  -1177,   -991,   -701,   -517,   -403,   -264,   -194,   -124,     -6,    215,
-    349,    259,    199,    148,    -93,   -540,   -936,  -1165,  -1350,  -1435,  -1462,  -1411,  -1163,   -972,   -877,   -659,
-   -444,   -393,   -436,   -476,   -508,   -469,   -515,   -636,   -777,  -1024,  -1149,  -1216,  -1270,  -1228,  -1114,   -991,
-  -1004,  -1089,  -1137,  -1157,  -1206,  -1225,  -1085,   -840,   -669,   -563,   -467,   -392,   -278,   -234,   -281,   -371,
-   -542,   -632,   -724,   -864,   -876,   -793,   -704,   -701,   -724,   -612,   -386,   -235,   -237,   -294,   -291,   -242,
-   -238,   -360,   -684,   -956,   -957,   -893,   -902,   -896,   -809,   -624,   -488,   -439,   -464,   -627,   -766,   -985,
-  -1351,  -1564,  -1571,  -1528,  -1452,  -1246,  -1048,   -915,   -793,   -823,   -902,   -862,   -746,   -631,   -618,   -619,
-   -440,   -282,   -159,     69,    181,    162,    116,     31,    -37,   -146,   -327,   -528,   -679,   -588,   -451,   -325,
-   -182,   -272,   -436,   -544,   -626,   -630,   -641,   -670,   -573,   -482,   -473,   -357,   -178,    -85,    -28,    -39,
-   -121,   -231,   -346,   -473,   -611,   -565,   -342,    -58,    172,    310,    443,    508,    485,    354,    245,    223,
-    134,     59,     56,    104,    263,    329,    178,     28,   -117,   -155,    136,    566,    859,   1075,   1248,   1377,
-   1437,   1258,   1040,    835,    530,    299,    160,     62,      7,     88,    313,    514,    640,    626,    526,    557,
-    617,    500,    428,    565,    684,    728,    748,    633,    465,    458,    609,    738,    726,    662,    605,    588,
-    714,    833,    829,    736,    518,    324,    256,    227,    179,    239,    342,    268,    159,    147,    249,    492,
-    709,    865,   1102,   1203,   1109,    986,    758,    435,    167,     26,    -75,   -205,   -348,   -371,    -96,    331,
-    655,    776,    771,    777,    758,    620,    413,    246,    165,    231,    379,    495,    550,    542,    627,    766,
-    889,   1073,   1188,   1202,   1067,    767,    471,    234,    182,    136,     -2,    -20,   -104,   -104,    173,    492,
-    704,    802,    922,   1026,   1083,   1122,   1002,    739,    482,    333,    335,    457,    625,    613,    468,    364,
-    274,    230,    255,    379,    504,    557,    571,    481,    326,    199,    166,    162,    196,    389,    492,    358,
-    172,     87,     77,     46,      0,      9,     76,     77,     46,     46,     59,    102,    156,     95,   -138,   -390,
-   -572,   -701,   -762,   -769,   -698,   -451,    -76,    289,    528,    646,    704,    724,    754,    647,    363,     95,
-   -234,   -616,   -849,   -925,   -785,   -496,   -284,   -247,   -271,   -141,     35,    116,    134,     67,    -45,   -140,
-   -238,   -284,   -312,   -475,   -710,   -795,   -819,   -944,   -970,   -916,   -793,   -558,   -370,   -174,    -55,    -92,
-   -137,   -200,   -274,   -318,   -360,   -428,   -528,   -582,   -510,   -437,   -487,   -511,   -371,    -54,    275,    418,
-    423,    307,     97,   -117,   -257,   -300,   -239,    -79,     26,    -78,   -333,   -514,   -580,   -672,   -703,   -562,
-   -472,   -423,   -384,   -460,   -536,   -546,   -537,   -569,   -622,   -666,   -718,   -732,   -569,   -254,     39,    178,
-    195,    148,     16,   -104,   -232,   -452,   -678,   -832,   -877,   -782,   -649,   -507,   -305,   -143,    -49,    -57,
-   -180,   -221,   -196,   -227,   -300,   -491,   -667,   -742,   -785,   -747,   -723,   -608,   -288,    -48,    -28,    -40,
-     14,     69,     66,     85,     36,   -197,   -383,   -454,   -498,   -500,   -498,   -412,   -101,    183,    239,    296,
-    370,    437,    623,    788,    948,   1160,   1268,   1305,   1256,   1010,    733,    412,     28,   -239,   -492,   -693,
-   -715,   -713,   -625,   -363,    -97,    135,    210,     99,    -26,    -30,    205,    490,    587,    529,    411,    246,
-      2,   -271,   -420,   -428,   -371,   -265,   -150,   -106,    -88,    -18,     55,     43,    -20,    -61,     -4,    152,
-    312,    450,    514,    453,    322,    250,    304,    279,     83,    -82,   -232,   -326,   -279,   -180,   -126,   -151,
-   -236,   -353,   -442,   -494,   -380,    -61,    202,    285,    273,    233,    260,    383,    514,    455,    198,    -31,
-   -183,   -305,   -331,   -260,   -229,   -183,    -59,     41,     99,     86,      7,     61,    254,    361,    355,    193,
-    -70,   -194,   -180,    -77,     10,     50,    140,    226,    243,    171,     58,    -47,    -82,    -95,    -75,     63,
-    242,    474,    657,    634,    555,    489,    375,    284,    236,    187,    144,     88,     -1,   -122,   -216,   -260,
-   -235,   -135,    -51,      8,     85,    245,    462,    538,    521,    579,    702,    797,    665,    315,    -69,   -443,
-   -698,   -742,   -642,   -467,   -257,    -61,    157,    424,    595,    561,    385,    195,     72,     -3,   -123,   -342,
-   -532,   -602,   -555,   -473,   -419,   -285,   -114,      5,     81,     20,    -98,   -110,    -21,    147,    232,    228,
-    175,     11,   -101,   -217,   -374,   -346,   -196,    -77,     20,    145,    206,    131,     79,     83,    134,    263,
-    336,    274,    114,   -154,   -439,   -563,   -541,   -471,   -356,   -223,   -114,     36,    205,    249,    187,     88,
-   -123,   -462,   -766,   -927,   -927,   -753,   -506,   -361,   -282,   -104,    103,    133,      0,    -87,    -77,    -74,
-    -58,     -8,     36,     40,     61,     87,     63,     25,     32,     69,    103,    191,    234,    133,    -23,   -154,
-   -243,   -249,   -205,   -268,   -349,   -329,   -256,   -135,    -76,   -167,   -271,   -297,   -245,   -137,    -99,   -186,
-   -353,   -529,   -644,   -625,   -394,   -100,    122,    341,    514,    576,    527,    437,    386,    365,    294,    115,
-    -69,   -121,    -25,    111,    188,    186,    209,    277,    311,    380,    414,    254,     51,   -128,   -294,   -331,
-   -245,     -1,    374,    662,    793,    796,    789,    803,    730,    655,    568,    395,    326,    390,    396,    348,
-    360,    524,    741,    835,    782,    553,    248,     86,     51,     11,    -16,     20,    104,    193,    237,    284,
-    442,    610,    635,    550,    485,    521,    595,    597,    484,    285,    138,    147,    232,    228,    128,     90,
-    115,    102,     84,     83,    122,    253,    327,    317,    212,     -8,   -159,   -326,   -428,   -377,   -424,   -513,
-   -541,   -540,   -457,   -339,   -192,     34,    244,    332,    413,    551,    663,    722,    690,    496,    238,     37,
-   -138,   -248,   -224,    -92,    -11,    -31,    -52,    -47,     -5,     44,     41,    -32,   -184,   -357,   -432,   -412,
-   -404,   -455,   -493,   -461,   -376,   -278,   -169,    -29,     60,     85,     85,     44,     62,    215,    399,    437,
-    255,     27,    -49,    -38,      9,     47,    -24,    -44,     47,    210,    388,    402,    236,      7,   -130,   -193,
-   -259,   -333,   -458,   -587,   -646,   -622,   -518,   -403,   -374,   -439,   -569,   -734,   -810,   -778,   -729,   -680,
-   -651,   -567,   -424,   -357,   -293,   -216,   -203,   -137,    -43,    -37,    -32,    -12,      0,    -29,   -117,   -141,
-   -163,   -265,   -343,   -377,   -388,   -414,   -464,   -503,   -539,   -520,   -408,   -318,   -271,   -223,   -233,   -234,
-   -240,   -318,   -320,   -269,   -257,   -283,   -366,   -516,   -751,   -961,  -1026,   -913,   -661,   -358,   -141,   -126,
-   -129,    -91,   -113,    -92,     15,    129,    136,    -45,   -295,   -435,   -449,   -356,   -255,   -280,   -363,   -367,
-   -278,   -145,    -11,     21,    -26,    -14,     44,     60,    -11,   -110,   -137,   -145,   -170,   -145,    -38,     74,
-     96,    124,    219,    295,    345,    368,    335,    241,    164,    167,    159,    120,     83,     -2,    -18,     76,
-     98,     36,     -8,    -15,     27,     89,     74,     10,     17,     78,    143,    220,    240,    252,    341,    383,
-    330,    244,    172,    185,    246,    202,     85,     19,     63,    238,    371,    338,    275,    273,    301,    334,
-    367,    395,    400,    404,    381,    324,    327,    323,    278,    289,    330,    377,    409,    385,    362,    316,
-    283,    365,    492,    579,    591,    555,    547,    577,    608,    623,    628,    609,    540,    447,    364,    269,
-    157,     89,     41,     17,     64,    131,    139,     81,     30,     53,    129,    180,    208,    204,    163,    163,
-    168,    148,     87,    -13,    -66,    -88,    -82,    -40,     23,    101,    132,    167,    252,    333,    353,    323,
-    299,    274,    269,    294,    246,    126,     61,     59,    134,    270,    322,    255,    126,     34,     33,     60,
-     95,    114,     64,      0,    -27,    -50,    -63,    -42,    -13,    -17,    -45,    -55,    -71,    -96,    -90,    -85,
-   -101,   -111,   -125,   -124,    -97,    -41,     34,     62,     32,      9,     17,     23,     28,     24,      2,    -21,
-    -45,    -56,    -41,    -21,     -8,     -4,    -15,    -29,    -40,    -34,    -13,     -6,    -25,    -55,    -79,    -78,
-    -54,    -33,    -32,    -39,    -44,    -41,    -28,    -24,    -28,    -34,    -33,    -27,    -28,    -24,    -17,    -13,
-    -18,    -18,    -12,    -10,    -13,    -18,    -22,    -22,    -22,    -21,    -22,    -24,    -28,    -31,    -27,    -20,
-    -14,    -12,    -11,     -8,     -7,     -8,     -8,     -7,     -6,     -5,     -6,     -6,     -6,     -5,     -3,     -3,
-     -3,     -3,     -2,     -1,     -1,      0};
+// Prepared by tools/sample_prep.py, trimmed at -60dB
+#define drum_clap_len        9338
+#define drum_clap_peak       32767
+#define drum_clap_gain       3651
+#define drum_clap_loop_start 0
+#define drum_clap_loop_end   0
+const int16_t drum_clap[] = {
+  21169, -16016, -27243,  -5595, -23004,  -9093,  17418, -16011,   -247,  26931, -10680,   5074,  21518,  22632,  28487,  11739,
+  13593,  -5544, -27452,   4184,  -6248, -16240,  -2468, -21194, -29783,  -6027, -10665,  -4608,  26489,   8736,    930,  -4032,
+ -21020,  14936,  16386, -19401, -12684,  -6976, -12046,  11877,  28081,  29590,  32767,  24160,  17871,  18923,  26496,  17243,
+   4806,   4635,  -2270,  18605,  23191,   8330,  19819,  27653,  29975,   6266,  -6018, -14120, -29315, -28506, -26307, -26870,
+ -31603, -31097, -30373, -26150, -11723,  -6525,  11663,  13112,  -2206, -25464, -28594, -18795,  -2394,  11310,   4555,   9631,
+  -1979, -15780,  -7423, -10533, -12894,   1025,   9684,   7632,   3494,   1757,  -3831,   -576,   6179,   -366,   3296,  -6776,
+ -14645,  -1614,  -1988, -10596,  -1866,   9063,  13267,  26052,  24618,  30350,  18075,  -8870,  -3310,  -5671,   3454,   6481,
+   8010,  16813,   3129, -10054, -14868, -13144, -17303, -20100, -17267, -21334, -22650, -13315,  -5966,    801,  -6879, -19154,
+ -19319, -16852,  -6959,  -6754,  -4166,  -3273,  -6533, -10109,  -5877,   9377,  15843,  28215,  22859,  15157,  25356,  25246,
+  24476,  27336,  14704,  16344,  16490,  -6550,   2702,   3236,   1329,  12493,   5964,   -491,  -4954,  -1167,  10430,  23941,
+  17490,  19510,  19115,  11737,  20835,   7543,   3876,   2552, -13660, -10244,   4767,   6721,   3757,  -1064, -19794, -20253,
+  -9328,    513,  13100,   9532,  -7227, -13150,    436,   9102,  14871,  12958,   6442,   1843,  -5534,   1115,   -935, -13999,
+ -17912,  -8837,   -765,   1957,   3660,   -410,  -1602,   9932,  23155,  21651,  16342,   8793,  -4148,  -3477,   5225,  -2024,
+  -4966, -12790, -23974, -17030, -16670, -16462,  -5503,  -6341, -11570,  -4506,  -5201,  -8167,  -8495, -10185,  -3115,  -2762,
+ -11283, -18362, -21409, -19125,  -9806,  -2889,  -6080,  -7782,  -9180, -10186,  -5693,  -3322,  -1569,   -358,  -3729,  -2712,
+  -2319,  -6232,  -6850,   -691,   5479,   2320,   6326,  11014,   3395,   -160,  -3915, -12491, -12767,  -6176,  -4503,  -4453,
+   -959,   6435,   9032,   3172,   2355,   9281,  18161,  18277,  11653,   7831,   6613,   4123,   6897,  12601,   9097,   7114,
+   9917,  15015,  12814,   1352,  -2928,   3048,   8776,   2293,  -2911,  -1058,   2751,   6484,   3453,   3017,  -1257,  -8110,
+   -886,   5983,   5468,   4482,    -89,   -767,    784,  -6593,  -8886,  -2463,   -893,  -6749,  -8517,   -424,  -2389, -11075,
+  -9906,  -8757,  -6938,  -2977,  -4733,  -7998, -11049,  -9529,  -4115,  -4311,  -3777,  -5341,  -8878,  -2774,   -838,  -2925,
+   2617,    411,  -5076,  -1680,  -6498, -11503,  -4006,  -5546,  -8206,   1512,  -1432,  -3225,   7669,  -2495,  -8313,  -2184,
+  -4587,   7519,  11909,   1528,    393,    -82,   4365,  15598,  14051,  -2908,  -8196,  -1901,  -1296,   3022,   8629,  12668,
+  16506,  14792,  10608,   1977,   1234,  17371,  25849,  23110,  20806,  16351,  15244,  13598,   8553,   7958,   4851,   2068,
+   3046,   3791,   4170,   1032,   -960,   2079,   7077,   8420,   8107,  11250,  13335,   8244,   7278,  18093,  17748,   6645,
+  -1651,  -6731,  -3623,  -2935,  -5987,  -2088,   -451,  -3676,   -485,    310,  -4522,  -8761, -13154,  -9627,    115,   2798,
+  -1262,   1293,   4686,   -625,  -1606,   -720,  -1933,   2136,   4045,    591,   -501,   -103,   -758,   -918,  -2658,   1490,
+   3947,  -6233, -11350,  -8387,  -8686,  -7872,  -6619, -11596, -16120, -16776, -15909, -13500, -10418,  -6982,  -8554, -10862,
+ -13622, -21440, -22391, -14797, -10772,  -5151,   5626,   1347,  -4506,  -4223,  -8763,  -8478,  -7073,  -7267,  -6763,  -4987,
+  -9848, -14815, -12611,  -6317,  -2253,  -4101,   -504,  -3885,  -5317,  12016,  24926,  19210,  14183,   1319, -25434, -27052,
+ -22861, -29680, -29385, -26211, -25645, -29189, -21940,   8516,  23278,   9240, -11389, -28114, -31167, -15802, -11978, -16069,
+ -20824, -31280, -18941, -10543,  11463,  24595,  15761,  15897,  13061,  19961,  30596,  30652,  29840,  32068,  32546,  30949,
+  24123,  21019,  18753,  14571,  12650,   8260,    107,  -1786,   2762,   3299,  -9738, -12790, -12437, -21256, -14804,  -5525,
+  -5328, -15645, -19225,  -8661,   4579,   6329,   3411,  10824,  19973,  19980,   1856,   -977,  15498,   8823,   1252,  13463,
+  26974,  31083,  32546,  25215,   6933,   6943,  20082,  31296,  30917,  24092,   7804,  -5775, -18085, -15669,  -5682,   3009,
+   2696,   3556,   5111,   3923,   4207,   7626,   6347,  13046,  26008,  18625,   8063,  -4573, -16676, -14731, -15960, -19921,
+ -12493,  -1052,   9468,  10594,   3668,   2046,  -7466,  -4075,  10105,  20056,  26840,  18815,   4434,  -9970, -12785,   5228,
+  17411,   5107,  -5755,  -4635,  -4368, -15266, -28741, -17780,    668,   8827,   7542,    303,  -8778, -10049,  -9726,  -2786,
+  12332,   6543,   5985,  10744,   7836,  12624,  13999,  10496,  -1004,  -5039,  -4505,  -7463,   8203,  13385,    237,   1635,
+   7322,  13245,  21920,  12584,  -3825,  -8729, -21141, -30387, -27122, -17920,  -5832,    682,  -1163,    -67,  -2093, -12411,
+ -12221,  -2377,  15047,  16195,   2017,    595,   2021,   2534,  -3345, -18559, -29634, -32730, -31198, -22317, -17096, -14311,
+ -13077, -15375, -20950, -13558,   3881,   7684,   4370,    728,  -4235,   3284,  15460,  13532,   5182,  -1410, -10679, -11237,
+  -4157,  -3890,  -6289, -15241, -24202, -24839, -24628, -21874, -18197, -13748,  -5948,  -4487,  -7117, -10993, -11861,  -8653,
+  -9607, -13264, -11744,  -9093,  -7293,   -758,   2266,   3602,   2068,   6484,  11346,   8125,   8279,   5645,   2157,   -240,
+  -6622, -10824, -13956, -15569, -12737, -16910, -14946, -10138,  -8480,  -3750,  -5224,  -9984, -11185,  -6726,  -4758,  -5854,
+  -4574,  -5957,  -6189,  -1090,  -2399,   3205,  12945,   9837,   8983,   4296,  -3785,  -2822,    -72,   2412,  -1474,  -5588,
+  -3071,   1373,   6654,   9767,  10356,   7979,   6214,   9498,   7465,   -666,    457,   5347,   7697,   3382,   5606,   1876,
+  -3573,   6537,   2048,   4214,   9391,  -1991,  -6543,  -3227,  -2255,  -6566,  -1994,   5706,   4502,   6349,   4890,   4314,
+   2638,  -3722,  -2541,   1956,   2267,   -573,   3564,    223,    -90,  10105,   7767,  10583,   7025,   -158,   -615,  -1022,
+    918,  -3480,   5846,  12134,  18237,  21680,  15710,  19022,   9134,   8050,  13485,  11235,  15576,  17487,   9706,   4401,
+   8942,   7153,  14601,  18829,   8180,   7745,  -1873,  -5117,  -5835, -14489,  -5824,   5008,  20329,  19905,  18469,  20478,
+  12114,  21515,  20090,  11231,  19782,  22696,  11914,  11248,  15923,  17837,  21396,  21381,   5794, -14862, -17787,  -4687,
+  10086,  11984,   9041,   5311,  -1927,  -4142, -10068,  -7592,  -1788,  -6458, -15400, -18398, -11439, -14693, -15825,  -8987,
+ -10603, -21179, -17531,  -7928,  -2939,   4601,   4506,  10306,  23708,  29856,  31356,  29847,  30228,  29563,  27523,  29496,
+  27973,  26653,  22366,  13181,   5441,   4718,   1067,  -8679, -14202, -21388, -20432, -20967, -22712, -20629, -18079, -14304,
+ -10279,   2589,   4836,    -74,  -8797, -13760,  -5756, -17151, -17922,  -6979, -17646, -19087, -15834, -19264, -18343, -10474,
+  -4643,  -4662,  -7335,  -1611,   8893,  10500,  12796,  15683,  17060,  14791,  11755,   5288,   8544,   7210,   4484,   6130,
+  -6327,  -6227, -11661, -14325, -16266, -26253, -21654, -19459, -15272, -10119, -10665,  -5058,  -1300,  -5162,  -4060,  -2560,
+  -2655,   4273,   3445,    164,  -3778,  -7022,  -8735,  -2351,   5785,   3942,   7266,   4193,   2310,  -5737,  -4999, -12293,
+ -12160,  -5422, -11317,   7629,   1528,  -7207, -15163, -23035,    516,   7228,   3367,  -4872, -20960, -22188, -14064, -18305,
+ -20753, -11653, -25548, -18573,    268,    592,  -3374,   4138,   9261, -11143, -11331,  -2545,   2240,   7477,  -7745, -10345,
+  -1926,   -703,  -4975,  -4260,   5441,  -6582,  -5461,  -2245, -12265,  -6905,   2795,  13793,   5932,    832,   5233,  13052,
+  14673,  12610,  -5380, -29118, -16540, -18030, -23734, -17988, -26107, -30031, -28059, -26171, -25918, -22065, -13479,  -1513,
+   7427,   8389,  22108,  28795,  12769,   1125,  -3083,   6510,   3549,   1002,  -2246,  -7719,   -741,     73,   9431,   9253,
+   5661,  18428,  24873,  23732,  18657,  13499,   6735,    245, -10660, -16345,   -598,  -2004,   9013,  -7109, -31092, -29883,
+  -7922,  13069, -11306, -17929, -16346, -14092,  -7809,   6595,   2465, -24527, -26447, -20589,  -9659,   2770,   4842,   7724,
+   8206,  -2784, -15036, -14951,  -4013,   6412,   7565,  17559,   7875,  -7811,  -2206, -14648, -17537, -20136, -22244,  -8998,
+  -6539,  -9790,   2481,   2351,  14761,  25419,  25062,  22396,   1791,   -155,   1812,   7401,  16587,  18746,  26249,  25267,
+  26682,  21636,  14463,  12749,   3666,   2365,  12394,  22850,  17191,  12419,  15137,   3663,   2023,   7358,   5807,   7591,
+   1689,  -1238,  10268,   9715,   1921,  -1586,  -4414,  -5016,  -7421,  -2860,   -719,  -1581,   1326,   4811,  12950,   7189,
+   1974,   2120,  -2152,   6399,   6542,   1798,  10127,   9379,   8607,  11668,  12710,  13626,  10295,  12364,  17929,  20972,
+  19586,  16218,  16543,  11660,  13880,   7820,   1814,   3561,   -291,  -2119,  -1604,   6960,   4539,   1810,   4427,   6919,
+   7241,   5617,   5615,   5905,  12173,  13429,  10661,   6406,  -6572, -10489, -10639, -10036,  -7118,  -9029, -12317, -12283,
+  -7293,  -7392,  -8917, -11785,  -5403,    720,   3991,   2198,   4569,   6075,    -21,   2754,  13738,  15535,    273,   -845,
+    524,  -5786,   4993,  -5730, -13214, -16713, -14202,  -8636, -10565,  -4463,  -7500, -14544, -17958, -14049, -15144, -14603,
+  -8044,   6364,   8471,   1511,   1215,  -6167, -10250, -12333, -15080, -13156,  -1773,   -184,   1549,   9269,  13200,  11335,
+  10107,  15679,  18649,  19815,  17237,  19820,  16154,   4150,   4672,  -4289, -14812, -17393, -11900, -12485, -14391, -13840,
+ -12004,  -8671, -14187,  -5441,  -2430,  -8074,  -6907,   -424,   2904,   1050,  -1845,  -8360,  -9092,  -9197,  -8751,  -8850,
+  -6157,  -7052, -15330, -15786, -16515, -13707,  -5976,  -9031,  -9329, -10393, -13274,  -8519,  -2177,  -1283,  -2999,      2,
+  -6037,  -4915,  -1869,  -1242,   2188,  -2842,   1118,  -5631, -12377,  -8609,  -5804,  -8919,  -5201,   -983,  -3642,   -598,
+  -9021, -10867,  -7124,  -7979,  -5007, -10202,  -9322,  -8651, -11241, -11784,  -8544,  -8361,  -9876,   2171,   6046,  -1695,
+  -9207, -14755, -11866,   1156,  10978,  14323,  10980,  14373,  12341,   2083,     75,      1,   4780,   4072,   7275,   4304,
+   -927,   1919,   1718,   1315,  -4266,    -24,  -6628,  -6875,   7853,  11271,  13629,  10642,  12331,   9985,   6551,   7296,
+   6410,   7403,    908,   1265,   3594,      5,  -6058, -14446, -14338,  -9481,  -1543,    627,  -1211,  -5221,  -8114,   -634,
+   3696,   5168,    985,  -6246,  -4995,   1940,   5779,   3357,    561,  -3024,  -7065,  -2129,    866,  -6976, -12772, -14341,
+ -15733,  -6621,   4604,  16390,  22968,  23269,  20836,  14151,  16127,  20588,  20831,  22226,  20990,  14319,   7984,   4243,
+   4477,   9783,  12126,  14200,  15142,  13956,  13875,  14233,   8624,   5553,   9939,  12579,   7452,   2301,   4446,     -3,
+ -10384, -10851,  -5192,  -3195,   1823,  10313,   5519,   8779,  13039,   1259, -15773, -20075,  -5186,   6656,   9486,   4798,
+   6132,  14370,  14289,   9747,   9778,   9978,   1097,  -6968,  -6293,    295,   5180,   6558,   5834,  -1893,  -6305,  -1636,
+   4348,   8714,  11359,   9629,   6482,   1490,  -7355, -16394, -17984,  -1006,  14116,  10677,   8036,   4506,  -3488,    202,
+   3365,   1053,  -5579, -13601, -10946,  -3314,  -4589,  -5335,    125,    847,    107,    985,   4674,   4518,  -1505,   -706,
+   6528,  15433,  22468,  21649,   9486,   3869,   6842,   4666,   7010,  11963,  11999,  11600,  14098,   7986,  -6582, -18471,
+ -22539, -18416, -16930, -15407, -12350, -11915, -11753, -10139,  -7564,  -9684, -14318,  -9690,    219,  -1063,  -3490,  -2747,
+  -1446,  11508,  22550,  18606,   9267,   4876,    148,  -1147,   1902,  -1562,  -7672, -14040,  -8109,   9483,  14735,   7180,
+   3096,    -28,  -4011,  -6027,  -8197,  -7137, -11483, -19776, -20111, -19311, -25260, -28394, -24927, -20936, -14656, -10051,
+  -5043,  10776,  19304,  16257,  15182,  10762,   4402,   -690,  -4702,   1104,  11376,   6728,   2929,   2351,  -7674,  -7863,
+  -3756,  -2599,   1076,  -3264,  -3883,  -5283, -11895, -15235, -12103,  -4695,  -3185,  -8779,  -8725,  -3414,  -3965,  -6994,
+  -1066,   7147,   7476,   4984,    132,  -1631,   4019,   9412,  14278,  10741,   4928,   3429,    855,  -3738,  -9348, -11463,
+ -15280, -15480, -16797, -15234,  -9744,  -6543,  -5406,  -1526,   4601,   3632,  -1198,  -5911,  -6929,  -7563,  -5328,   3728,
+   8620,  15074,  18089,   9762,    923,  -1245,  -2511,   1769,  10600,  14471,  15227,  10254,   7645,   8278,   5111,   -649,
+  -2188,  -5146, -11727, -13270, -13431, -12878, -17510, -18374, -11711,  -7923,  -8631, -10611,  -7166,  -1780,   3523,   2123,
+  -2308,   3386,  10152,  15850,  25375,  26479,  24039,  21477,  16657,   8895,  -2460, -12703, -16013,  -6185,   1861,   4366,
+   1478,  -4706,  -8794,  -7599,     20,   -982,  -1847,   -185,   2966,   9367,  10685,   7325,   3224,   1837,   1315,   4931,
+   7206,   2262,  -8206, -15528, -14687,  -8843,   -214,   3075,   8172,   7847,   6667,   9254,   5412,   9280,  12673,  10711,
+   3890,  -4768,  -4683,  -3711,  -1460,   2862,  10635,  19079,  20535,  15149,  14608,  11093,   2738,  -1432,   -705,  10339,
+  11062,   8063,   4280,  -6516, -13885, -18190,  -6600,   5466,  14724,  20981,  16405,  17769,  15989,   6350,   -125,  -6452,
+  -8281,  -1447,   2684,    408,  -5951,  -6526,  -2743,  -4028,   2434,   8436,   2879,   2092,   7187,   7439,   5164,   3822,
+   4757,   2107,   -862,   5428,  11571,  16793,  16608,   5979,   -312,   -627,   1145,  -2608, -12022,  -5640,    330,  -6404,
+  -8458,  -6237,  -2208,    456,   3385,   3844,   5410,    903,  -3129,   3331,   2230,   1400,   -990,  -2615,  -5310,  -7780,
+  -3581,  -3916,  -9344, -17083, -16055,  -8897,   1532,   3345,   3043,   -371, -11447,  -7961,  -3969,  -1764,   2365,   1502,
+   -877,   -126,  -2885,  -2449,   3463,   3080,   9253,   7817,   7352,   6640,   2192,  -3408, -13276,  -5601,   1253,   3550,
+   2401,   7415,  11960,   8457,   4239,  -2376,  -1850,  -2589,   4023,   5885,  -5709,  -9179,  -3703,    763,   -788, -11010,
+ -19399, -18544, -16569, -13877,  -8876,  -4740,  -4886,  -7786,  -9652,  -1392,   4123,   6218,  11163,  10779,   6132,   3777,
+   1472,  -6339, -14488, -12329,  -5923,   4654,  15851,   7830,    941,    293,  -3834, -12152, -16011,  -3560,   1083,  -7000,
+  -9469, -14764, -19700, -16121,  -6116,  -3536,  -3515,    345,    748,    -69,  -1896,   4046,   6046,   1080,  -2898,  -7810,
+ -10191, -11067, -12022, -18554, -21671, -12339,  -1029,   2669,   3338,   4295,   4214,   5905,   6173,   6680,   4736,     16,
+  -2186,  -3142,  -5370,  -3460,  -1498,  -2107,   2013,   5014,   8176,   8419,   6903,   5433,   2651,   4424,   5723,   3240,
+   3917,    248,  -9567,  -7224,  -4842, -10692, -13664, -14784,  -8694,  -2830,  -3071,  -4762,  -3766,   6507,   9134,  -3152,
+ -11754, -11183, -11700, -12941,  -8188,   -147,   4134,  -2452, -10702, -11209,  -5358,    -73,   6432,   7929,   3953,   5519,
+   4436,   6307,   9210,  11999,  11178,   4747,   2340,   1526,   1230,  -1278,  -1446,   3822,   7006,   8156,  12504,  12032,
+    -57,  -5613,  -1058,   1162,   6523,   1722,  -9034, -10896,  -7012,   -735,    986,   -735,    245,  -2456,  -7381,  -4664,
+    908,   2642,   4222,   9314,   6862,  10358,  18132,  23533,  25724,  26076,  26568,  22698,  12772,   5097,   4324,   3822,
+   1524,  -2455,  -6295,  -4974,  -4690, -11812, -13065, -11777, -10869, -10949, -13243, -17087, -15341,  -2597,   2488,   1695,
+   5011,   5980,   5028,   6880,   4324,   2726,   6171,   7318,   6241,   8877,  13568,   8364,   1995,   4551,  10368,  10152,
+  10609,  15217,  14207,  13097,  12443,   5910,   4492,  11611,  18880,  25006,  21873,  13626,   8059,   4603,   4712,   7649,
+   5220,  -3814,  -2319,   4330,   9625,  12813,   4809,  -4682,  -7319,  -3509,   2014,   2510,   5880,   6507,  -2476,  -2822,
+  -2029,  -5951,  -6361,  -4703,   4165,  10745,   6847,  -5105, -12792, -14114, -16701, -14348,  -8180,    421,   6287,  11535,
+  14354,   5926,   -142,   3829,  10936,  13858,   7977,   1145,    809,    851,    150,   7704,  20003,  23196,  16684,   7578,
+   3964,   3885,    519,  -1880,  -3505,  -4852,  -1787,   2038,   4712,   6955,   5479,   1965,  -3310,  -8615, -12533, -15721,
+ -13927, -13532, -12746,  -5723,  -3888,  -6716,  -1802,   4623,   1348,  -3227,  -4994,  -5907,  -4333,  -1251,   1293,  -3328,
+ -12043, -20194, -26637, -27271, -24711, -18352,  -7591,   2688,   9338,   7604,   -177,  -3253,  -2360,  -5011, -10547,  -8030,
+  -1070,   2004,   -235,  -8891,  -9287,  -2217,    290,  -1005,  -5551, -10703, -12514, -11393,  -5896,  -3083,  -7057,  -9306,
+  -6466,  -2300,  -5146,  -9128,  -1816,  12014,  19555,  15406,   9263,   4854,  -6406, -17060, -15450,  -6886,   -533,  -2281,
+  -9334, -11585,  -7236,  -9461, -17818, -20091, -19649, -10087,   3209,   3296,  -4707, -13204, -15965, -11717,  -6058,  -4620,
+  -6949,  -2262,   5920,   3232,  -7468, -13353, -11255,  -7833,  -2726,   -273,  -1211,   -398,  -3027,  -3522,  -1385,  -1872,
+  -1695,  -2778,  -5464,  -6745,  -9806, -15364, -19740, -13891,  -5132,  -4064,  -5957,  -5659,   2846,  10350,  16093,  17036,
+  13372,  10495,   4199,  -3233,  -4750,   1661,   5284,   3613,   3205,  -1557, -10651, -12644, -12748, -10262,  -6470,  -6203,
+ -10032, -11731,  -9885, -12706,  -9657,  -2387,  -1708,   1794,   5163,  10653,   9688,   7850,  10411,     49,  -6329,  -4997,
+   -767,   3985,   9566,  11742,   5657,    423,  -1188,  -5329,  -3737,    938,   1406,   8403,   9879,   7194,   4729,   -266,
+  -1243,  -1230,     78,   4156,  10698,  14625,  23378,  28880,  25134,  20808,  11178,   3967,  -6334, -10465,  -5584,  -1156,
+   -253,  -4413,  -9870,  -9574,  -6950, -11250,  -8053,   3033,   6459,   4409,   2227,    835,   6073,  13089,  18166,  20930,
+  14604,   5220,   3151,  10548,  14747,  12452,  16110,  17005,  12029,  10169,   9454,  11870,  12750,  13449,  15107,  15724,
+  15438,  12592,  14183,   7456,  -3646,   -635,   -288, -14768, -22133, -14997, -10351,  -4430,   -564,    449,   1324,  -8970,
+ -14758,  -3005,   4854,   7090,   7175,   7452,   7215,   7506,  10124,  14397,  18702,  14400,  17651,  15623,  10170,   7399,
+   7086,  13922,  18768,  18239,  14702,  15170,  16790,  15868,  15071,  14544,  14789,  11582,   7673,   2149,  -3436,  -7698,
+  -9236,  -3612,  -2704,  -5250,   -415,   3075,   6312,  10885,  11993,   6585,  -1853,  -4233,  -2918,  -6693,  -7524,  -1976,
+  -6655,  -9328,  -7301, -15019, -16931,  -7589,   1899,   2333,  -1417,   2546,   -423,  -5584,  -3917,  -3184,   -250,   -761,
+   -474,   7788,  12598,  14762,  11488,   7264,   6130,   5320,   3814,   -853,   2007,   4537,   6568,   2607,  -4766,  -2741,
+   1621,    -22,  -8042,  -6180,  -2420,  -2979,  -5505, -11083, -11993, -10013,  -8260,  -8862,  -7503,  -3634,   2210,   3055,
+   4840,   9911,   5905,   8431,   7680,   3980,    105,  -6935, -10180, -12570, -14207, -13637, -10461,  -8736,  -8176,  -7157,
+  -4455, -11975, -16985, -16807, -16782,  -6141,  -2926,  -3769,  -2483,  -2528,   -137,  -6688, -10459, -10529, -10197,  -8195,
+ -12401,  -8630,  -1391,   2891,   -965,  -4629,   1237,   4314,   1222,   1165,   4024,   -718,  -7366, -12931, -10521,  -9807,
+ -11559, -14362, -10816,  -2165,  -4362,  -9019, -13448, -13874, -15148, -13721, -11241,  -9871, -10619, -12617, -13455, -11690,
+  -6656,  -4559,  -1092,  -3470,   1052,  10794,   7318,  -1780,  -6506,  -4779,  -1210,   -996,  -4192,  -6108,  -2199,   5015,
+   5890,   1988,  -7097, -12376, -12797, -18523, -17628, -13018, -12263,  -8462,  -4799,   -378,    761,    292,   1453,   -153,
+    868,   -416,  -3127,  -4090,  -3433,  -7174,  -5836,   -191,   2267,   3883,  -1062,    142,   2197,   3943,   5609,   3145,
+  -1786,  -5025,  -4175,  -6392, -10902,  -9242,  -4025,  -7231,  -5392,  -2462,  -4740,  -2998,  -3542,  -4358,    686,   7293,
+   4752,   -105,   1973,   4055,   3367,   3495,   7805,  11855,  12563,   7828,   -172,  -3334,  -4176,  -6881, -10431,  -9492,
+  -8417,  -7553,  -3312,  -3939,  -6736,  -7810,  -5906,   1329,   3504,   3442,   4758,   3060,   8919,  16567,  20171,  19389,
+  17110,  20572,  19522,  18046,  19379,  15500,  14144,  13913,   8993,   6246,   4698,   2590,   3080,   9369,  12941,   8584,
+   6252,   6468,   4398,  -3743,  -9652,  -6568,   -337,   7721,  11486,  11063,  11800,  10982,   4793,   -988,  -1177,    242,
+   5251,   9483,  10248,  12354,  12401,   8658,   2753,  -3189,   -102,   9337,  14017,  11783,   9529,  10981,  15766,  18796,
+  12989,   5158,   1082,   2298,  11255,  17333,  14692,  12104,   7292,   4218,   3658,    274,    834,   5157,   4399,   1958,
+  -2822,  -8998,  -5347,   -116,     64,    -26,  -2365,  -5853,  -3471,  -1136,  -2208,  -2767,  -1085,   -922,   1886,   6806,
+   5354,   1554,   -885,   1746,   3100,   2605,   5638,   7972,   5450,     23,  -3192,   1614,   8845,   7058,   1428,   -812,
+   2967,   6351,   7704,  11055,  12334,  12118,  11506,   8105,   3674,   1566,     93,  -1154,  -5386,  -7507,    355,   6286,
+   6286,   3701,   -853,  -3810,  -4688,   -444,   4342,   4007,   3460,   5058,   3365,     20,   1163,  -2513,  -7234,  -6003,
+  -8477,  -9291,  -5019,  -2402,  -1930,  -4630,  -5700,  -4461,  -7401,  -9623,  -7962,  -8146,  -9087,  -4297,   -231,   -764,
+     19,    837,  -1451,  -5128,  -8248,  -5661,   -489,  -1687,  -2652,  -2391,  -3500,  -3650,  -4445,  -8603, -12375,  -8438,
+    328,   1275,  -2677,  -2057,  -3458,  -5535,  -3781,  -2709,  -4213,  -7703, -13715, -15768, -13453, -10374,  -5545,  -4447,
+  -5896,  -8821, -10768,  -9594, -10542,  -6788,  -1354,  -3532,  -6961,  -6112,  -1346,    274,   2114,   5716,   2856,    524,
+  -1526,  -5156,  -4558,  -2479,  -5510, -11067, -14516, -14051, -11428,  -9125,  -6321,  -8539, -10367,  -7680,  -7743,  -6360,
+  -2984,  -4469,  -8417,  -8264,  -1777,    776,    285,   1539,   -986,  -3123,    121,   5763,   8385,   4480,  -3819,  -9263,
+ -12243, -13035,  -8537,  -3062,  -2463,  -6858, -12333, -11971,  -8293,  -4136,   1405,   2225,  -1480,  -5535,  -1526,   6500,
+   8337,   7576,   4930,    540,   -274,   2724,   1278,  -4049,  -5994,  -5056,  -3973,  -1567,   3296,   7389,   6027,   2358,
+   4906,   3796,  -2401,  -4571,  -3832,  -2648,  -3020,  -3258,  -2337,  -3703,  -4767,  -6327, -13034, -14857,  -8986,  -9558,
+  -9828,   2717,  11019,  13705,  13541,   8838,   8100,   8112,   5975,   5024,   3929,  -1119,    -34,   6298,    870,  -3794,
+    538,      3,  -2328,   1240,   6477,   8358,   6963,   -814,  -8699,  -8718,  -4685,  -2415,   -709,   4426,   7151,   6884,
+   7093,   5516,   5600,   5606,   8029,  14759,  14391,  11982,   9414,   7350,   8971,   8966,   7287,   5491,   5098,   6314,
+   7379,   8408,   9105,  10408,   8589,   4821,   5132,   2365,   -588,   -570,   2490,   1507,   -835,   4765,   4719,   1864,
+   4757,   7771,   8615,  10507,  12205,  11955,  11419,   8406,   4474,   3230,    875,  -3316,  -5605,  -4703,  -1176,  -4258,
+  -7491,  -5873,  -8884,  -9372,  -2206,   4073,   3964,   3937,   5574,   5324,   3458,    696,   -695,   1646,   5754,   9684,
+   7997,   5202,   6206,   2966,   2992,   6401,   5357,   6979,  10042,  10078,  10580,   7749,   3287,    462,  -4033,  -4545,
+  -2479,   -133,   1353,    -79,   1019,   2788,   3801,   6469,   7632,   4897,   6231,   6706,   7830,  12780,  13044,  10316,
+   1151,  -5267,  -4042,    588,   4078,   2477,   2494,     79,  -6528,  -7868,  -7139, -11267, -11281,  -9769,  -8486,  -9175,
+ -12628, -11615, -10664,  -6516,  -1963,   -793,    494,   2842,    572,    363,   4376,   3098,   6421,  11969,  13465,  12881,
+   8148,   2447,   1142,   2994,    787,  -2470,   1038,   3993,     65,  -4593,  -3847,  -6478,  -7752,  -4137,  -2657,    561,
+  -1162,  -4336,  -6473,  -8220,  -3960,   -528,  -2203,  -4513,  -5435,  -4046,   -715,  -2005,  -2755,  -3332,  -5159,   2689,
+   3397,  -5206,  -6722,  -7094, -10537,  -9260,  -6203,  -4303,  -2178,  -2835,  -1855,  -1663,  -1070,   -688,   -973,  -4359,
+ -10461,  -9614,  -7450,  -4362,  -6567, -10849, -11605, -16157, -15611, -12271,  -9753,  -5515,  -3454,  -4424,  -7204,  -7007,
+  -3706,    304,   2540,   -349,   2442,   4613,   3286,   6060,   6039,   6906,   2697,  -4423,  -4170,  -1466,  -1767,  -1799,
+   1947,    995,  -1181,  -5338, -10395,  -6985,  -5457,  -6100,  -5547,  -7608,  -8313,  -7715,  -9327,  -9485, -11185, -11710,
+  -8043,  -6295,  -2344,    870,    192,   -674,   1140,   3924,   3472,   3254,   3675,   1864,   1271,    884,   -478,   1529,
+   3898,   2204,   2584,   3175,   4302,   7073,   2463,   1411,   3606,   2578,    227,  -3060,  -3214,  -1243,   2932,   3649,
+    538,  -2707,    631,   4435,   -844,  -6844,  -8525,  -5940,  -4885,  -6126,  -5981,  -5438,  -6795,  -6966,  -2627,    418,
+  -1049,  -1831,   -317,   -465,    779,   3277,   1781,   1812,   2461,   4158,   8400,  11119,  10606,   8574,  10549,  10861,
+  10851,  11247,   7356,   7344,  10256,  10762,   7678,   5073,   4597,   2197,   3062,   5111,   3996,   3363,   2074,   1064,
+    -85,  -1752,  -2894,  -2005,    195,  -1269,  -1483,   1804,   5555,   4978,   2208,   2299,   3279,   3712,   4987,   6432,
+   5040,    831,   1247,   5623,   9228,  10503,   5205,   2747,   4232,   3782,   2197,   -377,   -751,   1717,     65,  -3104,
+  -2003,    369,   1840,   1335,   1181,   1246,   2712,   5517,   3408,   1898,   2599,   5297,   8910,   8627,   7891,   6580,
+   4734,   3606,   3688,   4540,   6185,   6591,   3726,   -284,  -1003,   1102,     -7,   -931,   2022,   2888,   3449,   4595,
+   1612,    827,   3804,   5009,   6064,   2924,   -795,   3054,   7233,   8569,   6811,   5952,   3771,   -242,   2280,   2849,
+   1817,   2242,    227,   1327,    181,  -2890,  -4452,  -3322,  -3263,  -5912,  -4769,  -5513,  -3375,  -1789,  -4271,  -4953,
+  -2302,   -286,  -1961,  -5088,  -7827,  -5892,  -2887,  -4270,  -8491,  -9422,  -7556,  -1281,   4444,   2526,   1612,   2508,
+   2036,   1232,   1897,   2714,  -1088,  -2809,  -2023,  -3562,  -3278,  -1175,   -798,    -35,   1796,   1110,    875,   -119,
+  -4046,  -1953,   -380,  -3173,  -3110,  -5197,  -6321,  -6361,  -8206,  -6347,  -1549,  -3846,  -8640,  -9762, -10599,  -8445,
+  -4384,   1174,   4881,   3710,   -157,   -656,  -1032,  -4102,  -2777,  -1068,  -1475,  -1904,  -5316,  -6900,  -3424,  -2678,
+  -4807,  -4193,  -4568,  -5465,  -2933,   -132,   3102,   3464,   -795,  -4189,  -5740,  -6267,  -6238,  -5732,  -3069,  -3293,
+  -2734,   -655,  -2109,  -1960,  -1211,  -3351,  -2758,    350,   -924,    273,   1139,   -425,    289,  -1111,  -6709, -12074,
+  -9519,  -6893,  -5884,  -1381,   -958,  -2564,  -1911,  -2572,  -5171,  -7718,  -8738,  -7307,  -6229,  -4441,  -3256,  -3851,
+  -2382,   -308,   2142,   1812,    587,    424,  -2145,  -3558,  -2152,   -601,   2244,   5286,   4357,   1544,  -2424,  -3494,
+   1870,   4950,   3753,   2676,     57,  -1897,   4471,   6884,   -831,  -4154,  -3296,  -7642,  -8596,  -4683,  -5629,  -4908,
+  -3198,     61,   2263,   1013,    278,    318,    105,   -989,   -767,  -1501,  -3504,  -4027,  -3484,  -2012,    493,   1301,
+   3670,   5502,   2740,   -220,    429,   2174,   2593,   5719,   6578,   2747,    937,    957,   1145,   1171,   2923,   3672,
+   2701,   3375,   3757,   4266,   3909,   2293,   4200,   5585,   3710,   4037,   3224,   2863,   6490,   5496,   2479,   1487,
+    625,   1233,   1679,   1641,    238,    739,   1016,    424,    586,  -1188,   -464,   1430,   2253,   2663,   1102,    -94,
+   -877,    917,   4075,   2696,   3006,   6054,   7569,   7712,   7173,   5241,   2605,   3167,   2155,   3306,   5228,   3075,
+   3338,   2620,   3470,   5462,   5823,   8197,   7819,   5801,   4455,   3988,   3956,   2888,   2738,   3047,   4419,   6823,
+   8594,   7188,   6250,   6014,   2723,   3785,   5242,    831,   -784,   -101,   -139,   -270,   -262,    788,    769,    905,
+   2793,   2881,   2028,   1469,   1916,   4125,   4504,   4129,   4314,   1664,   -526,   2166,   1951,   2125,   3720,      0,
+  -3245,  -4226,  -1022,    969,    911,   1449,    763,   1357,  -1354,  -2238,   -689,  -2058,   -941,    367,   2918,   4719,
+   3509,   1997,   1571,   2455,    826,   1721,   1605,   -920,  -1778,  -2843,  -5289,  -7551,  -3828,  -2562,  -3773,   1135,
+   2854,   1460,   3591,   3236,   -361,    803,   4720,   4072,   1945,   3406,   1101,  -2261,   -779,  -1772,  -2790,  -3115,
+  -3947,  -5214,  -4624,  -1936,  -2553,  -1747,  -1811,  -2406,   1110,   3223,   4092,   4143,   2681,   1615,   1180,   2597,
+   3999,   3857,    851,  -2310,  -2787,  -3450,  -7334, -10968,  -8877,  -8834,  -7932,  -3940,  -7465, -12519, -10169,  -6863,
+  -7212,  -7460,  -5969,  -3353,  -2378,  -3378,  -1596,  -1595,  -5060,  -3378,   -524,   -664,    224,   1419,   4362,   3851,
+   2145,   5424,   3779,     10,  -2350,  -2214,  -1746,  -2374,  -2050,  -2476,  -2604,  -2339,  -3741,  -6767,  -3952,  -1856,
+  -2757,  -4528,  -6916,  -4730,  -2022,  -1961,  -4402,  -4781,  -3604,  -5084,  -4788,  -4737,  -6160,  -4465,  -2972,  -5431,
+  -7429,  -7489,  -6845,  -4130,  -2656,  -1008,  -1941,  -1020,   1337,    662,   -221,  -1684,  -3001,  -2265,    954,     75,
+  -1185,  -2184,  -2682,   -454,   -598,  -2333,   -881,    843,   -514,  -1705,   -810,   1071,    374,   -667,   -960,  -4419,
+  -6183,  -3957,   -239,   1720,   -503,   -329,   1479,    841,   -445,  -3244,  -2421,   1526,    829,   -238,   -528,  -1621,
+    420,   3309,   5396,   3353,   -102,    978,     -9,   -603,   3989,   3049,   1096,   3690,   1252,    180,   2819,   2764,
+   5025,   5596,   2069,   3319,   2836,    930,   3548,   4594,   3502,   1547,  -1019,  -1500,   -355,   2245,   3757,   5091,
+   4198,   1457,   -582,  -3027,  -2261,   -390,   1350,   2651,   1995,   -270,  -1125,  -1975,   -970,    803,   -178,    -44,
+   1010,    449,   -333,   1006,   3372,   5952,   3490,   2122,   3363,   3672,   5869,   6760,   7301,   5637,   3081,   2628,
+   4575,   6151,   5302,   1523,   1428,   3670,   2208,   2258,   3405,   6211,   5184,   1363,   2339,   3994,   2866,    590,
+  -1136,   -269,    986,   -352,   -619,  -1067,  -1526,    993,   2385,   3149,   5938,   2797,    266,   4230,   2499,    195,
+   2377,   2937,   2585,   2416,   1218,     79,   1487,     65,  -4587,  -3175,  -1118,  -2822,  -1501,    255,  -2337,    433,
+   2137,   -474,   -575,    655,   1956,   -957,  -1001,   -261,    752,   2115,    760,    955,   -251,  -2920,   -340,   3103,
+   1887,   -814,  -1721,  -1069,    378,    -22,    383,   1768,    396,    988,   -402,  -3334,  -3291,  -2220,  -2272,  -1989,
+   -613,   -618,  -4723,  -5508,  -1889,    160,   1822,    179,  -2061,  -3014,  -1679,   -150,    103,   1246,  -1113,  -3388,
+  -2989,  -3365,  -1928,    433,   -437,   -982,  -1921,  -4231,  -3019,  -2025,   -929,   1995,   2323,   -983,  -2325,  -2096,
+  -1394,   2800,   3628,    363,    539,   1631,    255,    -72,   -728,  -2253,  -1210,   1956,   3360,   2879,   2066,   -645,
+  -4109,  -3881,  -1929,  -1310,    844,    -71,  -3274,  -3250,  -4201,  -4723,  -5581,  -5324,  -1009,  -1830,  -3006,  -2226,
+  -4876,  -3705,    754,    644,    448,   2275,   1503,   1111,   -691,    -18,   1595,  -1086,  -1474,  -2846,  -5303,  -3321,
+   -426,   -902,  -1065,   -159,    -97,   -905,  -2776,   -650,   2258,    153,  -1603,   -318,  -1398,  -2182,    414,    689,
+   -316,    550,   -206,  -1214,  -2733,  -4493,  -1365,  -1626,  -4661,  -3833,  -3803,  -3281,  -1885,   -587,   3582,   4318,
+   1446,   2081,   2632,    554,   -480,   2361,   2996,    595,   1079,   2024,   1817,    264,   1093,    985,  -1902,  -1200,
+    353,   1081,   1494,    794,   -677,   -371,    135,  -1788,  -4835,  -4011,     -6,   2005,   1784,   1425,   3329,   4783,
+   4380,   4349,   4169,   3981,   4940,   2958,   -821,  -1463,  -1873,  -2255,  -2148,   -333,   2630,   2003,    566,   -163,
+    862,   2975,    723,  -2481,  -2771,  -2545,   -673,    757,    416,   1412,   1569,   1793,    806,  -2452,  -2830,    168,
+   1866,    134,   -487,    723,   2287,   3341,   2116,   1081,   2495,   3559,   4107,   5185,   3919,   2224,    474,  -1203,
+      7,    687,    522,   2191,   1994,    342,   -211,    -98,  -1183,  -4805,  -5385,  -4083,  -4431,  -4668,  -4603,  -3281,
+  -2241,  -1088,    468,   1373,   1358,   1917,   3229,   1988,   2430,   4907,   5172,   3521,   3821,   5476,   5425,   4756,
+   3701,   4862,   4448,   1954,   1555,   1432,   1533,   2092,   2175,    252,  -1914,  -2815,  -1866,  -1681,  -2895,  -1869,
+   -700,  -1214,  -2554,  -1665,  -2009,  -3386,  -1608,   -743,   -215,    426,  -1414,  -2884,   -352,   1330,    166,   -679,
+   -552,  -1069,  -1493,    808,    453,   -782,   1396,   1675,   -227,   -396,  -1556,  -4133,  -3216,   -349,   1093,    490,
+    785,   2396,   1880,   1318,   3267,   5171,   5983,   4881,   1504,   1480,   2602,    836,    912,   2479,   2142,    587,
+  -2909,  -5689,  -4736,  -5316,  -4744,  -2136,  -1336,   -997,  -2566,  -4138,  -2760,  -2261,  -3100,   -183,    306,  -2481,
+  -3250,  -2548,    241,   2436,   2234,    937,   1658,   2593,    470,   -881,   -950,   -900,   1717,   3042,   2938,   4442,
+   3517,    236,  -1015,  -1316,   -851,      9,  -1812,  -3310,  -3230,  -2823,  -2163,   -745,  -1865,  -5395,  -3153,     38,
+   -608,    177,    450,    275,   1959,   2716,   1524,   -326,  -1801,  -3573,  -4225,  -2378,  -2280,  -3700,  -2233,  -1613,
+  -3022,  -2357,  -2013,  -1334,    706,   1519,    830,  -1986,  -3395,  -1694,   -665,    169,     71,    554,   4166,   4743,
+   4107,   4146,   3323,   4421,   4626,   4620,   3004,   -930,  -1586,  -2086,  -2801,  -2691,  -1985,    468,    885,   -576,
+  -1322,  -2185,  -3008,  -2520,  -4043,  -3873,  -1499,  -1847,   -740,   1226,   2481,   2443,   1046,    523,    806,   1485,
+   1890,   2285,   1003,    -75,    413,  -2123,  -4012,  -2828,  -1827,  -1263,    106,   1055,    309,    711,   1150,    726,
+   1690,   2718,   1450,    783,   1073,     84,    260,    265,   -535,    159,    415,    113,  -1186,  -2507,  -1429,    317,
+   3894,   6446,   4099,   2931,   4773,   4389,   4283,   5884,   5023,   1936,    250,   -431,   -738,   -844,  -2016,  -1930,
+  -1253,  -1260,  -2977,  -2891,  -2353,  -4618,  -2451,    205,  -1537,  -1087,    507,    655,   1155,    358,   -183,    542,
+   1040,   2212,   3427,   3723,   3353,   2171,   2753,   3827,   3120,   3079,   1169,  -1381,   -334,  -1122,  -3682,  -3648,
+  -3230,   -598,   1386,    869,    291,     15,   1725,   3652,   4009,   3378,   2873,   1556,   2643,   3342,   2332,   3518,
+   1494,   -938,     -8,   -850,  -1886,    135,   -480,  -2592,  -2740,  -2973,  -2495,  -3063,  -3446,  -1762,   -928,  -1577,
+   -752,   1169,    240,   -506,    980,   1045,   1247,   2240,   1532,    843,    461,   -352,   -756,  -2189,  -4851,  -4784,
+  -2150,  -1857,  -2297,  -2788,  -4519,  -6400,  -5495,  -1789,   -265,    -17,    443,    827,    126,    967,   3379,   3666,
+   5170,   7084,   5048,    584,  -1613,     -2,    652,    536,   1335,    100,  -1702,  -3887,  -4685,  -4971,  -5170,  -2413,
+   -676,  -1966,  -4901,  -5010,  -3473,  -3707,  -2580,  -1399,  -2508,  -1853,   -120,  -1047,  -1450,      0,   1949,   2515,
+   1724,    163,   -620,    342,    955,   1216,     32,    708,   2242,    703,     72,   -468,   -710,   2546,   4053,    208,
+  -2839,  -3975,  -4139,  -3275,  -3844,  -3618,  -3138,  -2851,  -2727,  -3102,  -2501,  -1591,  -1948,  -3599,  -3015,  -1342,
+  -1835,  -1237,    623,   -139,   -314,   1382,   1578,    999,   1022,     28,   -341,   1525,   1947,   1083,    432,   1218,
+   2497,   3260,   3668,   2068,    958,   1770,   1465,    890,    512,  -1331,  -1037,    473,    799,   -388,  -1669,  -1512,
+  -1844,   -986,     16,    282,    -58,   -904,    854,   2661,   2353,   3486,   3287,    212,     44,   1252,   1367,    421,
+    -25,    860,    160,    -45,    159,   -756,  -1262,   -964,   -708,   -363,   -727,   -743,    206,    239,    654,    778,
+     69,  -1422,   -160,   1973,   1711,   1457,    804,   1387,   2415,    765,  -1409,    670,    729,   -361,   1341,    862,
+    348,    468,    839,   1308,   1761,   2005,   1617,   1131,   3079,   3445,   -788,  -1364,   -184,  -2164,  -2705,  -2069,
+  -4009,  -2288,    -42,  -2008,     99,   2395,   1824,   2245,   3214,   3718,   3907,   4811,   4252,   2521,   2036,   2294,
+   1467,   1147,    931,     59,    -82,    275,   2026,   1705,    975,   2064,   1845,   1506,   2778,   2155,   -944,  -1752,
+      0,   1325,    159,   -628,  -2105,  -2866,  -2218,  -1985,  -1242,  -2352,  -2044,  -1280,    -53,    963,    543,    244,
+    758,   3172,   4289,   3916,    796,   -102,    893,     47,   -321,   -952,   -469,   -272,   -269,   -468,   -496,   -471,
+   -465,   -562,   -385,   1470,   3883,   6594,   5529,   3300,   1286,   1898,   3312,    824,   2008,   2198,    588,   -325,
+   -355,  -1772,  -4240,  -2635,  -2885,  -2634,  -1440,  -1424,   -895,    297,   -247,  -1550,  -1733,   -963,   1262,    648,
+    855,    976,    -28,    682,   1552,   1615,   2092,   1471,  -1570,   -233,   1780,   1649,    241,     64,    757,   -733,
+   -747,  -1623,  -2028,  -2227,  -2237,  -2274,  -2051,  -2480,  -3083,   -110,   -280,   -968,    212,   1053,   1696,   2416,
+   3100,   2492,   1951,    136,  -1563,    802,   2570,    127,     54,    -89,   -783,    318,     12,    435,    985,   1124,
+   1389,    846,   -452,   -937,  -1261,   -688,   1331,   1760,   1388,   -282,   -583,   1692,    545,  -1687,     42,   1260,
+    993,   1431,    753,    166,   -543,  -1055,  -1937,  -2825,  -1097,    -55,  -1546,  -1864,  -1758,  -4785,  -5476,  -4031,
+  -3602,  -2208,  -2499,  -3355,  -2479,  -1568,  -1662,   -814,    540,    444,    626,    959,   1094,   1603,   2168,   2189,
+   2986,   3904,   3611,   3800,   2771,   1381,    425,  -2145,  -4000,  -5055,  -5654,  -5322,  -5183,  -5335,  -5378,  -4327,
+  -4753,  -5205,  -3904,  -3810,  -4127,  -4351,  -3909,  -1649,    351,     14,    433,   1111,   -706,  -1889,  -1475,   -818,
+    734,   1858,   -517,  -2897,  -1400,   -251,  -1042,   -248,    568,   -468,  -1469,  -2385,  -2856,  -2162,   -665,    653,
+    742,   -535,   -526,  -1218,  -3406,  -2559,  -3111,  -3685,  -2132,  -1778,   -384,   -580,  -1911,   -239,   1082,    656,
+    349,   -907,  -1155,   -213,    819,   1045,   -590,   -633,   -587,     44,    830,    929,   1511,    811,    716,    645,
+   -477,  -1545,   -986,    -79,    755,   1029,    155,    166,    500,     46,   -343,    781,   1059,    613,    444,   -685,
+  -1129,    820,   1910,     16,  -1250,    456,    628,  -1056,     20,     49,    282,   2219,   1318,    232,   1596,   1111,
+    232,    853,    284,   1100,   1406,   2978,   5623,   4430,   2885,   1797,   1342,    974,   -168,  -1075,  -1101,     21,
+    -68,  -1006,  -1270,   -613,    841,   1891,   2838,   3361,   2718,   2578,   2291,   1842,   2776,   2941,   3099,   2606,
+   1540,   2510,   2746,   2548,   2822,    985,   -412,    990,   1607,    383,   -277,    901,      5,  -1797,  -1173,   -281,
+   1339,   2436,   2318,   2145,   3552,   4399,   3250,   2383,   1951,    652,  -1033,  -1183,  -1692,  -2176,  -3174,  -3331,
+  -1632,  -1838,  -1476,    476,   1283,   1853,   2520,   2528,   3672,   3914,   2630,   2859,   1778,   -454,   -141,    488,
+   -625,  -1239,  -1529,  -1859,  -1782,  -2259,  -2556,  -1419,     50,    417,   1450,   2341,   2185,   1258,    851,   1897,
+   2327,   3225,   4324,   3997,   3286,   3830,   4103,   3933,   3824,   3379,   2184,    613,   1082,   1807,   2349,   1445,
+   -210,  -1018,  -2049,  -1479,  -1476,  -1949,   -570,    877,   1182,    660,  -1185,  -2561,  -2102,  -2245,  -1959,  -1562,
+  -1549,   -767,   -542,    507,   2846,   2635,    904,   1088,    260,  -1518,  -1479,  -1392,  -1655,   -906,     51,    324,
+   -145,   -265,   -117,    175,    943,   -348,  -1020,    232,     69,  -1168,  -2523,  -3093,  -3424,  -3902,  -2808,  -2601,
+  -4222,  -4001,  -4181,  -3834,  -1476,   -664,    195,   1075,    243,    487,   1398,    435,    387,   1046,   1160,    356,
+  -1228,  -1058,  -1271,  -1512,   -679,   -943,  -1544,  -1246,   -521,   -563,   -606,   -386,   -778,   -810,   -800,    244,
+   2064,   1808,   1831,   1862,    531,   1069,   1296,    129,  -1170,  -3268,  -3197,  -2700,  -3996,  -3063,  -2086,  -2854,
+  -1983,  -1351,   -985,      6,   -361,  -1072,   -907,    -37,    897,   1108,    630,   -229,   -819,   1040,   1668,   -736,
+  -1479,  -1923,  -1985,   -585,   -248,   -485,  -1015,  -1794,  -1010,     42,    169,    830,    597,   -792,  -1236,  -2754,
+  -3264,  -1824,  -2443,  -2443,  -1729,  -1999,  -1534,  -1097,  -2372,  -3347,  -2485,  -2469,  -1941,    412,   1466,   1737,
+   1468,   1182,   3194,   4800,   4371,   3242,   2100,   2311,   3049,   2750,   2437,   1323,    -58,   -723,  -1573,   -890,
+   1012,   1044,   -334,  -1129,  -1050,   1097,   2470,    805,   -338,   -344,   -368,    431,    563,   -262,    531,    893,
+    812,   1604,   1133,   -577,   -867,    694,   1394,   1817,   1826,    566,   -195,   -483,     64,    798,    497,   1425,
+   1875,    970,   1396,   1850,   1904,   1955,   2038,   1918,   1071,  -1238,  -2336,  -1212,  -1170,   -912,   -143,    472,
+    287,   -533,   -365,   -304,  -1034,   -870,    344,   -779,  -3465,  -4005,  -3122,  -2835,  -2395,   -647,   1206,   1587,
+    851,   1791,   3309,   1992,   1662,   2124,   1226,   1990,   1851,   1022,   1842,   2292,   1676,    864,    435,    195,
+    490,    184,    -36,   -770,  -2600,  -2184,  -1587,  -2654,  -3116,  -3406,  -3353,  -2643,  -2096,  -1729,  -1647,  -1532,
+  -2780,  -2640,   -261,    514,   1269,   2276,   2028,   2764,   3087,   1224,   1662,   3398,   3122,   2094,   1791,   2363,
+   2482,   1170,    335,    636,    838,    993,   1023,    373,  -2235,  -3901,  -2715,  -2109,  -2144,  -2681,  -3380,  -2054,
+  -1374,   -649,    298,   -783,   -345,    752,    161,    815,   1529,    578,   1017,   1811,   2107,   2522,   2082,   1484,
+   1233,    670,    282,    168,   -636,   -611,   -364,   -944,  -1296,  -2478,  -3856,  -3648,  -1821,   -846,  -2769,  -3271,
+  -1474,   -621,    910,   2087,    731,    966,   2469,   1646,   1412,   1932,   1647,   1080,    499,    371,   -894,  -1172,
+   -397,  -2398,  -3262,  -1620,  -1666,  -2429,  -2213,  -1868,   -810,    654,    190,   -890,     84,    900,    343,    199,
+    533,    738,   1058,   1694,   1823,   1355,    805,    403,    133,    514,    814,   -595,  -1879,  -1130,   -728,  -1380,
+   -734,   -127,   -801,  -1351,  -1110,   -736,   -218,    404,   -149,  -1127,  -1128,  -1292,  -2801,  -2699,   -601,   -631,
+  -1850,  -1904,  -1864,  -1598,   -806,    377,   1402,   -144,  -1411,    238,   1373,   1797,   1455,   -424,   -736,    719,
+   1652,   2063,   1827,   1439,    970,    923,   1532,    852,   -149,   -529,   -428,    553,    279,   -564,   -689,  -1350,
+   -188,    983,    839,   1574,    398,   -923,   -184,    -81,    804,   2290,   1492,    564,      6,  -1101,   -804,   -341,
+  -1147,  -1022,     62,    320,     48,    125,    799,   1188,    619,    366,    476,    326,    127,   -798,  -1234,   -295,
+    388,    759,    897,    469,    528,    -16,  -1275,  -1407,  -1313,   -135,   1382,    549,     56,    534,    744,   1571,
+   1599,   1044,   1172,   1543,   2480,   2891,   1474,   1001,   1422,    415,    399,   1143,   -416,  -1968,  -1222,   -678,
+   -684,   -956,  -1671,   -830,    641,   1043,   1377,   1381,    424,   -370,   -265,    262,    625,   1650,   2224,    743,
+   -114,    763,   1160,    569,     98,    335,   1146,   1297,    560,    502,   1762,   1993,    977,   1063,    886,   1156,
+   2686,   2708,   2536,   2479,   1296,   1329,   1221,   -211,   -242,    625,    812,   1277,   1360,    614,    547,    317,
+   -471,   -339,    705,   1331,   1553,    589,   -958,   -530,    440,    541,    496,    778,   1346,   1361,   1771,   2463,
+   1750,   2225,   3148,   2633,   2689,    758,  -1998,   -962,    440,    569,   1591,   1469,    354,    403,    607,    408,
+    -45,   -683,  -1213,  -2149,  -1845,   -324,   -436,   -626,    331,    493,    495,    784,    965,   1193,   1551,   2338,
+   1779,    984,   1432,    810,    282,    857,   -614,  -1345,    129,   -846,  -1751,   -478,   -666,  -2197,  -3315,  -4070,
+  -3760,  -3208,  -2581,  -1932,  -2255,  -2177,  -1427,  -1304,  -1594,  -1223,    -87,    523,    102,    588,   1343,   1107,
+    367,    242,    900,    400,   -249,     20,    184,    -73,   -511,   -722,   -858,  -1447,  -1547,  -1313,  -2088,  -3327,
+  -3594,  -2681,  -2673,  -3518,  -3073,  -2782,  -3571,  -2718,  -1526,  -1849,  -1373,    338,   1048,     93,   -767,   -383,
+    248,    341,    581,   -272,  -1849,  -1994,  -2197,  -2804,  -2371,  -2366,  -3598,  -4213,  -3592,  -3609,  -4015,  -3663,
+  -3557,  -2860,  -1355,   -673,   -417,     10,   -206,    492,   1369,    800,   1126,   1031,    235,   1163,   1129,   -568,
+   -635,    -38,   -496,  -1017,  -1392,  -2260,  -2040,  -1580,  -2943,  -3583,  -3170,  -3845,  -3842,  -3236,  -3434,  -2877,
+  -2392,  -2490,  -2720,  -2874,  -2186,  -1405,  -1583,   -532,    830,    482,    191,    895,   2123,   2470,   2520,   1799,
+    889,   1722,   1933,    390,   -541,   -564,    931,    889,  -1742,  -2084,  -1788,  -2221,  -1764,   -668,   -705,  -1709,
+   -838,    937,    779,    670,    188,   -858,   -118,    168,    535,   1336,    908,    -84,   -415,    231,    814,    872,
+    884,    -88,  -1091,    128,   1302,    936,    646,   1190,   1716,   2255,   2512,   2285,   2045,   1974,   2086,   1578,
+   1090,    797,   1257,   1399,    560,   1448,   2626,   2071,   2646,   3739,   3166,   3054,   2591,   2000,   2675,   2797,
+   1849,   1252,   1311,    821,    169,    474,    681,    368,   1346,   1666,    757,   1933,   2764,   1942,   2886,   3746,
+   3157,   3278,   3465,   3315,   2438,   1441,   1865,   1636,    742,   1077,   1683,   1055,   -667,  -1260,   -539,   -667,
+   -824,     -9,    353,    -15,    -66,    134,   -962,  -1478,   -507,   -445,    -60,   1551,   2209,   2220,   2792,   2959,
+   3228,   3330,   2550,   1723,   1496,   1636,   1860,   2050,   1846,    816,    343,   1145,    602,    289,    594,   -381,
+   -595,    698,   1754,    858,   -774,   -420,    516,    668,   1321,   1332,   1066,   1501,   1244,    545,    285,    201,
+    298,    288,    -71,    246,    394,   -170,    223,    174,   -932,  -1035,  -1629,  -2643,  -2042,  -1630,  -1637,   -895,
+   -371,    365,   1120,    670,    492,    736,     31,    133,   1880,   2813,   2631,   3099,   3364,   2703,   2326,   2247,
+   1682,    807,    565,    161,   -861,  -1499,  -1615,  -1612,  -1692,  -1885,  -1857,  -1116,    198,    493,   -157,    119,
+   -650,  -1883,   -942,    -19,    223,    658,    100,  -1157,  -1658,   -845,   -127,   -563,   -424,   -640,  -1646,   -840,
+   -351,  -1496,  -1439,  -1482,  -1523,   -335,  -1098,  -2301,  -2138,  -2530,  -2295,  -1678,  -1036,    448,    601,    -45,
+    609,   1027,     -3,  -1189,  -1628,  -1699,  -1055,   -686,  -1601,  -1712,  -1554,  -1964,   -988,   -279,   -492,   -222,
+   -788,  -1487,  -1384,   -914,   -365,   -669,  -1502,  -2112,  -1970,  -1311,   -696,   -163,   -332,   -849,   -929,   -623,
+   -192,   -917,  -1962,  -1519,   -733,   -244,    -90,   -524,  -1112,  -1633,  -1377,   -536,   -753,  -2227,  -2841,  -1945,
+  -2383,  -2956,  -1783,  -1708,  -2162,  -1922,  -1789,  -1944,  -2847,  -3333,  -3065,  -2912,  -2093,  -1073,   -952,   -999,
+   -440,   -652,  -1033,    147,     82,  -1179,  -1007,   -795,  -1329,  -1797,  -2004,  -2436,  -2939,  -2169,  -1308,  -1236,
+  -1131,  -1164,   -829,   -133,    154,    435,   1623,   2324,   1863,   2120,   2233,   1322,    997,   1133,   1125,   1434,
+   1875,   1548,    529,   -332,  -1380,  -1730,  -1483,  -2072,  -1796,  -1271,  -1565,  -1080,   -989,  -2106,  -2398,  -1537,
+  -1687,  -2138,   -881,    -22,    241,    999,    731,    863,   1314,    802,   1168,   1229,    782,   1650,   1757,   1008,
+    948,    923,    713,    788,   1728,   1307,    311,   1669,   1810,    928,   1414,   1539,   2356,   2694,   1492,   1736,
+   1844,    778,    461,    216,    202,     10,  -1030,  -1134,   -508,     74,    604,    707,   1052,   1152,    501,   1029,
+   1881,   1204,   1121,   1551,   1259,    906,   -156,  -1039,  -1037,  -1208,   -543,    272,   -486,   -665,   -245,  -1309,
+  -1675,   -609,    114,   1092,   2575,   2801,   1709,   1936,   2943,   2677,   2198,   2526,   2688,   1863,   1757,   2476,
+   2351,   2365,   2585,   2119,   1641,   1612,   1525,   1124,   1827,   2651,   1955,   1904,   2269,   1502,   1133,   1444,
+   1240,    357,   -890,  -1244,   -382,   -671,  -1525,   -847,   -538,   -895,   -725,   -465,    -56,    415,   1016,   1516,
+   2099,   2605,   1791,   1310,   1821,   1788,   1726,   1463,   1045,   1052,    322,    225,   1269,    715,     67,    681,
+    543,     98,   -110,   -318,    285,    877,    696,    273,     85,    553,    619,    424,    663,    489,    792,   1441,
+   1125,    227,   -503,    -76,    581,    165,    -51,    646,   1082,   -183,  -1378,   -955,  -1137,  -1376,   -852,   -813,
+   -671,   -479,   -682,   -805,   -834,   -801,   -539,   -360,   -222,    147,    472,    619,    788,    726,    -16,   -625,
+   -820,   -906,  -1154,  -1847,  -2117,  -1840,  -1190,   -966,  -1750,  -1439,   -412,   -882,  -1353,  -1386,  -1862,  -1356,
+   -273,   -270,  -1176,  -1068,   -152,   -666,   -601,    235,   -895,  -1774,  -1039,   -317,    -99,   -229,   -769,  -2375,
+  -2249,   -783,  -2418,  -2768,  -1209,  -1916,  -1360,    -97,   -315,   -132,   -139,   -473,   -791,  -1151,   -846,     20,
+   1029,    799,    117,    780,    854,    533,    735,    800,    778,   -152,   -600,   -356,   -787,   -412,    678,    783,
+   -650,  -1882,  -1499,  -1200,  -1719,  -2279,  -2191,  -1727,  -2144,  -2146,  -1012,   -999,  -1520,   -956,   -428,   -486,
+   -608,     85,   1204,    514,  -1016,   -976,   -286,    -75,    318,    628,     68,   -558,   -285,    466,    464,    325,
+    929,    735,    305,    837,    527,   -387,   -638,   -813,   -198,   1033,   1487,   1447,   1462,   1947,   1705,    424,
+   -137,   -856,  -1600,  -1006,   -841,  -1952,  -2095,   -677,   -440,  -1022,   -582,   -683,   -754,   -367,   -568,   -456,
+   -890,  -1498,   -396,    270,   -532,   -720,   -165,    287,    291,     53,   -161,    309,   1505,   1596,   1559,   2075,
+   1372,    336,     48,    193,    670,   1086,   1569,   1743,    923,    616,    814,    319,    387,    856,    265,   -302,
+   -166,   -258,   -468,   -330,    155,   -109,   -499,    485,    905,     -1,   -328,    409,    829,   1182,   1974,   1839,
+   1267,   1545,   1901,   1440,   1672,   2149,   1087,    541,   1048,   1243,   1601,   2044,   2017,    905,   -531,    440,
+   1272,   -163,   -337,   -635,  -1455,   -992,  -1399,  -1558,   -732,   -344,   -125,   -154,   -111,   -254,   -138,    768,
+    826,    585,   1104,   1295,   1120,   1449,   1232,     59,     84,    332,   -315,    102,    669,    195,   -292,   -240,
+     29,    -32,    263,    449,     75,    105,   -395,   -784,   -207,     -1,     12,    207,    395,    354,    -96,   -293,
+    -17,    619,   1603,   1392,    354,    229,    245,   -353,  -1274,   -575,   1085,     98,  -1298,   -523,   -290,   -257,
+    167,    210,    507,   -260,   -253,    685,    292,    532,   1147,    782,    415,   1058,    514,  -1281,  -1332,   -794,
+   -571,   -463,   -536,   -933,  -1755,  -2073,  -2540,  -2775,  -1813,  -1938,  -2452,  -1097,   -388,   -643,   -897,  -1794,
+  -1340,    371,    422,     79,   1015,    664,   -272,    256,    814,    873,   1053,   1528,   1319,    164,  -1302,  -2434,
+  -2197,  -1202,   -680,   -944,  -1042,   -671,  -1086,  -1498,  -1239,  -1520,  -1535,   -853,   -790,   -816,   -260,   -125,
+   -760,   -664,   -266,   -710,   -765,   -260,    924,   1667,    963,   1031,   1632,   1209,     93,   -187,    237,   -337,
+   -888,   -440,    -67,   -550,  -1143,   -685,   -389,  -1426,  -1383,   -255,    -50,    320,    537,    228,   -347,   -736,
+   -261,   -741,   -873,    -51,    -95,    301,   -245,  -1413,  -1031,   -953,   -875,   -602,    103,    715,   -373,   -498,
+   -283,   -494,     63,    267,    757,   1112,    977,    912,    594,    709,    182,  -1390,  -1343,   -984,  -1371,   -824,
+   -897,  -1388,  -1353,   -779,    568,   1223,   1274,   1184,    584,    851,   1365,     50,   -322,    435,     76,    344,
+    547,      9,   -380,   -243,    351,    692,   1546,   1532,    473,    412,     33,   -377,    110,    616,    910,    484,
+    341,    691,   1048,   2140,   2340,   1546,   1099,    814,   1139,    931,     66,    466,   1553,   2370,   2269,   1272,
+    807,    999,    872,    539,   1248,   1344,    506,   1801,   2826,   2094,   1876,   1111,   -159,    -59,   1019,    693,
+    357,   1738,   1640,   1299,   1708,    875,    649,    990,   1267,   1769,   1544,   1417,   1199,    686,   1099,    667,
+     -7,    507,    422,    674,    453,   -604,    -72,   -148,  -1045,   -602,   -955,  -1550,   -907,  -1122,  -1490,  -1132,
+   -771,   -476,   -221,   -468,  -1307,  -1688,  -1501,   -480,    355,    544,    390,     -2,    -91,   -664,     30,   1256,
+   1062,    854,    825,    503,    484,   1249,   1074,   1085,   1496,   1064,   1418,   1482,   1157,   1007,    708,    730,
+    635,    300,     60,    287,    -91,   -679,   -838,  -2005,  -2225,  -1723,  -2488,  -2099,  -1244,  -1595,  -1600,  -1085,
+   -442,   -271,   -566,   -497,    -93,    486,    685,    451,    100,   -243,   -296,   -386,   -661,   -400,     56,     75,
+    199,   -504,   -808,    -70,   -725,   -294,    573,   -383,   -637,   -823,  -1149,   -784,   -830,  -1878,  -2639,  -2222,
+  -2433,  -2809,  -2383,  -2062,  -1872,  -1624,  -1213,  -1180,   -924,   -607,  -1010,   -628,    -75,    -77,   -382,  -1044,
+  -1211,  -1223,  -1037,   -811,   -711,   -674,  -1403,  -1064,    -41,   -930,  -1503,   -958,  -1769,  -2253,  -1699,  -2003,
+  -2066,  -1990,  -1678,   -494,   -562,   -782,    -97,   -426,   -945,  -1024,  -1084,   -762,   -576,   -311,     94,    132,
+     93,   -361,   -846,   -613,    -86,    457,    825,    472,   -440,   -435,      1,   -717,  -1078,   -337,   -287,   -824,
+   -863,   -942,   -974,   -501,   -325,   -527,   -904,  -1398,  -1494,  -1307,   -720,   -174,   -308,   -214,     11,      6,
+    352,    779,    848,    460,     14,   -140,   -490,   -720,   -590,   -280,     92,    -65,    169,    598,    456,    783,
+    789,    438,    612,    713,    767,    891,    887,    939,    956,   1006,   1443,   1384,   1212,   1280,    952,   1024,
+   1151,   1276,   1406,   1075,    564,     87,    526,    896,    -73,   -615,   -244,   -603,   -743,    -16,    -91,   -211,
+    754,   1222,    867,    959,    482,    363,   1345,    922,    395,    892,    970,    713,    647,    612,    623,    405,
+   -383,     60,    876,    586,   1354,   2199,   2141,   2153,   1888,   2029,   1991,   1784,   1700,   1041,   1239,   1597,
+   1568,   1897,   1764,   1482,   1307,   1481,   1678,   1536,   1850,   2009,   1950,   2097,   1994,   1475,    734,    395,
+    255,     84,    365,    473,    145,    285,    252,    -59,    711,   1257,    956,   1482,   2409,   2164,   1615,   2313,
+   1958,    802,   1241,   1384,    917,    757,    789,    810,    373,    -26,    -91,    -82,   -148,     56,    246,    398,
+    733,    622,    221,   -167,     -7,    368,    543,   1138,   1564,   1488,   1126,   1413,   1998,   1118,    813,   1365,
+    602,    452,    683,    -80,    -96,   -485,  -1512,  -1582,  -1339,   -369,    298,   -163,    324,    880,    165,   -137,
+    409,    662,    347,     97,    682,    801,    198,    718,    556,   -574,   -712,   -558,   -286,   -595,   -908,   -887,
+  -1894,  -2012,  -1721,  -1701,   -334,    178,   -286,   -120,    152,    501,    285,    -59,    332,    682,    822,    104,
+  -1515,  -1905,  -1152,  -1012,  -1570,  -1522,   -717,  -1170,  -2011,  -1633,  -1361,  -1327,   -718,    343,    131,  -1143,
+   -617,    523,    125,   -548,   -699,   -718,   -786,   -784,  -1246,  -2226,  -1687,   -732,  -1836,  -2179,  -1234,  -1743,
+  -2265,  -1673,  -1122,  -1485,  -1215,     20,   -753,  -1166,    -12,   -588,  -1382,   -659,     -1,   -689,  -1506,  -1049,
+  -1025,  -1549,  -1281,  -1660,  -2289,  -1685,  -1784,  -2606,  -2106,  -1599,  -1931,  -1342,   -386,   -675,  -1169,   -945,
+   -749,   -656,   -481,   -642,   -323,    545,     94,   -785,   -443,    -21,   -348,   -708,   -639,  -1244,  -2177,  -1869,
+  -1346,  -1864,  -2099,  -1077,   -884,  -1587,  -1761,  -1947,  -1465,   -397,     57,   -302,   -507,   -289,   -671,  -1090,
+  -1449,  -1419,   -693,   -286,   -511,  -1045,   -556,    -92,   -796,   -843,   -534,   -568,   -324,   -118,   -342,   -484,
+   -406,   -227,    457,    433,    -78,    349,    404,    -24,    -80,    148,    279,     44,     48,    704,   1704,   1327,
+    189,      5,   -667,  -1141,   -577,   -668,   -844,     98,    630,    185,     84,    -58,    -93,     45,   -153,   -499,
+  -1139,  -1137,   -701,   -554,   -487,   -223,    320,    416,    404,    337,    161,    134,     22,     65,     28,     69,
+    272,     84,   -341,   -623,   -725,   -697,   -458,     43,    941,   1211,    795,   1150,   1396,    907,    744,    797,
+    613,    816,   1369,   1291,    725,    587,    575,    225,    365,    793,    689,    621,    615,    156,   -366,    -79,
+    815,   1001,    985,   1541,   1952,   1925,   1468,   1056,    790,    498,    436,    268,    255,    428,    604,    972,
+   1091,   1191,   1502,   1711,   1783,   1397,    655,    666,    706,    305,    978,   1698,   1701,   1902,   1745,   1319,
+    931,    524,    628,   1017,    843,    456,    597,    611,    725,   1167,   1321,   1497,   1313,    740,    491,    791,
+   1438,   1571,   1664,   2010,   1928,   1842,   1872,   1664,   1276,    866,    409,    171,     35,   -119,     65,     11,
+    291,   1363,   1847,   1798,   1711,   1409,    879,    355,    368,    467,    369,    532,    528,    297,    433,    747,
+    836,   1005,   1167,   1158,    973,    534,    588,    741,    446,    456,    512,    371,    230,    154,    294,    249,
+    510,    843,    464,    359,    235,    -28,    106,     81,    233,    521,    418,    125,   -228,   -513,   -720,   -814,
+   -611,   -511,   -507,   -435,   -482,   -440,   -479,   -509,   -447,   -450,   -222,    -32,    207,    659,    689,    406,
+    182,     15,    108,    220,     18,   -104,   -406,   -793,   -764,   -675,   -489,   -237,     13,    185,     11,   -487,
+  -1021,  -1193,  -1181,  -1012,   -656,   -670,   -980,  -1156,  -1364,  -1519,  -1301,   -972,   -844,   -999,  -1080,   -895,
+   -766,   -656,   -616,   -523,   -286,      9,    250,    187,    108,   -133,   -505,   -517,   -488,   -544,   -596,   -715,
+   -974,  -1229,  -1061,   -750,   -553,   -515,   -583,   -715,   -928,   -764,   -601,   -652,   -596,   -712,   -825,   -672,
+   -395,   -163,   -215,   -356,   -477,   -360,     29,    250,    367,    230,     61,    175,    320,    524,    798,    880,
+    768,    572,    287,    120,     48,   -205,   -561,   -766,   -916,  -1028,   -912,   -740,   -662,   -566,   -544,   -527,
+   -534,   -751,   -866,   -894,   -916,   -920,  -1030,  -1014,   -997,  -1086,  -1070,   -938,   -675,   -264,     69,     11,
+   -184,   -371,   -532,   -354,     22,    405,    523,    191,    -84,   -200,   -346,   -201,    222,    460,    536,    587,
+    476,    282,    199,    244,    307,    192,    -51,   -345,   -701,   -707,   -552,   -616,   -787,  -1005,   -986,   -821,
+   -693,   -669,   -847,   -871,   -586,   -171,     47,    -46,   -369,   -754,   -818,   -529,   -221,   -219,   -386,   -552,
+   -828,  -1002,   -856,   -720,   -784,   -790,   -619,   -277,    115,    291,    208,    -24,   -281,   -284,   -120,    102,
+    622,   1097,   1200,   1088,    726,    364,    335,    339,    201,    114,      6,   -268,   -674,  -1048,  -1221,  -1067,
+   -512,     35,    289,    405,    475,    618,    743,    956,   1159,    962,    525,     60,    -94,    200,    576,    697,
+    386,    -45,   -405,   -612,   -457,   -231,   -140,    -32,    181,    417,    557,    499,    140,   -202,   -124,    230,
+    584,    622,    179,   -343,   -547,   -449,   -173,    225,    442,    271,   -113,   -405,   -319,     88,    684,   1165,
+   1097,    714,    464,    418,    408,    296,    213,    111,     60,    124,    -47,   -348,   -511,   -609,   -628,   -291,
+    280,    515,    288,    -90,   -202,    -40,    201,    359,    238,    133,    157,     53,   -193,   -488,   -674,   -628,
+   -353,   -127,   -223,   -485,   -590,   -282,    354,    909,   1000,    652,    303,    174,    181,    298,    558,    528,
+   -126,   -945,  -1473,  -1370,   -670,     69,    429,    480,    595,    686,    537,    292,     96,    254,    679,    748,
+    489,    280,     58,   -284,   -651,   -812,   -418,    275,    635,    569,    223,    -28,    165,    520,    950,   1466,
+   1534,    960,    140,   -367,   -125,    682,   1231,    991,    279,   -347,   -730,   -734,   -292,    265,    667,    734,
+    579,    532,    464,    172,   -207,   -463,   -403,    -93,    146,    101,   -165,   -450,   -477,   -185,    285,    729,
+    859,    788,    632,    360,    228,    352,    618,    788,    684,    391,     61,     36,    421,    685,    656,    628,
+    525,    315,    235,    263,    114,   -177,   -307,   -206,    -44,     27,    162,    279,    132,   -129,   -414,   -623,
+   -542,   -268,    140,    676,   1098,   1302,   1133,    603,     62,   -275,   -349,   -198,     29,     11,    -98,    -74,
+   -271,   -483,   -354,    -49,    339,    685,    665,    336,    208,    403,    695,    926,    945,    861,    759,    679,
+    857,   1069,   1130,   1016,    729,    439,     57,   -320,   -479,   -415,   -162,    270,    669,    631,    173,   -326,
+   -709,   -870,   -682,   -548,   -713,   -867,   -927,   -775,   -313,    250,    756,    994,    898,    852,    904,    837,
+    760,    534,    170,      7,     66,    294,    649,    971,   1170,   1106,    746,    304,    -92,   -218,   -119,    -12,
+    169,    304,    397,    508,    534,    498,    315,    127,    -78,   -536,   -903,  -1051,  -1121,   -949,   -512,    -18,
+    393,    686,    676,    505,    537,    571,    368,    -17,   -488,   -876,  -1007,   -881,   -546,    -80,    294,    406,
+    294,    131,      6,      6,    192,    367,    362,    174,   -145,   -403,   -456,   -332,   -220,   -150,    -60,   -160,
+   -406,   -608,   -738,   -719,   -536,   -230,    -10,   -145,   -533,   -802,   -779,   -471,    -49,    -35,   -480,   -900,
+  -1031,   -976,   -876,   -768,   -792,   -835,   -793,   -689,   -507,   -325,   -103,    154,    350,    375,    222,     91,
+    -86,   -386,   -580,   -704,   -712,   -509,   -392,   -478,   -563,   -620,   -802,   -864,   -701,   -657,   -692,   -527,
+   -355,   -403,   -440,   -439,   -481,   -511,   -548,   -535,   -514,   -593,   -573,   -512,   -546,   -450,   -286,     -2,
+    379,    523,    470,    315,     51,   -307,   -518,   -506,   -625,   -855,  -1007,  -1093,  -1081,   -904,   -665,   -502,
+   -347,   -159,    -30,   -110,   -367,   -574,   -729,   -858,   -910,   -850,   -881,  -1111,  -1203,  -1236,  -1330,  -1270,
+  -1087,   -909,   -804,   -764,   -698,   -520,   -322,   -346,   -563,   -697,   -808,  -1045,  -1174,  -1092,   -818,   -415,
+   -189,   -219,   -457,   -766,   -837,   -740,   -630,   -553,   -594,   -578,   -418,   -279,   -255,   -161,    -58,   -140,
+   -187,   -208,   -289,   -438,   -595,   -569,   -277,     93,    238,    113,   -131,   -216,    -97,     20,     48,    143,
+    390,    567,    675,    676,    517,    443,    473,    486,    424,    370,    339,    191,     12,   -217,   -450,   -581,
+   -683,   -625,   -324,   -103,   -128,    -72,     42,     51,    105,     94,     67,     88,    -24,   -177,   -181,    120,
+    448,    540,    596,    558,    440,    525,    783,    997,   1085,   1117,   1197,   1260,   1218,   1050,    822,    573,
+    371,    254,    122,    -36,   -245,   -300,    -45,    322,    668,    868,    977,   1047,   1002,    975,    897,    838,
+    928,    976,    926,    739,    564,    549,    550,    565,    549,    539,    701,    927,   1121,   1251,   1221,   1082,
+    976,    846,    646,    451,    280,    287,    292,    117,    118,    298,    474,    627,    814,    907,    821,    801,
+    890,    995,    944,    903,   1091,   1294,   1383,   1249,    943,    717,    630,    630,    620,    769,   1077,   1167,
+   1194,   1224,   1137,   1044,   1087,   1219,   1140,    970,    844,    604,    474,    558,    532,    361,    289,    157,
+    -98,   -153,    -16,    153,    217,    202,    283,    461,    747,    963,    815,    609,    563,    515,    470,    310,
+     67,    -43,     19,    136,    183,    192,    217,    284,    404,    464,    341,    158,     76,    124,    296,    561,
+    656,    541,    587,    690,    698,    738,    828,    909,    756,    509,    339,    145,     29,     15,     93,    113,
+     21,    -76,   -157,    -82,     57,     81,     -1,   -104,    -74,     19,    -20,    -56,    -24,    -34,     24,    172,
+    201,    173,    206,    222,    263,    429,    610,    606,    462,    293,    107,     -2,    -36,   -231,   -505,   -596,
+   -669,   -884,  -1065,  -1198,  -1255,  -1177,   -991,   -701,   -517,   -403,   -264,   -194,   -124,     -6,    215,    349,
+    259,    199,    148,    -93,   -540,   -936,  -1165,  -1350,  -1435,  -1462,  -1411,  -1163,   -972,   -877,   -659,   -444,
+   -393,   -436,   -476,   -508,   -469,   -515,   -636,   -777,  -1024,  -1149,  -1216,  -1270,  -1228,  -1114,   -991,  -1004,
+  -1089,  -1137,  -1157,  -1206,  -1225,  -1085,   -840,   -669,   -563,   -467,   -392,   -278,   -234,   -281,   -371,   -542,
+   -632,   -724,   -864,   -876,   -793,   -704,   -701,   -724,   -612,   -386,   -235,   -237,   -294,   -291,   -242,   -238,
+   -360,   -684,   -956,   -957,   -893,   -902,   -896,   -809,   -624,   -488,   -439,   -464,   -627,   -766,   -985,  -1351,
+  -1564,  -1571,  -1528,  -1452,  -1246,  -1048,   -915,   -793,   -823,   -902,   -862,   -746,   -631,   -618,   -619,   -440,
+   -282,   -159,     69,    181,    162,    116,     31,    -37,   -146,   -327,   -528,   -679,   -588,   -451,   -325,   -182,
+   -272,   -436,   -544,   -626,   -630,   -641,   -670,   -573,   -482,   -473,   -357,   -178,    -85,    -28,    -39,   -121,
+   -231,   -346,   -473,   -611,   -565,   -342,    -58,    172,    310,    443,    508,    485,    354,    245,    223,    134,
+     59,     56,    104,    263,    329,    178,     28,   -117,   -155,    136,    566,    859,   1075,   1248,   1377,   1437,
+   1258,   1040,    835,    530,    299,    160,     62,      7,     88,    313,    514,    640,    626,    526,    557,    617,
+    500,    428,    565,    684,    728,    748,    633,    465,    458,    609,    738,    726,    662,    605,    588,    714,
+    833,    829,    736,    518,    324,    256,    227,    179,    239,    342,    268,    159,    147,    249,    492,    709,
+    865,   1102,   1203,   1109,    986,    758,    435,    167,     26,    -75,   -205,   -348,   -371,    -96,    331,    655,
+    776,    771,    777,    758,    620,    413,    246,    165,    231,    379,    495,    550,    542,    627,    766,    889,
+   1073,   1188,   1202,   1067,    767,    471,    234,    182,    136,     -2,    -20,   -104,   -104,    173,    492,    704,
+    802,    922,   1026,   1083,   1122,   1002,    739,    482,    333,    335,    457,    625,    613,    468,    364,    274,
+    230,    255,    379,    504,    557,    571,    481,    326,    199,    166,    162,    196,    389,    492,    358,    172,
+     87,     77,     46,      0,      9,     76,     77,     46,     46,     59,    102,    156,     95,   -138,   -390,   -572,
+   -701,   -762,   -769,   -698,   -451,    -76,    289,    528,    646,    704,    724,    754,    647,    363,     95,   -234,
+   -616,   -849,   -925,   -785,   -496,   -284,   -247,   -271,   -141,     35,    116,    134,     67,    -45,   -140,   -238,
+   -284,   -312,   -475,   -710,   -795,   -819,   -944,   -970,   -916,   -793,   -558,   -370,   -174,    -55,    -92,   -137,
+   -200,   -274,   -318,   -360,   -428,   -528,   -582,   -510,   -437,   -487,   -511,   -371,    -54,    275,    418,    423,
+    307,     97,   -117,   -257,   -300,   -239,    -79,     26,    -78,   -333,   -514,   -580,   -672,   -703,   -562,   -472,
+   -423,   -384,   -460,   -536,   -546,   -537,   -569,   -622,   -666,   -718,   -732,   -569,   -254,     39,    178,    195,
+    148,     16,   -104,   -232,   -452,   -678,   -832,   -877,   -782,   -649,   -507,   -305,   -143,    -49,    -57,   -180,
+   -221,   -196,   -227,   -300,   -491,   -667,   -742,   -785,   -747,   -723,   -608,   -288,    -48,    -28,    -40,     14,
+     69,     66,     85,     36,   -197,   -383,   -454,   -498,   -500,   -498,   -412,   -101,    183,    239,    296,    370,
+    437,    623,    788,    948,   1160,   1268,   1305,   1256,   1010,    733,    412,     28,   -239,   -492,   -693,   -715,
+   -713,   -625,   -363,    -97,    135,    210,     99,    -26,    -30,    205,    490,    587,    529,    411,    246,      2,
+   -271,   -420,   -428,   -371,   -265,   -150,   -106,    -88,    -18,     55,     43,    -20,    -61,     -4,    152,    312,
+    450,    514,    453,    322,    250,    304,    279,     83,    -82,   -232,   -326,   -279,   -180,   -126,   -151,   -236,
+   -353,   -442,   -494,   -380,    -61,    202,    285,    273,    233,    260,    383,    514,    455,    198,    -31,   -183,
+   -305,   -331,   -260,   -229,   -183,    -59,     41,     99,     86,      7,     61,    254,    361,    355,    193,    -70,
+   -194,   -180,    -77,     10,     50,    140,    226,    243,    171,     58,    -47,    -82,    -95,    -75,     63,    242,
+    474,    657,    634,    555,    489,    375,    284,    236,    187,    144,     88,     -1,   -122,   -216,   -260,   -235,
+   -135,    -51,      8,     85,    245,    462,    538,    521,    579,    702,    797,    665,    315,    -69,   -443,   -698,
+   -742,   -642,   -467,   -257,    -61,    157,    424,    595,    561,    385,    195,     72,     -3,   -123,   -342,   -532,
+   -602,   -555,   -473,   -419,   -285,   -114,      5,     81,     20,    -98,   -110,    -21,    147,    232,    228,    175,
+     11,   -101,   -217,   -374,   -346,   -196,    -77,     20,    145,    206,    131,     79,     83,    134,    263,    336,
+    274,    114,   -154,   -439,   -563,   -541,   -471,   -356,   -223,   -114,     36,    205,    249,    187,     88,   -123,
+   -462,   -766,   -927,   -927,   -753,   -506,   -361,   -282,   -104,    103,    133,      0,    -87,    -77,    -74,    -58,
+     -8,     36,     40,     61,     87,     63,     25,     32,     69,    103,    191,    234,    133,    -23,   -154,   -243,
+   -249,   -205,   -268,   -349,   -329,   -256,   -135,    -76,   -167,   -271,   -297,   -245,   -137,    -99,   -186,   -353,
+   -529,   -644,   -625,   -394,   -100,    122,    341,    514,    576,    527,    437,    386,    365,    294,    115,    -69,
+   -121,    -25,    111,    188,    186,    209,    277,    311,    380,    414,    254,     51,   -128,   -294,   -331,   -245,
+     -1,    374,    662,    793,    796,    789,    803,    730,    655,    568,    395,    326,    390,    396,    348,    360,
+    524,    741,    835,    782,    553,    248,     86,     51,     11,    -16,     20,    104,    193,    237,    284,    442,
+    610,    635,    550,    485,    521,    595,    597,    484,    285,    138,    147,    232,    228,    128,     90,    115,
+    102,     84,     83,    122,    253,    327,    317,    212,     -8,   -159,   -326,   -428,   -377,   -424,   -513,   -541,
+   -540,   -457,   -339,   -192,     34,    244,    332,    413,    551,    663,    722,    690,    496,    238,     37,   -138,
+   -248,   -224,    -92,    -11,    -31,    -52,    -47,     -5,     44,     41,    -32,   -184,   -357,   -432,   -412,   -404,
+   -455,   -493,   -461,   -376,   -278,   -169,    -29,     60,     85,     85,     44,     62,    215,    399,    437,    255,
+     27,    -49,    -38,      9,     47,    -24,    -44,     47,    210,    388,    402,    236,      7,   -130,   -193,   -259,
+   -333,   -458,   -587,   -646,   -622,   -518,   -403,   -374,   -439,   -569,   -734,   -810,   -778,   -729,   -680,   -651,
+   -567,   -424,   -357,   -293,   -216,   -203,   -137,    -43,    -37,    -32,    -12,      0,    -29,   -117,   -141,   -163,
+   -265,   -343,   -377,   -388,   -414,   -464,   -503,   -539,   -520,   -408,   -318,   -271,   -223,   -233,   -234,   -240,
+   -318,   -320,   -269,   -257,   -283,   -366,   -516,   -751,   -961,  -1026,   -913,   -661,   -358,   -141,   -126,   -129,
+    -91,   -113,    -92,     15,    129,    136,    -45,   -295,   -435,   -449,   -356,   -255,   -280,   -363,   -367,   -278,
+   -145,    -11,     21,    -26,    -14,     44,     60,    -11,   -110,   -137,   -145,   -170,   -145,    -38,     74,     96,
+    124,    219,    295,    345,    368,    335,    241,    164,    167,    159,    120,     83,     -2,    -18,     76,     98,
+     36,     -8,    -15,     27,     89,     74,     10,     17,     78,    143,    220,    240,    252,    341,    383,    330,
+    244,    172,    185,    246,    202,     85,     19,     63,    238,    371,    338,    275,    273,    301,    334,    367,
+    395,    400,    404,    381,    324,    327,    323,    278,    289,    330,    377,    409,    385,    362,    316,    283,
+    365,    492,    579,    591,    555,    547,    577,    608,    623,    628,    609,    540,    447,    364,    269,    157,
+     89,     41,     17,     64,    131,    139,     81,     30,     53,    129,    180,    208,    204,    163,    163,    168,
+    148,     87,    -13,    -66,    -88,    -82,    -40,     23,    101,    132,    167,    252,    333,    353,    323,    299,
+    274,    269,    294,    246,    126,     61,     59,    134,    270,    322,    255,    126,     34,     33,     60,     95,
+    114,     64,      0,    -27,    -50,    -63,    -42,    -13,    -17,    -45,    -55,    -71,    -96,    -90,    -85,   -101,
+   -111,   -125,   -124,    -97,    -41,     34,     62,     32,      9,     17,     23,     28,     24,      2,    -21,    -45,
+    -56,    -41,    -21,     -8,     -4,    -15,    -29,    -40,    -34,    -13,     -6,    -25,    -55,    -79,    -78,    -54,
+    -33,    -32,    -39,    -44,    -41,    -28,    -24,    -28,    -34,    -33
+};
@@ -1,344 +1,325 @@
-const int16_t drum_hihat[] = { 0, 
-
-    -19,    195,   -187,   -271,    492,    250,   -444,    751,     60,  -2827,    156,   3423,   -292,  -2517,   -146,
-   1594,    995,    -98,  -1767,  -1285,    766,   1100,   -202,   -152,    506,   -835,  -1297,    734,   1302,    575,    490,
-   -450,  -1104,    750,    653,  -2150,  -1918,   2375,   2593,  -2051,  -1209,   1178,  -1687,  -1393,   3154,   2539,  -3782,
-  -4049,   2868,   3933,    842,   -965,  -2348,  -1755,    917,    574,   1351,   2670,  -1907,  -3156,    987,  -1002,    703,
-   6919,  -3473, -10972,   4163,  12159,    740,  -9417,   -811,   5107,  -3626,  -7094,    981,   7691,   2781,  -1058,    699,
-  -3431,  -5442,   3291,   5333,  -3232,  -5211,   4239,   3641,  -4168,   2318,   1889, -11476,  -3823,  10833,   5301,  -3627,
-  -2298,   -589,     53,   2332,    400,  -4497,  -1915,   6041,   3779,  -3835,  -6023,    -61,   6141,   5598,  -1017,  -3701,
-  -3380,  -4143,   2175,   9389,   -344,  -8072,   -463,   4978,   4152,   1917,  -5288,  -6407,    872,   3236,   3110,   1973,
-  -6412,  -4158,  10818,   7081,  -6425,  -7299,    508,   4682,   4730,    100,  -6018,  -8562,   -114,  12131,  10174, -10275,
- -12542,   6570,   9887,   2365,  -1010,  -7057,  -7519,   3080,   6846,   2437,   -870,  -4056,  -4481,   4107,   8184,  -1613,
- -11704,  -1781,   7039,   2648,  -2794,  -3797,   -891,   4615,    767,  -4843,   3537,   2815,  -7974,  -1984,   3121,  -2445,
-   3868,   3828, -10393,  -4796,  10043,   4566,  -8804,   -598,  12547,   1521,  -9612,  -4659,   2782,   4799,   3056,  -3893,
-  -3061,   5748,    508,  -7348,   1072,   9910,  -2227, -13811,   1713,   8760,  -4145,  -4748,   1108,   2784,   3753,  -3896,
-  -7561,   8526,   9088,  -4083,  -1561, -11025, -18803,  10646,  20652,   -993,  -5808,  -7284,  -9595,  10484,   2497, -21781,
-   2738,  18459,  -8536, -11498,   9039,  13667,   5953,  -6941, -18031,   3698,  20915,     29, -13422,  -8230,  -2302,  14158,
-  13791, -12803, -18465,   3487,  17207,   3544,  -5282,  -3383,  -4322,   -530,   8069,    581,   2370,  15013,   4272, -17311,
- -13440,   4878,   3225,   -362,  10762,   6720, -13468,  -6821,   3575,  -6373,   2651,  17211,   6904, -21230, -18755,  15626,
-  21796,   -119, -11615,   3001,  -1343, -14944,  -4443,  14151,  10694,  -6767,  -3188,   7198,  -9146,  -1136,  25342,   4226,
- -30887, -12526,  27201,  13181, -22564,  -2392,  15892, -10811, -17791,  14783,  25633, -13343, -19576,  18922,  19502, -17337,
- -20268,  10761,   4551, -12749,   4958,   8080,  -8106,  12336,  12503, -23872, -20218,  20227,  22851, -12124, -15990,   6550,
-  13516,   4673,  -8112,  -9828,   3784,  12819,  -6744, -14913,    173,  16028,  15758,   4429, -13362, -13336,  -1759,   1346,
-   2729,   8125,    839,  -3677,   6515,   2971,  -7736,   1837,  12622,  -8125, -22449,    610,  18361,  10268,  -7732, -10677,
-   4514,  14110,  -1914, -17929,  -7085,  12111,  18303,   7058, -20190, -24481,  12750,  25563,   -308, -21265,  -2172,  17172,
-  -3789,  -8347,  13067,   7044, -20213, -16423,  18627,  18640,  -2055,  -7308, -12379,  -9468,  17323,  13198, -18791, -16200,
-  13048,  16218,  -4057,  -4002,   2912,  -8090,  -9593,   3952,  15015,  10803,  -9298, -18012,   -717,  15537,   9373,  -4835,
- -19020, -12981,  20691,  22900, -17421, -10896,  18484,  -5139, -15792,   5824,   3781,  -6091,   6265,  13203,    618, -10315,
- -11449,  -5518,  12431,  16083, -10755, -21326,  10714,  18467,  -6257, -16580,  -3400,  11792,  10710, -10270, -14437,  14559,
-  15294, -11549, -12131,   7850,   3612, -20135, -13945,  22342,  30435,  -8037, -29407,    519,   9526,  -6415,   5829,   6475,
- -13263,  -7775,  13915,  11424,  -6705,  -2619,    141, -12632,  -5431,  15886,  14434,  -5017, -11654,   -307,   2466,  -2131,
-   1884,   5591,  -1997, -12194,  -1762,  16395,  14312, -12020, -23872,  -9546,  18337,  23635,   3146, -19683, -12270,  15276,
-   6545, -18756, -12619,  16290,  19777,  -6286, -18630,  -7013,  15804,  12923,  -8664, -14920,   5838,  10454,  -9959,  -4102,
-  12356,   6345, -10110, -16348,  -6043,  19693,  19464, -10532, -12162,    611,  -9579,  -5024,  16647,  13455, -14989, -15158,
-  14799,  14585,  -6596, -11909,  -3831,    934,   6351,   6704,  -1100,  -3623,   4959,  -2225, -14039,   -424,  10525,   3727,
-   4855,  -3223, -14985,   1007,  10385,  -3207,   7214,   3873, -21984, -10045,  16724,   8092,   5135,   4375, -17189, -15885,
-   9781,  16499,  -2969, -10885,   5181,  14121,   3317, -14813, -12650,  -1951,   4578,   1859,   -929,   9668,  20448,   5745,
- -28723, -22617,  10572,  17009,  -2522,    747,  17816,    781, -24215, -15497,  19366,  19092, -11619, -13393,   -626,   3500,
-   8599,   2526, -15077,  -9683,   3828,   4638,   6812,   9394,   4426,  -4945, -13836, -14405,   8279,  17188,   -392,  -9417,
-   -492,  -2489,  -5957,  10435,  16264,  -9030, -10838,  12214,  -4643, -14133,  12391,  16414,  -3783, -10417,  -3486,    167,
-   6434,   4207,  -9753, -12346,  11218,  16706,  -7582, -15748,   2783,  14375,  -6246, -15912,    287,  16430,  13068,  -3261,
- -13976, -10160,   1105,   6958,   8354,   3703,  -7110,  -2587,  11047,    640, -12031,  -3246,   8236,   2824,  -6093,  -1737,
-   2633,   1037,  -2065,  -3007,   3472,   7456,  -5401, -14539,   5811,  14793,  -2870, -12941,  -6766,   2925,  12699,  10501,
-  -9372, -16836,    438,  19019,   5755, -11031,  -3627,   7879,     45,  -8926,  -1203,   4243,   3500,   4921,  -3571, -12587,
-  -3379,   4706,   3318,   6836,   1651, -11402,  -5987,   4900,   6011,   3682,  -1761,  -6635,   -171,   1655,  -2619,   2782,
-   4987,  -1288,  -5752,  -6636,    227,  12048,   4716, -11905,  -4150,   2769,  -3271,   3670,   8545,  -1234,  -9365,  -6006,
-   2846,  10654,  10665,   1645, -12442, -15260,  -4388,  13728,  12441,  -1929,  -6447,  -2293,    991,   2251,   -488,  -3597,
-    809,   2417,  -1760,    541,   3927,   -598,  -3124,   2584,    473,  -8475,   3701,  16917,    139, -12883,   -587,   6747,
-  -3911,  -8460,   8344,  11952,  -9332, -17268,   8295,  22730,  -5860, -17517,   3615,   8895,    471,   5358,   2247, -14428,
- -11464,  16595,   8757, -19695,  -6872,  17409,  10930, -10880, -11059,   1786,  11087,   8511,  -5722, -15594,  -2635,  17141,
-   9116,  -8026,  -3775,   8267,  -5365, -16906,      6,  14493,   9896,  -1878, -10275,  -9041,   6236,  10195,   1414,  -5136,
-  -6212,  -4471,   4906,   5907,  -1841,  -3229,   2398,   3499,  -1519,  -3651,    231,   4973,    370,  -7331,  -5953,   3426,
-  10504,   2668, -10780,  -6726,  13892,   8110, -12773,  -7596,   7188,   5543,  -3687,  -3581,  -1086,   2081,   5953,   2991,
-  -4423,  -2779,  -4761,  -7669,  11278,  18900,  -9619, -18277,   3747,  15236,   1611, -10183,  -3679,   2668,   -267,     92,
-   7333,   3406, -10817,  -2636,   9292,  -2882,  -1353,  10249,   -811, -13112,  -4144,  10682,   2619,  -9020,    983,   8894,
-   1160,  -9324,  -4357,   5616,   6406,   1224,  -5509,  -7346,   2218,  11405,   3628,  -9317,  -8905,   3598,   7833,   1225,
-  -7877,  -3632,   8944,   8423,  -7629, -11864,   3904,   9017,   1976,  -4059,  -6240,  -2161,   8503,   5033,  -5835,  -3768,
-   2776,   1265,  -2751,  -2033,   -128,   1929,   6481,   4345,  -7604,  -4630,   5184,   -315,  -4586,   1829,   6199,    968,
-  -7263,  -4835,   7476,   8121, -10084, -11950,   5019,  15913,   6000,  -9222, -10769,  -4170,   2471,   7565,   4518,  -5936,
-  -7363,   3945,   9566,   1350,  -2928,  -3329,  -8114,  -5000,   8823,  11651,  -5158, -12346,   4882,  12112,   2281, -11533,
- -10889,   2130,  13340,   4506,  -7408,  -1726,   3139,   -228,  -1678,   -683,   -999,    503,   2597,    618,  -3224,    -11,
-   2838,  -2595,  -4166,   5460,   9504,  -4617, -12524,    319,  11877,   7732,  -9182, -13314,    342,  14825,   5799,  -8426,
-  -4561,   2668,   1611,    672,  -1697,  -6793,  -2142,   8945,   5535,  -8155,  -2678,   5433,    372,  -1727,  -1665,  -3317,
-   3120,   3946,  -4807,    545,   5482,  -5530,  -7156,   2953,   8478,   4766,  -4225,  -9963,  -1813,   8966,   6017,  -5076,
-  -8494,    476,   8024,   4353,  -3533,  -1414,  -1605,  -4356,   4859,   7043,  -6585,  -4563,   4642,   -112,  -2693,   2220,
-    652,  -1888,   1752,   3688,  -1603,  -4468,    171,   2651,   1310,    360,   1013,  -2535,  -4739,   3415,   6372,  -3818,
-  -5441,   4448,   6049,  -4314,  -7348,   2039,   7674,   2302,  -6343,  -5267,   1327,   5791,    748,  -3921,   -377,   5200,
-   1653,  -7569,  -5684,   6136,   9566,  -3496,  -9191,   2934,   8526,   -130,  -7377,  -1259,   2874,    753,   -890,  -2812,
-   -770,   7672,   5172,  -9640,  -7223,   4056,   4517,    676,   1785,    913,  -3212,  -2581,   2711,   3519,  -1011,  -5804,
-  -2475,   3223,   4262,   2151,   -775,  -3394,    574,   4303,   -545,  -6465,  -4516,   5223,   8515,   2926,  -6543,  -8130,
-  -3568,   5295,   8227,   2836,  -6254,  -5103,    874,   3817,   -270,  -2916,   -545,   3052,   3698,    -47,  -3618,  -2651,
-   2852,   3825,     62,  -3233,  -2061,  -1705,   -698,   4573,   4980,  -3208,  -5734,   -191,   4620,   1788,   -914,  -1843,
-  -2328,    748,   5103,     68,  -3826,   1835,   2677,  -3348,  -5132,   2374,   5873,    983,  -2109,  -1232,  -1430,  -1295,
-   -288,   -532,   1913,   5434,   2863,  -5392,  -4855,   3368,   1810,  -3933,  -1454,   5028,   5834,  -1264,  -7492,  -2725,
-   6930,   3628,  -1722,  -1328,  -2170,  -1839,   2794,   2557,   -213,  -1046,    -59,   -324,     78,   -706,  -1876,    -17,
-   4179,   3511,  -3985,  -7037,  -1344,   7130,   4888,   -936,  -3310,  -2137,   -436,    484,  -1508,    759,   4753,    845,
-  -2198,    -20,  -2214,  -2494,   3402,   3424,   -809,  -2600,  -2955,     52,   5937,   1967,  -5151,  -3708,   2638,   2412,
-   -334,   1490,   1059,  -3340,  -2137,    122,  -1773,   -266,   3968,   2090,  -3778,  -1661,   4682,    120,  -3785,   1980,
-   5034,  -1308,  -8176,  -3050,   5589,   5791,  -1976,  -3797,    651,   1996,   1425,   1213,  -2752,  -4034,    166,   3117,
-   1989,   -168,  -1895,  -2099,  -1002,   1170,   3258,   1421,  -4261,  -2011,   5979,   2472,  -5090,  -5113,   1077,   4753,
-   2815,  -2552,  -2506,   1526,    239,   -908,   2454,     81,  -4560,   -348,   7723,    733, -12893,  -4590,  10098,   7540,
-  -5772,  -5350,   4500,   4049,  -1221,  -2430,  -1776,  -1189,   1047,   1819,    286,   -268,   -438,  -3011,  -2401,   5509,
-   5144,  -4757,  -6062,    628,   4657,    150,  -3929,  -2466,   3867,   4720,  -1134,  -4952,  -1949,   2021,   2352,   3078,
-   1965,  -5206,  -5742,   1655,   5370,   3301,   -828,  -4379,  -3121,    919,   1558,   2432,   3983,  -1032,  -5558,  -2793,
-   3102,   1924,  -2810,   -618,   3413,   1559,  -4242,  -3100,   3666,   4556,   -893,  -5228,  -2520,   1829,   4072,   1734,
-  -2637,  -3758,    374,    669,  -1253,   2221,   3006,  -1937,  -3231,   -401,    621,    500,   1775,    519,  -2391,    713,
-   3707,  -2262,  -2770,   4589,   3087,  -5054,  -6021,   2171,   5067,   1690,   -962,  -2453,  -3437,    156,   3810,   2196,
-  -3298,  -3123,   1214,   3169,   1739,   -629,  -2480,  -2281,   -950,   1480,   3391,   1384,  -3627,  -1968,   2390,    950,
-     72,    505,  -2278,   -633,   3703,    329,  -3369,  -1326,   1467,   1253,    224,   -176,    463,    510,  -1707,  -2058,
-    175,   1497,   1515,   1931,   -247,  -4207,  -3515,   3395,   2548,  -3410,  -1241,   3045,    689,  -3308,   -308,   3845,
-    367,  -3269,   -692,   4245,   2098,  -3563,  -3975,    453,   4297,   1806,  -3945,  -4328,   3101,   4281,  -1346,  -2976,
-    300,    952,  -1712,   -820,   1658,   1453,    499,   -962,  -1997,   1687,   4300,  -2408,  -6233,   -113,   7177,   2597,
-  -5172,  -2866,   2471,   2288,  -1883,  -2186,    778,   2483,    893,   -618,   -218,  -1102,  -2394,     38,   3011,   2055,
-  -1779,  -1843,    354,   1022,    561,    417,    -22,   -771,  -1479,   -912,   1123,   1880,   -100,   -629,    363,   -133,
-  -1094,   -335,   1279,    718,  -1003,  -1083,    574,   1564,    270,   -611,     63,     61,  -1352,   -778,   1831,    483,
-  -1627,    735,   2257,    -92,  -2566,   -913,   1679,   1697,   -114,  -1231,   -519,    554,    569,   -344,   -128,    156,
-  -1249,  -1057,   2368,   4168,   -623,  -4847,   -685,   3419,    527,  -4675,  -1413,   4384,   3988,   -361,  -2911,  -2401,
-   -103,   1789,   1077,   -766,   -129,   2739,   1639,  -2094,  -3212,   -529,   1771,   2097,    792,  -1315,  -1950,   -157,
-    773,    869,   1900,   -247,  -4721,   -658,   5717,   2971,  -4071,  -5126,   -286,   3044,   3449,   2169,  -1068,  -3931,
-  -2067,   3212,   3838,  -1555,  -3301,   -776,   1462,   1907,   1338,  -1472,  -2845,     41,   4174,    798,  -4582,  -3156,
-   3160,   4807,     31,  -3609,  -3197,    119,   2788,   2564,   -504,  -2654,  -1713,   2132,   3676,   -178,  -5651,  -2377,
-   3759,   3439,   -927,  -2003,     -3,    463,    344,    440,   -736,  -1020,    463,   1252,   1176,     41,  -2222,  -2275,
-    473,   1917,   2298,    975,  -3133,  -2758,   3515,   3699,  -1244,  -4009,  -1536,   1956,   2195,  -1532,  -1578,   2942,
-   2287,  -1224,  -1559,   -961,  -1283,     65,   1944,   1523,   -588,  -1543,   -736,   1441,   1726,  -1360,  -3415,    755,
-   2799,   -908,  -1072,   1269,    494,  -1146,   -807,    159,    135,    124,   1150,   1219,  -1056,  -3365,  -1207,   2259,
-   2577,    601,   -963,  -2005,  -1340,   1187,   2751,   -238,  -2489,    -83,   1477,    135,   -528,    502,   -568,  -1751,
-    704,   1228,  -1533,   -986,   1292,   2086,    859,  -2032,  -3791,   -494,   2713,   2227,    198,  -1420,  -1589,    613,
-   1586,   -695,  -2009,   -191,   2187,   1336,   -799,  -1556,   -627,    -93,     65,    758,   1191,    485,  -1295,  -1550,
-    650,   1777,   -201,  -2415,   -785,   1473,   1612,   -123,  -1659,  -1373,    707,   1412,    -89,  -1258,   -270,   1549,
-    848,  -1421,  -2200,    178,   2072,   1292,   -706,   -883,   -157,   -648,   -571,    844,   1074,    208,   -437,   -652,
-    388,    912,  -1927,  -2038,   2323,   2942,   -445,  -2585,  -1102,    780,   1488,    135,  -1521,  -1166,   1065,   1446,
-   -220,  -1048,   -830,    249,   1315,    215,  -2096,   -879,   1503,   1802,   -122,  -1541,  -1594,    -76,    846,   1020,
-   1188,     92,  -2106,  -1617,    213,   1379,    718,   -109,   -205,    429,    634,   -574,  -2010,   -739,   2269,   1874,
-   -770,  -1918,   -438,    841,   1031,     25,  -1104,  -1167,    240,   1074,    902,    596,     53,  -1197,  -1463,   -111,
-   1648,    999,   -718,  -1034,    356,    818,   -401,  -1146,   -115,   1516,   1268,   -785,  -2126,   -411,   1765,   1508,
-  -1117,  -1583,    327,   1474,    715,   -691,  -1099,   -304,    823,    691,   -475,  -1386,   -166,   1587,   1568,   -566,
-  -1594,   -601,    211,    284,    669,    814,   -592,  -1906,   -146,   1884,   1546,   -785,  -1954,   -634,   1920,   1681,
-  -1016,  -1794,    -31,   1590,    645,  -1011,  -1093,    462,    968,    -10,   -674,   -351,    296,    378,    172,     10,
-   -367,   -280,    176,    468,    412,   -102,   -670,   -386,    481,    618,    -14,   -652,   -373,     61,    472,    460,
-   -390,   -941,    418,   1298,    125,  -1262,   -689,    392,    357,    235,    440,   -238,   -768,     -6,    801,    294,
-   -312,     -7,    119,   -253,   -333,   -177,    218,    977,    717,   -784,  -1338,   -407,    942,   1031,    182,   -576,
-   -769,   -496,    345,   1205,    591,  -1085,  -1003,    547,   1155,   -184,   -410,    591,    -42,   -887,    -65,    921,
-    333,   -703,   -215,    545,    215,   -836,   -484,    973,    969,   -168,   -909,   -566,    206,    883,    389,   -747,
-  -1036,    228,    944,    262,   -628,   -504,    165,    202,    -84,    205,    776,    442,   -511,   -655,   -139,    451,
-    390,   -243,   -396,    650,    461,  -1109,  -1295,    332,   1961,   1031,  -1049,  -1767,     42,   1035,    335,   -591,
-   -276,    399,    255,   -366,   -259,    887,    937,   -641,  -1389,    -90,   1142,    344,    -22,    337,   -371,   -758,
-   -139,    260,    446,    443,   -291,   -595,   -205,    519,   1124,    564,  -1206,   -651,   1213,    321,   -992,   -599,
-    148,    632,   1002,    187,   -894,   -875,    341,    888,    265,   -603,   -348,    308,    196,    141,    514,    305,
-   -531,  -1060,   -305,    754,    702,   -712,   -722,    663,    965,   -190,  -1011,   -219,    564,    344,   -408,   -299,
-    352,    429,     75,    -44,   -228,   -621,   -393,    794,    771,   -390,   -879,   -376,    279,    840,    672,   -488,
-  -1371,   -342,   1214,    878,   -318,   -859,   -289,    333,    263,   -597,   -604,    240,    850,    382,   -588,   -840,
-     81,    805,    218,   -231,   -104,   -167,   -265,   -100,     59,     13,   -300,   -723,   -167,   1021,   1092,   -246,
-  -1390,   -727,    490,    753,   -123,   -300,    289,    392,   -321,   -651,     33,    526,    190,   -434,   -362,    143,
-    406,     63,   -375,   -242,    145,    188,     48,    176,     -2,   -475,      0,    556,   -120,   -589,   -304,     38,
-    444,    800,    337,   -565,   -920,   -289,    325,    277,   -293,   -135,    451,    434,   -184,   -524,   -321,    -90,
-    130,    389,    122,   -406,   -364,    228,    568,     64,   -564,   -512,    219,    495,    175,    -83,   -103,   -382,
-   -588,    167,    948,    517,   -380,   -722,   -172,    442,    309,   -404,   -323,     63,     95,    228,    183,   -386,
-    -97,    539,     75,   -585,   -213,    587,    401,    -37,   -130,   -591,   -784,    283,    985,    436,   -412,   -254,
-     84,     18,    152,    302,    -75,   -313,   -101,    201,    222,    146,     98,    -28,   -238,   -230,     47,    142,
-     40,    122,    -84,   -576,   -158,    624,    601,    -20,   -451,   -473,   -107,    305,    393,    218,    116,     24,
-   -234,   -290,    130,    319,     45,   -178,    106,    199,   -216,   -298,    113,    505,    328,   -129,   -314,    127,
-    504,    241,   -311,   -476,    -53,    361,    275,      0,    162,    103,   -401,   -278,    172,     93,   -216,    -23,
-    514,    399,   -244,   -610,    -90,    423,    267,   -178,   -229,     90,    366,    381,    107,   -227,   -327,   -231,
-   -108,    169,    454,    235,     -6,    146,     95,   -253,   -288,    226,    409,     47,    -67,     33,   -100,   -298,
-   -151,    280,    510,    352,   -127,   -325,      4,    386,    -42,   -494,   -253,    236,    249,    -67,    -98,    -30,
-   -102,      7,    238,    131,   -262,   -175,    352,    341,    -28,   -277,   -178,    241,    628,    133,   -526,   -492,
-     72,    240,    -44,   -194,     -4,    236,    202,     59,    -90,   -191,   -103,     88,      5,   -122,    -69,     67,
-    125,     55,   -142,   -152,    128,    296,    186,      0,   -125,   -208,    -55,    353,    296,   -308,   -469,    -46,
-    439,    340,   -115,   -395,    -89,    207,    244,    157,     -9,   -108,    178,    306,    -21,   -350,   -222,    165,
-    377,    251,    -87,   -226,    -85,     76,     84,    135,    183,     11,    -25,    191,    149,   -159,   -268,      7,
-    151,     94,     93,     47,    -81,     -2,     77,    -52,   -169,     35,    346,    225,   -136,   -347,   -144,    165,
-    281,    142,     88,    126,     34,    -71,    -29,     97,    152,     47,   -217,   -338,   -158,    202,    317,    128,
-    -65,     19,    241,    191,    -82,   -225,     22,    223,    157,    -63,    -65,     87,     86,    -68,    -94,    116,
-    121,   -168,   -270,    -15,    261,    222,     71,    -14,    -48,    -17,     42,     45,     -5,    -13,     -9,     13,
-     38,      8,    -55,    -27,    115,    153,     32,   -101,    -93,    -25,     49,     73,     32,    -15,     76,    174,
-     11,   -231,   -247,      7,    162,    162,     77,     12,     -2,     25,     -5,    -78,    -80,      1,     27,    -60,
-    -80,    -11,     22,     70,    160,     96,    -86,   -202,   -141,      8,     50,   -112,   -109,     79,    166,     46,
-    -47,    -37,    -67,    -62,     -3,    -15,    -11,     56,     28,    -86,   -108,   -161,   -237,   -161,     23,     98,
-     61,     58,     37,    -75,   -156,   -121,    -58,    -58,    -75,    -59,    -32,    -35,    -11,     60,    126,    116,
-    -26,   -142,    -97,     38,    143,     49,   -148,   -206,    -53,     67,     29,    -40,    -15,    -26,   -118,   -151,
-   -108,    -55,    -37,    -29,    -49,    -45,    -29,    -28,    -69,    -77,    -15,      1,    -96,   -217,   -173,    -39,
-     10,    -86,   -118,     -6,     90,     87,     62,     27,    -85,   -225,   -201,    -56,     40,    -42,   -196,   -263,
-   -114,     84,    153,     75,     21,     29,    -17,   -127,   -221,   -174,    -37,     86,    107,     93,     60,    -32,
-   -127,   -143,   -100,    -80,    -66,    -35,     52,    105,      4,   -120,   -127,    -32,     33,     42,    -38,   -118,
-    -80,     81,     71,   -142,   -278,   -181,     16,    113,     93,     18,    -13,     32,     52,    -10,      8,     38,
-    -88,   -156,    -64,     41,     29,    -89,   -184,    -85,     97,     47,    -79,    -96,    -29,     39,    129,     84,
-    -77,   -135,     37,     61,   -106,   -127,    -17,      2,    -53,    -18,     60,     82,    103,    135,    111,     71,
-     51,     35,     40,     71,     72,     80,    113,    115,     67,     12,      3,     23,     39,     30,     19,    -21,
-   -101,   -140,   -141,    -92,     57,    157,     35,    -54,    -21,     20,     40,     81,     89,     69,     40,     21,
-     22,     34,     27,     18,     29,     42,     26,      8,     29,     69,    100,     84,     45,     29,     48,     65,
-     74,     37,    -55,   -115,   -116,   -153,   -127,     38,     47,    -83,    -66,     29,     36,     15,    130,    245,
-    158,      2,    -45,     19,     29,    -28,    -72,    -37,     21,     14,    -27,     -8,     75,     69,      0,    -23,
-    -19,    -26,    -22,    -23,    -27,    -11,     12,     32,     40,     22,      3,     15,     23,     -5,    -58,    -53,
-      7,     38,    -21,    -81,    -66,    -11,     53,     89,     19,    -66,    -46,    -12,    -40,    -71,    -35,      4,
-     18,     31,      9,    -48,    -21,     30,     -8,    -52,    -37,    -17,    -32,    -51,    -68,    -86,    -68,     -1,
-     16,    -30,    -57,      8,     67,     28,    -44,    -79,    -60,    -17,      6,     -8,    -33,    -47,    -39,    -23,
-    -27,    -39,     -6,     16,    -20,    -56,    -65,    -62,    -46,    -29,    -26,    -27,    -25,     14,     80,     70,
-    -21,    -30,    -13,    -63,    -89,    -67,    -53,    -28,      3,      8,     -6,    -23,    -28,     -3,      7,    -20,
-    -38,    -48,    -55,    -29,     -7,    -18,      3,     24,    -33,    -92,    -45,     63,     58,     -8,    -36,    -29,
-    -15,     13,      5,    -49,    -89,    -32,     27,     12,    -37,    -49,    -10,     17,    -20,    -98,    -93,    -28,
-      8,    -16,    -25,     22,     79,     81,     16,    -61,    -76,      0,     55,      2,   -102,   -117,    -96,    -77,
-    -23,      1,    -31,      0,     39,     -1,    -45,    -34,    -24,    -53,    -65,    -56,    -49,    -16,     32,     -1,
-    -54,    -38,    -12,    -50,    -86,    -30,      9,     -4,      1,     -9,    -51,    -31,     -6,    -22,    -13,      0,
-     -9,      4,    -12,    -96,   -113,    -52,    -12,    -46,    -60,    -21,     27,     63,     61,     -4,    -48,    -40,
-    -36,    -46,    -63,    -87,    -64,      0,     25,     24,     -4,    -89,   -108,    -33,     -1,      9,     48,     58,
-     45,     28,    -29,    -56,      4,     61,     29,    -51,    -87,    -69,     -6,     42,     21,    -33,    -73,    -52,
-    -20,     -3,     10,     21,     19,     17,      8,    -24,    -33,     17,     44,     15,    -27,    -29,    -11,    -13,
-    -15,    -11,    -14,    -12,     -1,    -14,    -34,    -24,      0,     18,     -5,    -68,    -76,     -3,     27,      9,
-     -9,    -31,    -18,     32,     42,     16,     -3,     -2,     26,     34,     -2,     13,     51,     22,    -13,    -18,
-    -34,    -38,    -10,      9,    -19,    -31,     18,     57,     27,    -14,     11,     33,     24,     43,     50,     22,
-     40,     59,     19,    -13,     43,    109,     86,     36,    -28,    -32,      9,     47,     38,    -14,    -10,     44,
-     39,    -27,    -64,    -12,     60,     87,     33,    -42,    -56,      4,     47,     36,      7,      9,     45,     70,
-     45,     -3,    -18,     19,     54,     35,      4,     43,     63,     18,    -16,    -10,     18,     77,     95,     49,
-     33,     87,    119,     95,     59,     37,      8,    -21,    -20,      7,     45,     53,     29,     15,     26,     33,
-     36,     56,     68,     55,     44,     29,     11,     16,     13,     -4,     17,     52,     46,     30,     50,     74,
-     61,     39,     27,     25,     41,     55,     42,     22,     26,     45,     38,     24,     46,     87,     90,     46,
-     14,     16,     21,      5,      0,     30,     70,     77,     59,     46,     55,     81,     83,     42,      7,     10,
-     19,     18,     22,     41,     72,     86,     52,     21,     40,     71,     38,    -20,    -10,     45,     68,     18,
-    -22,      3,     59,     55,     27,     30,     32,     22,     33,     50,     49,     44,     50,     52,     52,     48,
-     26,     15,     42,     47,     24,     31,     50,     33,      0,     -4,     24,     60,     79,     70,     59,     66,
-     51,     18,     25,     53,     60,     53,     51,     51,     32,      4,     19,     84,     84,     26,      0,     37,
-     73,     54,     10,     14,     75,     90,     48,     20,     49,     74,     58,     30,     19,     27,     61,     82,
-     59,     36,     44,     72,     81,     70,     49,     41,     52,     64,     39,      4,      4,     46,     67,     28,
-    -14,    -11,     22,     38,     50,     58,     53,     59,     77,     51,     11,     10,     46,     70,     51,     16,
-     20,     73,     94,     56,     -2,      2,     41,     53,     10,    -22,      0,     52,     70,     38,     13,     26,
-     56,     43,      0,    -31,    -24,      3,     26,     16,      2,      3,     21,     33,     14,    -20,    -17,     14,
-      6,    -15,    -16,    -13,    -16,    -19,    -26,    -11,     27,     39,     32,     33,     46,     58,     62,     46,
-     18,    -23,    -40,     -7,     35,      9,    -17,      1,     19,      2,    -29,    -47,    -31,      7,      9,    -13,
-    -31,    -11,     33,     65,     19,    -36,    -29,     21,     19,    -28,    -44,    -34,    -29,    -17,     -4,    -13,
-    -19,      5,     29,     14,      9,     18,      0,    -14,     -6,    -27,    -46,    -19,     14,     -4,    -54,    -53,
-     -9,     22,    -15,    -46,    -15,     24,     -3,    -46,    -38,    -40,    -42,     15,     26,    -39,    -47,      0,
-     14,    -44,    -90,    -93,    -52,     -6,      1,    -54,    -69,    -17,     24,     11,    -15,    -13,     -9,    -29,
-    -60,    -78,    -78,    -56,    -29,    -20,    -42,    -46,    -28,    -11,    -11,    -50,   -100,    -65,      5,    -31,
-    -83,    -73,    -36,    -37,    -64,    -77,    -53,    -24,    -31,    -38,    -37,    -46,    -19,     29,      6,    -63,
-   -100,    -67,    -32,    -26,    -51,    -58,    -36,    -16,    -49,   -106,   -103,    -51,    -21,    -52,    -67,    -53,
-    -35,    -15,     -7,    -42,    -52,    -18,     -4,    -39,    -76,    -68,    -49,    -44,    -62,    -77,    -65,    -38,
-    -42,    -46,    -33,    -41,    -32,     14,    -20,    -89,    -66,    -39,    -47,    -44,    -63,    -86,    -24,     27,
-     -1,    -57,    -62,    -33,    -11,    -27,    -60,    -63,    -26,     18,     27,     -8,    -50,    -59,    -52,    -50,
-    -71,   -103,    -96,    -25,      1,    -39,    -68,    -22,     39,     34,    -28,    -71,    -42,      4,     16,    -30,
-    -65,    -39,     18,     -9,    -78,    -89,    -53,    -14,     -5,    -64,   -114,    -57,     -2,    -23,    -70,    -61,
-    -19,     -6,    -40,    -74,    -65,    -34,    -14,    -22,    -44,    -49,    -22,    -12,    -32,    -53,    -48,    -31,
-    -22,    -23,    -29,    -44,    -58,    -61,    -55,    -63,    -73,    -53,    -21,    -22,    -55,    -43,     -4,      4,
-    -11,    -25,    -33,    -35,    -37,    -35,    -32,    -29,    -26,    -24,    -24,    -23,    -32,    -56,    -62,    -34,
-    -13,    -34,    -55,    -37,    -13,    -19,    -34,    -35,    -43,    -47,    -31,    -13,      2,      2,    -32,    -39,
-      5,      7,    -22,    -17,      0,     -3,    -12,    -11,    -10,     -9,    -19,    -45,    -72,    -63,    -36,    -34,
-    -55,    -66,    -52,    -32,     -9,     16,     15,     -6,    -11,      9,     15,     -2,      2,      2,    -46,    -83,
-    -53,      0,     -1,      3,     47,     46,     -2,    -53,    -78,    -51,     22,     35,      8,     21,     47,     19,
-    -16,     13,     15,    -36,    -14,     27,      8,      0,     23,     43,     33,    -10,    -37,     15,     35,    -11,
-     10,     30,    -25,    -16,     37,     29,     -9,     -8,     22,     38,      7,    -59,    -41,     47,     96,     34,
-    -13,     12,     24,     -2,    -16,     -6,     -3,      2,     38,     54,     20,     -5,      9,     41,     38,     10,
-     -7,     14,     41,     37,     14,     31,     82,     87,     50,     10,      1,     14,     37,     35,     19,     26,
-     60,     53,     -7,    -29,      1,     35,     43,     51,     49,     10,     -5,     34,     42,     -7,    -40,     10,
-     43,     23,     23,     42,     53,     81,     86,     42,     14,     28,     39,     19,      1,     -8,     -3,     32,
-     59,     26,     21,     63,     51,      4,     -8,      7,     19,     41,     60,     48,     18,     29,     55,     44,
-      4,      5,     33,     29,     21,     29,     31,     44,     63,     37,     17,     38,     61,     55,     34,     18,
-     18,     30,     32,     22,     -1,    -19,     10,     68,     76,     47,     13,     10,     42,     72,     43,     23,
-     33,     36,     41,     50,     22,      5,     16,      6,    -11,     -1,     19,     27,     25,     10,     -6,      0,
-     32,     29,      3,      5,     18,     20,     16,      0,     -8,     42,     89,     78,     14,    -22,    -14,     10,
-      5,    -10,     14,     63,     91,     49,    -14,    -43,    -13,      1,    -26,    -51,    -16,     45,     56,     21,
-    -14,    -19,     -2,     20,     18,    -11,    -35,     -4,     23,     15,      0,      7,     17,      3,     -8,     -9,
-    -22,    -18,      7,      0,    -41,    -57,     -5,     26,     11,     -6,     -2,      0,     -4,      0,      5,     -3,
-      0,     11,      0,    -16,    -20,    -13,      6,     18,     -5,    -33,    -23,     26,     49,     32,      3,     -8,
-     -3,      0,    -21,    -31,      9,     30,      3,    -22,    -24,     -8,     20,     20,      3,     17,     31,     15,
-     -2,     -9,    -23,    -34,    -21,    -13,    -22,     -2,     17,     -1,      0,      8,    -35,    -51,    -13,      2,
-    -19,    -22,     15,     40,     36,     18,     -8,    -16,     21,     39,      7,    -31,    -22,      5,      8,    -11,
-    -20,      5,     31,     17,    -31,    -42,    -18,     -1,      6,      4,      1,      9,     16,     20,      9,    -24,
-    -37,     11,     43,     -2,    -38,    -16,     34,     36,      4,     -8,     12,     24,     16,     -2,    -43,    -68,
-    -12,     29,    -22,    -55,    -33,     -3,     17,     14,     -6,      9,     47,     49,      9,    -22,    -20,     -1,
-      6,    -10,    -33,    -22,     12,      2,    -32,    -38,    -19,      6,     39,     24,    -15,    -28,    -11,    -11,
-    -25,    -23,    -14,    -11,    -16,    -25,    -31,    -22,     -3,     10,    -15,    -57,    -58,     -1,     32,     11,
-     -7,      7,     32,     30,     -8,    -64,    -70,    -29,     -9,    -33,    -34,      0,     25,     27,     14,     -1,
-      0,     21,     26,      8,    -11,    -22,    -15,      2,    -14,    -54,    -60,     -7,     25,      0,    -34,    -26,
-      6,     23,     12,    -18,    -17,     15,     34,     -3,    -33,    -20,     -3,     -2,     -7,    -12,     -7,      4,
-      0,    -16,    -36,    -41,    -17,     17,      2,    -33,    -31,     13,     35,     12,    -33,    -42,      1,     33,
-      5,    -41,    -29,      1,     13,      9,      9,     15,     31,     46,     32,    -12,    -17,     22,     30,    -13,
-    -45,     -9,     28,     11,    -34,    -46,    -31,      2,     33,     30,    -18,    -35,      0,     34,     10,    -41,
-    -45,      6,     50,     18,    -36,    -49,    -13,     24,     33,     18,      5,      2,      5,    -18,    -31,    -25,
-    -16,     10,     21,     -6,     -3,     22,     17,    -15,    -37,    -26,     -1,      0,    -15,    -15,    -10,      4,
-     30,     19,     -9,     -1,     17,      2,    -20,    -24,    -17,     -7,      6,     12,     11,     12,     15,     24,
-     39,     34,     21,    -16,    -37,    -25,    -11,    -12,      6,     29,     32,     31,     37,     28,      3,    -14,
-    -15,      6,     35,     29,      4,      9,     25,     -1,    -18,     -9,    -25,    -24,     13,     16,    -15,    -24,
-      1,     13,     -7,    -23,      0,     31,     39,     34,     30,     24,     11,     -8,    -11,     10,      6,    -13,
-     14,     39,     31,     24,     -1,    -31,    -18,     -4,    -11,    -15,     -3,     30,     57,     12,    -38,    -10,
-     16,     19,     34,     26,     20,     56,     47,    -12,    -41,    -12,     24,     36,     22,      5,      6,     16,
-     21,     16,     -8,    -28,      7,     73,     83,      8,    -34,     -6,     46,     53,     39,     34,     43,     52,
-     39,      0,     -2,     51,     63,     23,     -4,     28,     87,     97,     26,    -20,      8,     18,     12,     20,
-     11,     17,     65,     62,     27,     22,     34,     55,     74,     31,     -8,     24,     51,     32,     12,     25,
-     50,     65,     55,     34,     13,      5,     33,     76,     50,      0,      2,     41,     50,     24,      3,     -6,
-      0,     32,     59,     60,     66,     76,     63,     25,      5,     22,     46,     50,     26,      2,     11,     41,
-     46,     37,     27,      8,      9,     45,     43,      4,     -7,     37,     51,     -1,    -36,    -10,     52,     72,
-     29,    -18,      8,     33,      5,    -15,    -17,    -25,     -6,     26,     38,     20,      9,     27,     43,      1,
-    -73,    -67,    -22,    -10,    -25,    -30,    -25,      1,     39,     52,      4,    -41,    -36,      2,     24,     21,
-     15,     20,     16,    -20,    -51,    -45,    -10,     25,     35,      3,    -30,    -35,    -14,      3,     -8,    -41,
-    -36,      0,      3,     -1,     13,     17,     15,     19,    -17,    -66,    -51,     30,     37,    -52,    -72,    -11,
-     37,     10,    -26,    -26,      1,      7,     -8,    -19,    -23,    -18,      3,     -6,    -49,    -47,    -10,     10,
-     -7,    -24,    -26,    -15,     -7,     -8,    -11,     -4,      5,     12,      9,    -22,    -63,    -51,    -11,    -34,
-    -64,    -59,    -40,    -12,     12,    -18,    -32,      4,     19,     -2,    -13,     -9,    -20,    -33,    -17,     -7,
-    -30,    -42,    -18,     -2,    -40,    -61,    -35,     -7,     -4,    -23,    -37,     -6,     34,     -7,    -65,    -68,
-    -22,      3,      0,    -28,    -39,    -17,      5,    -14,    -46,    -27,     -1,      0,    -12,    -23,    -33,    -24,
-     -5,      0,    -19,    -36,    -39,    -16,     -3,    -34,    -81,    -58,     -3,    -21,    -47,    -31,    -14,    -11,
-    -10,    -21,    -23,    -10,     -9,    -21,    -32,    -35,    -24,     -7,    -13,    -37,    -59,    -43,      0,     15,
-    -38,    -70,    -56,    -36,    -18,    -12,    -51,    -65,    -17,     15,    -22,    -64,    -38,    -14,    -15,    -15,
-    -40,    -77,    -50,     -2,      7,    -13,     -7,     10,    -11,    -48,    -52,    -10,      4,    -29,    -64,    -51,
-    -23,    -20,    -29,    -50,    -65,    -14,     43,      2,    -45,    -41,     -6,     30,     36,    -16,    -38,    -13,
-    -14,    -33,    -34,    -32,    -26,     -9,    -14,    -46,    -53,    -24,    -32,    -53,    -36,    -41,    -55,      0,
-     38,     -5,    -77,    -71,    -17,     -1,    -37,    -62,    -30,      7,     18,      2,    -23,    -37,    -15,      9,
-     14,     -7,    -16,      3,     20,    -12,    -49,    -36,    -14,     -4,     -3,    -18,    -19,     31,     56,     22,
-    -33,    -43,    -10,     27,      9,    -32,    -25,      6,     11,    -11,    -30,    -38,    -32,    -17,    -20,    -44,
-    -39,    -16,    -13,    -16,    -16,    -23,    -13,     16,     17,    -20,    -33,      8,     20,     -5,    -22,    -24,
-    -16,      3,      2,    -14,    -13,      2,     13,      5,    -17,    -27,    -17,    -17,    -19,    -19,    -26,    -10,
-     29,      6,    -40,    -31,      4,     30,     39,      4,    -25,      7,     41,     30,     -8,    -31,    -19,     19,
-     13,    -23,    -23,     15,     15,    -27,    -14,     33,     49,     49,     47,     27,      9,     12,     25,     27,
-     25,     26,     29,     32,     28,     16,     15,     30,     32,     20,     12,     21,     39,     43,     22,      8,
-     16,     18,     15,     19,     16,     17,     31,     31,     20,     18,     21,     28,     34,     21,      8,     18,
-     27,     21,     15,     18,     26,     31,     28,     21,     14,     11,     20,     35,     26,      9,     10,     23,
-     26,     17,     10,      6,      8,     20,     29,     30,     32,     36,     31,     17,     10,     16,     25,     27,
-     18,      9,     12,     23,     25,     22,     18,     11,     11,     25,     25,      9,      4,     22,     28,      7,
-     -6,      3,     28,     37,     19,      0,     11,     21,      9,      1,      0,     -2,      4,     18,     23,     16,
-     11,     19,     26,      8,    -23,    -21,     -1,      3,     -3,     -5,     -3,      8,     25,     31,     10,    -10,
-     -8,      9,     19,     18,     15,     17,     16,      0,    -15,    -12,      4,     20,     25,     10,     -5,     -7,
-      2,     10,      5,    -10,     -7,     10,     11,      9,     16,     18,     17,     19,      1,    -22,    -15,     26,
-     29,    -15,    -25,      5,     30,     16,     -2,     -2,     12,     15,      6,      1,      0,      1,     13,      8,
-    -13,    -13,      6,     18,      8,      0,     -1,      4,      8,      8,      6,     10,     16,     20,     18,      1,
-    -21,    -14,      7,     -5,    -22,    -19,     -9,      7,     20,      3,     -4,     16,     25,     13,      6,      9,
-      2,     -4,      4,     10,     -2,    -10,      3,     13,     -8,    -20,     -6,     11,     12,      1,     -7,     11,
-     36,     10,    -24,    -26,      2,     18,     15,     -1,     -8,      5,     19,      7,    -12,      0,     15,     15,
-      8,      1,     -4,      0,     12,     16,      3,     -7,     -8,      6,     14,     -5,    -36,    -21,     14,      2,
-    -14,     -4,      7,      9,      9,      2,      1,     10,     10,      2,     -4,     -7,      0,     12,      7,     -8,
-    -23,    -12,     17,     27,     -9,    -31,    -22,     -8,      3,      8,    -19,    -28,      4,     27,      0,    -28,
-    -10,      6,      5,      5,    -12,    -39,    -20,     14,     22,      6,     11,     23,      8,    -18,    -21,      8,
-     19,     -6,    -31,    -20,     -1,      0,     -6,    -21,    -33,      4,     48,     16,    -18,    -13,     12,     39,
-     44,      2,    -14,      5,      5,     -9,    -10,     -8,     -6,      5,      3,    -22,    -30,     -6,    -11,    -26,
-    -11,    -18,    -33,     15,     49,     11,    -50,    -47,     -2,     13,    -15,    -38,    -13,     19,     31,     19,
-     -4,    -19,     -3,     19,     25,      7,      0,     15,     27,      0,    -27,    -13,      4,     10,     12,     -3,
-     -8,     37,     60,     29,    -20,    -27,      5,     40,     20,    -22,    -17,     16,     22,     -2,    -16,    -18,
-    -15,     -1,      0,    -27,    -27,     -2,      4,     -1,     -4,     -9,      2,     26,     20,    -15,    -24,     14,
-     23,      1,    -10,     -7,     -2,     10,     12,      0,     -7,      4,     16,      8,     -4,     -7,     -3,     -6,
-     -6,     -4,    -13,     -8,     18,     10,    -16,    -14,      7,     27,     30,      5,    -16,      0,     26,     30,
-      6,    -14,    -12,     12,     12,     -9,     -7,     15,     14,    -10,      0,     28,     31,     20,     17,     17,
-     15,     12,     11,     11,     11,     12,     11,     11,     11,     11,     10,     10,      9,      7,      5,      4,
-      3,      3,      3,      3,      3,      3,      3,      3,      3,      2,      2,      2,      2,      2,      2,      2,
-      2,      2,      2,      2,      2,      2,      2,      2,      2,      2,      2,      1,      1,      1,      1,      1,
-      1,      1,      1,      1,      1,      1,      1,      1,      1,      0,      0,      0,      0,      0,      0,      0,
-      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,
-      0,      0,      0,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,
-     -1,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,
-     -2,     -2,     -2,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,
-     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,
-     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,
-     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,
-     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,
-     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,
-     -2,     -2,     -2,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,
-     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,
-     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1};
+// Prepared by tools/sample_prep.py, trimmed at -60dB
+#define drum_hihat_len        5068
+#define drum_hihat_peak       30887
+#define drum_hihat_gain       3873
+#define drum_hihat_loop_start 0
+#define drum_hihat_loop_end   0
+const int16_t drum_hihat[] = {
+    -19,    195,   -187,   -271,    492,    250,   -444,    751,     60,  -2827,    156,   3423,   -292,  -2517,   -146,   1594,
+    995,    -98,  -1767,  -1285,    766,   1100,   -202,   -152,    506,   -835,  -1297,    734,   1302,    575,    490,   -450,
+  -1104,    750,    653,  -2150,  -1918,   2375,   2593,  -2051,  -1209,   1178,  -1687,  -1393,   3154,   2539,  -3782,  -4049,
+   2868,   3933,    842,   -965,  -2348,  -1755,    917,    574,   1351,   2670,  -1907,  -3156,    987,  -1002,    703,   6919,
+  -3473, -10972,   4163,  12159,    740,  -9417,   -811,   5107,  -3626,  -7094,    981,   7691,   2781,  -1058,    699,  -3431,
+  -5442,   3291,   5333,  -3232,  -5211,   4239,   3641,  -4168,   2318,   1889, -11476,  -3823,  10833,   5301,  -3627,  -2298,
+   -589,     53,   2332,    400,  -4497,  -1915,   6041,   3779,  -3835,  -6023,    -61,   6141,   5598,  -1017,  -3701,  -3380,
+  -4143,   2175,   9389,   -344,  -8072,   -463,   4978,   4152,   1917,  -5288,  -6407,    872,   3236,   3110,   1973,  -6412,
+  -4158,  10818,   7081,  -6425,  -7299,    508,   4682,   4730,    100,  -6018,  -8562,   -114,  12131,  10174, -10275, -12542,
+   6570,   9887,   2365,  -1010,  -7057,  -7519,   3080,   6846,   2437,   -870,  -4056,  -4481,   4107,   8184,  -1613, -11704,
+  -1781,   7039,   2648,  -2794,  -3797,   -891,   4615,    767,  -4843,   3537,   2815,  -7974,  -1984,   3121,  -2445,   3868,
+   3828, -10393,  -4796,  10043,   4566,  -8804,   -598,  12547,   1521,  -9612,  -4659,   2782,   4799,   3056,  -3893,  -3061,
+   5748,    508,  -7348,   1072,   9910,  -2227, -13811,   1713,   8760,  -4145,  -4748,   1108,   2784,   3753,  -3896,  -7561,
+   8526,   9088,  -4083,  -1561, -11025, -18803,  10646,  20652,   -993,  -5808,  -7284,  -9595,  10484,   2497, -21781,   2738,
+  18459,  -8536, -11498,   9039,  13667,   5953,  -6941, -18031,   3698,  20915,     29, -13422,  -8230,  -2302,  14158,  13791,
+ -12803, -18465,   3487,  17207,   3544,  -5282,  -3383,  -4322,   -530,   8069,    581,   2370,  15013,   4272, -17311, -13440,
+   4878,   3225,   -362,  10762,   6720, -13468,  -6821,   3575,  -6373,   2651,  17211,   6904, -21230, -18755,  15626,  21796,
+   -119, -11615,   3001,  -1343, -14944,  -4443,  14151,  10694,  -6767,  -3188,   7198,  -9146,  -1136,  25342,   4226, -30887,
+ -12526,  27201,  13181, -22564,  -2392,  15892, -10811, -17791,  14783,  25633, -13343, -19576,  18922,  19502, -17337, -20268,
+  10761,   4551, -12749,   4958,   8080,  -8106,  12336,  12503, -23872, -20218,  20227,  22851, -12124, -15990,   6550,  13516,
+   4673,  -8112,  -9828,   3784,  12819,  -6744, -14913,    173,  16028,  15758,   4429, -13362, -13336,  -1759,   1346,   2729,
+   8125,    839,  -3677,   6515,   2971,  -7736,   1837,  12622,  -8125, -22449,    610,  18361,  10268,  -7732, -10677,   4514,
+  14110,  -1914, -17929,  -7085,  12111,  18303,   7058, -20190, -24481,  12750,  25563,   -308, -21265,  -2172,  17172,  -3789,
+  -8347,  13067,   7044, -20213, -16423,  18627,  18640,  -2055,  -7308, -12379,  -9468,  17323,  13198, -18791, -16200,  13048,
+  16218,  -4057,  -4002,   2912,  -8090,  -9593,   3952,  15015,  10803,  -9298, -18012,   -717,  15537,   9373,  -4835, -19020,
+ -12981,  20691,  22900, -17421, -10896,  18484,  -5139, -15792,   5824,   3781,  -6091,   6265,  13203,    618, -10315, -11449,
+  -5518,  12431,  16083, -10755, -21326,  10714,  18467,  -6257, -16580,  -3400,  11792,  10710, -10270, -14437,  14559,  15294,
+ -11549, -12131,   7850,   3612, -20135, -13945,  22342,  30435,  -8037, -29407,    519,   9526,  -6415,   5829,   6475, -13263,
+  -7775,  13915,  11424,  -6705,  -2619,    141, -12632,  -5431,  15886,  14434,  -5017, -11654,   -307,   2466,  -2131,   1884,
+   5591,  -1997, -12194,  -1762,  16395,  14312, -12020, -23872,  -9546,  18337,  23635,   3146, -19683, -12270,  15276,   6545,
+ -18756, -12619,  16290,  19777,  -6286, -18630,  -7013,  15804,  12923,  -8664, -14920,   5838,  10454,  -9959,  -4102,  12356,
+   6345, -10110, -16348,  -6043,  19693,  19464, -10532, -12162,    611,  -9579,  -5024,  16647,  13455, -14989, -15158,  14799,
+  14585,  -6596, -11909,  -3831,    934,   6351,   6704,  -1100,  -3623,   4959,  -2225, -14039,   -424,  10525,   3727,   4855,
+  -3223, -14985,   1007,  10385,  -3207,   7214,   3873, -21984, -10045,  16724,   8092,   5135,   4375, -17189, -15885,   9781,
+  16499,  -2969, -10885,   5181,  14121,   3317, -14813, -12650,  -1951,   4578,   1859,   -929,   9668,  20448,   5745, -28723,
+ -22617,  10572,  17009,  -2522,    747,  17816,    781, -24215, -15497,  19366,  19092, -11619, -13393,   -626,   3500,   8599,
+   2526, -15077,  -9683,   3828,   4638,   6812,   9394,   4426,  -4945, -13836, -14405,   8279,  17188,   -392,  -9417,   -492,
+  -2489,  -5957,  10435,  16264,  -9030, -10838,  12214,  -4643, -14133,  12391,  16414,  -3783, -10417,  -3486,    167,   6434,
+   4207,  -9753, -12346,  11218,  16706,  -7582, -15748,   2783,  14375,  -6246, -15912,    287,  16430,  13068,  -3261, -13976,
+ -10160,   1105,   6958,   8354,   3703,  -7110,  -2587,  11047,    640, -12031,  -3246,   8236,   2824,  -6093,  -1737,   2633,
+   1037,  -2065,  -3007,   3472,   7456,  -5401, -14539,   5811,  14793,  -2870, -12941,  -6766,   2925,  12699,  10501,  -9372,
+ -16836,    438,  19019,   5755, -11031,  -3627,   7879,     45,  -8926,  -1203,   4243,   3500,   4921,  -3571, -12587,  -3379,
+   4706,   3318,   6836,   1651, -11402,  -5987,   4900,   6011,   3682,  -1761,  -6635,   -171,   1655,  -2619,   2782,   4987,
+  -1288,  -5752,  -6636,    227,  12048,   4716, -11905,  -4150,   2769,  -3271,   3670,   8545,  -1234,  -9365,  -6006,   2846,
+  10654,  10665,   1645, -12442, -15260,  -4388,  13728,  12441,  -1929,  -6447,  -2293,    991,   2251,   -488,  -3597,    809,
+   2417,  -1760,    541,   3927,   -598,  -3124,   2584,    473,  -8475,   3701,  16917,    139, -12883,   -587,   6747,  -3911,
+  -8460,   8344,  11952,  -9332, -17268,   8295,  22730,  -5860, -17517,   3615,   8895,    471,   5358,   2247, -14428, -11464,
+  16595,   8757, -19695,  -6872,  17409,  10930, -10880, -11059,   1786,  11087,   8511,  -5722, -15594,  -2635,  17141,   9116,
+  -8026,  -3775,   8267,  -5365, -16906,      6,  14493,   9896,  -1878, -10275,  -9041,   6236,  10195,   1414,  -5136,  -6212,
+  -4471,   4906,   5907,  -1841,  -3229,   2398,   3499,  -1519,  -3651,    231,   4973,    370,  -7331,  -5953,   3426,  10504,
+   2668, -10780,  -6726,  13892,   8110, -12773,  -7596,   7188,   5543,  -3687,  -3581,  -1086,   2081,   5953,   2991,  -4423,
+  -2779,  -4761,  -7669,  11278,  18900,  -9619, -18277,   3747,  15236,   1611, -10183,  -3679,   2668,   -267,     92,   7333,
+   3406, -10817,  -2636,   9292,  -2882,  -1353,  10249,   -811, -13112,  -4144,  10682,   2619,  -9020,    983,   8894,   1160,
+  -9324,  -4357,   5616,   6406,   1224,  -5509,  -7346,   2218,  11405,   3628,  -9317,  -8905,   3598,   7833,   1225,  -7877,
+  -3632,   8944,   8423,  -7629, -11864,   3904,   9017,   1976,  -4059,  -6240,  -2161,   8503,   5033,  -5835,  -3768,   2776,
+   1265,  -2751,  -2033,   -128,   1929,   6481,   4345,  -7604,  -4630,   5184,   -315,  -4586,   1829,   6199,    968,  -7263,
+  -4835,   7476,   8121, -10084, -11950,   5019,  15913,   6000,  -9222, -10769,  -4170,   2471,   7565,   4518,  -5936,  -7363,
+   3945,   9566,   1350,  -2928,  -3329,  -8114,  -5000,   8823,  11651,  -5158, -12346,   4882,  12112,   2281, -11533, -10889,
+   2130,  13340,   4506,  -7408,  -1726,   3139,   -228,  -1678,   -683,   -999,    503,   2597,    618,  -3224,    -11,   2838,
+  -2595,  -4166,   5460,   9504,  -4617, -12524,    319,  11877,   7732,  -9182, -13314,    342,  14825,   5799,  -8426,  -4561,
+   2668,   1611,    672,  -1697,  -6793,  -2142,   8945,   5535,  -8155,  -2678,   5433,    372,  -1727,  -1665,  -3317,   3120,
+   3946,  -4807,    545,   5482,  -5530,  -7156,   2953,   8478,   4766,  -4225,  -9963,  -1813,   8966,   6017,  -5076,  -8494,
+    476,   8024,   4353,  -3533,  -1414,  -1605,  -4356,   4859,   7043,  -6585,  -4563,   4642,   -112,  -2693,   2220,    652,
+  -1888,   1752,   3688,  -1603,  -4468,    171,   2651,   1310,    360,   1013,  -2535,  -4739,   3415,   6372,  -3818,  -5441,
+   4448,   6049,  -4314,  -7348,   2039,   7674,   2302,  -6343,  -5267,   1327,   5791,    748,  -3921,   -377,   5200,   1653,
+  -7569,  -5684,   6136,   9566,  -3496,  -9191,   2934,   8526,   -130,  -7377,  -1259,   2874,    753,   -890,  -2812,   -770,
+   7672,   5172,  -9640,  -7223,   4056,   4517,    676,   1785,    913,  -3212,  -2581,   2711,   3519,  -1011,  -5804,  -2475,
+   3223,   4262,   2151,   -775,  -3394,    574,   4303,   -545,  -6465,  -4516,   5223,   8515,   2926,  -6543,  -8130,  -3568,
+   5295,   8227,   2836,  -6254,  -5103,    874,   3817,   -270,  -2916,   -545,   3052,   3698,    -47,  -3618,  -2651,   2852,
+   3825,     62,  -3233,  -2061,  -1705,   -698,   4573,   4980,  -3208,  -5734,   -191,   4620,   1788,   -914,  -1843,  -2328,
+    748,   5103,     68,  -3826,   1835,   2677,  -3348,  -5132,   2374,   5873,    983,  -2109,  -1232,  -1430,  -1295,   -288,
+   -532,   1913,   5434,   2863,  -5392,  -4855,   3368,   1810,  -3933,  -1454,   5028,   5834,  -1264,  -7492,  -2725,   6930,
+   3628,  -1722,  -1328,  -2170,  -1839,   2794,   2557,   -213,  -1046,    -59,   -324,     78,   -706,  -1876,    -17,   4179,
+   3511,  -3985,  -7037,  -1344,   7130,   4888,   -936,  -3310,  -2137,   -436,    484,  -1508,    759,   4753,    845,  -2198,
+    -20,  -2214,  -2494,   3402,   3424,   -809,  -2600,  -2955,     52,   5937,   1967,  -5151,  -3708,   2638,   2412,   -334,
+   1490,   1059,  -3340,  -2137,    122,  -1773,   -266,   3968,   2090,  -3778,  -1661,   4682,    120,  -3785,   1980,   5034,
+  -1308,  -8176,  -3050,   5589,   5791,  -1976,  -3797,    651,   1996,   1425,   1213,  -2752,  -4034,    166,   3117,   1989,
+   -168,  -1895,  -2099,  -1002,   1170,   3258,   1421,  -4261,  -2011,   5979,   2472,  -5090,  -5113,   1077,   4753,   2815,
+  -2552,  -2506,   1526,    239,   -908,   2454,     81,  -4560,   -348,   7723,    733, -12893,  -4590,  10098,   7540,  -5772,
+  -5350,   4500,   4049,  -1221,  -2430,  -1776,  -1189,   1047,   1819,    286,   -268,   -438,  -3011,  -2401,   5509,   5144,
+  -4757,  -6062,    628,   4657,    150,  -3929,  -2466,   3867,   4720,  -1134,  -4952,  -1949,   2021,   2352,   3078,   1965,
+  -5206,  -5742,   1655,   5370,   3301,   -828,  -4379,  -3121,    919,   1558,   2432,   3983,  -1032,  -5558,  -2793,   3102,
+   1924,  -2810,   -618,   3413,   1559,  -4242,  -3100,   3666,   4556,   -893,  -5228,  -2520,   1829,   4072,   1734,  -2637,
+  -3758,    374,    669,  -1253,   2221,   3006,  -1937,  -3231,   -401,    621,    500,   1775,    519,  -2391,    713,   3707,
+  -2262,  -2770,   4589,   3087,  -5054,  -6021,   2171,   5067,   1690,   -962,  -2453,  -3437,    156,   3810,   2196,  -3298,
+  -3123,   1214,   3169,   1739,   -629,  -2480,  -2281,   -950,   1480,   3391,   1384,  -3627,  -1968,   2390,    950,     72,
+    505,  -2278,   -633,   3703,    329,  -3369,  -1326,   1467,   1253,    224,   -176,    463,    510,  -1707,  -2058,    175,
+   1497,   1515,   1931,   -247,  -4207,  -3515,   3395,   2548,  -3410,  -1241,   3045,    689,  -3308,   -308,   3845,    367,
+  -3269,   -692,   4245,   2098,  -3563,  -3975,    453,   4297,   1806,  -3945,  -4328,   3101,   4281,  -1346,  -2976,    300,
+    952,  -1712,   -820,   1658,   1453,    499,   -962,  -1997,   1687,   4300,  -2408,  -6233,   -113,   7177,   2597,  -5172,
+  -2866,   2471,   2288,  -1883,  -2186,    778,   2483,    893,   -618,   -218,  -1102,  -2394,     38,   3011,   2055,  -1779,
+  -1843,    354,   1022,    561,    417,    -22,   -771,  -1479,   -912,   1123,   1880,   -100,   -629,    363,   -133,  -1094,
+   -335,   1279,    718,  -1003,  -1083,    574,   1564,    270,   -611,     63,     61,  -1352,   -778,   1831,    483,  -1627,
+    735,   2257,    -92,  -2566,   -913,   1679,   1697,   -114,  -1231,   -519,    554,    569,   -344,   -128,    156,  -1249,
+  -1057,   2368,   4168,   -623,  -4847,   -685,   3419,    527,  -4675,  -1413,   4384,   3988,   -361,  -2911,  -2401,   -103,
+   1789,   1077,   -766,   -129,   2739,   1639,  -2094,  -3212,   -529,   1771,   2097,    792,  -1315,  -1950,   -157,    773,
+    869,   1900,   -247,  -4721,   -658,   5717,   2971,  -4071,  -5126,   -286,   3044,   3449,   2169,  -1068,  -3931,  -2067,
+   3212,   3838,  -1555,  -3301,   -776,   1462,   1907,   1338,  -1472,  -2845,     41,   4174,    798,  -4582,  -3156,   3160,
+   4807,     31,  -3609,  -3197,    119,   2788,   2564,   -504,  -2654,  -1713,   2132,   3676,   -178,  -5651,  -2377,   3759,
+   3439,   -927,  -2003,     -3,    463,    344,    440,   -736,  -1020,    463,   1252,   1176,     41,  -2222,  -2275,    473,
+   1917,   2298,    975,  -3133,  -2758,   3515,   3699,  -1244,  -4009,  -1536,   1956,   2195,  -1532,  -1578,   2942,   2287,
+  -1224,  -1559,   -961,  -1283,     65,   1944,   1523,   -588,  -1543,   -736,   1441,   1726,  -1360,  -3415,    755,   2799,
+   -908,  -1072,   1269,    494,  -1146,   -807,    159,    135,    124,   1150,   1219,  -1056,  -3365,  -1207,   2259,   2577,
+    601,   -963,  -2005,  -1340,   1187,   2751,   -238,  -2489,    -83,   1477,    135,   -528,    502,   -568,  -1751,    704,
+   1228,  -1533,   -986,   1292,   2086,    859,  -2032,  -3791,   -494,   2713,   2227,    198,  -1420,  -1589,    613,   1586,
+   -695,  -2009,   -191,   2187,   1336,   -799,  -1556,   -627,    -93,     65,    758,   1191,    485,  -1295,  -1550,    650,
+   1777,   -201,  -2415,   -785,   1473,   1612,   -123,  -1659,  -1373,    707,   1412,    -89,  -1258,   -270,   1549,    848,
+  -1421,  -2200,    178,   2072,   1292,   -706,   -883,   -157,   -648,   -571,    844,   1074,    208,   -437,   -652,    388,
+    912,  -1927,  -2038,   2323,   2942,   -445,  -2585,  -1102,    780,   1488,    135,  -1521,  -1166,   1065,   1446,   -220,
+  -1048,   -830,    249,   1315,    215,  -2096,   -879,   1503,   1802,   -122,  -1541,  -1594,    -76,    846,   1020,   1188,
+     92,  -2106,  -1617,    213,   1379,    718,   -109,   -205,    429,    634,   -574,  -2010,   -739,   2269,   1874,   -770,
+  -1918,   -438,    841,   1031,     25,  -1104,  -1167,    240,   1074,    902,    596,     53,  -1197,  -1463,   -111,   1648,
+    999,   -718,  -1034,    356,    818,   -401,  -1146,   -115,   1516,   1268,   -785,  -2126,   -411,   1765,   1508,  -1117,
+  -1583,    327,   1474,    715,   -691,  -1099,   -304,    823,    691,   -475,  -1386,   -166,   1587,   1568,   -566,  -1594,
+   -601,    211,    284,    669,    814,   -592,  -1906,   -146,   1884,   1546,   -785,  -1954,   -634,   1920,   1681,  -1016,
+  -1794,    -31,   1590,    645,  -1011,  -1093,    462,    968,    -10,   -674,   -351,    296,    378,    172,     10,   -367,
+   -280,    176,    468,    412,   -102,   -670,   -386,    481,    618,    -14,   -652,   -373,     61,    472,    460,   -390,
+   -941,    418,   1298,    125,  -1262,   -689,    392,    357,    235,    440,   -238,   -768,     -6,    801,    294,   -312,
+     -7,    119,   -253,   -333,   -177,    218,    977,    717,   -784,  -1338,   -407,    942,   1031,    182,   -576,   -769,
+   -496,    345,   1205,    591,  -1085,  -1003,    547,   1155,   -184,   -410,    591,    -42,   -887,    -65,    921,    333,
+   -703,   -215,    545,    215,   -836,   -484,    973,    969,   -168,   -909,   -566,    206,    883,    389,   -747,  -1036,
+    228,    944,    262,   -628,   -504,    165,    202,    -84,    205,    776,    442,   -511,   -655,   -139,    451,    390,
+   -243,   -396,    650,    461,  -1109,  -1295,    332,   1961,   1031,  -1049,  -1767,     42,   1035,    335,   -591,   -276,
+    399,    255,   -366,   -259,    887,    937,   -641,  -1389,    -90,   1142,    344,    -22,    337,   -371,   -758,   -139,
+    260,    446,    443,   -291,   -595,   -205,    519,   1124,    564,  -1206,   -651,   1213,    321,   -992,   -599,    148,
+    632,   1002,    187,   -894,   -875,    341,    888,    265,   -603,   -348,    308,    196,    141,    514,    305,   -531,
+  -1060,   -305,    754,    702,   -712,   -722,    663,    965,   -190,  -1011,   -219,    564,    344,   -408,   -299,    352,
+    429,     75,    -44,   -228,   -621,   -393,    794,    771,   -390,   -879,   -376,    279,    840,    672,   -488,  -1371,
+   -342,   1214,    878,   -318,   -859,   -289,    333,    263,   -597,   -604,    240,    850,    382,   -588,   -840,     81,
+    805,    218,   -231,   -104,   -167,   -265,   -100,     59,     13,   -300,   -723,   -167,   1021,   1092,   -246,  -1390,
+   -727,    490,    753,   -123,   -300,    289,    392,   -321,   -651,     33,    526,    190,   -434,   -362,    143,    406,
+     63,   -375,   -242,    145,    188,     48,    176,     -2,   -475,      0,    556,   -120,   -589,   -304,     38,    444,
+    800,    337,   -565,   -920,   -289,    325,    277,   -293,   -135,    451,    434,   -184,   -524,   -321,    -90,    130,
+    389,    122,   -406,   -364,    228,    568,     64,   -564,   -512,    219,    495,    175,    -83,   -103,   -382,   -588,
+    167,    948,    517,   -380,   -722,   -172,    442,    309,   -404,   -323,     63,     95,    228,    183,   -386,    -97,
+    539,     75,   -585,   -213,    587,    401,    -37,   -130,   -591,   -784,    283,    985,    436,   -412,   -254,     84,
+     18,    152,    302,    -75,   -313,   -101,    201,    222,    146,     98,    -28,   -238,   -230,     47,    142,     40,
+    122,    -84,   -576,   -158,    624,    601,    -20,   -451,   -473,   -107,    305,    393,    218,    116,     24,   -234,
+   -290,    130,    319,     45,   -178,    106,    199,   -216,   -298,    113,    505,    328,   -129,   -314,    127,    504,
+    241,   -311,   -476,    -53,    361,    275,      0,    162,    103,   -401,   -278,    172,     93,   -216,    -23,    514,
+    399,   -244,   -610,    -90,    423,    267,   -178,   -229,     90,    366,    381,    107,   -227,   -327,   -231,   -108,
+    169,    454,    235,     -6,    146,     95,   -253,   -288,    226,    409,     47,    -67,     33,   -100,   -298,   -151,
+    280,    510,    352,   -127,   -325,      4,    386,    -42,   -494,   -253,    236,    249,    -67,    -98,    -30,   -102,
+      7,    238,    131,   -262,   -175,    352,    341,    -28,   -277,   -178,    241,    628,    133,   -526,   -492,     72,
+    240,    -44,   -194,     -4,    236,    202,     59,    -90,   -191,   -103,     88,      5,   -122,    -69,     67,    125,
+     55,   -142,   -152,    128,    296,    186,      0,   -125,   -208,    -55,    353,    296,   -308,   -469,    -46,    439,
+    340,   -115,   -395,    -89,    207,    244,    157,     -9,   -108,    178,    306,    -21,   -350,   -222,    165,    377,
+    251,    -87,   -226,    -85,     76,     84,    135,    183,     11,    -25,    191,    149,   -159,   -268,      7,    151,
+     94,     93,     47,    -81,     -2,     77,    -52,   -169,     35,    346,    225,   -136,   -347,   -144,    165,    281,
+    142,     88,    126,     34,    -71,    -29,     97,    152,     47,   -217,   -338,   -158,    202,    317,    128,    -65,
+     19,    241,    191,    -82,   -225,     22,    223,    157,    -63,    -65,     87,     86,    -68,    -94,    116,    121,
+   -168,   -270,    -15,    261,    222,     71,    -14,    -48,    -17,     42,     45,     -5,    -13,     -9,     13,     38,
+      8,    -55,    -27,    115,    153,     32,   -101,    -93,    -25,     49,     73,     32,    -15,     76,    174,     11,
+   -231,   -247,      7,    162,    162,     77,     12,     -2,     25,     -5,    -78,    -80,      1,     27,    -60,    -80,
+    -11,     22,     70,    160,     96,    -86,   -202,   -141,      8,     50,   -112,   -109,     79,    166,     46,    -47,
+    -37,    -67,    -62,     -3,    -15,    -11,     56,     28,    -86,   -108,   -161,   -237,   -161,     23,     98,     61,
+     58,     37,    -75,   -156,   -121,    -58,    -58,    -75,    -59,    -32,    -35,    -11,     60,    126,    116,    -26,
+   -142,    -97,     38,    143,     49,   -148,   -206,    -53,     67,     29,    -40,    -15,    -26,   -118,   -151,   -108,
+    -55,    -37,    -29,    -49,    -45,    -29,    -28,    -69,    -77,    -15,      1,    -96,   -217,   -173,    -39,     10,
+    -86,   -118,     -6,     90,     87,     62,     27,    -85,   -225,   -201,    -56,     40,    -42,   -196,   -263,   -114,
+     84,    153,     75,     21,     29,    -17,   -127,   -221,   -174,    -37,     86,    107,     93,     60,    -32,   -127,
+   -143,   -100,    -80,    -66,    -35,     52,    105,      4,   -120,   -127,    -32,     33,     42,    -38,   -118,    -80,
+     81,     71,   -142,   -278,   -181,     16,    113,     93,     18,    -13,     32,     52,    -10,      8,     38,    -88,
+   -156,    -64,     41,     29,    -89,   -184,    -85,     97,     47,    -79,    -96,    -29,     39,    129,     84,    -77,
+   -135,     37,     61,   -106,   -127,    -17,      2,    -53,    -18,     60,     82,    103,    135,    111,     71,     51,
+     35,     40,     71,     72,     80,    113,    115,     67,     12,      3,     23,     39,     30,     19,    -21,   -101,
+   -140,   -141,    -92,     57,    157,     35,    -54,    -21,     20,     40,     81,     89,     69,     40,     21,     22,
+     34,     27,     18,     29,     42,     26,      8,     29,     69,    100,     84,     45,     29,     48,     65,     74,
+     37,    -55,   -115,   -116,   -153,   -127,     38,     47,    -83,    -66,     29,     36,     15,    130,    245,    158,
+      2,    -45,     19,     29,    -28,    -72,    -37,     21,     14,    -27,     -8,     75,     69,      0,    -23,    -19,
+    -26,    -22,    -23,    -27,    -11,     12,     32,     40,     22,      3,     15,     23,     -5,    -58,    -53,      7,
+     38,    -21,    -81,    -66,    -11,     53,     89,     19,    -66,    -46,    -12,    -40,    -71,    -35,      4,     18,
+     31,      9,    -48,    -21,     30,     -8,    -52,    -37,    -17,    -32,    -51,    -68,    -86,    -68,     -1,     16,
+    -30,    -57,      8,     67,     28,    -44,    -79,    -60,    -17,      6,     -8,    -33,    -47,    -39,    -23,    -27,
+    -39,     -6,     16,    -20,    -56,    -65,    -62,    -46,    -29,    -26,    -27,    -25,     14,     80,     70,    -21,
+    -30,    -13,    -63,    -89,    -67,    -53,    -28,      3,      8,     -6,    -23,    -28,     -3,      7,    -20,    -38,
+    -48,    -55,    -29,     -7,    -18,      3,     24,    -33,    -92,    -45,     63,     58,     -8,    -36,    -29,    -15,
+     13,      5,    -49,    -89,    -32,     27,     12,    -37,    -49,    -10,     17,    -20,    -98,    -93,    -28,      8,
+    -16,    -25,     22,     79,     81,     16,    -61,    -76,      0,     55,      2,   -102,   -117,    -96,    -77,    -23,
+      1,    -31,      0,     39,     -1,    -45,    -34,    -24,    -53,    -65,    -56,    -49,    -16,     32,     -1,    -54,
+    -38,    -12,    -50,    -86,    -30,      9,     -4,      1,     -9,    -51,    -31,     -6,    -22,    -13,      0,     -9,
+      4,    -12,    -96,   -113,    -52,    -12,    -46,    -60,    -21,     27,     63,     61,     -4,    -48,    -40,    -36,
+    -46,    -63,    -87,    -64,      0,     25,     24,     -4,    -89,   -108,    -33,     -1,      9,     48,     58,     45,
+     28,    -29,    -56,      4,     61,     29,    -51,    -87,    -69,     -6,     42,     21,    -33,    -73,    -52,    -20,
+     -3,     10,     21,     19,     17,      8,    -24,    -33,     17,     44,     15,    -27,    -29,    -11,    -13,    -15,
+    -11,    -14,    -12,     -1,    -14,    -34,    -24,      0,     18,     -5,    -68,    -76,     -3,     27,      9,     -9,
+    -31,    -18,     32,     42,     16,     -3,     -2,     26,     34,     -2,     13,     51,     22,    -13,    -18,    -34,
+    -38,    -10,      9,    -19,    -31,     18,     57,     27,    -14,     11,     33,     24,     43,     50,     22,     40,
+     59,     19,    -13,     43,    109,     86,     36,    -28,    -32,      9,     47,     38,    -14,    -10,     44,     39,
+    -27,    -64,    -12,     60,     87,     33,    -42,    -56,      4,     47,     36,      7,      9,     45,     70,     45,
+     -3,    -18,     19,     54,     35,      4,     43,     63,     18,    -16,    -10,     18,     77,     95,     49,     33,
+     87,    119,     95,     59,     37,      8,    -21,    -20,      7,     45,     53,     29,     15,     26,     33,     36,
+     56,     68,     55,     44,     29,     11,     16,     13,     -4,     17,     52,     46,     30,     50,     74,     61,
+     39,     27,     25,     41,     55,     42,     22,     26,     45,     38,     24,     46,     87,     90,     46,     14,
+     16,     21,      5,      0,     30,     70,     77,     59,     46,     55,     81,     83,     42,      7,     10,     19,
+     18,     22,     41,     72,     86,     52,     21,     40,     71,     38,    -20,    -10,     45,     68,     18,    -22,
+      3,     59,     55,     27,     30,     32,     22,     33,     50,     49,     44,     50,     52,     52,     48,     26,
+     15,     42,     47,     24,     31,     50,     33,      0,     -4,     24,     60,     79,     70,     59,     66,     51,
+     18,     25,     53,     60,     53,     51,     51,     32,      4,     19,     84,     84,     26,      0,     37,     73,
+     54,     10,     14,     75,     90,     48,     20,     49,     74,     58,     30,     19,     27,     61,     82,     59,
+     36,     44,     72,     81,     70,     49,     41,     52,     64,     39,      4,      4,     46,     67,     28,    -14,
+    -11,     22,     38,     50,     58,     53,     59,     77,     51,     11,     10,     46,     70,     51,     16,     20,
+     73,     94,     56,     -2,      2,     41,     53,     10,    -22,      0,     52,     70,     38,     13,     26,     56,
+     43,      0,    -31,    -24,      3,     26,     16,      2,      3,     21,     33,     14,    -20,    -17,     14,      6,
+    -15,    -16,    -13,    -16,    -19,    -26,    -11,     27,     39,     32,     33,     46,     58,     62,     46,     18,
+    -23,    -40,     -7,     35,      9,    -17,      1,     19,      2,    -29,    -47,    -31,      7,      9,    -13,    -31,
+    -11,     33,     65,     19,    -36,    -29,     21,     19,    -28,    -44,    -34,    -29,    -17,     -4,    -13,    -19,
+      5,     29,     14,      9,     18,      0,    -14,     -6,    -27,    -46,    -19,     14,     -4,    -54,    -53,     -9,
+     22,    -15,    -46,    -15,     24,     -3,    -46,    -38,    -40,    -42,     15,     26,    -39,    -47,      0,     14,
+    -44,    -90,    -93,    -52,     -6,      1,    -54,    -69,    -17,     24,     11,    -15,    -13,     -9,    -29,    -60,
+    -78,    -78,    -56,    -29,    -20,    -42,    -46,    -28,    -11,    -11,    -50,   -100,    -65,      5,    -31,    -83,
+    -73,    -36,    -37,    -64,    -77,    -53,    -24,    -31,    -38,    -37,    -46,    -19,     29,      6,    -63,   -100,
+    -67,    -32,    -26,    -51,    -58,    -36,    -16,    -49,   -106,   -103,    -51,    -21,    -52,    -67,    -53,    -35,
+    -15,     -7,    -42,    -52,    -18,     -4,    -39,    -76,    -68,    -49,    -44,    -62,    -77,    -65,    -38,    -42,
+    -46,    -33,    -41,    -32,     14,    -20,    -89,    -66,    -39,    -47,    -44,    -63,    -86,    -24,     27,     -1,
+    -57,    -62,    -33,    -11,    -27,    -60,    -63,    -26,     18,     27,     -8,    -50,    -59,    -52,    -50,    -71,
+   -103,    -96,    -25,      1,    -39,    -68,    -22,     39,     34,    -28,    -71,    -42,      4,     16,    -30,    -65,
+    -39,     18,     -9,    -78,    -89,    -53,    -14,     -5,    -64,   -114,    -57,     -2,    -23,    -70,    -61,    -19,
+     -6,    -40,    -74,    -65,    -34,    -14,    -22,    -44,    -49,    -22,    -12,    -32,    -53,    -48,    -31,    -22,
+    -23,    -29,    -44,    -58,    -61,    -55,    -63,    -73,    -53,    -21,    -22,    -55,    -43,     -4,      4,    -11,
+    -25,    -33,    -35,    -37,    -35,    -32,    -29,    -26,    -24,    -24,    -23,    -32,    -56,    -62,    -34,    -13,
+    -34,    -55,    -37,    -13,    -19,    -34,    -35,    -43,    -47,    -31,    -13,      2,      2,    -32,    -39,      5,
+      7,    -22,    -17,      0,     -3,    -12,    -11,    -10,     -9,    -19,    -45,    -72,    -63,    -36,    -34,    -55,
+    -66,    -52,    -32,     -9,     16,     15,     -6,    -11,      9,     15,     -2,      2,      2,    -46,    -83,    -53,
+      0,     -1,      3,     47,     46,     -2,    -53,    -78,    -51,     22,     35,      8,     21,     47,     19,    -16,
+     13,     15,    -36,    -14,     27,      8,      0,     23,     43,     33,    -10,    -37,     15,     35,    -11,     10,
+     30,    -25,    -16,     37,     29,     -9,     -8,     22,     38,      7,    -59,    -41,     47,     96,     34,    -13,
+     12,     24,     -2,    -16,     -6,     -3,      2,     38,     54,     20,     -5,      9,     41,     38,     10,     -7,
+     14,     41,     37,     14,     31,     82,     87,     50,     10,      1,     14,     37,     35,     19,     26,     60,
+     53,     -7,    -29,      1,     35,     43,     51,     49,     10,     -5,     34,     42,     -7,    -40,     10,     43,
+     23,     23,     42,     53,     81,     86,     42,     14,     28,     39,     19,      1,     -8,     -3,     32,     59,
+     26,     21,     63,     51,      4,     -8,      7,     19,     41,     60,     48,     18,     29,     55,     44,      4,
+      5,     33,     29,     21,     29,     31,     44,     63,     37,     17,     38,     61,     55,     34,     18,     18,
+     30,     32,     22,     -1,    -19,     10,     68,     76,     47,     13,     10,     42,     72,     43,     23,     33,
+     36,     41,     50,     22,      5,     16,      6,    -11,     -1,     19,     27,     25,     10,     -6,      0,     32,
+     29,      3,      5,     18,     20,     16,      0,     -8,     42,     89,     78,     14,    -22,    -14,     10,      5,
+    -10,     14,     63,     91,     49,    -14,    -43,    -13,      1,    -26,    -51,    -16,     45,     56,     21,    -14,
+    -19,     -2,     20,     18,    -11,    -35,     -4,     23,     15,      0,      7,     17,      3,     -8,     -9,    -22,
+    -18,      7,      0,    -41,    -57,     -5,     26,     11,     -6,     -2,      0,     -4,      0,      5,     -3,      0,
+     11,      0,    -16,    -20,    -13,      6,     18,     -5,    -33,    -23,     26,     49,     32,      3,     -8,     -3,
+      0,    -21,    -31,      9,     30,      3,    -22,    -24,     -8,     20,     20,      3,     17,     31,     15,     -2,
+     -9,    -23,    -34,    -21,    -13,    -22,     -2,     17,     -1,      0,      8,    -35,    -51,    -13,      2,    -19,
+    -22,     15,     40,     36,     18,     -8,    -16,     21,     39,      7,    -31,    -22,      5,      8,    -11,    -20,
+      5,     31,     17,    -31,    -42,    -18,     -1,      6,      4,      1,      9,     16,     20,      9,    -24,    -37,
+     11,     43,     -2,    -38,    -16,     34,     36,      4,     -8,     12,     24,     16,     -2,    -43,    -68,    -12,
+     29,    -22,    -55,    -33,     -3,     17,     14,     -6,      9,     47,     49,      9,    -22,    -20,     -1,      6,
+    -10,    -33,    -22,     12,      2,    -32,    -38,    -19,      6,     39,     24,    -15,    -28,    -11,    -11,    -25,
+    -23,    -14,    -11,    -16,    -25,    -31,    -22,     -3,     10,    -15,    -57,    -58,     -1,     32,     11,     -7,
+      7,     32,     30,     -8,    -64,    -70,    -29,     -9,    -33,    -34,      0,     25,     27,     14,     -1,      0,
+     21,     26,      8,    -11,    -22,    -15,      2,    -14,    -54,    -60,     -7,     25,      0,    -34,    -26,      6,
+     23,     12,    -18,    -17,     15,     34,     -3,    -33,    -20,     -3,     -2,     -7,    -12,     -7,      4,      0,
+    -16,    -36,    -41,    -17,     17,      2,    -33,    -31,     13,     35,     12,    -33,    -42,      1,     33,      5,
+    -41,    -29,      1,     13,      9,      9,     15,     31,     46,     32,    -12,    -17,     22,     30,    -13,    -45,
+     -9,     28,     11,    -34,    -46,    -31,      2,     33,     30,    -18,    -35,      0,     34,     10,    -41,    -45,
+      6,     50,     18,    -36,    -49,    -13,     24,     33,     18,      5,      2,      5,    -18,    -31,    -25,    -16,
+     10,     21,     -6,     -3,     22,     17,    -15,    -37,    -26,     -1,      0,    -15,    -15,    -10,      4,     30,
+     19,     -9,     -1,     17,      2,    -20,    -24,    -17,     -7,      6,     12,     11,     12,     15,     24,     39,
+     34,     21,    -16,    -37,    -25,    -11,    -12,      6,     29,     32,     31,     37,     28,      3,    -14,    -15,
+      6,     35,     29,      4,      9,     25,     -1,    -18,     -9,    -25,    -24,     13,     16,    -15,    -24,      1,
+     13,     -7,    -23,      0,     31,     39,     34,     30,     24,     11,     -8,    -11,     10,      6,    -13,     14,
+     39,     31,     24,     -1,    -31,    -18,     -4,    -11,    -15,     -3,     30,     57,     12,    -38,    -10,     16,
+     19,     34,     26,     20,     56,     47,    -12,    -41,    -12,     24,     36,     22,      5,      6,     16,     21,
+     16,     -8,    -28,      7,     73,     83,      8,    -34,     -6,     46,     53,     39,     34,     43,     52,     39,
+      0,     -2,     51,     63,     23,     -4,     28,     87,     97,     26,    -20,      8,     18,     12,     20,     11,
+     17,     65,     62,     27,     22,     34,     55,     74,     31,     -8,     24,     51,     32,     12,     25,     50,
+     65,     55,     34,     13,      5,     33,     76,     50,      0,      2,     41,     50,     24,      3,     -6,      0,
+     32,     59,     60,     66,     76,     63,     25,      5,     22,     46,     50,     26,      2,     11,     41,     46,
+     37,     27,      8,      9,     45,     43,      4,     -7,     37,     51,     -1,    -36,    -10,     52,     72,     29,
+    -18,      8,     33,      5,    -15,    -17,    -25,     -6,     26,     38,     20,      9,     27,     43,      1,    -73,
+    -67,    -22,    -10,    -25,    -30,    -25,      1,     39,     52,      4,    -41,    -36,      2,     24,     21,     15,
+     20,     16,    -20,    -51,    -45,    -10,     25,     35,      3,    -30,    -35,    -14,      3,     -8,    -41,    -36,
+      0,      3,     -1,     13,     17,     15,     19,    -17,    -66,    -51,     30,     37,    -52,    -72,    -11,     37,
+     10,    -26,    -26,      1,      7,     -8,    -19,    -23,    -18,      3,     -6,    -49,    -47,    -10,     10,     -7,
+    -24,    -26,    -15,     -7,     -8,    -11,     -4,      5,     12,      9,    -22,    -63,    -51,    -11,    -34,    -64,
+    -59,    -40,    -12,     12,    -18,    -32,      4,     19,     -2,    -13,     -9,    -20,    -33,    -17,     -7,    -30,
+    -42,    -18,     -2,    -40,    -61,    -35,     -7,     -4,    -23,    -37,     -6,     34,     -7,    -65,    -68,    -22,
+      3,      0,    -28,    -39,    -17,      5,    -14,    -46,    -27,     -1,      0,    -12,    -23,    -33,    -24,     -5,
+      0,    -19,    -36,    -39,    -16,     -3,    -34,    -81,    -58,     -3,    -21,    -47,    -31,    -14,    -11,    -10,
+    -21,    -23,    -10,     -9,    -21,    -32,    -35,    -24,     -7,    -13,    -37,    -59,    -43,      0,     15,    -38,
+    -70,    -56,    -36,    -18,    -12,    -51,    -65,    -17,     15,    -22,    -64,    -38,    -14,    -15,    -15,    -40,
+    -77,    -50,     -2,      7,    -13,     -7,     10,    -11,    -48,    -52,    -10,      4,    -29,    -64,    -51,    -23,
+    -20,    -29,    -50,    -65,    -14,     43,      2,    -45,    -41,     -6,     30,     36,    -16,    -38,    -13,    -14,
+    -33,    -34,    -32,    -26,     -9,    -14,    -46,    -53,    -24,    -32,    -53,    -36,    -41,    -55,      0,     38,
+     -5,    -77,    -71,    -17,     -1,    -37,    -62,    -30,      7,     18,      2,    -23,    -37,    -15,      9,     14,
+     -7,    -16,      3,     20,    -12,    -49,    -36,    -14,     -4,     -3,    -18,    -19,     31,     56,     22,    -33,
+    -43,    -10,     27,      9,    -32,    -25,      6,     11,    -11,    -30,    -38,    -32,    -17,    -20,    -44,    -39,
+    -16,    -13,    -16,    -16,    -23,    -13,     16,     17,    -20,    -33,      8,     20,     -5,    -22,    -24,    -16,
+      3,      2,    -14,    -13,      2,     13,      5,    -17,    -27,    -17,    -17,    -19,    -19,    -26,    -10,     29,
+      6,    -40,    -31,      4,     30,     39,      4,    -25,      7,     41,     30,     -8,    -31,    -19,     19,     13,
+    -23,    -23,     15,     15,    -27,    -14,     33,     49,     49,     47,     27,      9,     12,     25,     27,     25,
+     26,     29,     32,     28,     16,     15,     30,     32,     20,     12,     21,     39,     43,     22,      8,     16,
+     18,     15,     19,     16,     17,     31,     31,     20,     18,     21,     28,     34,     21,      8,     18,     27,
+     21,     15,     18,     26,     31,     28,     21,     14,     11,     20,     35,     26,      9,     10,     23,     26,
+     17,     10,      6,      8,     20,     29,     30,     32,     36,     31,     17,     10,     16,     25,     27,     18,
+      9,     12,     23,     25,     22,     18,     11,     11,     25,     25,      9,      4,     22,     28,      7,     -6,
+      3,     28,     37,     19,      0,     11,     21,      9,      1,      0,     -2,      4,     18,     23,     16,     11,
+     19,     26,      8,    -23,    -21,     -1,      3,     -3,     -5,     -3,      8,     25,     31,     10,    -10,     -8,
+      9,     19,     18,     15,     17,     16,      0,    -15,    -12,      4,     20,     25,     10,     -5,     -7,      2,
+     10,      5,    -10,     -7,     10,     11,      9,     16,     18,     17,     19,      1,    -22,    -15,     26,     29,
+    -15,    -25,      5,     30,     16,     -2,     -2,     12,     15,      6,      1,      0,      1,     13,      8,    -13,
+    -13,      6,     18,      8,      0,     -1,      4,      8,      8,      6,     10,     16,     20,     18,      1,    -21,
+    -14,      7,     -5,    -22,    -19,     -9,      7,     20,      3,     -4,     16,     25,     13,      6,      9,      2,
+     -4,      4,     10,     -2,    -10,      3,     13,     -8,    -20,     -6,     11,     12,      1,     -7,     11,     36,
+     10,    -24,    -26,      2,     18,     15,     -1,     -8,      5,     19,      7,    -12,      0,     15,     15,      8,
+      1,     -4,      0,     12,     16,      3,     -7,     -8,      6,     14,     -5,    -36,    -21,     14,      2,    -14,
+     -4,      7,      9,      9,      2,      1,     10,     10,      2,     -4,     -7,      0,     12,      7,     -8,    -23,
+    -12,     17,     27,     -9,    -31,    -22,     -8,      3,      8,    -19,    -28,      4,     27,      0,    -28,    -10,
+      6,      5,      5,    -12,    -39,    -20,     14,     22,      6,     11,     23,      8,    -18,    -21,      8,     19,
+     -6,    -31,    -20,     -1,      0,     -6,    -21,    -33,      4,     48,     16,    -18,    -13,     12,     39,     44,
+      2,    -14,      5,      5,     -9,    -10,     -8,     -6,      5,      3,    -22,    -30,     -6,    -11,    -26,    -11,
+    -18,    -33,     15,     49,     11,    -50,    -47,     -2,     13,    -15,    -38,    -13,     19,     31,     19,     -4,
+    -19,     -3,     19,     25,      7,      0,     15,     27,      0,    -27,    -13,      4,     10,     12,     -3,     -8,
+     37,     60,     29,    -20,    -27,      5,     40,     20,    -22,    -17,     16,     22,     -2,    -16,    -18,    -15,
+     -1,      0,    -27,    -27,     -2,      4,     -1,     -4,     -9,      2,     26,     20,    -15,    -24,     14,     23,
+      1,    -10,     -7,     -2,     10,     12,      0,     -7,      4,     16,      8,     -4,     -7,     -3,     -6,     -6,
+     -4,    -13,     -8,     18,     10,    -16,    -14,      7,     27,     30,      5,    -16,      0,     26,     30,      6,
+    -14,    -12,     12,     12,     -9,     -7,     15,     14,    -10,      0,     28,     31
+};
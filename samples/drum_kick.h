@@ -1,1106 +1,1112 @@
-const int16_t drum_kick[] = { 0, 
-
-      0,  12883,  22983,  29270,  31500,  29994,  25425,  18640,  10520,   1887,  -6549, -14225, -20728, -25787, -29265,
- -31133, -31448, -30336, -27971, -24555, -20306, -15447, -10192,  -4743,    714,   6020,  11035,  15642,  19753,  23296,  26227,
-  28516,  30154,  31145,  31507,  31270,  30471,  29155,  27373,  25179,  22629,  19780,  16690,  13415,  10009,   6525,   3011,
-   -486,  -3925,  -7267, -10478, -13527, -16388, -19038, -21459, -23636, -25556, -27213, -28600, -29715, -30558, -31133, -31445,
- -31500, -31306, -30875, -30217, -29345, -28273, -27015, -25586, -24000, -22275, -20424, -18464, -16411, -14280, -12085,  -9843,
-  -7567,  -5270,  -2967,   -670,   1608,   3858,   6067,   8226,  10326,  12357,  14312,  16184,  17966,  19653,  21239,  22719,
-  24091,  25351,  26497,  27525,  28436,  29229,  29902,  30456,  30893,  31212,  31415,  31505,  31483,  31351,  31114,  30773,
-  30332,  29795,  29166,  28448,  27646,  26763,  25805,  24775,  23679,  22520,  21303,  20033,  18715,  17354,  15953,  14517,
-  13052,  11561,  10049,   8520,   6979,   5429,   3876,   2321,    770,   -772,  -2305,  -3824,  -5325,  -6805,  -8262,  -9691,
- -11092, -12460, -13794, -15091, -16348, -17565, -18739, -19867, -20950, -21984, -22969, -23904, -24787, -25618, -26396, -27119,
- -27788, -28402, -28961, -29464, -29911, -30303, -30639, -30920, -31146, -31317, -31434, -31497, -31507, -31465, -31371, -31227,
- -31032, -30789, -30499, -30161, -29778, -29351, -28880, -28368, -27815, -27223, -26593, -25927, -25226, -24492, -23725, -22928,
- -22102, -21248, -20368, -19464, -18537, -17589, -16621, -15634, -14631, -13612, -12580, -11536, -10480,  -9416,  -8343,  -7264,
-  -6180,  -5093,  -4003,  -2913,  -1823,   -735,    350,   1430,   2506,   3574,   4635,   5686,   6727,   7757,   8775,   9780,
-  10770,  11745,  12703,  13645,  14569,  15474,  16360,  17225,  18070,  18892,  19693,  20471,  21225,  21955,  22661,  23342,
-  23998,  24627,  25231,  25808,  26358,  26881,  27376,  27844,  28284,  28697,  29081,  29437,  29765,  30064,  30335,  30578,
-  30792,  30978,  31136,  31266,  31369,  31443,  31490,  31509,  31501,  31467,  31405,  31317,  31203,  31064,  30899,  30709,
-  30494,  30254,  29991,  29704,  29395,  29062,  28707,  28331,  27933,  27514,  27075,  26616,  26138,  25641,  25126,  24594,
-  24043,  23477,  22894,  22296,  21683,  21055,  20414,  19759,  19092,  18412,  17721,  17019,  16307,  15585,  14854,  14114,
-  13366,  12611,  11849,  11080,  10306,   9527,   8743,   7955,   7164,   6369,   5573,   4774,   3974,   3174,   2373,   1573,
-    773,    -24,   -821,  -1615,  -2406,  -3194,  -3979,  -4759,  -5534,  -6304,  -7069,  -7827,  -8579,  -9324, -10062, -10793,
- -11515, -12228, -12933, -13629, -14315, -14992, -15658, -16313, -16958, -17591, -18213, -18824, -19422, -20008, -20582, -21142,
- -21690, -22224, -22745, -23252, -23746, -24225, -24690, -25141, -25577, -25998, -26404, -26796, -27172, -27533, -27879, -28209,
- -28524, -28823, -29107, -29374, -29626, -29863, -30083, -30288, -30476, -30649, -30806, -30947, -31072, -31182, -31275, -31353,
- -31415, -31462, -31492, -31508, -31508, -31492, -31462, -31416, -31355, -31279, -31188, -31083, -30963, -30828, -30679, -30516,
- -30339, -30148, -29944, -29726, -29494, -29250, -28992, -28722, -28439, -28143, -27835, -27516, -27184, -26841, -26486, -26120,
- -25743, -25356, -24958, -24549, -24131, -23702, -23264, -22817, -22360, -21895, -21421, -20939, -20448, -19950, -19443, -18930,
- -18409, -17882, -17347, -16807, -16260, -15707, -15149, -14585, -14017, -13443, -12865, -12282, -11695, -11105, -10511,  -9914,
-  -9313,  -8710,  -8104,  -7496,  -6886,  -6274,  -5660,  -5045,  -4429,  -3813,  -3195,  -2578,  -1960,  -1343,   -725,   -109,
-    506,   1121,   1734,   2346,   2956,   3564,   4169,   4773,   5373,   5971,   6566,   7158,   7746,   8330,   8911,   9487,
-  10059,  10627,  11190,  11748,  12301,  12849,  13392,  13929,  14461,  14986,  15506,  16019,  16526,  17026,  17520,  18007,
-  18487,  18960,  19426,  19884,  20335,  20779,  21214,  21642,  22062,  22473,  22877,  23272,  23659,  24037,  24407,  24768,
-  25120,  25464,  25798,  26124,  26440,  26748,  27046,  27335,  27614,  27884,  28145,  28396,  28637,  28869,  29092,  29304,
-  29507,  29701,  29884,  30058,  30222,  30376,  30520,  30655,  30780,  30894,  30999,  31094,  31180,  31255,  31321,  31377,
-  31423,  31459,  31485,  31502,  31509,  31507,  31495,  31473,  31442,  31401,  31351,  31291,  31222,  31144,  31056,  30960,
-  30854,  30739,  30615,  30482,  30340,  30190,  30031,  29863,  29686,  29502,  29308,  29107,  28897,  28679,  28453,  28219,
-  27977,  27727,  27470,  27205,  26933,  26653,  26366,  26072,  25770,  25462,  25147,  24825,  24497,  24162,  23821,  23473,
-  23120,  22760,  22394,  22023,  21645,  21263,  20874,  20481,  20082,  19679,  19270,  18856,  18438,  18015,  17588,  17157,
-  16721,  16281,  15838,  15390,  14939,  14485,  14027,  13565,  13101,  12634,  12163,  11690,  11215,  10737,  10256,   9774,
-   9289,   8803,   8314,   7824,   7333,   6840,   6345,   5850,   5354,   4856,   4358,   3859,   3360,   2861,   2361,   1861,
-   1361,    861,    361,   -137,   -635,  -1133,  -1631,  -2127,  -2623,  -3117,  -3610,  -4102,  -4592,  -5081,  -5568,  -6053,
-  -6536,  -7017,  -7496,  -7973,  -8447,  -8919,  -9388,  -9855, -10319, -10780, -11238, -11692, -12144, -12592, -13037, -13478,
- -13916, -14350, -14780, -15206, -15629, -16047, -16461, -16871, -17277, -17678, -18075, -18467, -18854, -19237, -19615, -19988,
- -20356, -20719, -21078, -21430, -21778, -22120, -22457, -22789, -23115, -23436, -23751, -24060, -24363, -24661, -24953, -25239,
- -25519, -25794, -26062, -26324, -26580, -26830, -27073, -27311, -27542, -27767, -27986, -28198, -28404, -28603, -28796, -28982,
- -29162, -29335, -29502, -29662, -29816, -29963, -30104, -30237, -30364, -30485, -30599, -30706, -30806, -30900, -30987, -31067,
- -31141, -31208, -31268, -31321, -31368, -31408, -31442, -31468, -31489, -31502, -31509, -31509, -31502, -31489, -31470, -31444,
- -31411, -31372, -31326, -31274, -31215, -31150, -31079, -31001, -30917, -30826, -30730, -30627, -30518, -30402, -30281, -30154,
- -30020, -29881, -29735, -29584, -29427, -29263, -29095, -28920, -28740, -28554, -28362, -28165, -27963, -27755, -27541, -27323,
- -27099, -26869, -26635, -26395, -26151, -25901, -25647, -25388, -25124, -24855, -24581, -24303, -24020, -23733, -23442, -23146,
- -22845, -22541, -22232, -21920, -21603, -21282, -20958, -20629, -20297, -19961, -19622, -19279, -18933, -18583, -18230, -17874,
- -17514, -17152, -16786, -16418, -16047, -15673, -15296, -14917, -14535, -14150, -13764, -13374, -12983, -12590, -12194, -11796,
- -11397, -10995, -10592, -10187,  -9781,  -9373,  -8963,  -8553,  -8140,  -7727,  -7312,  -6897,  -6480,  -6063,  -5644,  -5225,
-  -4806,  -4385,  -3964,  -3543,  -3121,  -2699,  -2277,  -1854,  -1432,  -1009,   -587,   -165,    256,    678,   1099,   1520,
-   1940,   2360,   2779,   3197,   3614,   4031,   4446,   4861,   5274,   5686,   6097,   6507,   6915,   7322,   7727,   8130,
-   8532,   8932,   9331,   9727,  10122,  10514,  10905,  11293,  11679,  12063,  12445,  12824,  13201,  13575,  13947,  14316,
-  14682,  15046,  15407,  15765,  16120,  16472,  16821,  17168,  17511,  17850,  18187,  18520,  18850,  19177,  19500,  19820,
-  20136,  20448,  20757,  21063,  21364,  21662,  21956,  22246,  22533,  22815,  23093,  23368,  23638,  23905,  24167,  24425,
-  24679,  24929,  25174,  25415,  25652,  25884,  26112,  26336,  26555,  26770,  26980,  27186,  27387,  27584,  27776,  27963,
-  28146,  28324,  28498,  28666,  28830,  28990,  29144,  29294,  29439,  29579,  29714,  29844,  29970,  30090,  30206,  30317,
-  30423,  30524,  30621,  30712,  30798,  30880,  30956,  31028,  31094,  31156,  31213,  31264,  31311,  31353,  31390,  31422,
-  31449,  31471,  31488,  31500,  31507,  31510,  31507,  31500,  31487,  31470,  31448,  31421,  31389,  31352,  31311,  31264,
-  31213,  31157,  31097,  31031,  30961,  30886,  30807,  30722,  30633,  30540,  30442,  30339,  30232,  30120,  30003,  29882,
-  29757,  29627,  29493,  29354,  29211,  29064,  28912,  28756,  28596,  28432,  28263,  28090,  27914,  27733,  27548,  27358,
-  27165,  26968,  26767,  26563,  26354,  26141,  25925,  25705,  25481,  25254,  25023,  24789,  24550,  24309,  24064,  23815,
-  23563,  23308,  23049,  22788,  22523,  22254,  21983,  21709,  21431,  21151,  20868,  20581,  20292,  20000,  19706,  19408,
-  19108,  18805,  18500,  18192,  17882,  17569,  17254,  16937,  16617,  16295,  15971,  15645,  15316,  14986,  14653,  14319,
-  13983,  13645,  13305,  12963,  12620,  12275,  11928,  11580,  11231,  10880,  10528,  10174,   9819,   9463,   9106,   8747,
-   8388,   8027,   7666,   7303,   6940,   6576,   6211,   5845,   5479,   5112,   4745,   4377,   4009,   3640,   3271,   2902,
-   2532,   2162,   1793,   1423,   1053,    683,    313,    -56,   -426,   -795,  -1164,  -1533,  -1902,  -2270,  -2637,  -3004,
-  -3371,  -3737,  -4102,  -4466,  -4830,  -5193,  -5555,  -5916,  -6276,  -6635,  -6994,  -7351,  -7706,  -8061,  -8415,  -8767,
-  -9118,  -9467,  -9815, -10162, -10507, -10850, -11192, -11532, -11871, -12208, -12543, -12876, -13207, -13537, -13864, -14190,
- -14513, -14835, -15154, -15471, -15786, -16099, -16410, -16718, -17024, -17328, -17629, -17927, -18224, -18517, -18809, -19097,
- -19383, -19666, -19947, -20225, -20500, -20772, -21042, -21308, -21572, -21833, -22091, -22345, -22597, -22846, -23092, -23335,
- -23574, -23811, -24044, -24274, -24501, -24724, -24944, -25161, -25375, -25585, -25792, -25996, -26196, -26393, -26586, -26776,
- -26962, -27144, -27324, -27499, -27671, -27840, -28004, -28166, -28323, -28477, -28627, -28774, -28917, -29056, -29191, -29323,
- -29450, -29574, -29695, -29811, -29924, -30033, -30138, -30239, -30337, -30430, -30520, -30606, -30688, -30766, -30840, -30910,
- -30977, -31039, -31098, -31153, -31203, -31250, -31293, -31333, -31368, -31399, -31427, -31450, -31470, -31485, -31497, -31505,
- -31509, -31509, -31506, -31498, -31486, -31471, -31452, -31429, -31402, -31371, -31336, -31298, -31256, -31210, -31160, -31106,
- -31049, -30987, -30922, -30854, -30781, -30705, -30625, -30542, -30455, -30364, -30269, -30171, -30069, -29964, -29855, -29742,
- -29626, -29507, -29384, -29257, -29127, -28993, -28856, -28716, -28572, -28425, -28274, -28121, -27963, -27803, -27639, -27472,
- -27302, -27129, -26952, -26772, -26590, -26404, -26215, -26023, -25828, -25629, -25428, -25224, -25018, -24808, -24595, -24380,
- -24161, -23940, -23716, -23490, -23261, -23029, -22794, -22557, -22318, -22075, -21831, -21584, -21334, -21082, -20827, -20571,
- -20312, -20050, -19787, -19521, -19253, -18983, -18710, -18436, -18159, -17881, -17601, -17318, -17034, -16748, -16460, -16170,
- -15878, -15585, -15290, -14993, -14695, -14395, -14094, -13791, -13486, -13180, -12873, -12564, -12254, -11943, -11630, -11316,
- -11001, -10685, -10367, -10049,  -9729,  -9409,  -9088,  -8765,  -8442,  -8118,  -7793,  -7467,  -7141,  -6813,  -6486,  -6157,
-  -5828,  -5498,  -5168,  -4838,  -4507,  -4175,  -3843,  -3511,  -3179,  -2846,  -2513,  -2180,  -1847,  -1513,  -1180,   -846,
-   -513,   -179,    153,    486,    819,   1152,   1485,   1817,   2149,   2481,   2812,   3143,   3473,   3803,   4133,   4462,
-   4790,   5118,   5445,   5771,   6096,   6421,   6745,   7068,   7391,   7712,   8032,   8352,   8670,   8987,   9304,   9619,
-   9933,  10246,  10557,  10868,  11177,  11484,  11791,  12096,  12399,  12701,  13002,  13301,  13599,  13895,  14189,  14482,
-  14773,  15063,  15351,  15637,  15921,  16203,  16484,  16762,  17039,  17314,  17587,  17858,  18127,  18394,  18659,  18921,
-  19182,  19440,  19697,  19951,  20203,  20452,  20700,  20945,  21187,  21428,  21666,  21902,  22135,  22366,  22594,  22820,
-  23043,  23264,  23482,  23698,  23911,  24122,  24330,  24535,  24738,  24938,  25135,  25329,  25521,  25710,  25896,  26079,
-  26260,  26438,  26613,  26785,  26954,  27120,  27284,  27444,  27602,  27756,  27908,  28056,  28202,  28344,  28484,  28621,
-  28754,  28885,  29012,  29136,  29258,  29376,  29491,  29603,  29712,  29817,  29920,  30019,  30115,  30208,  30298,  30385,
-  30468,  30549,  30626,  30700,  30771,  30838,  30902,  30963,  31021,  31076,  31127,  31175,  31220,  31262,  31301,  31336,
-  31368,  31396,  31422,  31444,  31463,  31479,  31491,  31501,  31507,  31509,  31509,  31505,  31498,  31488,  31475,  31458,
-  31439,  31416,  31389,  31360,  31327,  31292,  31253,  31210,  31165,  31117,  31065,  31010,  30952,  30891,  30827,  30760,
-  30690,  30616,  30540,  30460,  30377,  30291,  30203,  30111,  30016,  29918,  29817,  29714,  29607,  29497,  29384,  29269,
-  29150,  29029,  28904,  28777,  28647,  28514,  28379,  28240,  28099,  27955,  27808,  27658,  27506,  27351,  27193,  27032,
-  26869,  26704,  26535,  26364,  26191,  26015,  25836,  25655,  25471,  25285,  25096,  24905,  24712,  24516,  24318,  24117,
-  23914,  23709,  23501,  23291,  23079,  22865,  22648,  22429,  22208,  21985,  21760,  21533,  21304,  21072,  20839,  20604,
-  20366,  20127,  19886,  19643,  19398,  19151,  18902,  18652,  18400,  18146,  17890,  17633,  17374,  17114,  16851,  16587,
-  16322,  16055,  15787,  15517,  15246,  14973,  14699,  14423,  14147,  13869,  13589,  13308,  13027,  12744,  12459,  12174,
-  11887,  11600,  11311,  11022,  10731,  10439,  10147,   9853,   9559,   9264,   8968,   8671,   8373,   8075,   7776,   7476,
-   7176,   6875,   6573,   6271,   5969,   5665,   5362,   5058,   4753,   4448,   4143,   3837,   3532,   3225,   2919,   2612,
-   2306,   1999,   1692,   1385,   1077,    770,    463,    156,   -150,   -457,   -764,  -1071,  -1378,  -1684,  -1990,  -2296,
-  -2602,  -2907,  -3212,  -3517,  -3821,  -4125,  -4428,  -4731,  -5034,  -5335,  -5637,  -5937,  -6237,  -6537,  -6835,  -7133,
-  -7431,  -7727,  -8023,  -8318,  -8612,  -8905,  -9197,  -9488,  -9779, -10068, -10356, -10644, -10930, -11215, -11499, -11782,
- -12064, -12345, -12624, -12902, -13179, -13455, -13729, -14002, -14274, -14544, -14813, -15080, -15346, -15610, -15873, -16135,
- -16395, -16653, -16909, -17165, -17418, -17670, -17920, -18168, -18415, -18660, -18903, -19144, -19383, -19621, -19857, -20091,
- -20323, -20553, -20781, -21007, -21231, -21454, -21674, -21892, -22108, -22322, -22534, -22744, -22951, -23157, -23360, -23562,
- -23761, -23957, -24152, -24344, -24534, -24722, -24908, -25091, -25272, -25450, -25626, -25800, -25971, -26140, -26307, -26471,
- -26633, -26792, -26949, -27103, -27255, -27404, -27551, -27695, -27837, -27976, -28113, -28247, -28379, -28508, -28634, -28758,
- -28879, -28997, -29113, -29226, -29336, -29444, -29549, -29652, -29752, -29849, -29943, -30035, -30124, -30210, -30293, -30374,
- -30452, -30528, -30600, -30670, -30737, -30801, -30863, -30921, -30977, -31030, -31081, -31128, -31173, -31215, -31254, -31291,
- -31324, -31355, -31383, -31408, -31431, -31450, -31467, -31481, -31492, -31501, -31506, -31509, -31509, -31507, -31501, -31493,
- -31482, -31468, -31451, -31431, -31409, -31384, -31356, -31326, -31292, -31256, -31217, -31176, -31132, -31084, -31035, -30982,
- -30927, -30869, -30808, -30745, -30679, -30610, -30539, -30465, -30388, -30309, -30227, -30142, -30055, -29965, -29872, -29777,
- -29680, -29579, -29476, -29371, -29263, -29153, -29040, -28924, -28806, -28686, -28563, -28437, -28309, -28179, -28046, -27911,
- -27773, -27633, -27491, -27346, -27199, -27050, -26898, -26744, -26588, -26429, -26268, -26105, -25940, -25772, -25603, -25431,
- -25257, -25080, -24902, -24722, -24539, -24354, -24167, -23979, -23788, -23595, -23400, -23203, -23004, -22804, -22601, -22397,
- -22190, -21982, -21772, -21560, -21346, -21130, -20913, -20694, -20473, -20250, -20026, -19800, -19572, -19343, -19112, -18880,
- -18646, -18410, -18173, -17934, -17694, -17453, -17210, -16965, -16719, -16472, -16223, -15974, -15722, -15470, -15216, -14961,
- -14705, -14447, -14188, -13929, -13668, -13406, -13142, -12878, -12613, -12347, -12079, -11811, -11542, -11272, -11001, -10729,
- -10456, -10182,  -9908,  -9632,  -9356,  -9080,  -8802,  -8524,  -8245,  -7966,  -7686,  -7405,  -7124,  -6842,  -6559,  -6276,
-  -5993,  -5709,  -5425,  -5140,  -4855,  -4570,  -4284,  -3998,  -3712,  -3425,  -3139,  -2852,  -2564,  -2277,  -1990,  -1702,
-  -1414,  -1126,   -839,   -551,   -263,     24,    312,    600,    887,   1175,   1462,   1749,   2036,   2323,   2610,   2896,
-   3182,   3467,   3753,   4038,   4322,   4606,   4890,   5173,   5456,   5739,   6020,   6302,   6582,   6862,   7142,   7421,
-   7699,   7976,   8253,   8529,   8805,   9079,   9353,   9626,   9898,  10169,  10439,  10709,  10977,  11245,  11512,  11777,
-  12042,  12305,  12568,  12829,  13090,  13349,  13607,  13864,  14120,  14374,  14627,  14880,  15130,  15380,  15628,  15875,
-  16121,  16365,  16608,  16849,  17089,  17328,  17565,  17801,  18035,  18267,  18499,  18728,  18956,  19183,  19408,  19631,
-  19852,  20072,  20291,  20507,  20722,  20935,  21147,  21356,  21564,  21770,  21975,  22177,  22378,  22577,  22774,  22969,
-  23162,  23354,  23543,  23730,  23916,  24099,  24281,  24461,  24638,  24814,  24987,  25159,  25328,  25495,  25661,  25824,
-  25985,  26144,  26301,  26455,  26608,  26758,  26906,  27052,  27196,  27338,  27477,  27614,  27749,  27882,  28012,  28140,
-  28266,  28390,  28511,  28630,  28746,  28861,  28973,  29082,  29190,  29295,  29397,  29498,  29595,  29691,  29784,  29875,
-  29963,  30049,  30132,  30214,  30292,  30368,  30442,  30514,  30583,  30649,  30713,  30775,  30834,  30890,  30945,  30996,
-  31046,  31092,  31137,  31178,  31218,  31255,  31289,  31321,  31350,  31377,  31402,  31424,  31443,  31460,  31475,  31487,
-  31496,  31503,  31507,  31510,  31509,  31506,  31501,  31493,  31482,  31469,  31454,  31436,  31416,  31393,  31368,  31340,
-  31310,  31277,  31242,  31204,  31164,  31122,  31077,  31030,  30980,  30928,  30873,  30816,  30757,  30695,  30631,  30564,
-  30495,  30424,  30350,  30274,  30195,  30115,  30031,  29946,  29858,  29768,  29676,  29581,  29484,  29384,  29283,  29179,
-  29073,  28964,  28854,  28741,  28626,  28508,  28389,  28267,  28143,  28017,  27889,  27758,  27626,  27491,  27355,  27216,
-  27075,  26932,  26787,  26639,  26490,  26339,  26186,  26030,  25873,  25714,  25553,  25390,  25224,  25057,  24889,  24718,
-  24545,  24370,  24194,  24016,  23835,  23653,  23470,  23284,  23097,  22908,  22717,  22524,  22330,  22134,  21937,  21737,
-  21536,  21334,  21130,  20924,  20717,  20508,  20297,  20085,  19872,  19657,  19441,  19223,  19003,  18782,  18560,  18337,
-  18112,  17885,  17658,  17429,  17198,  16967,  16734,  16500,  16265,  16028,  15790,  15552,  15312,  15070,  14828,  14585,
-  14340,  14095,  13848,  13600,  13352,  13102,  12852,  12600,  12348,  12094,  11840,  11585,  11329,  11073,  10815,  10557,
-  10297,  10038,   9777,   9516,   9254,   8991,   8728,   8464,   8199,   7934,   7669,   7402,   7136,   6868,   6601,   6332,
-   6064,   5795,   5525,   5255,   4985,   4715,   4444,   4172,   3901,   3629,   3357,   3085,   2813,   2540,   2267,   1995,
-   1722,   1449,   1176,    902,    629,    356,     83,   -190,   -463,   -736,  -1009,  -1282,  -1554,  -1827,  -2099,  -2372,
-  -2644,  -2915,  -3187,  -3458,  -3729,  -4000,  -4270,  -4540,  -4809,  -5079,  -5347,  -5616,  -5884,  -6151,  -6418,  -6684,
-  -6950,  -7216,  -7480,  -7744,  -8008,  -8271,  -8533,  -8795,  -9056,  -9316,  -9575,  -9834, -10092, -10349, -10605, -10861,
- -11116, -11370, -11622, -11875, -12126, -12376, -12625, -12873, -13121, -13367, -13612, -13857, -14100, -14342, -14583, -14823,
- -15062, -15299, -15536, -15771, -16005, -16238, -16470, -16700, -16929, -17157, -17384, -17609, -17833, -18056, -18277, -18497,
- -18715, -18932, -19148, -19362, -19575, -19786, -19996, -20204, -20411, -20616, -20820, -21022, -21222, -21421, -21619, -21814,
- -22009, -22201, -22392, -22581, -22769, -22954, -23139, -23321, -23502, -23680, -23858, -24033, -24207, -24378, -24548, -24716,
- -24883, -25047, -25210, -25371, -25530, -25687, -25842, -25995, -26146, -26296, -26443, -26588, -26732, -26873, -27013, -27151,
- -27286, -27420, -27551, -27681, -27808, -27934, -28057, -28179, -28298, -28415, -28530, -28643, -28754, -28863, -28970, -29074,
- -29177, -29277, -29375, -29472, -29565, -29657, -29747, -29834, -29920, -30003, -30084, -30162, -30239, -30313, -30385, -30455,
- -30523, -30588, -30651, -30712, -30771, -30828, -30882, -30934, -30984, -31032, -31077, -31120, -31161, -31200, -31236, -31270,
- -31302, -31331, -31359, -31384, -31406, -31427, -31445, -31461, -31475, -31486, -31495, -31502, -31507, -31509, -31509, -31507,
- -31503, -31496, -31487, -31476, -31463, -31447, -31429, -31409, -31386, -31361, -31334, -31305, -31274, -31240, -31204, -31166,
- -31125, -31083, -31038, -30991, -30942, -30890, -30837, -30781, -30723, -30662, -30600, -30535, -30468, -30399, -30328, -30255,
- -30180, -30102, -30022, -29941, -29857, -29770, -29682, -29592, -29500, -29405, -29308, -29210, -29109, -29006, -28901, -28795,
- -28686, -28575, -28462, -28347, -28230, -28111, -27990, -27867, -27742, -27615, -27486, -27356, -27223, -27089, -26952, -26814,
- -26673, -26531, -26387, -26242, -26094, -25944, -25793, -25640, -25485, -25328, -25170, -25009, -24847, -24684, -24518, -24351,
- -24182, -24012, -23839, -23665, -23490, -23313, -23134, -22953, -22771, -22588, -22403, -22216, -22028, -21838, -21646, -21454,
- -21259, -21063, -20866, -20667, -20467, -20266, -20063, -19858, -19653, -19446, -19237, -19027, -18816, -18604, -18390, -18175,
- -17959, -17742, -17523, -17303, -17082, -16860, -16637, -16412, -16187, -15960, -15732, -15503, -15273, -15042, -14810, -14577,
- -14343, -14108, -13872, -13635, -13397, -13159, -12919, -12679, -12437, -12195, -11952, -11708, -11463, -11218, -10972, -10725,
- -10477, -10229,  -9980,  -9730,  -9480,  -9229,  -8977,  -8725,  -8472,  -8219,  -7965,  -7711,  -7456,  -7200,  -6944,  -6688,
-  -6431,  -6174,  -5916,  -5658,  -5400,  -5141,  -4882,  -4623,  -4363,  -4103,  -3843,  -3583,  -3322,  -3061,  -2800,  -2539,
-  -2278,  -2016,  -1755,  -1493,  -1231,   -970,   -708,   -446,   -184,     77,    339,    601,    862,   1124,   1385,   1647,
-   1908,   2169,   2430,   2691,   2951,   3212,   3472,   3732,   3991,   4250,   4509,   4768,   5026,   5284,   5541,   5798,
-   6055,   6311,   6567,   6822,   7077,   7331,   7584,   7838,   8090,   8342,   8594,   8844,   9094,   9344,   9593,   9841,
-  10088,  10335,  10581,  10826,  11071,  11315,  11558,  11800,  12041,  12281,  12521,  12760,  12997,  13234,  13470,  13705,
-  13939,  14172,  14404,  14635,  14865,  15094,  15322,  15549,  15775,  16000,  16223,  16446,  16667,  16887,  17106,  17324,
-  17541,  17756,  17970,  18183,  18395,  18605,  18814,  19022,  19229,  19434,  19638,  19840,  20041,  20241,  20439,  20636,
-  20832,  21026,  21218,  21410,  21599,  21787,  21974,  22159,  22343,  22525,  22706,  22885,  23062,  23238,  23413,  23585,
-  23756,  23926,  24094,  24260,  24424,  24587,  24749,  24908,  25066,  25222,  25376,  25529,  25680,  25829,  25976,  26122,
-  26266,  26408,  26548,  26687,  26823,  26958,  27091,  27223,  27352,  27479,  27605,  27729,  27851,  27971,  28089,  28205,
-  28319,  28431,  28542,  28650,  28757,  28862,  28964,  29065,  29164,  29261,  29355,  29448,  29539,  29628,  29715,  29800,
-  29882,  29963,  30042,  30119,  30194,  30267,  30337,  30406,  30473,  30537,  30600,  30660,  30719,  30775,  30829,  30881,
-  30932,  30980,  31026,  31070,  31112,  31151,  31189,  31225,  31258,  31290,  31319,  31346,  31371,  31394,  31415,  31434,
-  31451,  31466,  31478,  31489,  31497,  31503,  31507,  31509,  31509,  31507,  31503,  31497,  31488,  31478,  31465,  31450,
-  31434,  31415,  31394,  31371,  31346,  31318,  31289,  31258,  31224,  31189,  31151,  31112,  31070,  31026,  30980,  30932,
-  30882,  30831,  30777,  30721,  30662,  30602,  30540,  30476,  30410,  30342,  30272,  30200,  30125,  30049,  29971,  29891,
-  29809,  29725,  29639,  29551,  29461,  29370,  29276,  29180,  29083,  28983,  28882,  28778,  28673,  28566,  28457,  28346,
-  28234,  28119,  28003,  27885,  27765,  27643,  27519,  27394,  27267,  27138,  27007,  26874,  26740,  26604,  26466,  26326,
-  26185,  26042,  25898,  25751,  25603,  25453,  25302,  25149,  24994,  24838,  24680,  24521,  24360,  24197,  24033,  23867,
-  23700,  23531,  23360,  23188,  23015,  22840,  22664,  22486,  22306,  22125,  21943,  21760,  21575,  21388,  21200,  21011,
-  20821,  20629,  20435,  20241,  20045,  19848,  19649,  19450,  19249,  19046,  18843,  18638,  18433,  18226,  18017,  17808,
-  17598,  17386,  17173,  16959,  16744,  16528,  16311,  16093,  15874,  15654,  15433,  15211,  14988,  14763,  14538,  14313,
-  14086,  13858,  13629,  13400,  13169,  12938,  12706,  12474,  12240,  12006,  11770,  11535,  11298,  11061,  10823,  10584,
-  10345,  10104,   9864,   9623,   9381,   9138,   8895,   8652,   8407,   8163,   7918,   7672,   7426,   7179,   6932,   6685,
-   6437,   6189,   5940,   5691,   5442,   5192,   4942,   4691,   4441,   4190,   3939,   3688,   3436,   3184,   2932,   2680,
-   2428,   2175,   1923,   1670,   1418,   1165,    912,    659,    406,    153,    -99,   -352,   -604,   -857,  -1110,  -1362,
-  -1615,  -1867,  -2120,  -2372,  -2624,  -2875,  -3127,  -3378,  -3629,  -3880,  -4130,  -4381,  -4631,  -4880,  -5130,  -5378,
-  -5627,  -5875,  -6123,  -6370,  -6617,  -6864,  -7110,  -7355,  -7601,  -7845,  -8089,  -8333,  -8576,  -8818,  -9060,  -9301,
-  -9542,  -9782, -10021, -10260, -10498, -10735, -10972, -11207, -11443, -11677, -11911, -12143, -12375, -12607, -12837, -13067,
- -13295, -13523, -13750, -13976, -14201, -14426, -14649, -14871, -15093, -15313, -15533, -15751, -15968, -16185, -16400, -16614,
- -16827, -17040, -17250, -17460, -17669, -17877, -18083, -18288, -18492, -18695, -18897, -19098, -19297, -19495, -19692, -19887,
- -20081, -20274, -20466, -20656, -20845, -21033, -21219, -21404, -21587, -21770, -21950, -22130, -22308, -22484, -22659, -22833,
- -23005, -23176, -23345, -23513, -23679, -23844, -24007, -24168, -24329, -24487, -24644, -24799, -24953, -25106, -25256, -25405,
- -25553, -25698, -25843, -25985, -26126, -26265, -26403, -26539, -26673, -26805, -26936, -27065, -27192, -27318, -27442, -27564,
- -27684, -27803, -27920, -28035, -28148, -28260, -28370, -28478, -28584, -28688, -28791, -28891, -28990, -29087, -29183, -29276,
- -29367, -29457, -29545, -29631, -29715, -29797, -29877, -29956, -30032, -30107, -30180, -30251, -30320, -30387, -30452, -30515,
- -30576, -30636, -30693, -30748, -30802, -30854, -30903, -30951, -30997, -31041, -31083, -31123, -31161, -31197, -31231, -31263,
- -31293, -31321, -31348, -31372, -31394, -31414, -31433, -31449, -31464, -31476, -31487, -31495, -31502, -31506, -31509, -31510,
- -31508, -31505, -31500, -31493, -31483, -31472, -31459, -31444, -31427, -31408, -31387, -31364, -31339, -31312, -31284, -31253,
- -31220, -31186, -31149, -31111, -31070, -31028, -30984, -30937, -30889, -30839, -30787, -30733, -30677, -30620, -30560, -30499,
- -30435, -30370, -30303, -30234, -30163, -30090, -30015, -29939, -29860, -29780, -29698, -29614, -29529, -29441, -29352, -29260,
- -29167, -29073, -28976, -28878, -28777, -28675, -28572, -28466, -28359, -28250, -28139, -28027, -27912, -27796, -27679, -27559,
- -27438, -27316, -27191, -27065, -26937, -26808, -26677, -26544, -26410, -26274, -26136, -25997, -25856, -25714, -25570, -25424,
- -25277, -25129, -24978, -24827, -24673, -24519, -24362, -24205, -24045, -23885, -23723, -23559, -23394, -23227, -23060, -22890,
- -22720, -22547, -22374, -22199, -22023, -21845, -21666, -21486, -21305, -21122, -20938, -20752, -20566, -20378, -20189, -19998,
- -19807, -19614, -19420, -19225, -19028, -18831, -18632, -18433, -18232, -18030, -17827, -17622, -17417, -17211, -17004, -16795,
- -16586, -16375, -16164, -15952, -15738, -15524, -15309, -15093, -14876, -14658, -14439, -14219, -13999, -13777, -13555, -13332,
- -13108, -12884, -12658, -12432, -12205, -11978, -11749, -11520, -11290, -11060, -10829, -10597, -10365, -10132,  -9898,  -9664,
-  -9429,  -9194,  -8958,  -8722,  -8485,  -8247,  -8010,  -7771,  -7532,  -7293,  -7053,  -6813,  -6573,  -6332,  -6091,  -5849,
-  -5607,  -5365,  -5122,  -4879,  -4636,  -4393,  -4149,  -3905,  -3661,  -3416,  -3172,  -2927,  -2682,  -2437,  -2192,  -1947,
-  -1701,  -1456,  -1210,   -965,   -719,   -473,   -228,     17,    263,    508,    754,    999,   1245,   1490,   1735,   1981,
-   2226,   2470,   2715,   2960,   3204,   3448,   3692,   3936,   4179,   4422,   4665,   4907,   5150,   5391,   5633,   5874,
-   6115,   6355,   6595,   6835,   7074,   7313,   7551,   7789,   8026,   8263,   8499,   8735,   8970,   9205,   9439,   9673,
-   9906,  10138,  10370,  10601,  10831,  11061,  11290,  11518,  11746,  11972,  12199,  12424,  12649,  12872,  13096,  13318,
-  13539,  13760,  13980,  14199,  14417,  14634,  14850,  15065,  15280,  15493,  15706,  15917,  16128,  16338,  16546,  16754,
-  16960,  17166,  17371,  17574,  17776,  17978,  18178,  18377,  18575,  18772,  18968,  19162,  19355,  19548,  19739,  19929,
-  20117,  20305,  20491,  20676,  20859,  21042,  21223,  21403,  21581,  21759,  21934,  22109,  22282,  22454,  22625,  22794,
-  22962,  23128,  23293,  23457,  23619,  23780,  23939,  24097,  24254,  24408,  24562,  24714,  24865,  25014,  25161,  25307,
-  25452,  25595,  25736,  25876,  26014,  26151,  26286,  26420,  26552,  26682,  26811,  26938,  27064,  27188,  27310,  27431,
-  27550,  27667,  27783,  27897,  28009,  28120,  28229,  28336,  28442,  28546,  28648,  28748,  28847,  28944,  29040,  29133,
-  29225,  29315,  29403,  29490,  29575,  29658,  29739,  29819,  29896,  29972,  30046,  30119,  30189,  30258,  30325,  30390,
-  30453,  30515,  30575,  30632,  30688,  30743,  30795,  30846,  30894,  30941,  30986,  31029,  31071,  31110,  31148,  31184,
-  31217,  31250,  31280,  31308,  31335,  31359,  31382,  31403,  31422,  31439,  31454,  31468,  31479,  31489,  31497,  31503,
-  31507,  31509,  31510,  31508,  31505,  31499,  31492,  31483,  31472,  31460,  31445,  31429,  31411,  31390,  31368,  31345,
-  31319,  31291,  31262,  31231,  31197,  31163,  31126,  31087,  31047,  31004,  30960,  30914,  30867,  30817,  30766,  30712,
-  30657,  30600,  30542,  30481,  30419,  30355,  30289,  30222,  30152,  30081,  30008,  29933,  29857,  29779,  29699,  29617,
-  29534,  29448,  29362,  29273,  29183,  29090,  28997,  28901,  28804,  28705,  28605,  28502,  28398,  28293,  28186,  28077,
-  27966,  27854,  27740,  27625,  27508,  27389,  27269,  27147,  27023,  26898,  26772,  26644,  26514,  26383,  26250,  26115,
-  25980,  25842,  25703,  25563,  25421,  25278,  25133,  24986,  24839,  24689,  24539,  24386,  24233,  24078,  23922,  23764,
-  23605,  23444,  23282,  23119,  22955,  22789,  22622,  22453,  22283,  22112,  21940,  21766,  21591,  21415,  21237,  21058,
-  20879,  20697,  20515,  20332,  20147,  19961,  19774,  19586,  19396,  19206,  19015,  18822,  18628,  18433,  18237,  18041,
-  17843,  17644,  17443,  17242,  17040,  16837,  16633,  16429,  16223,  16016,  15808,  15599,  15390,  15179,  14968,  14756,
-  14543,  14329,  14114,  13899,  13683,  13465,  13248,  13029,  12810,  12590,  12369,  12147,  11925,  11702,  11478,  11254,
-  11029,  10804,  10578,  10351,  10124,   9896,   9667,   9438,   9209,   8979,   8748,   8517,   8286,   8054,   7821,   7588,
-   7355,   7121,   6887,   6652,   6418,   6182,   5947,   5711,   5474,   5238,   5001,   4764,   4526,   4289,   4051,   3813,
-   3574,   3336,   3097,   2858,   2619,   2380,   2141,   1902,   1662,   1423,   1183,    943,    703,    464,    224,    -15,
-   -255,   -494,   -734,   -974,  -1213,  -1453,  -1692,  -1932,  -2171,  -2410,  -2649,  -2887,  -3126,  -3364,  -3602,  -3840,
-  -4078,  -4315,  -4552,  -4789,  -5026,  -5262,  -5498,  -5734,  -5969,  -6204,  -6439,  -6673,  -6907,  -7140,  -7373,  -7605,
-  -7837,  -8069,  -8300,  -8531,  -8761,  -8990,  -9220,  -9448,  -9676,  -9903, -10130, -10356, -10582, -10807, -11031, -11255,
- -11478, -11701, -11922, -12143, -12364, -12583, -12802, -13020, -13237, -13454, -13670, -13885, -14099, -14312, -14525, -14736,
- -14947, -15157, -15366, -15574, -15781, -15988, -16193, -16397, -16601, -16803, -17005, -17206, -17405, -17604, -17801, -17998,
- -18193, -18388, -18581, -18773, -18964, -19154, -19343, -19531, -19718, -19903, -20088, -20271, -20453, -20634, -20814, -20992,
- -21170, -21346, -21521, -21694, -21867, -22038, -22207, -22376, -22543, -22709, -22874, -23037, -23199, -23360, -23519, -23677,
- -23834, -23989, -24143, -24295, -24446, -24596, -24744, -24891, -25036, -25180, -25323, -25464, -25603, -25741, -25878, -26013,
- -26147, -26279, -26410, -26539, -26666, -26792, -26917, -27040, -27161, -27281, -27400, -27516, -27632, -27745, -27857, -27968,
- -28076, -28184, -28289, -28393, -28496, -28596, -28695, -28793, -28889, -28983, -29075, -29166, -29255, -29343, -29429, -29513,
- -29595, -29676, -29755, -29832, -29908, -29982, -30054, -30125, -30194, -30261, -30326, -30390, -30452, -30512, -30570, -30627,
- -30682, -30735, -30787, -30837, -30884, -30931, -30975, -31018, -31059, -31098, -31135, -31171, -31205, -31237, -31267, -31296,
- -31322, -31347, -31370, -31392, -31411, -31429, -31445, -31460, -31472, -31483, -31492, -31499, -31504, -31508, -31509, -31509,
- -31508, -31504, -31499, -31492, -31483, -31472, -31459, -31445, -31429, -31411, -31391, -31370, -31347, -31322, -31295, -31267,
- -31236, -31204, -31171, -31135, -31098, -31059, -31018, -30975, -30931, -30885, -30837, -30788, -30736, -30683, -30628, -30572,
- -30514, -30454, -30392, -30329, -30264, -30197, -30129, -30058, -29987, -29913, -29838, -29761, -29682, -29602, -29520, -29436,
- -29351, -29264, -29176, -29085, -28994, -28900, -28805, -28708, -28610, -28510, -28409, -28306, -28201, -28095, -27987, -27877,
- -27766, -27654, -27540, -27424, -27307, -27188, -27068, -26946, -26823, -26698, -26572, -26444, -26315, -26184, -26052, -25918,
- -25783, -25646, -25508, -25369, -25228, -25086, -24942, -24797, -24651, -24503, -24354, -24203, -24051, -23898, -23744, -23588,
- -23431, -23272, -23112, -22951, -22789, -22625, -22460, -22294, -22127, -21958, -21788, -21617, -21445, -21271, -21097, -20921,
- -20744, -20566, -20386, -20206, -20024, -19842, -19658, -19473, -19287, -19100, -18912, -18723, -18532, -18341, -18149, -17956,
- -17762, -17566, -17370, -17173, -16975, -16776, -16576, -16375, -16173, -15971, -15767, -15563, -15357, -15151, -14944, -14736,
- -14528, -14318, -14108, -13897, -13685, -13473, -13259, -13045, -12831, -12615, -12399, -12182, -11965, -11747, -11528, -11309,
- -11089, -10868, -10647, -10425, -10202,  -9980,  -9756,  -9532,  -9307,  -9082,  -8857,  -8631,  -8404,  -8177,  -7950,  -7722,
-  -7494,  -7265,  -7036,  -6807,  -6577,  -6347,  -6116,  -5885,  -5654,  -5423,  -5191,  -4959,  -4727,  -4494,  -4261,  -4028,
-  -3795,  -3562,  -3328,  -3094,  -2860,  -2626,  -2392,  -2157,  -1923,  -1688,  -1454,  -1219,   -984,   -749,   -515,   -280,
-    -45,    189,    424,    659,    894,   1128,   1363,   1597,   1832,   2066,   2300,   2535,   2768,   3002,   3236,   3469,
-   3702,   3935,   4168,   4401,   4633,   4865,   5097,   5328,   5559,   5790,   6020,   6250,   6480,   6709,   6938,   7167,
-   7395,   7623,   7850,   8077,   8304,   8530,   8755,   8980,   9205,   9429,   9652,   9875,  10097,  10319,  10540,  10761,
-  10981,  11200,  11419,  11637,  11854,  12071,  12287,  12503,  12717,  12931,  13145,  13357,  13569,  13780,  13990,  14200,
-  14409,  14616,  14824,  15030,  15235,  15440,  15643,  15846,  16048,  16249,  16449,  16648,  16847,  17044,  17241,  17436,
-  17630,  17824,  18016,  18208,  18398,  18588,  18776,  18964,  19150,  19335,  19519,  19702,  19884,  20065,  20245,  20424,
-  20601,  20778,  20953,  21127,  21300,  21472,  21642,  21812,  21980,  22147,  22312,  22477,  22640,  22802,  22963,  23122,
-  23280,  23437,  23593,  23747,  23900,  24051,  24202,  24351,  24498,  24645,  24789,  24933,  25075,  25216,  25355,  25493,
-  25630,  25765,  25899,  26031,  26162,  26291,  26419,  26546,  26671,  26794,  26916,  27037,  27156,  27274,  27390,  27505,
-  27618,  27729,  27839,  27948,  28055,  28160,  28264,  28367,  28468,  28567,  28664,  28761,  28855,  28948,  29039,  29129,
-  29217,  29304,  29389,  29472,  29554,  29634,  29712,  29789,  29864,  29938,  30010,  30080,  30148,  30215,  30281,  30344,
-  30406,  30467,  30525,  30582,  30637,  30691,  30743,  30793,  30842,  30889,  30934,  30977,  31019,  31059,  31098,  31134,
-  31169,  31203,  31234,  31264,  31292,  31319,  31343,  31366,  31388,  31407,  31425,  31441,  31456,  31469,  31480,  31489,
-  31496,  31502,  31506,  31509,  31510,  31509,  31506,  31501,  31495,  31487,  31478,  31466,  31453,  31439,  31422,  31404,
-  31384,  31363,  31339,  31314,  31287,  31259,  31229,  31197,  31164,  31128,  31091,  31053,  31013,  30971,  30927,  30882,
-  30835,  30786,  30736,  30683,  30630,  30574,  30517,  30459,  30398,  30336,  30273,  30207,  30140,  30072,  30002,  29930,
-  29856,  29781,  29705,  29626,  29547,  29465,  29382,  29297,  29211,  29123,  29034,  28943,  28850,  28756,  28660,  28563,
-  28464,  28364,  28262,  28159,  28054,  27947,  27839,  27730,  27619,  27506,  27392,  27277,  27160,  27042,  26922,  26801,
-  26678,  26554,  26428,  26301,  26173,  26043,  25911,  25779,  25645,  25509,  25372,  25234,  25095,  24954,  24811,  24668,
-  24523,  24377,  24229,  24080,  23930,  23779,  23626,  23472,  23317,  23160,  23002,  22843,  22683,  22522,  22359,  22195,
-  22030,  21864,  21696,  21528,  21358,  21187,  21015,  20842,  20667,  20492,  20316,  20138,  19959,  19780,  19599,  19417,
-  19234,  19050,  18865,  18679,  18492,  18304,  18115,  17925,  17735,  17543,  17350,  17156,  16962,  16766,  16570,  16373,
-  16174,  15975,  15775,  15575,  15373,  15171,  14968,  14764,  14559,  14353,  14147,  13940,  13732,  13524,  13314,  13104,
-  12894,  12682,  12470,  12258,  12044,  11830,  11616,  11400,  11185,  10968,  10751,  10533,  10315,  10097,   9877,   9658,
-   9437,   9217,   8995,   8774,   8551,   8329,   8106,   7882,   7658,   7434,   7209,   6984,   6759,   6533,   6307,   6080,
-   5853,   5626,   5399,   5171,   4943,   4715,   4487,   4258,   4029,   3800,   3571,   3341,   3111,   2882,   2652,   2422,
-   2191,   1961,   1731,   1500,   1270,   1039,    808,    577,    347,    116,   -114,   -345,   -575,   -806,  -1037,  -1267,
-  -1498,  -1728,  -1958,  -2188,  -2419,  -2648,  -2878,  -3108,  -3337,  -3566,  -3795,  -4024,  -4253,  -4481,  -4709,  -4937,
-  -5165,  -5392,  -5619,  -5846,  -6072,  -6298,  -6524,  -6749,  -6974,  -7199,  -7423,  -7647,  -7870,  -8093,  -8315,  -8538,
-  -8759,  -8980,  -9201,  -9421,  -9640,  -9860, -10078, -10296, -10514, -10730, -10947, -11162, -11377, -11592, -11806, -12019,
- -12231, -12443, -12655, -12865, -13075, -13284, -13492, -13700, -13907, -14113, -14319, -14523, -14727, -14930, -15133, -15334,
- -15535, -15735, -15934, -16132, -16329, -16525, -16721, -16915, -17109, -17302, -17493, -17684, -17874, -18063, -18251, -18438,
- -18624, -18809, -18993, -19176, -19358, -19539, -19719, -19898, -20076, -20252, -20428, -20602, -20776, -20948, -21119, -21289,
- -21458, -21626, -21793, -21958, -22122, -22285, -22447, -22608, -22767, -22926, -23083, -23238, -23393, -23546, -23698, -23849,
- -23999, -24147, -24294, -24439, -24584, -24727, -24869, -25009, -25148, -25286, -25422, -25557, -25691, -25823, -25954, -26083,
- -26211, -26338, -26464, -26587, -26710, -26831, -26951, -27069, -27186, -27301, -27415, -27527, -27638, -27748, -27856, -27962,
- -28067, -28171, -28273, -28373, -28472, -28570, -28666, -28760, -28853, -28945, -29035, -29123, -29210, -29295, -29379, -29461,
- -29541, -29620, -29698, -29774, -29848, -29921, -29992, -30061, -30129, -30196, -30260, -30323, -30385, -30445, -30503, -30560,
- -30615, -30668, -30720, -30770, -30819, -30866, -30911, -30955, -30997, -31037, -31076, -31113, -31148, -31182, -31214, -31245,
- -31273, -31301, -31326, -31350, -31372, -31393, -31412, -31429, -31444, -31458, -31471, -31481, -31490, -31497, -31503, -31507,
- -31509, -31510, -31509, -31506, -31501, -31495, -31488, -31478, -31467, -31455, -31440, -31424, -31407, -31387, -31366, -31344,
- -31319, -31293, -31266, -31237, -31206, -31173, -31139, -31103, -31066, -31027, -30986, -30944, -30900, -30854, -30807, -30758,
- -30708, -30656, -30602, -30547, -30490, -30431, -30371, -30309, -30246, -30181, -30115, -30047, -29977, -29906, -29833, -29759,
- -29683, -29605, -29526, -29446, -29364, -29280, -29195, -29108, -29020, -28930, -28839, -28746, -28652, -28556, -28458, -28360,
- -28259, -28157, -28054, -27950, -27843, -27736, -27627, -27516, -27404, -27291, -27176, -27059, -26942, -26823, -26702, -26580,
- -26457, -26332, -26206, -26079, -25950, -25820, -25688, -25555, -25421, -25286, -25149, -25011, -24871, -24730, -24588, -24445,
- -24300, -24154, -24007, -23859, -23709, -23558, -23406, -23253, -23098, -22943, -22786, -22628, -22468, -22308, -22146, -21983,
- -21819, -21654, -21488, -21321, -21152, -20983, -20812, -20640, -20467, -20294, -20119, -19943, -19766, -19588, -19408, -19228,
- -19047, -18865, -18682, -18498, -18313, -18127, -17940, -17753, -17564, -17374, -17184, -16992, -16800, -16607, -16413, -16218,
- -16022, -15825, -15628, -15430, -15231, -15031, -14831, -14629, -14427, -14224, -14021, -13816, -13611, -13406, -13199, -12992,
- -12784, -12576, -12367, -12157, -11947, -11736, -11524, -11312, -11099, -10886, -10672, -10458, -10243, -10027,  -9811,  -9595,
-  -9378,  -9160,  -8942,  -8724,  -8505,  -8286,  -8066,  -7846,  -7625,  -7404,  -7183,  -6961,  -6739,  -6517,  -6294,  -6071,
-  -5848,  -5624,  -5400,  -5176,  -4952,  -4727,  -4502,  -4277,  -4051,  -3826,  -3600,  -3374,  -3148,  -2922,  -2695,  -2469,
-  -2242,  -2015,  -1788,  -1561,  -1334,  -1107,   -880,   -653,   -425,   -198,     28,    255,    483,    710,    937,   1164,
-   1391,   1618,   1845,   2072,   2298,   2525,   2751,   2977,   3203,   3429,   3655,   3880,   4106,   4331,   4556,   4780,
-   5005,   5229,   5452,   5676,   5899,   6122,   6345,   6567,   6789,   7010,   7231,   7452,   7672,   7892,   8112,   8331,
-   8550,   8768,   8986,   9203,   9420,   9636,   9852,  10067,  10282,  10496,  10710,  10923,  11136,  11347,  11559,  11770,
-  11980,  12189,  12398,  12606,  12814,  13021,  13227,  13432,  13637,  13841,  14045,  14247,  14449,  14650,  14851,  15050,
-  15249,  15447,  15644,  15841,  16036,  16231,  16425,  16618,  16810,  17001,  17192,  17381,  17570,  17758,  17944,  18130,
-  18315,  18499,  18682,  18864,  19045,  19225,  19404,  19582,  19759,  19935,  20110,  20284,  20457,  20628,  20799,  20969,
-  21137,  21305,  21471,  21636,  21800,  21963,  22125,  22286,  22445,  22604,  22761,  22917,  23072,  23225,  23378,  23529,
-  23679,  23828,  23975,  24121,  24266,  24410,  24553,  24694,  24834,  24972,  25110,  25246,  25381,  25514,  25646,  25777,
-  25906,  26035,  26161,  26287,  26411,  26534,  26655,  26775,  26894,  27011,  27126,  27241,  27354,  27465,  27576,  27684,
-  27792,  27897,  28002,  28105,  28206,  28306,  28405,  28502,  28598,  28692,  28785,  28876,  28966,  29054,  29141,  29226,
-  29310,  29392,  29473,  29552,  29629,  29706,  29780,  29853,  29925,  29995,  30063,  30130,  30196,  30259,  30322,  30382,
-  30441,  30499,  30555,  30609,  30662,  30713,  30763,  30811,  30858,  30903,  30946,  30988,  31028,  31066,  31103,  31139,
-  31172,  31205,  31235,  31264,  31291,  31317,  31341,  31364,  31385,  31404,  31422,  31438,  31452,  31465,  31476,  31486,
-  31494,  31500,  31505,  31508,  31509,  31509,  31508,  31504,  31499,  31493,  31485,  31475,  31463,  31450,  31436,  31420,
-  31402,  31382,  31361,  31338,  31314,  31288,  31261,  31232,  31201,  31169,  31135,  31099,  31062,  31024,  30983,  30942,
-  30898,  30853,  30807,  30758,  30709,  30657,  30604,  30550,  30494,  30436,  30377,  30317,  30254,  30191,  30125,  30059,
-  29990,  29920,  29849,  29776,  29701,  29625,  29548,  29469,  29388,  29306,  29223,  29138,  29051,  28963,  28874,  28783,
-  28690,  28597,  28501,  28404,  28306,  28206,  28105,  28003,  27899,  27793,  27687,  27578,  27469,  27358,  27245,  27131,
-  27016,  26900,  26782,  26662,  26542,  26420,  26296,  26172,  26046,  25918,  25790,  25660,  25528,  25396,  25262,  25127,
-  24990,  24852,  24713,  24573,  24432,  24289,  24145,  24000,  23853,  23706,  23557,  23407,  23256,  23103,  22950,  22795,
-  22639,  22482,  22324,  22164,  22004,  21842,  21680,  21516,  21351,  21185,  21018,  20850,  20681,  20511,  20340,  20167,
-  19994,  19820,  19644,  19468,  19291,  19113,  18933,  18753,  18572,  18390,  18207,  18023,  17838,  17652,  17466,  17278,
-  17090,  16901,  16710,  16519,  16328,  16135,  15942,  15747,  15552,  15357,  15160,  14963,  14764,  14566,  14366,  14166,
-  13965,  13763,  13561,  13357,  13154,  12949,  12744,  12538,  12332,  12125,  11917,  11709,  11500,  11291,  11081,  10871,
-  10660,  10448,  10236,  10023,   9810,   9597,   9382,   9168,   8953,   8737,   8521,   8305,   8088,   7871,   7654,   7436,
-   7217,   6999,   6780,   6560,   6341,   6121,   5900,   5680,   5459,   5238,   5017,   4795,   4573,   4351,   4129,   3906,
-   3683,   3460,   3237,   3014,   2791,   2567,   2344,   2120,   1896,   1672,   1448,   1224,   1000,    776,    551,    327,
-    103,   -120,   -345,   -569,   -793,  -1017,  -1241,  -1465,  -1689,  -1913,  -2137,  -2360,  -2584,  -2807,  -3030,  -3253,
-  -3476,  -3699,  -3921,  -4144,  -4366,  -4587,  -4809,  -5030,  -5251,  -5472,  -5693,  -5913,  -6133,  -6353,  -6572,  -6791,
-  -7009,  -7228,  -7446,  -7663,  -7880,  -8097,  -8313,  -8529,  -8744,  -8959,  -9174,  -9388,  -9602,  -9815, -10027, -10239,
- -10451, -10662, -10872, -11082, -11291, -11500, -11708, -11916, -12123, -12329, -12535, -12740, -12944, -13148, -13351, -13554,
- -13756, -13957, -14157, -14356, -14555, -14754, -14951, -15148, -15343, -15538, -15733, -15926, -16119, -16311, -16502, -16692,
- -16881, -17070, -17257, -17444, -17630, -17815, -17999, -18182, -18365, -18546, -18726, -18906, -19084, -19262, -19438, -19614,
- -19788, -19962, -20134, -20306, -20476, -20646, -20814, -20981, -21148, -21313, -21477, -21640, -21802, -21963, -22123, -22281,
- -22439, -22595, -22751, -22905, -23058, -23209, -23360, -23509, -23658, -23805, -23950, -24095, -24238, -24381, -24522, -24661,
- -24800, -24937, -25073, -25208, -25341, -25473, -25604, -25734, -25862, -25989, -26114, -26239, -26362, -26484, -26604, -26723,
- -26841, -26957, -27072, -27186, -27298, -27409, -27518, -27626, -27733, -27838, -27942, -28045, -28146, -28245, -28344, -28440,
- -28536, -28630, -28722, -28813, -28903, -28991, -29078, -29163, -29247, -29329, -29410, -29490, -29567, -29644, -29719, -29792,
- -29864, -29934, -30003, -30071, -30137, -30201, -30264, -30325, -30385, -30444, -30500, -30556, -30609, -30661, -30712, -30761,
- -30809, -30855, -30899, -30942, -30984, -31023, -31062, -31098, -31133, -31167, -31199, -31229, -31258, -31286, -31311, -31336,
- -31358, -31379, -31399, -31417, -31433, -31448, -31461, -31473, -31483, -31491, -31498, -31503, -31507, -31509, -31510, -31509,
- -31506, -31502, -31496, -31489, -31480, -31470, -31457, -31444, -31429, -31412, -31394, -31374, -31352, -31329, -31305, -31279,
- -31251, -31222, -31191, -31158, -31124, -31089, -31052, -31013, -30973, -30931, -30888, -30843, -30797, -30749, -30700, -30649,
- -30596, -30542, -30487, -30430, -30371, -30311, -30249, -30186, -30122, -30056, -29988, -29919, -29848, -29776, -29703, -29628,
- -29551, -29473, -29394, -29313, -29230, -29147, -29061, -28975, -28886, -28797, -28706, -28613, -28519, -28424, -28327, -28229,
- -28129, -28028, -27926, -27822, -27717, -27611, -27503, -27394, -27283, -27171, -27058, -26943, -26827, -26710, -26591, -26471,
- -26350, -26227, -26103, -25978, -25851, -25724, -25595, -25464, -25333, -25200, -25066, -24930, -24794, -24656, -24517, -24377,
- -24235, -24092, -23948, -23803, -23657, -23510, -23361, -23211, -23060, -22908, -22755, -22601, -22445, -22289, -22131, -21973,
- -21813, -21652, -21490, -21327, -21163, -20997, -20831, -20664, -20496, -20327, -20156, -19985, -19813, -19639, -19465, -19290,
- -19114, -18937, -18759, -18580, -18400, -18219, -18038, -17855, -17672, -17487, -17302, -17116, -16929, -16741, -16553, -16364,
- -16173, -15982, -15791, -15598, -15405, -15211, -15016, -14820, -14624, -14427, -14229, -14031, -13832, -13632, -13432, -13230,
- -13029, -12826, -12623, -12419, -12215, -12010, -11805, -11599, -11392, -11185, -10977, -10769, -10560, -10351, -10141,  -9931,
-  -9720,  -9509,  -9297,  -9085,  -8872,  -8659,  -8445,  -8231,  -8017,  -7802,  -7587,  -7372,  -7156,  -6940,  -6723,  -6506,
-  -6289,  -6072,  -5854,  -5636,  -5417,  -5199,  -4980,  -4761,  -4542,  -4322,  -4102,  -3882,  -3662,  -3442,  -3221,  -3001,
-  -2780,  -2559,  -2338,  -2117,  -1896,  -1674,  -1453,  -1232,  -1010,   -789,   -567,   -345,   -124,     97,    319,    540,
-    762,    983,   1205,   1426,   1648,   1869,   2090,   2311,   2532,   2753,   2973,   3194,   3414,   3634,   3854,   4074,
-   4294,   4513,   4732,   4951,   5170,   5388,   5606,   5824,   6041,   6259,   6476,   6692,   6908,   7124,   7340,   7555,
-   7770,   7984,   8198,   8412,   8625,   8838,   9050,   9262,   9473,   9684,   9895,  10105,  10314,  10523,  10731,  10939,
-  11147,  11353,  11560,  11765,  11970,  12175,  12378,  12582,  12784,  12986,  13188,  13388,  13588,  13788,  13986,  14184,
-  14381,  14578,  14774,  14969,  15163,  15357,  15549,  15741,  15933,  16123,  16313,  16502,  16690,  16877,  17063,  17249,
-  17434,  17617,  17800,  17982,  18164,  18344,  18523,  18702,  18879,  19056,  19231,  19406,  19580,  19753,  19924,  20095,
-  20265,  20434,  20602,  20768,  20934,  21099,  21262,  21425,  21587,  21747,  21907,  22065,  22222,  22378,  22533,  22687,
-  22840,  22992,  23142,  23292,  23440,  23587,  23733,  23878,  24021,  24164,  24305,  24445,  24584,  24722,  24858,  24993,
-  25127,  25260,  25391,  25521,  25650,  25778,  25904,  26029,  26153,  26276,  26397,  26517,  26636,  26753,  26869,  26984,
-  27097,  27209,  27320,  27429,  27537,  27644,  27749,  27853,  27956,  28057,  28157,  28255,  28352,  28448,  28542,  28635,
-  28726,  28816,  28905,  28992,  29078,  29162,  29245,  29327,  29407,  29485,  29562,  29638,  29712,  29785,  29856,  29926,
-  29994,  30061,  30127,  30190,  30253,  30314,  30373,  30431,  30488,  30543,  30596,  30648,  30699,  30748,  30795,  30841,
-  30886,  30929,  30970,  31010,  31048,  31085,  31120,  31154,  31186,  31217,  31246,  31274,  31300,  31325,  31348,  31369,
-  31389,  31408,  31425,  31440,  31454,  31466,  31477,  31486,  31494,  31500,  31505,  31508,  31509,  31509,  31508,  31505,
-  31500,  31494,  31486,  31477,  31466,  31454,  31440,  31424,  31407,  31389,  31369,  31347,  31324,  31300,  31273,  31246,
-  31216,  31186,  31153,  31120,  31084,  31047,  31009,  30969,  30928,  30885,  30841,  30795,  30747,  30698,  30648,  30596,
-  30543,  30488,  30431,  30373,  30314,  30253,  30191,  30127,  30062,  29995,  29927,  29857,  29786,  29714,  29640,  29564,
-  29487,  29409,  29329,  29248,  29165,  29081,  28996,  28909,  28821,  28731,  28640,  28547,  28454,  28358,  28262,  28164,
-  28064,  27963,  27861,  27758,  27653,  27547,  27439,  27330,  27220,  27109,  26996,  26882,  26766,  26649,  26531,  26412,
-  26291,  26170,  26046,  25922,  25796,  25669,  25541,  25411,  25281,  25149,  25016,  24881,  24746,  24609,  24471,  24332,
-  24191,  24050,  23907,  23763,  23618,  23472,  23325,  23177,  23027,  22876,  22724,  22572,  22418,  22263,  22106,  21949,
-  21791,  21632,  21471,  21310,  21147,  20984,  20819,  20654,  20487,  20320,  20151,  19982,  19811,  19640,  19467,  19294,
-  19120,  18945,  18768,  18591,  18414,  18235,  18055,  17875,  17693,  17511,  17328,  17144,  16959,  16773,  16587,  16400,
-  16212,  16023,  15833,  15643,  15452,  15260,  15067,  14874,  14680,  14485,  14290,  14094,  13897,  13699,  13501,  13303,
-  13103,  12903,  12702,  12501,  12299,  12097,  11894,  11690,  11486,  11281,  11076,  10870,  10663,  10456,  10249,  10041,
-   9833,   9624,   9415,   9205,   8995,   8784,   8573,   8362,   8150,   7937,   7725,   7512,   7298,   7085,   6871,   6656,
-   6442,   6227,   6011,   5796,   5580,   5364,   5147,   4931,   4714,   4497,   4279,   4062,   3844,   3626,   3408,   3190,
-   2971,   2753,   2534,   2316,   2097,   1878,   1659,   1440,   1220,   1001,    782,    563,    343,    124,    -95,   -314,
-   -533,   -753,   -972,  -1191,  -1410,  -1629,  -1848,  -2067,  -2286,  -2505,  -2723,  -2941,  -3160,  -3378,  -3596,  -3814,
-  -4031,  -4248,  -4466,  -4683,  -4899,  -5116,  -5332,  -5548,  -5764,  -5979,  -6194,  -6409,  -6623,  -6837,  -7051,  -7265,
-  -7478,  -7691,  -7903,  -8115,  -8327,  -8538,  -8748,  -8959,  -9169,  -9378,  -9587,  -9796, -10004, -10211, -10418, -10625,
- -10831, -11036, -11241, -11446, -11650, -11853, -12056, -12258, -12459, -12660, -12861, -13060, -13259, -13458, -13655, -13852,
- -14049, -14245, -14440, -14634, -14828, -15020, -15213, -15404, -15595, -15785, -15974, -16162, -16350, -16537, -16723, -16908,
- -17092, -17276, -17458, -17640, -17821, -18001, -18181, -18359, -18537, -18713, -18889, -19064, -19237, -19410, -19582, -19753,
- -19923, -20093, -20261, -20428, -20594, -20759, -20923, -21086, -21249, -21410, -21570, -21729, -21887, -22044, -22199, -22354,
- -22508, -22660, -22812, -22962, -23112, -23260, -23407, -23553, -23697, -23841, -23984, -24125, -24265, -24404, -24542, -24678,
- -24814, -24948, -25081, -25213, -25343, -25473, -25601, -25728, -25854, -25978, -26101, -26223, -26344, -26463, -26581, -26698,
- -26813, -26928, -27040, -27152, -27262, -27371, -27479, -27585, -27690, -27794, -27896, -27997, -28097, -28195, -28292, -28388,
- -28482, -28575, -28666, -28756, -28845, -28932, -29018, -29103, -29186, -29267, -29348, -29426, -29504, -29580, -29654, -29728,
- -29799, -29870, -29939, -30006, -30072, -30136, -30200, -30261, -30321, -30380, -30437, -30493, -30547, -30600, -30652, -30702,
- -30750, -30797, -30842, -30886, -30929, -30970, -31009, -31047, -31084, -31119, -31152, -31185, -31215, -31244, -31272, -31298,
- -31322, -31345, -31367, -31387, -31405, -31422, -31438, -31452, -31464, -31475, -31485, -31493, -31499, -31504, -31507, -31509,
- -31510, -31508, -31506, -31502, -31496, -31489, -31480, -31470, -31458, -31445, -31430, -31414, -31396, -31377, -31356, -31334,
- -31310, -31285, -31258, -31230, -31200, -31169, -31136, -31102, -31066, -31029, -30990, -30950, -30908, -30865, -30820, -30774,
- -30727, -30678, -30627, -30575, -30522, -30467, -30410, -30352, -30293, -30232, -30170, -30106, -30041, -29975, -29907, -29838,
- -29767, -29694, -29621, -29546, -29469, -29391, -29312, -29231, -29149, -29066, -28981, -28894, -28807, -28718, -28627, -28535,
- -28442, -28348, -28252, -28155, -28056, -27956, -27855, -27752, -27649, -27543, -27437, -27329, -27220, -27109, -26998, -26884,
- -26770, -26655, -26538, -26420, -26300, -26179, -26058, -25934, -25810, -25684, -25557, -25429, -25300, -25170, -25038, -24905,
- -24771, -24636, -24499, -24362, -24223, -24083, -23942, -23800, -23656, -23512, -23366, -23219, -23072, -22923, -22773, -22622,
- -22469, -22316, -22162, -22006, -21850, -21693, -21534, -21375, -21214, -21053, -20890, -20726, -20562, -20396, -20230, -20062,
- -19894, -19725, -19554, -19383, -19211, -19038, -18864, -18689, -18513, -18337, -18159, -17981, -17802, -17622, -17441, -17259,
- -17077, -16893, -16709, -16524, -16338, -16152, -15964, -15776, -15588, -15398, -15208, -15017, -14825, -14633, -14440, -14246,
- -14051, -13856, -13661, -13464, -13267, -13069, -12871, -12672, -12473, -12272, -12072, -11870, -11669, -11466, -11263, -11060,
- -10856, -10651, -10446, -10241, -10035,  -9828,  -9622,  -9414,  -9206,  -8998,  -8789,  -8580,  -8371,  -8161,  -7951,  -7740,
-  -7529,  -7318,  -7106,  -6894,  -6681,  -6469,  -6256,  -6042,  -5829,  -5615,  -5401,  -5187,  -4972,  -4757,  -4542,  -4327,
-  -4111,  -3896,  -3680,  -3464,  -3248,  -3031,  -2815,  -2598,  -2382,  -2165,  -1948,  -1731,  -1514,  -1296,  -1079,   -862,
-   -645,   -427,   -210,      6,    224,    441,    658,    876,   1093,   1310,   1527,   1744,   1961,   2178,   2395,   2611,
-   2828,   3044,   3260,   3476,   3692,   3908,   4123,   4339,   4554,   4769,   4983,   5198,   5412,   5626,   5839,   6053,
-   6266,   6479,   6691,   6903,   7115,   7326,   7537,   7748,   7958,   8168,   8378,   8587,   8796,   9004,   9212,   9420,
-   9627,   9833,  10039,  10245,  10450,  10655,  10859,  11062,  11265,  11468,  11670,  11871,  12072,  12272,  12472,  12671,
-  12869,  13067,  13265,  13461,  13657,  13852,  14047,  14241,  14434,  14627,  14819,  15010,  15201,  15390,  15579,  15768,
-  15955,  16142,  16328,  16513,  16698,  16881,  17064,  17246,  17427,  17608,  17787,  17966,  18144,  18321,  18497,  18672,
-  18846,  19020,  19192,  19364,  19535,  19704,  19873,  20041,  20208,  20374,  20539,  20703,  20866,  21028,  21189,  21349,
-  21508,  21666,  21823,  21979,  22134,  22288,  22441,  22592,  22743,  22893,  23041,  23188,  23335,  23480,  23624,  23767,
-  23909,  24049,  24189,  24327,  24464,  24601,  24735,  24869,  25002,  25133,  25263,  25392,  25520,  25647,  25772,  25896,
-  26019,  26141,  26261,  26380,  26498,  26615,  26730,  26844,  26957,  27069,  27179,  27288,  27396,  27502,  27607,  27711,
-  27814,  27915,  28015,  28113,  28210,  28306,  28401,  28494,  28586,  28676,  28765,  28853,  28940,  29025,  29108,  29190,
-  29271,  29351,  29429,  29506,  29581,  29655,  29727,  29799,  29868,  29937,  30003,  30069,  30133,  30196,  30257,  30317,
-  30375,  30432,  30487,  30541,  30594,  30645,  30695,  30743,  30789,  30835,  30879,  30921,  30962,  31001,  31039,  31076,
-  31111,  31145,  31177,  31207,  31237,  31264,  31291,  31315,  31339,  31360,  31381,  31399,  31417,  31433,  31447,  31460,
-  31471,  31481,  31490,  31497,  31502,  31506,  31509,  31510,  31509,  31507,  31504,  31499,  31492,  31484,  31475,  31464,
-  31452,  31438,  31423,  31406,  31387,  31368,  31346,  31324,  31300,  31274,  31247,  31218,  31188,  31156,  31123,  31089,
-  31053,  31015,  30977,  30936,  30894,  30851,  30806,  30760,  30713,  30664,  30613,  30561,  30508,  30453,  30397,  30339,
-  30280,  30219,  30157,  30094,  30029,  29963,  29895,  29826,  29756,  29684,  29611,  29536,  29460,  29383,  29304,  29224,
-  29142,  29059,  28975,  28889,  28802,  28714,  28624,  28533,  28441,  28347,  28252,  28156,  28058,  27959,  27859,  27757,
-  27654,  27550,  27444,  27337,  27229,  27120,  27009,  26897,  26784,  26669,  26554,  26437,  26319,  26199,  26078,  25956,
-  25833,  25709,  25583,  25457,  25329,  25200,  25069,  24938,  24805,  24671,  24536,  24400,  24263,  24125,  23985,  23844,
-  23703,  23560,  23416,  23271,  23124,  22977,  22829,  22679,  22529,  22377,  22225,  22071,  21916,  21761,  21604,  21446,
-  21288,  21128,  20967,  20805,  20643,  20479,  20314,  20149,  19982,  19815,  19647,  19477,  19307,  19136,  18964,  18791,
-  18617,  18443,  18267,  18091,  17914,  17736,  17557,  17377,  17197,  17015,  16833,  16650,  16467,  16282,  16097,  15911,
-  15724,  15537,  15349,  15160,  14970,  14780,  14589,  14398,  14205,  14012,  13819,  13624,  13429,  13234,  13038,  12841,
-  12644,  12446,  12247,  12048,  11848,  11648,  11447,  11246,  11044,  10842,  10639,  10436,  10232,  10028,   9823,   9618,
-   9412,   9206,   8999,   8792,   8585,   8377,   8169,   7961,   7752,   7542,   7333,   7123,   6913,   6702,   6491,   6280,
-   6068,   5857,   5645,   5432,   5220,   5007,   4794,   4581,   4367,   4153,   3940,   3726,   3511,   3297,   3082,   2868,
-   2653,   2438,   2223,   2008,   1793,   1577,   1362,   1147,    931,    716,    500,    285,     69,   -146,   -361,   -577,
-   -792,  -1008,  -1223,  -1439,  -1654,  -1869,  -2084,  -2299,  -2514,  -2729,  -2943,  -3158,  -3372,  -3587,  -3801,  -4014,
-  -4228,  -4442,  -4655,  -4868,  -5081,  -5293,  -5505,  -5717,  -5929,  -6141,  -6352,  -6563,  -6773,  -6984,  -7194,  -7403,
-  -7612,  -7821,  -8030,  -8238,  -8446,  -8653,  -8860,  -9066,  -9273,  -9478,  -9683,  -9888, -10092, -10296, -10500, -10702,
- -10905, -11107, -11308, -11509, -11709, -11909, -12108, -12306, -12504, -12702, -12898, -13095, -13290, -13485, -13679, -13873,
- -14066, -14258, -14450, -14641, -14831, -15021, -15210, -15398, -15586, -15772, -15958, -16144, -16328, -16512, -16695, -16877,
- -17058, -17239, -17419, -17598, -17776, -17953, -18130, -18305, -18480, -18654, -18827, -18999, -19171, -19341, -19510, -19679,
- -19846, -20013, -20179, -20344, -20508, -20671, -20832, -20993, -21153, -21312, -21470, -21627, -21783, -21938, -22092, -22245,
- -22397, -22548, -22698, -22846, -22994, -23141, -23286, -23430, -23574, -23716, -23857, -23997, -24136, -24274, -24410, -24546,
- -24680, -24813, -24945, -25076, -25206, -25334, -25461, -25587, -25712, -25836, -25959, -26080, -26200, -26319, -26436, -26553,
- -26668, -26782, -26895, -27006, -27116, -27225, -27333, -27439, -27544, -27648, -27750, -27852, -27951, -28050, -28147, -28243,
- -28338, -28431, -28523, -28614, -28703, -28791, -28878, -28963, -29047, -29130, -29211, -29291, -29370, -29447, -29523, -29597,
- -29670, -29742, -29812, -29881, -29949, -30015, -30079, -30143, -30205, -30265, -30324, -30382, -30438, -30493, -30546, -30598,
- -30649, -30698, -30746, -30792, -30837, -30881, -30923, -30963, -31002, -31040, -31076, -31111, -31144, -31176, -31207, -31236,
- -31263, -31289, -31314, -31337, -31359, -31379, -31398, -31415, -31431, -31446, -31459, -31470, -31480, -31489, -31496, -31501,
- -31506, -31508, -31510, -31509, -31508, -31505, -31500, -31494, -31486, -31477, -31467, -31455, -31442, -31427, -31411, -31393,
- -31374, -31353, -31331, -31307, -31282, -31256, -31228, -31199, -31168, -31135, -31102, -31067, -31030, -30992, -30952, -30912,
- -30869, -30825, -30780, -30734, -30686, -30636, -30585, -30533, -30479, -30424, -30367, -30309, -30250, -30189, -30127, -30063,
- -29999, -29932, -29864, -29795, -29725, -29653, -29580, -29505, -29429, -29352, -29273, -29193, -29111, -29029, -28945, -28859,
- -28772, -28684, -28595, -28504, -28412, -28318, -28224, -28128, -28030, -27932, -27832, -27730, -27628, -27524, -27419, -27313,
- -27205, -27096, -26986, -26875, -26762, -26648, -26533, -26417, -26300, -26181, -26061, -25940, -25817, -25694, -25569, -25443,
- -25316, -25188, -25058, -24928, -24796, -24663, -24529, -24394, -24258, -24120, -23982, -23842, -23701, -23560, -23417, -23273,
- -23128, -22982, -22834, -22686, -22537, -22386, -22235, -22083, -21929, -21775, -21619, -21463, -21305, -21147, -20988, -20827,
- -20666, -20504, -20340, -20176, -20011, -19845, -19678, -19510, -19342, -19172, -19002, -18830, -18658, -18485, -18311, -18136,
- -17960, -17784, -17607, -17428, -17250, -17070, -16889, -16708, -16526, -16343, -16160, -15975, -15790, -15605, -15418, -15231,
- -15043, -14854, -14665, -14475, -14285, -14093, -13901, -13709, -13516, -13322, -13127, -12932, -12737, -12541, -12344, -12147,
- -11949, -11750, -11551, -11352, -11152, -10951, -10750, -10548, -10346, -10144,  -9941,  -9737,  -9534,  -9329,  -9124,  -8919,
-  -8714,  -8508,  -8301,  -8095,  -7888,  -7680,  -7472,  -7264,  -7056,  -6847,  -6638,  -6428,  -6218,  -6008,  -5798,  -5588,
-  -5377,  -5166,  -4954,  -4743,  -4531,  -4319,  -4107,  -3895,  -3682,  -3470,  -3257,  -3044,  -2831,  -2618,  -2404,  -2191,
-  -1977,  -1764,  -1550,  -1336,  -1122,   -908,   -694,   -480,   -266,    -52,    161,    375,    589,    803,   1016,   1230,
-   1444,   1658,   1871,   2085,   2298,   2512,   2725,   2938,   3151,   3364,   3576,   3789,   4001,   4213,   4425,   4637,
-   4848,   5060,   5271,   5481,   5692,   5902,   6112,   6322,   6531,   6740,   6949,   7158,   7366,   7573,   7781,   7988,
-   8195,   8401,   8607,   8812,   9018,   9222,   9426,   9630,   9834,  10037,  10239,  10441,  10643,  10844,  11044,  11244,
-  11444,  11643,  11841,  12039,  12236,  12433,  12629,  12825,  13020,  13214,  13408,  13601,  13793,  13985,  14177,  14367,
-  14557,  14746,  14935,  15123,  15310,  15496,  15682,  15867,  16051,  16235,  16418,  16600,  16781,  16962,  17141,  17320,
-  17498,  17676,  17852,  18028,  18203,  18377,  18550,  18722,  18894,  19064,  19234,  19403,  19571,  19738,  19904,  20069,
-  20233,  20397,  20559,  20720,  20881,  21040,  21199,  21357,  21513,  21669,  21823,  21977,  22130,  22281,  22432,  22581,
-  22730,  22877,  23023,  23169,  23313,  23456,  23598,  23739,  23879,  24018,  24156,  24292,  24428,  24562,  24695,  24827,
-  24958,  25088,  25217,  25344,  25470,  25596,  25719,  25842,  25964,  26084,  26203,  26321,  26438,  26554,  26668,  26781,
-  26893,  27004,  27113,  27221,  27328,  27434,  27538,  27641,  27743,  27844,  27943,  28041,  28138,  28233,  28327,  28420,
-  28512,  28602,  28691,  28778,  28865,  28950,  29033,  29116,  29196,  29276,  29354,  29431,  29507,  29581,  29654,  29725,
-  29795,  29864,  29932,  29998,  30062,  30125,  30187,  30248,  30307,  30365,  30421,  30476,  30529,  30581,  30632,  30681,
-  30729,  30776,  30821,  30864,  30907,  30948,  30987,  31025,  31062,  31097,  31130,  31163,  31194,  31223,  31251,  31277,
-  31303,  31326,  31349,  31369,  31389,  31407,  31423,  31438,  31452,  31464,  31475,  31484,  31492,  31498,  31503,  31507,
-  31509,  31510,  31509,  31507,  31503,  31498,  31491,  31483,  31474,  31463,  31450,  31437,  31421,  31405,  31387,  31367,
-  31346,  31324,  31300,  31275,  31248,  31220,  31190,  31159,  31127,  31093,  31058,  31021,  30983,  30943,  30902,  30860,
-  30816,  30771,  30725,  30677,  30627,  30576,  30524,  30471,  30416,  30359,  30302,  30242,  30182,  30120,  30057,  29992,
-  29926,  29859,  29790,  29720,  29648,  29575,  29501,  29426,  29349,  29271,  29191,  29110,  29028,  28944,  28859,  28773,
-  28686,  28597,  28507,  28415,  28323,  28229,  28133,  28037,  27939,  27840,  27739,  27638,  27535,  27431,  27325,  27218,
-  27110,  27001,  26891,  26779,  26666,  26552,  26437,  26320,  26203,  26084,  25964,  25842,  25720,  25596,  25472,  25346,
-  25218,  25090,  24961,  24830,  24699,  24566,  24432,  24297,  24161,  24023,  23885,  23746,  23605,  23464,  23321,  23177,
-  23032,  22887,  22740,  22592,  22443,  22293,  22142,  21990,  21837,  21683,  21528,  21372,  21215,  21057,  20898,  20739,
-  20578,  20416,  20254,  20090,  19926,  19760,  19594,  19427,  19259,  19090,  18920,  18749,  18578,  18406,  18232,  18058,
-  17884,  17708,  17532,  17354,  17176,  16997,  16818,  16638,  16456,  16275,  16092,  15909,  15725,  15540,  15354,  15168,
-  14981,  14794,  14606,  14417,  14227,  14037,  13846,  13655,  13463,  13270,  13077,  12883,  12688,  12493,  12298,  12102,
-  11905,  11708,  11510,  11312,  11113,  10914,  10714,  10514,  10313,  10112,   9910,   9708,   9505,   9302,   9099,   8895,
-   8691,   8486,   8281,   8076,   7870,   7664,   7457,   7250,   7043,   6836,   6628,   6420,   6212,   6003,   5794,   5585,
-   5376,   5166,   4956,   4746,   4536,   4325,   4114,   3903,   3692,   3481,   3270,   3058,   2847,   2635,   2423,   2211,
-   1999,   1786,   1574,   1362,   1149,    937,    724,    512,    299,     87,   -125,   -337,   -550,   -763,   -975,  -1187,
-  -1400,  -1612,  -1824,  -2037,  -2249,  -2461,  -2672,  -2884,  -3096,  -3307,  -3518,  -3729,  -3940,  -4151,  -4362,  -4572,
-  -4782,  -4992,  -5202,  -5411,  -5621,  -5830,  -6038,  -6247,  -6455,  -6663,  -6870,  -7077,  -7284,  -7491,  -7697,  -7903,
-  -8108,  -8313,  -8518,  -8723,  -8926,  -9130,  -9333,  -9536,  -9738,  -9940, -10141, -10342, -10543, -10743, -10942, -11141,
- -11339, -11537, -11735, -11932, -12128, -12324, -12519, -12713, -12908, -13101, -13294, -13486, -13678, -13869, -14059, -14249,
- -14438, -14626, -14814, -15001, -15188, -15373, -15558, -15743, -15926, -16109, -16291, -16473, -16653, -16833, -17012, -17191,
- -17368, -17545, -17721, -17896, -18070, -18244, -18417, -18588, -18759, -18930, -19099, -19267, -19435, -19601, -19767, -19932,
- -20096, -20259, -20421, -20582, -20743, -20902, -21060, -21218, -21374, -21530, -21684, -21838, -21990, -22142, -22292, -22442,
- -22590, -22738, -22884, -23029, -23174, -23317, -23459, -23600, -23740, -23879, -24017, -24154, -24290, -24424, -24558, -24690,
- -24822, -24952, -25081, -25209, -25335, -25461, -25585, -25709, -25831, -25952, -26071, -26190, -26307, -26424, -26539, -26652,
- -26765, -26876, -26986, -27095, -27203, -27309, -27415, -27518, -27621, -27723, -27823, -27922, -28019, -28116, -28211, -28305,
- -28397, -28489, -28579, -28667, -28755, -28841, -28925, -29009, -29091, -29172, -29251, -29330, -29406, -29482, -29556, -29629,
- -29700, -29771, -29839, -29907, -29973, -30038, -30101, -30163, -30224, -30283, -30341, -30397, -30453, -30506, -30559, -30610,
- -30659, -30708, -30754, -30800, -30844, -30887, -30928, -30968, -31006, -31043, -31079, -31113, -31146, -31177, -31207, -31236,
- -31263, -31289, -31313, -31336, -31358, -31378, -31396, -31414, -31429, -31444, -31457, -31468, -31478, -31487, -31495, -31500,
- -31505, -31508, -31509, -31510, -31508, -31506, -31502, -31496, -31489, -31481, -31471, -31460, -31447, -31433, -31417, -31400,
- -31382, -31362, -31341, -31319, -31295, -31269, -31242, -31214, -31184, -31153, -31121, -31087, -31052, -31015, -30977, -30937,
- -30897, -30854, -30811, -30766, -30719, -30671, -30622, -30571, -30519, -30466, -30411, -30355, -30298, -30239, -30179, -30117,
- -30054, -29990, -29924, -29857, -29789, -29719, -29648, -29576, -29502, -29427, -29350, -29273, -29194, -29113, -29032, -28949,
- -28864, -28779, -28692, -28604, -28514, -28424, -28332, -28238, -28144, -28048, -27951, -27852, -27753, -27652, -27550, -27446,
- -27342, -27236, -27129, -27020, -26911, -26800, -26688, -26575, -26461, -26345, -26229, -26111, -25992, -25871, -25750, -25627,
- -25504, -25379, -25253, -25126, -24997, -24868, -24737, -24606, -24473, -24339, -24204, -24068, -23931, -23793, -23653, -23513,
- -23372, -23229, -23086, -22941, -22796, -22649, -22501, -22353, -22203, -22052, -21901, -21748, -21595, -21440, -21284, -21128,
- -20970, -20812, -20653, -20493, -20331, -20169, -20006, -19842, -19678, -19512, -19345, -19178, -19010, -18840, -18671, -18500,
- -18328, -18156, -17982, -17808, -17633, -17458, -17281, -17104, -16926, -16747, -16567, -16387, -16206, -16024, -15842, -15659,
- -15475, -15290, -15105, -14919, -14732, -14545, -14357, -14169, -13979, -13790, -13599, -13408, -13216, -13024, -12831, -12638,
- -12444, -12249, -12054, -11859, -11663, -11466, -11269, -11071, -10873, -10674, -10475, -10275, -10075,  -9875,  -9674,  -9472,
-  -9270,  -9068,  -8865,  -8662,  -8459,  -8255,  -8051,  -7846,  -7641,  -7436,  -7231,  -7025,  -6818,  -6612,  -6405,  -6198,
-  -5991,  -5783,  -5575,  -5367,  -5159,  -4950,  -4741,  -4532,  -4323,  -4113,  -3904,  -3694,  -3484,  -3274,  -3064,  -2853,
-  -2643,  -2432,  -2221,  -2010,  -1799,  -1588,  -1377,  -1166,   -955,   -744,   -533,   -321,   -110,    100,    312,    523,
-    734,    945,   1157,   1368,   1579,   1790,   2001,   2211,   2422,   2633,   2843,   3053,   3264,   3474,   3684,   3893,
-   4103,   4312,   4521,   4730,   4939,   5147,   5356,   5564,   5772,   5979,   6186,   6393,   6600,   6806,   7012,   7218,
-   7424,   7629,   7833,   8038,   8242,   8446,   8649,   8852,   9054,   9256,   9458,   9659,   9860,  10060,  10260,  10460,
-  10658,  10857,  11055,  11252,  11449,  11646,  11842,  12037,  12232,  12426,  12620,  12813,  13006,  13198,  13389,  13580,
-  13770,  13960,  14149,  14337,  14525,  14712,  14898,  15084,  15269,  15453,  15637,  15820,  16002,  16183,  16364,  16544,
-  16723,  16902,  17080,  17257,  17433,  17608,  17783,  17957,  18130,  18302,  18473,  18644,  18814,  18983,  19151,  19318,
-  19484,  19650,  19814,  19978,  20140,  20302,  20463,  20623,  20782,  20940,  21098,  21254,  21409,  21564,  21717,  21869,
-  22021,  22171,  22321,  22469,  22616,  22763,  22908,  23053,  23196,  23338,  23479,  23620,  23759,  23897,  24034,  24170,
-  24304,  24438,  24571,  24702,  24833,  24962,  25090,  25217,  25343,  25468,  25591,  25714,  25835,  25955,  26074,  26192,
-  26309,  26424,  26539,  26652,  26764,  26874,  26984,  27092,  27199,  27305,  27410,  27513,  27615,  27716,  27816,  27914,
-  28012,  28108,  28202,  28296,  28388,  28479,  28568,  28657,  28744,  28829,  28914,  28997,  29079,  29159,  29239,  29317,
-  29393,  29469,  29543,  29615,  29687,  29757,  29825,  29893,  29959,  30023,  30087,  30148,  30209,  30268,  30326,  30383,
-  30438,  30492,  30544,  30595,  30645,  30693,  30740,  30786,  30830,  30873,  30915,  30955,  30993,  31031,  31067,  31101,
-  31134,  31166,  31196,  31225,  31253,  31279,  31304,  31327,  31349,  31370,  31389,  31406,  31423,  31438,  31451,  31463,
-  31474,  31483,  31491,  31498,  31503,  31506,  31509,  31510,  31509,  31507,  31504,  31499,  31493,  31485,  31476,  31466,
-  31454,  31441,  31426,  31410,  31393,  31374,  31353,  31332,  31309,  31284,  31258,  31231,  31203,  31173,  31141,  31108,
-  31074,  31039,  31002,  30963,  30923,  30882,  30840,  30796,  30751,  30704,  30656,  30607,  30556,  30504,  30450,  30395,
-  30339,  30282,  30223,  30163,  30101,  30038,  29974,  29908,  29841,  29773,  29703,  29632,  29560,  29487,  29412,  29336,
-  29258,  29179,  29099,  29018,  28935,  28851,  28766,  28679,  28591,  28502,  28412,  28320,  28227,  28133,  28037,  27941,
-  27843,  27744,  27643,  27542,  27439,  27335,  27229,  27123,  27015,  26906,  26796,  26684,  26572,  26458,  26343,  26227,
-  26110,  25992,  25872,  25751,  25629,  25506,  25382,  25257,  25131,  25003,  24874,  24745,  24614,  24482,  24349,  24215,
-  24080,  23943,  23806,  23668,  23528,  23388,  23246,  23103,  22960,  22815,  22670,  22523,  22375,  22227,  22077,  21926,
-  21775,  21622,  21469,  21314,  21159,  21002,  20845,  20687,  20528,  20368,  20207,  20045,  19882,  19718,  19554,  19388,
-  19222,  19055,  18887,  18718,  18549,  18378,  18207,  18035,  17862,  17688,  17514,  17338,  17162,  16986,  16808,  16630,
-  16451,  16271,  16091,  15909,  15728,  15545,  15362,  15178,  14993,  14808,  14622,  14435,  14248,  14060,  13871,  13682,
-  13493,  13302,  13111,  12920,  12728,  12535,  12342,  12148,  11954,  11759,  11564,  11368,  11171,  10975,  10777,  10579,
-  10381,  10182,   9983,   9784,   9584,   9383,   9182,   8981,   8779,   8577,   8374,   8172,   7968,   7765,   7561,   7357,
-   7152,   6947,   6742,   6537,   6331,   6125,   5918,   5712,   5505,   5298,   5090,   4883,   4675,   4467,   4259,   4051,
-   3842,   3633,   3425,   3216,   3006,   2797,   2588,   2378,   2169,   1959,   1749,   1539,   1329,   1119,    909,    699,
-    489,    279,     69,   -140,   -350,   -561,   -771,   -981,  -1191,  -1401,  -1611,  -1820,  -2030,  -2240,  -2449,  -2659,
-  -2868,  -3077,  -3286,  -3495,  -3704,  -3912,  -4121,  -4329,  -4537,  -4745,  -4952,  -5160,  -5367,  -5574,  -5780,  -5987,
-  -6193,  -6399,  -6604,  -6809,  -7014,  -7219,  -7423,  -7627,  -7831,  -8034,  -8237,  -8440,  -8642,  -8844,  -9045,  -9246,
-  -9447,  -9647,  -9846, -10046, -10245, -10443, -10641, -10838, -11035, -11232, -11428, -11623, -11818, -12013, -12206, -12400,
- -12593, -12785, -12976, -13167, -13358, -13548, -13737, -13926, -14114, -14301, -14488, -14674, -14860, -15044, -15229, -15412,
- -15595, -15777, -15958, -16139, -16319, -16498, -16677, -16854, -17031, -17208, -17383, -17558, -17732, -17905, -18077, -18249,
- -18420, -18589, -18759, -18927, -19094, -19261, -19426, -19591, -19755, -19918, -20081, -20242, -20402, -20562, -20720, -20878,
- -21035, -21191, -21345, -21499, -21652, -21804, -21955, -22105, -22254, -22402, -22550, -22696, -22841, -22985, -23128, -23270,
- -23411, -23551, -23690, -23827, -23964, -24100, -24235, -24368, -24501, -24632, -24762, -24892, -25020, -25147, -25273, -25397,
- -25521, -25643, -25765, -25885, -26004, -26122, -26239, -26354, -26469, -26582, -26694, -26805, -26914, -27023, -27130, -27236,
- -27341, -27445, -27547, -27649, -27749, -27847, -27945, -28041, -28136, -28230, -28323, -28414, -28504, -28593, -28680, -28766,
- -28851, -28935, -29017, -29099, -29178, -29257, -29334, -29410, -29485, -29558, -29630, -29701, -29770, -29838, -29905, -29970,
- -30034, -30097, -30159, -30219, -30277, -30335, -30391, -30446, -30499, -30551, -30602, -30651, -30699, -30745, -30791, -30834,
- -30877, -30918, -30958, -30996, -31033, -31069, -31103, -31136, -31167, -31198, -31226, -31254, -31280, -31304, -31327, -31349,
- -31370, -31389, -31406, -31423, -31438, -31451, -31463, -31474, -31483, -31491, -31498, -31503, -31506, -31509, -31510, -31509,
- -31507, -31504, -31499, -31493, -31486, -31477, -31467, -31455, -31442, -31428, -31412, -31395, -31377, -31357, -31335, -31313,
- -31288, -31263, -31236, -31208, -31178, -31147, -31115, -31081, -31046, -31009, -30972, -30932, -30892, -30850, -30806, -30762,
- -30716, -30668, -30619, -30569, -30518, -30465, -30411, -30355, -30298, -30240, -30181, -30120, -30058, -29994, -29929, -29863,
- -29796, -29727, -29657, -29585, -29512, -29438, -29363, -29286, -29208, -29129, -29049, -28967, -28884, -28799, -28714, -28627,
- -28539, -28449, -28359, -28267, -28173, -28079, -27983, -27886, -27788, -27689, -27588, -27486, -27383, -27279, -27174, -27067,
- -26959, -26850, -26740, -26628, -26516, -26402, -26287, -26171, -26054, -25935, -25816, -25695, -25573, -25450, -25326, -25201,
- -25075, -24947, -24819, -24689, -24558, -24427, -24294, -24160, -24025, -23889, -23751, -23613, -23474, -23334, -23192, -23050,
- -22907, -22762, -22617, -22471, -22323, -22175, -22026, -21875, -21724, -21572, -21419, -21264, -21109, -20953, -20796, -20639,
- -20480, -20320, -20160, -19998, -19836, -19673, -19508, -19343, -19178, -19011, -18844, -18675, -18506, -18336, -18165, -17994,
- -17821, -17648, -17474, -17299, -17124, -16948, -16771, -16593, -16415, -16235, -16055, -15875, -15693, -15511, -15329, -15145,
- -14961, -14777, -14591, -14405, -14219, -14031, -13843, -13655, -13466, -13276, -13086, -12895, -12703, -12511, -12319, -12126,
- -11932, -11738, -11543, -11348, -11152, -10956, -10760, -10562, -10365, -10167,  -9968,  -9769,  -9570,  -9370,  -9170,  -8969,
-  -8768,  -8567,  -8365,  -8163,  -7960,  -7757,  -7554,  -7350,  -7147,  -6942,  -6738,  -6533,  -6328,  -6123,  -5917,  -5711,
-  -5505,  -5298,  -5092,  -4885,  -4678,  -4471,  -4263,  -4055,  -3848,  -3640,  -3431,  -3223,  -3015,  -2806,  -2597,  -2388,
-  -2179,  -1970,  -1761,  -1552,  -1343,  -1133,   -924,   -715,   -505,   -296,    -86,    123,    332,    541,    751,    960,
-   1170,   1379,   1588,   1798,   2007,   2216,   2425,   2634,   2842,   3051,   3259,   3468,   3676,   3884,   4092,   4299,
-   4507,   4714,   4921,   5128,   5334,   5541,   5747,   5953,   6158,   6364,   6569,   6773,   6978,   7182,   7386,   7589,
-   7793,   7995,   8198,   8400,   8602,   8803,   9004,   9205,   9405,   9605,   9804,  10003,  10201,  10399,  10597,  10794,
-  10990,  11186,  11382,  11577,  11772,  11966,  12159,  12352,  12545,  12737,  12928,  13119,  13309,  13499,  13688,  13876,
-  14064,  14251,  14438,  14624,  14809,  14993,  15177,  15361,  15543,  15725,  15906,  16087,  16267,  16446,  16624,  16802,
-  16978,  17155,  17330,  17504,  17678,  17851,  18024,  18195,  18366,  18536,  18705,  18873,  19040,  19207,  19372,  19537,
-  19701,  19864,  20026,  20188,  20348,  20507,  20666,  20824,  20981,  21136,  21291,  21445,  21598,  21750,  21901,  22052,
-  22201,  22349,  22496,  22642,  22788,  22932,  23075,  23217,  23358,  23498,  23637,  23775,  23912,  24048,  24183,  24317,
-  24450,  24581,  24712,  24841,  24969,  25097,  25223,  25348,  25472,  25594,  25716,  25837,  25956,  26074,  26191,  26307,
-  26422,  26535,  26648,  26759,  26869,  26978,  27086,  27192,  27297,  27401,  27504,  27606,  27706,  27805,  27903,  28000,
-  28095,  28190,  28283,  28374,  28465,  28554,  28642,  28729,  28814,  28898,  28981,  29063,  29143,  29222,  29300,  29376,
-  29451,  29525,  29598,  29669,  29739,  29807,  29875,  29941,  30005,  30069,  30131,  30191,  30250,  30308,  30365,  30420,
-  30474,  30527,  30578,  30628,  30677,  30724,  30770,  30814,  30857,  30899,  30939,  30978,  31016,  31052,  31087,  31120,
-  31153,  31183,  31213,  31241,  31267,  31293,  31316,  31339,  31360,  31380,  31398,  31415,  31430,  31445,  31457,  31469,
-  31479,  31487,  31494,  31500,  31505,  31508,  31509,  31510,  31508,  31506,  31502,  31497,  31490,  31482,  31472,  31461,
-  31449,  31435,  31420,  31404,  31386,  31367,  31346,  31324,  31300,  31276,  31250,  31222,  31193,  31163,  31131,  31098,
-  31064,  31028,  30991,  30952,  30912,  30871,  30828,  30784,  30739,  30692,  30644,  30594,  30544,  30491,  30438,  30383,
-  30327,  30269,  30210,  30150,  30089,  30026,  29962,  29896,  29829,  29761,  29692,  29621,  29549,  29475,  29401,  29325,
-  29247,  29169,  29089,  29008,  28925,  28842,  28757,  28670,  28583,  28494,  28404,  28312,  28220,  28126,  28031,  27935,
-  27837,  27738,  27638,  27537,  27435,  27331,  27226,  27120,  27013,  26904,  26795,  26684,  26572,  26459,  26344,  26229,
-  26112,  25994,  25875,  25755,  25634,  25512,  25388,  25263,  25138,  25011,  24883,  24754,  24624,  24492,  24360,  24226,
-  24092,  23956,  23820,  23682,  23543,  23404,  23263,  23121,  22978,  22834,  22689,  22544,  22397,  22249,  22100,  21950,
-  21799,  21648,  21495,  21341,  21187,  21031,  20875,  20717,  20559,  20400,  20240,  20079,  19917,  19754,  19590,  19426,
-  19260,  19094,  18927,  18759,  18590,  18421,  18250,  18079,  17907,  17734,  17561,  17386,  17211,  17036,  16859,  16682,
-  16503,  16325,  16145,  15965,  15784,  15602,  15420,  15237,  15053,  14869,  14684,  14498,  14312,  14125,  13937,  13749,
-  13560,  13371,  13181,  12990,  12799,  12607,  12415,  12222,  12029,  11835,  11640,  11445,  11250,  11054,  10857,  10661,
-  10463,  10265,  10067,   9868,   9669,   9469,   9269,   9069,   8868,   8667,   8465,   8263,   8061,   7858,   7655,   7452,
-   7248,   7044,   6840,   6635,   6430,   6225,   6019,   5814,   5607,   5401,   5195,   4988,   4781,   4574,   4366,   4159,
-   3951,   3743,   3535,   3327,   3118,   2910,   2701,   2492,   2283,   2074,   1865,   1656,   1447,   1238,   1028,    819,
-    609,    400,    190,    -18,   -228,   -437,   -647,   -856,  -1066,  -1275,  -1484,  -1693,  -1903,  -2112,  -2321,  -2530,
-  -2738,  -2947,  -3156,  -3364,  -3572,  -3780,  -3988,  -4196,  -4403,  -4611,  -4818,  -5025,  -5232,  -5438,  -5644,  -5850,
-  -6056,  -6262,  -6467,  -6672,  -6876,  -7081,  -7285,  -7488,  -7692,  -7895,  -8097,  -8299,  -8501,  -8703,  -8904,  -9105,
-  -9305,  -9505,  -9705,  -9904, -10102, -10301, -10498, -10696, -10893, -11089, -11285, -11480, -11675, -11869, -12063, -12256,
- -12449, -12641, -12833, -13024, -13215, -13404, -13594, -13782, -13971, -14158, -14345, -14531, -14717, -14902, -15086, -15269,
- -15452, -15635, -15816, -15997, -16177, -16357, -16535, -16713, -16891, -17067, -17243, -17418, -17592, -17765, -17938, -18110,
- -18281, -18451, -18621, -18789, -18957, -19124, -19290, -19455, -19620, -19783, -19946, -20107, -20268, -20428, -20587, -20745,
- -20903, -21059, -21214, -21369, -21522, -21675, -21826, -21977, -22127, -22275, -22423, -22570, -22715, -22860, -23004, -23146,
- -23288, -23429, -23568, -23707, -23844, -23981, -24116, -24250, -24384, -24516, -24647, -24777, -24906, -25034, -25160, -25286,
- -25410, -25534, -25656, -25777, -25897, -26016, -26133, -26250, -26365, -26479, -26592, -26704, -26814, -26924, -27032, -27139,
- -27245, -27350, -27453, -27555, -27656, -27756, -27855, -27952, -28048, -28143, -28237, -28329, -28420, -28510, -28598, -28686,
- -28772, -28857, -28940, -29022, -29103, -29183, -29261, -29338, -29414, -29489, -29562, -29634, -29704, -29773, -29841, -29908,
- -29973, -30037, -30100, -30161, -30221, -30280, -30337, -30393, -30448, -30501, -30553, -30603, -30653, -30700, -30747, -30792,
- -30836, -30878, -30919, -30959, -30997, -31034, -31070, -31104, -31137, -31168, -31198, -31227, -31254, -31280, -31305, -31328,
- -31350, -31370, -31389, -31407, -31423, -31438, -31451, -31463, -31474, -31483, -31491, -31498, -31503, -31506, -31509, -31510,
- -31509, -31507, -31504, -31499, -31493, -31486, -31477, -31467, -31455, -31442, -31428, -31412, -31395, -31376, -31356, -31335,
- -31312, -31288, -31263, -31236, -31208, -31178, -31147, -31115, -31081, -31046, -31009, -30971, -30932, -30892, -30850, -30806,
- -30761, -30715, -30668, -30619, -30569, -30518, -30465, -30411, -30355, -30298, -30240, -30180, -30120, -30057, -29994, -29929,
- -29863, -29795, -29726, -29656, -29585, -29512, -29438, -29363, -29286, -29208, -29129, -29048, -28967, -28883, -28799, -28713,
- -28626, -28538, -28449, -28358, -28266, -28173, -28079, -27983, -27886, -27788, -27688, -27588, -27486, -27383, -27279, -27173,
- -27066, -26959, -26850, -26739, -26628, -26515, -26402, -26287, -26170, -26053, -25935, -25815, -25695, -25573, -25450, -25326,
- -25200, -25074, -24947, -24818, -24689, -24558, -24426, -24293, -24159, -24024, -23888, -23751, -23613, -23473, -23333, -23192,
- -23049, -22906, -22762, -22616, -22470, -22323, -22174, -22025, -21875, -21723, -21571, -21418, -21264, -21109, -20953, -20796,
- -20638, -20479, -20319, -20159, -19997, -19835, -19672, -19508, -19343, -19177, -19010, -18843, -18674, -18503, -18330, -18157,
- -17983, -17808, -17632, -17456, -17279, -17101, -16923, -16744, -16564, -16383, -16202, -16020, -15838, -15655, -15471, -15286,
- -15101, -14916, -14729, -14543, -14355, -14167, -13978, -13789, -13600, -13409, -13218, -13027, -12835, -12643, -12450, -12257,
- -12063, -11868, -11674, -11478, -11282, -11086, -10890, -10693, -10495, -10297, -10099,  -9900,  -9701,  -9502,  -9302,  -9102,
-  -8902,  -8701,  -8500,  -8298,  -8097,  -7895,  -7692,  -7490,  -7287,  -7084,  -6880,  -6676,  -6473,  -6268,  -6064,  -5859,
-  -5655,  -5450,  -5245,  -5039,  -4834,  -4628,  -4422,  -4217,  -4011,  -3804,  -3598,  -3392,  -3185,  -2979,  -2772,  -2566,
-  -2359,  -2152,  -1945,  -1738,  -1532,  -1325,  -1118,   -911,   -704,   -497,   -291,    -84,    122,    328,    535,    741,
-    948,   1154,   1360,   1566,   1772,   1977,   2183,   2389,   2594,   2799,   3004,   3208,   3413,   3617,   3821,   4025,
-   4229,   4432,   4635,   4838,   5041,   5243,   5445,   5647,   5848,   6049,   6250,   6450,   6651,   6850,   7050,   7249,
-   7447,   7645,   7843,   8041,   8238,   8434,   8630,   8826,   9021,   9216,   9411,   9605,   9798,   9991,  10183,  10375,
-  10567,  10757,  10948,  11138,  11327,  11516,  11704,  11891,  12078,  12265,  12450,  12636,  12820,  13004,  13187,  13370,
-  13552,  13733,  13914,  14094,  14274,  14452,  14630,  14808,  14984,  15160,  15335,  15510,  15683,  15856,  16029,  16200,
-  16371,  16541,  16710,  16878,  17045,  17212,  17378,  17543,  17707,  17871,  18034,  18195,  18356,  18516,  18675,  18834,
-  18991,  19148,  19303,  19458,  19612,  19765,  19917,  20068,  20218,  20367,  20516,  20663,  20809,  20955,  21099,  21242,
-  21385,  21526,  21667,  21806,  21945,  22082,  22219,  22354,  22489,  22622,  22754,  22886,  23016,  23145,  23273,  23400,
-  23526,  23651,  23775,  23897,  24019,  24140,  24259,  24377,  24494,  24611,  24725,  24839,  24952,  25064,  25174,  25283,
-  25391,  25498,  25604,  25709,  25812,  25915,  26016,  26116,  26214,  26312,  26408,  26503,  26597,  26690,  26782,  26872,
-  26961,  27049,  27136,  27221,  27306,  27389,  27470,  27551,  27630,  27708,  27785,  27860,  27935,  28008,  28080,  28150,
-  28219,  28287,  28354,  28419,  28483,  28546,  28608,  28668,  28727,  28785,  28841,  28896,  28950,  29003,  29054,  29104,
-  29153,  29200,  29246,  29291,  29334,  29376,  29417,  29457,  29495,  29532,  29567,  29601,  29634,  29666,  29696,  29725,
-  29752,  29779,  29804,  29827,  29850,  29871,  29890,  29908,  29925,  29941,  29955,  29968,  29980,  29990,  29999,  30007,
-  30013,  30018,  30022,  30025,  30026,  30025,  30024,  30021,  30016,  30011,  30004,  29996,  29986,  29975,  29963,  29949,
-  29934,  29918,  29901,  29882,  29862,  29840,  29817,  29793,  29768,  29741,  29713,  29684,  29653,  29621,  29588,  29553,
-  29518,  29480,  29442,  29402,  29361,  29319,  29275,  29231,  29184,  29137,  29088,  29038,  28987,  28935,  28881,  28826,
-  28770,  28712,  28653,  28593,  28532,  28469,  28406,  28341,  28274,  28207,  28138,  28068,  27997,  27925,  27851,  27776,
-  27700,  27623,  27545,  27465,  27384,  27302,  27219,  27135,  27049,  26963,  26875,  26786,  26696,  26604,  26512,  26418,
-  26323,  26228,  26131,  26032,  25933,  25833,  25731,  25629,  25525,  25420,  25314,  25207,  25099,  24990,  24880,  24768,
-  24656,  24543,  24428,  24313,  24196,  24078,  23960,  23840,  23720,  23598,  23475,  23351,  23227,  23101,  22974,  22847,
-  22718,  22589,  22458,  22327,  22194,  22061,  21927,  21791,  21655,  21518,  21380,  21241,  21101,  20961,  20819,  20677,
-  20533,  20389,  20244,  20098,  19952,  19804,  19656,  19506,  19356,  19205,  19054,  18901,  18748,  18594,  18439,  18284,
-  18127,  17970,  17812,  17654,  17495,  17335,  17174,  17012,  16850,  16687,  16524,  16359,  16195,  16029,  15863,  15696,
-  15528,  15360,  15191,  15022,  14852,  14681,  14510,  14338,  14166,  13993,  13819,  13645,  13471,  13296,  13120,  12944,
-  12767,  12590,  12412,  12233,  12055,  11875,  11696,  11516,  11335,  11154,  10972,  10790,  10608,  10425,  10242,  10059,
-   9875,   9690,   9506,   9320,   9135,   8949,   8763,   8577,   8390,   8203,   8015,   7828,   7640,   7451,   7263,   7074,
-   6885,   6696,   6506,   6317,   6127,   5936,   5746,   5555,   5365,   5174,   4983,   4791,   4600,   4408,   4216,   4025,
-   3833,   3641,   3448,   3256,   3064,   2871,   2679,   2486,   2294,   2101,   1908,   1716,   1523,   1330,   1137,    945,
-    752,    559,    367,    174,    -18,   -210,   -402,   -595,   -787,   -979,  -1171,  -1363,  -1555,  -1747,  -1938,  -2130,
-  -2321,  -2512,  -2703,  -2894,  -3084,  -3275,  -3465,  -3655,  -3845,  -4034,  -4223,  -4412,  -4601,  -4790,  -4978,  -5166,
-  -5353,  -5541,  -5728,  -5915,  -6101,  -6287,  -6473,  -6658,  -6843,  -7028,  -7212,  -7396,  -7580,  -7763,  -7946,  -8128,
-  -8310,  -8492,  -8673,  -8854,  -9034,  -9214,  -9393,  -9572,  -9750,  -9928, -10105, -10282, -10458, -10634, -10810, -10984,
- -11159, -11332, -11505, -11678, -11850, -12021, -12192, -12362, -12532, -12701, -12869, -13037, -13204, -13371, -13537, -13702,
- -13867, -14030, -14194, -14356, -14518, -14679, -14840, -14999, -15159, -15317, -15474, -15631, -15787, -15943, -16097, -16251,
- -16404, -16557, -16708, -16859, -17009, -17158, -17306, -17454, -17601, -17747, -17892, -18036, -18179, -18322, -18464, -18604,
- -18744, -18883, -19022, -19159, -19295, -19431, -19565, -19699, -19832, -19964, -20095, -20225, -20354, -20482, -20609, -20735,
- -20861, -20985, -21108, -21231, -21352, -21473, -21592, -21710, -21828, -21944, -22060, -22174, -22288, -22400, -22511, -22622,
- -22731, -22839, -22946, -23053, -23158, -23262, -23365, -23467, -23567, -23667, -23766, -23863, -23960, -24055, -24150, -24243,
- -24335, -24426, -24516, -24605, -24692, -24779, -24864, -24949, -25032, -25114, -25195, -25275, -25353, -25431, -25507, -25582,
- -25656, -25729, -25801, -25871, -25941, -26009, -26076, -26142, -26206, -26270, -26332, -26393, -26453, -26512, -26569, -26626,
- -26681, -26735, -26788, -26839, -26890, -26939, -26987, -27033, -27079, -27123, -27166, -27208, -27249, -27288, -27326, -27363,
- -27399, -27434, -27467, -27499, -27530, -27560, -27588, -27615, -27641, -27666, -27689, -27712, -27733, -27752, -27771, -27788,
- -27804, -27819, -27833, -27845, -27856, -27866, -27875, -27882, -27889, -27893, -27897, -27900, -27901, -27901, -27900, -27897,
- -27894, -27889, -27883, -27875, -27867, -27857, -27846, -27833, -27820, -27805, -27789, -27772, -27753, -27734, -27713, -27691,
- -27667, -27643, -27617, -27590, -27562, -27533, -27502, -27470, -27437, -27403, -27368, -27331, -27293, -27254, -27214, -27173,
- -27130, -27086, -27041, -26995, -26948, -26899, -26850, -26799, -26747, -26694, -26639, -26584, -26527, -26469, -26410, -26350,
- -26289, -26227, -26163, -26098, -26033, -25966, -25898, -25828, -25758, -25687, -25614, -25540, -25466, -25390, -25313, -25235,
- -25156, -25075, -24994, -24912, -24828, -24744, -24658, -24571, -24484, -24395, -24305, -24214, -24122, -24029, -23935, -23840,
- -23744, -23647, -23549, -23450, -23350, -23249, -23146, -23043, -22939, -22834, -22728, -22621, -22513, -22404, -22294, -22184,
- -22072, -21959, -21845, -21731, -21615, -21499, -21382, -21263, -21144, -21024, -20903, -20781, -20659, -20535, -20411, -20285,
- -20159, -20032, -19904, -19775, -19646, -19516, -19384, -19252, -19120, -18986, -18852, -18716, -18580, -18444, -18306, -18168,
- -18029, -17889, -17748, -17607, -17465, -17322, -17179, -17035, -16890, -16744, -16598, -16451, -16303, -16155, -16006, -15856,
- -15706, -15555, -15403, -15251, -15098, -14945, -14791, -14636, -14481, -14325, -14169, -14012, -13854, -13696, -13537, -13378,
- -13218, -13058, -12897, -12736, -12574, -12411, -12249, -12085, -11921, -11757, -11592, -11427, -11261, -11095, -10929, -10762,
- -10594, -10426, -10258, -10090,  -9921,  -9751,  -9581,  -9411,  -9241,  -9070,  -8899,  -8727,  -8555,  -8383,  -8211,  -8038,
-  -7865,  -7691,  -7518,  -7344,  -7169,  -6995,  -6820,  -6645,  -6470,  -6295,  -6119,  -5943,  -5767,  -5591,  -5414,  -5238,
-  -5061,  -4884,  -4707,  -4529,  -4352,  -4174,  -3997,  -3819,  -3641,  -3463,  -3285,  -3107,  -2928,  -2750,  -2572,  -2393,
-  -2215,  -2036,  -1857,  -1679,  -1500,  -1322,  -1143,   -964,   -786,   -607,   -429,   -250,    -72,    106,    284,    462,
-    640,    819,    997,   1174,   1352,   1530,   1707,   1885,   2062,   2239,   2416,   2593,   2769,   2946,   3122,   3298,
-   3474,   3650,   3825,   4000,   4175,   4350,   4524,   4698,   4872,   5046,   5219,   5392,   5565,   5737,   5910,   6081,
-   6253,   6424,   6595,   6765,   6936,   7105,   7275,   7444,   7612,   7780,   7948,   8116,   8283,   8449,   8615,   8781,
-   8946,   9111,   9276,   9439,   9603,   9766,   9928,  10090,  10252,  10413,  10573,  10733,  10892,  11051,  11209,  11367,
-  11524,  11681,  11837,  11992,  12147,  12302,  12455,  12608,  12761,  12913,  13064,  13215,  13365,  13514,  13663,  13811,
-  13958,  14105,  14251,  14396,  14541,  14685,  14828,  14971,  15113,  15254,  15394,  15534,  15673,  15811,  15948,  16085,
-  16221,  16356,  16491,  16624,  16757,  16889,  17021,  17151,  17281,  17410,  17538,  17665,  17791,  17917,  18042,  18166,
-  18289,  18411,  18532,  18653,  18772,  18891,  19009,  19126,  19242,  19357,  19472,  19585,  19698,  19809,  19920,  20030,
-  20138,  20246,  20353,  20459,  20565,  20669,  20772,  20874,  20975,  21076,  21175,  21273,  21371,  21467,  21563,  21657,
-  21751,  21843,  21935,  22025,  22115,  22203,  22291,  22377,  22462,  22547,  22630,  22713,  22794,  22874,  22953,  23031,
-  23109,  23185,  23260,  23334,  23407,  23478,  23549,  23619,  23688,  23755,  23822,  23887,  23952,  24015,  24077,  24138,
-  24198,  24257,  24315,  24372,  24427,  24482,  24535,  24587,  24639,  24689,  24738,  24786,  24832,  24878,  24923,  24966,
-  25008,  25050,  25090,  25128,  25166,  25203,  25239,  25273,  25306,  25338,  25369,  25399,  25428,  25456,  25482,  25508,
-  25532,  25555,  25577,  25598,  25617,  25636,  25653,  25669,  25684,  25698,  25711,  25723,  25733,  25743,  25751,  25758,
-  25764,  25769,  25772,  25775,  25776,  25777,  25776,  25774,  25770,  25766,  25761,  25754,  25746,  25737,  25727,  25716,
-  25704,  25691,  25676,  25660,  25644,  25626,  25607,  25586,  25565,  25543,  25519,  25494,  25469,  25442,  25414,  25384,
-  25354,  25323,  25290,  25257,  25222,  25186,  25149,  25111,  25072,  25032,  24991,  24948,  24905,  24860,  24815,  24768,
-  24720,  24671,  24621,  24570,  24518,  24465,  24411,  24355,  24299,  24242,  24183,  24124,  24063,  24001,  23939,  23875,
-  23810,  23745,  23678,  23610,  23541,  23471,  23400,  23329,  23256,  23182,  23107,  23031,  22954,  22876,  22798,  22718,
-  22637,  22555,  22472,  22389,  22304,  22218,  22132,  22044,  21956,  21866,  21776,  21685,  21593,  21499,  21405,  21310,
-  21215,  21118,  21020,  20921,  20822,  20722,  20620,  20518,  20415,  20311,  20207,  20101,  19995,  19887,  19779,  19670,
-  19561,  19450,  19339,  19226,  19113,  18999,  18885,  18769,  18653,  18536,  18418,  18300,  18180,  18060,  17939,  17818,
-  17695,  17572,  17448,  17324,  17198,  17072,  16946,  16818,  16690,  16561,  16432,  16302,  16171,  16039,  15907,  15774,
-  15641,  15507,  15372,  15236,  15100,  14964,  14826,  14689,  14550,  14411,  14271,  14131,  13990,  13849,  13707,  13564,
-  13421,  13278,  13134,  12989,  12844,  12698,  12552,  12405,  12258,  12110,  11962,  11813,  11664,  11515,  11365,  11214,
-  11063,  10912,  10760,  10608,  10455,  10302,  10149,   9995,   9840,   9686,   9531,   9375,   9220,   9064,   8907,   8751,
-   8593,   8436,   8278,   8120,   7962,   7803,   7644,   7485,   7326,   7166,   7006,   6846,   6685,   6525,   6364,   6202,
-   6041,   5879,   5718,   5556,   5393,   5231,   5068,   4906,   4743,   4580,   4417,   4253,   4090,   3926,   3763,   3599,
-   3435,   3271,   3107,   2943,   2779,   2614,   2450,   2286,   2121,   1957,   1792,   1628,   1463,   1299,   1134,    970,
-    805,    641,    476,    312,    148,    -16,   -180,   -344,   -508,   -672,   -836,  -1000,  -1164,  -1327,  -1491,  -1654,
-  -1817,  -1980,  -2143,  -2306,  -2469,  -2631,  -2793,  -2955,  -3117,  -3279,  -3441,  -3602,  -3763,  -3924,  -4084,  -4245,
-  -4405,  -4565,  -4724,  -4884,  -5043,  -5202,  -5360,  -5518,  -5676,  -5834,  -5991,  -6148,  -6305,  -6461,  -6617,  -6773,
-  -6928,  -7083,  -7237,  -7391,  -7545,  -7698,  -7851,  -8004,  -8156,  -8308,  -8459,  -8610,  -8760,  -8910,  -9060,  -9209,
-  -9358,  -9506,  -9653,  -9801,  -9947, -10094, -10239, -10385, -10529, -10673, -10817, -10960, -11103, -11245, -11386, -11527,
- -11668, -11807, -11947, -12085, -12223, -12361, -12498, -12634, -12770, -12905, -13039, -13173, -13306, -13438, -13570, -13702,
- -13832, -13962, -14091, -14220, -14348, -14475, -14602, -14727, -14852, -14977, -15101, -15224, -15346, -15468, -15588, -15708,
- -15828, -15946, -16064, -16181, -16298, -16413, -16528, -16642, -16755, -16868, -16980, -17090, -17201, -17310, -17418, -17526,
- -17633, -17739, -17844, -17949, -18052, -18155, -18257, -18358, -18458, -18557, -18656, -18753, -18850, -18946, -19041, -19135,
- -19228, -19321, -19412, -19503, -19592, -19681, -19769, -19856, -19942, -20027, -20111, -20194, -20277, -20358, -20439, -20518,
- -20597, -20675, -20751, -20827, -20902, -20976, -21049, -21121, -21192, -21262, -21331, -21399, -21466, -21532, -21597, -21662,
- -21725, -21787, -21848, -21909, -21968, -22026, -22083, -22140, -22195, -22249, -22302, -22355, -22406, -22456, -22505, -22554,
- -22601, -22647, -22692, -22736, -22779, -22821, -22862, -22902, -22941, -22979, -23016, -23052, -23087, -23121, -23154, -23185,
- -23216, -23246, -23274, -23302, -23329, -23354, -23379, -23402, -23424, -23446, -23466, -23485, -23503, -23521, -23537, -23552,
- -23566, -23579, -23591, -23601, -23611, -23620, -23628, -23634, -23640, -23645, -23648, -23651, -23652, -23652, -23652, -23650,
- -23647, -23643, -23639, -23633, -23626, -23618, -23609, -23599, -23587, -23575, -23562, -23548, -23533, -23516, -23499, -23481,
- -23461, -23441, -23419, -23397, -23373, -23349, -23323, -23296, -23269, -23240, -23211, -23180, -23148, -23115, -23082, -23047,
- -23011, -22975, -22937, -22898, -22858, -22818, -22776, -22733, -22689, -22645, -22599, -22552, -22505, -22456, -22406, -22356,
- -22304, -22252, -22198, -22144, -22089, -22032, -21975, -21917, -21857, -21797, -21736, -21674, -21611, -21547, -21482, -21417,
- -21350, -21282, -21214, -21144, -21074, -21003, -20931, -20858, -20784, -20709, -20633, -20557, -20479, -20401, -20321, -20241,
- -20160, -20079, -19996, -19912, -19828, -19743, -19657, -19570, -19482, -19393, -19304, -19214, -19123, -19031, -18938, -18845,
- -18750, -18655, -18560, -18463, -18366, -18267, -18168, -18069, -17968, -17867, -17765, -17662, -17559, -17455, -17350, -17244,
- -17138, -17030, -16923, -16814, -16705, -16595, -16484, -16373, -16261, -16148, -16035, -15921, -15806, -15691, -15575, -15458,
- -15341, -15223, -15105, -14986, -14866, -14745, -14624, -14503, -14381, -14258, -14135, -14011, -13886, -13761, -13636, -13509,
- -13383, -13255, -13128, -12999, -12870, -12741, -12611, -12481, -12350, -12218, -12087, -11954, -11821, -11688, -11554, -11420,
- -11285, -11150, -11015, -10879, -10742, -10605, -10468, -10330, -10192, -10054,  -9915,  -9776,  -9636,  -9496,  -9355,  -9215,
-  -9074,  -8932,  -8790,  -8648,  -8506,  -8363,  -8220,  -8077,  -7933,  -7789,  -7645,  -7500,  -7355,  -7210,  -7065,  -6919,
-  -6773,  -6627,  -6481,  -6334,  -6188,  -6041,  -5893,  -5746,  -5598,  -5451,  -5303,  -5154,  -5006,  -4858,  -4709,  -4560,
-  -4411,  -4262,  -4113,  -3964,  -3814,  -3665,  -3515,  -3365,  -3215,  -3065,  -2915,  -2765,  -2615,  -2465,  -2315,  -2164,
-  -2014,  -1864,  -1713,  -1563,  -1413,  -1262,  -1112,   -961,   -811,   -661,   -510,   -360,   -210,    -60,     90,    240,
-    390,    540,    689,    839,    989,   1138,   1288,   1437,   1586,   1735,   1884,   2033,   2182,   2330,   2478,   2627,
-   2775,   2922,   3070,   3217,   3365,   3512,   3658,   3805,   3951,   4097,   4243,   4389,   4534,   4679,   4824,   4969,
-   5113,   5257,   5401,   5544,   5687,   5830,   5973,   6115,   6257,   6398,   6539,   6680,   6820,   6961,   7100,   7240,
-   7379,   7517,   7656,   7793,   7931,   8068,   8204,   8341,   8476,   8612,   8747,   8881,   9015,   9149,   9282,   9414,
-   9547,   9678,   9809,   9940,  10070,  10200,  10329,  10458,  10586,  10714,  10841,  10968,  11094,  11219,  11344,  11469,
-  11593,  11716,  11839,  11961,  12083,  12204,  12324,  12444,  12563,  12682,  12800,  12917,  13034,  13150,  13266,  13380,
-  13495,  13608,  13721,  13834,  13945,  14056,  14167,  14276,  14385,  14493,  14601,  14708,  14814,  14920,  15025,  15129,
-  15232,  15335,  15437,  15538,  15638,  15738,  15837,  15935,  16033,  16130,  16226,  16321,  16416,  16509,  16602,  16695,
-  16786,  16877,  16967,  17056,  17144,  17231,  17318,  17404,  17489,  17573,  17657,  17740,  17821,  17902,  17983,  18062,
-  18140,  18218,  18295,  18371,  18446,  18520,  18594,  18666,  18738,  18809,  18879,  18948,  19017,  19084,  19151,  19216,
-  19281,  19345,  19408,  19470,  19531,  19592,  19651,  19710,  19768,  19824,  19880,  19935,  19989,  20042,  20095,  20146,
-  20197,  20246,  20295,  20342,  20389,  20435,  20480,  20524,  20567,  20609,  20650,  20691,  20730,  20768,  20806,  20842,
-  20878,  20913,  20946,  20979,  21011,  21042,  21072,  21101,  21129,  21156,  21182,  21207,  21232,  21255,  21277,  21299,
-  21319,  21339,  21357,  21375,  21391,  21407,  21422,  21436,  21448,  21460,  21471,  21481,  21490,  21498,  21505,  21511,
-  21517,  21521,  21524,  21526,  21528,  21528,  21528,  21526,  21524,  21520,  21516,  21511,  21504,  21497,  21489,  21480,
-  21470,  21459,  21447,  21434,  21420,  21405,  21390,  21373,  21355,  21337,  21317,  21297,  21276,  21253,  21230,  21206,
-  21181,  21155,  21128,  21100,  21071,  21042,  21011,  20980,  20947,  20914,  20880,  20844,  20808,  20771,  20733,  20695,
-  20655,  20614,  20573,  20530,  20487,  20443,  20398,  20352,  20305,  20257,  20209,  20159,  20109,  20058,  20006,  19953,
-  19899,  19844,  19789,  19733,  19675,  19617,  19558,  19499,  19438,  19377,  19314,  19251,  19188,  19123,  19057,  18991,
-  18924,  18856,  18787,  18717,  18647,  18576,  18504,  18431,  18357,  18283,  18208,  18132,  18056,  17978,  17900,  17821,
-  17741,  17661,  17580,  17498,  17415,  17332,  17247,  17163,  17077,  16991,  16904,  16816,  16727,  16638,  16548,  16458,
-  16367,  16275,  16182,  16089,  15995,  15900,  15805,  15709,  15612,  15515,  15417,  15319,  15219,  15120,  15019,  14918,
-  14816,  14714,  14611,  14508,  14404,  14299,  14194,  14088,  13981,  13874,  13767,  13658,  13550,  13440,  13331,  13220,
-  13109,  12998,  12886,  12774,  12661,  12547,  12433,  12319,  12204,  12088,  11972,  11856,  11739,  11621,  11503,  11385,
-  11266,  11147,  11027,  10907,  10787,  10666,  10544,  10422,  10300,  10178,  10055,   9931,   9807,   9683,   9559,   9434,
-   9308,   9183,   9057,   8930,   8804,   8677,   8549,   8422,   8294,   8165,   8037,   7908,   7779,   7649,   7520,   7389,
-   7259,   7129,   6998,   6867,   6735,   6604,   6472,   6340,   6208,   6075,   5942,   5809,   5676,   5543,   5410,   5276,
-   5142,   5008,   4874,   4739,   4605,   4470,   4336,   4201,   4066,   3931,   3795,   3660,   3524,   3389,   3253,   3117,
-   2982,   2846,   2710,   2574,   2438,   2301,   2165,   2029,   1893,   1757,   1620,   1484,   1348,   1211,   1075,    939,
-    803,    666,    530,    394,    258,    122,    -13,   -149,   -285,   -421,   -557,   -693,   -828,   -964,  -1099,  -1234,
-  -1369,  -1504,  -1639,  -1774,  -1909,  -2043,  -2178,  -2312,  -2446,  -2580,  -2713,  -2847,  -2980,  -3113,  -3246,  -3379,
-  -3512,  -3644,  -3776,  -3908,  -4039,  -4171,  -4302,  -4433,  -4564,  -4694,  -4824,  -4954,  -5083,  -5213,  -5342,  -5470,
-  -5599,  -5727,  -5855,  -5982,  -6109,  -6236,  -6363,  -6489,  -6615,  -6740,  -6865,  -6990,  -7114,  -7238,  -7362,  -7485,
-  -7608,  -7731,  -7853,  -7974,  -8096,  -8217,  -8337,  -8457,  -8577,  -8696,  -8815,  -8933,  -9051,  -9168,  -9285,  -9401,
-  -9517,  -9633,  -9748,  -9863,  -9977, -10090, -10203, -10316, -10428, -10539, -10650, -10761, -10871, -10980, -11089, -11198,
- -11306, -11413, -11520, -11626, -11731, -11836, -11941, -12045, -12148, -12251, -12353, -12454, -12555, -12656, -12756, -12855,
- -12953, -13051, -13148, -13245, -13341, -13436, -13531, -13625, -13719, -13812, -13904, -13995, -14086, -14176, -14266, -14355,
- -14443, -14530, -14617, -14703, -14789, -14873, -14957, -15041, -15123, -15205, -15286, -15367, -15447, -15526, -15604, -15682,
- -15758, -15835, -15910, -15985, -16059, -16132, -16204, -16276, -16347, -16417, -16486, -16555, -16623, -16690, -16756, -16822,
- -16887, -16951, -17014, -17076, -17138, -17199, -17259, -17318, -17377, -17435, -17492, -17548, -17603, -17657, -17711, -17764,
- -17816, -17867, -17918, -17967, -18016, -18064, -18111, -18158, -18203, -18248, -18292, -18335, -18377, -18419, -18459, -18499,
- -18538, -18576, -18613, -18649, -18685, -18719, -18753, -18786, -18818, -18849, -18880, -18909, -18938, -18966, -18993, -19019,
- -19044, -19069, -19092, -19115, -19137, -19158, -19178, -19198, -19216, -19234, -19250, -19266, -19281, -19295, -19309, -19321,
- -19333, -19343, -19353, -19362, -19370, -19377, -19384, -19389, -19394, -19398, -19401, -19403, -19404, -19404, -19404, -19402,
- -19400, -19397, -19393, -19388, -19383, -19376, -19369, -19361, -19352, -19342, -19331, -19319, -19307, -19293, -19279, -19264,
- -19248, -19232, -19214, -19196, -19176, -19156, -19135, -19114, -19091, -19067, -19043, -19018, -18992, -18965, -18938, -18909,
- -18880, -18850, -18819, -18787, -18755, -18722, -18687, -18652, -18617, -18580, -18543, -18504, -18465, -18426, -18385, -18344,
- -18301, -18259, -18215, -18170, -18125, -18079, -18032, -17984, -17936, -17886, -17836, -17786, -17734, -17682, -17629, -17575,
- -17521, -17465, -17409, -17352, -17295, -17237, -17178, -17118, -17057, -16996, -16934, -16872, -16808, -16744, -16679, -16614,
- -16548, -16481, -16413, -16345, -16276, -16206, -16136, -16065, -15993, -15921, -15847, -15774, -15699, -15624, -15548, -15472,
- -15395, -15317, -15239, -15160, -15081, -15000, -14919, -14838, -14756, -14673, -14590, -14506, -14421, -14336, -14251, -14164,
- -14077, -13990, -13902, -13813, -13724, -13634, -13544, -13453, -13362, -13270, -13177, -13084, -12991, -12896, -12802, -12707,
- -12611, -12515, -12418, -12321, -12223, -12125, -12026, -11927, -11827, -11727, -11626, -11525, -11424, -11322, -11219, -11116,
- -11013, -10909, -10805, -10700, -10595, -10490, -10384, -10278, -10171, -10064,  -9956,  -9848,  -9740,  -9631,  -9522,  -9413,
-  -9303,  -9193,  -9082,  -8971,  -8860,  -8749,  -8637,  -8525,  -8412,  -8299,  -8186,  -8073,  -7959,  -7845,  -7731,  -7616,
-  -7501,  -7386,  -7270,  -7155,  -7039,  -6922,  -6806,  -6689,  -6572,  -6455,  -6337,  -6220,  -6102,  -5984,  -5866,  -5747,
-  -5628,  -5509,  -5390,  -5271,  -5152,  -5032,  -4912,  -4792,  -4672,  -4552,  -4431,  -4311,  -4190,  -4069,  -3949,  -3828,
-  -3706,  -3585,  -3464,  -3342,  -3221,  -3099,  -2978,  -2856,  -2734,  -2612,  -2490,  -2368,  -2246,  -2124,  -2002,  -1880,
-  -1758,  -1635,  -1513,  -1391,  -1269,  -1147,  -1024,   -902,   -780,   -658,   -536,   -414,   -292,   -170,    -48,     73,
-    195,    317,    438,    560,    681,    803,    924,   1045,   1166,   1287,   1408,   1529,   1650,   1770,   1891,   2011,
-   2131,   2251,   2371,   2490,   2610,   2729,   2848,   2967,   3085,   3204,   3322,   3440,   3558,   3676,   3793,   3911,
-   4028,   4144,   4261,   4377,   4493,   4609,   4724,   4840,   4955,   5069,   5184,   5298,   5412,   5525,   5638,   5751,
-   5864,   5976,   6088,   6200,   6311,   6422,   6533,   6643,   6753,   6862,   6972,   7081,   7189,   7297,   7405,   7512,
-   7619,   7726,   7832,   7938,   8043,   8148,   8253,   8357,   8461,   8564,   8667,   8769,   8871,   8973,   9074,   9175,
-   9275,   9375,   9474,   9573,   9671,   9769,   9866,   9963,  10059,  10155,  10251,  10346,  10440,  10534,  10627,  10720,
-  10812,  10904,  10995,  11086,  11176,  11266,  11355,  11444,  11532,  11619,  11706,  11792,  11878,  11963,  12048,  12132,
-  12215,  12298,  12381,  12462,  12543,  12624,  12704,  12783,  12862,  12940,  13017,  13094,  13171,  13246,  13321,  13396,
-  13469,  13542,  13615,  13687,  13758,  13828,  13898,  13967,  14036,  14104,  14171,  14238,  14304,  14369,  14434,  14498,
-  14561,  14623,  14685,  14747,  14807,  14867,  14926,  14985,  15042,  15099,  15156,  15211,  15266,  15321,  15374,  15427,
-  15479,  15531,  15581,  15631,  15681,  15729,  15777,  15824,  15870,  15916,  15961,  16005,  16049,  16091,  16133,  16175,
-  16215,  16255,  16294,  16332,  16370,  16407,  16443,  16478,  16513,  16546,  16579,  16612,  16643,  16674,  16704,  16733,
-  16762,  16790,  16817,  16843,  16869,  16893,  16917,  16940,  16963,  16985,  17006,  17026,  17045,  17064,  17082,  17099,
-  17115,  17131,  17145,  17159,  17173,  17185,  17197,  17208,  17218,  17227,  17236,  17244,  17251,  17257,  17263,  17268,
-  17272,  17275,  17278,  17279,  17280,  17281,  17280,  17279,  17277,  17274,  17270,  17266,  17261,  17255,  17248,  17241,
-  17232,  17223,  17214,  17203,  17192,  17180,  17167,  17154,  17139,  17124,  17109,  17092,  17075,  17057,  17038,  17019,
-  16998,  16978,  16956,  16933,  16910,  16886,  16862,  16836,  16810,  16783,  16755,  16727,  16698,  16668,  16638,  16607,
-  16575,  16542,  16509,  16474,  16440,  16404,  16368,  16331,  16293,  16255,  16216,  16176,  16136,  16095,  16053,  16010,
-  15967,  15923,  15879,  15833,  15787,  15741,  15694,  15646,  15597,  15548,  15498,  15447,  15396,  15344,  15291,  15238,
-  15184,  15130,  15075,  15019,  14962,  14905,  14848,  14789,  14730,  14671,  14611,  14550,  14488,  14426,  14364,  14301,
-  14237,  14172,  14107,  14042,  13975,  13909,  13841,  13773,  13705,  13636,  13566,  13496,  13425,  13354,  13282,  13209,
-  13136,  13063,  12989,  12914,  12839,  12763,  12687,  12610,  12533,  12455,  12377,  12298,  12219,  12139,  12059,  11978,
-  11897,  11815,  11733,  11650,  11567,  11483,  11399,  11315,  11230,  11144,  11058,  10972,  10885,  10798,  10710,  10622,
-  10534,  10445,  10355,  10266,  10176,  10085,   9994,   9903,   9811,   9719,   9626,   9533,   9440,   9346,   9252,   9158,
-   9063,   8968,   8873,   8777,   8681,   8585,   8488,   8391,   8293,   8196,   8098,   7999,   7901,   7802,   7702,   7603,
-   7503,   7403,   7303,   7202,   7101,   7000,   6899,   6797,   6695,   6593,   6491,   6388,   6285,   6182,   6079,   5976,
-   5872,   5768,   5664,   5560,   5455,   5350,   5246,   5141,   5035,   4930,   4825,   4719,   4613,   4507,   4401,   4295,
-   4188,   4082,   3975,   3869,   3762,   3655,   3548,   3440,   3333,   3226,   3118,   3011,   2903,   2796,   2688,   2580,
-   2472,   2364,   2257,   2149,   2041,   1933,   1824,   1716,   1608,   1500,   1392,   1284,   1176,   1068,    960,    852,
-    743,    635,    527,    419,    312,    204,     96,    -11,   -119,   -226,   -334,   -441,   -549,   -656,   -763,   -871,
-   -978,  -1085,  -1191,  -1298,  -1405,  -1511,  -1618,  -1724,  -1830,  -1936,  -2042,  -2147,  -2253,  -2358,  -2463,  -2569,
-  -2673,  -2778,  -2883,  -2987,  -3091,  -3195,  -3299,  -3402,  -3505,  -3608,  -3711,  -3814,  -3916,  -4019,  -4121,  -4222,
-  -4324,  -4425,  -4526,  -4627,  -4727,  -4827,  -4927,  -5027,  -5126,  -5225,  -5324,  -5423,  -5521,  -5619,  -5716,  -5814,
-  -5911,  -6007,  -6104,  -6200,  -6295,  -6391,  -6486,  -6580,  -6675,  -6769,  -6862,  -6956,  -7048,  -7141,  -7233,  -7325,
-  -7416,  -7507,  -7598,  -7688,  -7778,  -7868,  -7957,  -8045,  -8134,  -8222,  -8309,  -8396,  -8483,  -8569,  -8655,  -8740,
-  -8825,  -8909,  -8993,  -9077,  -9160,  -9243,  -9325,  -9406,  -9488,  -9569,  -9649,  -9729,  -9808,  -9887,  -9965, -10043,
- -10121, -10198, -10274, -10350, -10426, -10501, -10575, -10649, -10722, -10795, -10868, -10939, -11011, -11081, -11152, -11221,
- -11291, -11359, -11427, -11495, -11562, -11628, -11694, -11760, -11824, -11889, -11952, -12015, -12078, -12140, -12201, -12262,
- -12322, -12382, -12441, -12499, -12557, -12615, -12671, -12727, -12783, -12838, -12892, -12946, -12999, -13051, -13103, -13154,
- -13205, -13255, -13305, -13353, -13402, -13449, -13496, -13542, -13588, -13633, -13677, -13721, -13764, -13807, -13849, -13890,
- -13931, -13971, -14010, -14049, -14087, -14124, -14161, -14197, -14232, -14267, -14301, -14335, -14367, -14400, -14431, -14462,
- -14492, -14522, -14550, -14579, -14606, -14633, -14659, -14685, -14710, -14734, -14757, -14780, -14802, -14824, -14845, -14865,
- -14885, -14903, -14922, -14939, -14956, -14972, -14988, -15002, -15016, -15030, -15043, -15055, -15066, -15077, -15087, -15096,
- -15105, -15113, -15121, -15127, -15133, -15139, -15143, -15147, -15151, -15153, -15155, -15157, -15157, -15157, -15157, -15155,
- -15153, -15150, -15147, -15143, -15138, -15133, -15127, -15120, -15113, -15104, -15096, -15086, -15076, -15066, -15054, -15042,
- -15029, -15016, -15002, -14987, -14972, -14956, -14939, -14922, -14904, -14885, -14866, -14846, -14826, -14804, -14783, -14760,
- -14737, -14713, -14689, -14664, -14638, -14612, -14585, -14557, -14529, -14500, -14471, -14441, -14410, -14379, -14347, -14314,
- -14281, -14247, -14213, -14178, -14142, -14106, -14069, -14032, -13994, -13955, -13916, -13876, -13835, -13794, -13753, -13711,
- -13668, -13625, -13581, -13536, -13491, -13445, -13399, -13352, -13305, -13257, -13209, -13160, -13110, -13060, -13009, -12958,
- -12906, -12854, -12801, -12748, -12694, -12639, -12584, -12529, -12473, -12416, -12359, -12302, -12244, -12185, -12126, -12066,
- -12006, -11946, -11885, -11823, -11761, -11698, -11635, -11572, -11508, -11443, -11378, -11313, -11247, -11181, -11114, -11047,
- -10979, -10911, -10843, -10774, -10704, -10634, -10564, -10493, -10422, -10351, -10279, -10206, -10133, -10060,  -9987,  -9913,
-  -9838,  -9764,  -9688,  -9613,  -9537,  -9461,  -9384,  -9307,  -9229,  -9152,  -9073,  -8995,  -8916,  -8837,  -8757,  -8678,
-  -8597,  -8517,  -8436,  -8355,  -8273,  -8191,  -8109,  -8027,  -7944,  -7861,  -7778,  -7694,  -7610,  -7526,  -7441,  -7357,
-  -7272,  -7186,  -7101,  -7015,  -6929,  -6842,  -6756,  -6669,  -6582,  -6494,  -6407,  -6319,  -6231,  -6143,  -6054,  -5966,
-  -5877,  -5788,  -5698,  -5609,  -5519,  -5429,  -5339,  -5249,  -5158,  -5068,  -4977,  -4886,  -4795,  -4704,  -4613,  -4521,
-  -4429,  -4337,  -4246,  -4153,  -4061,  -3969,  -3876,  -3784,  -3691,  -3598,  -3506,  -3413,  -3319,  -3226,  -3133,  -3040,
-  -2946,  -2853,  -2759,  -2666,  -2572,  -2478,  -2385,  -2291,  -2197,  -2103,  -2009,  -1915,  -1821,  -1727,  -1633,  -1539,
-  -1445,  -1351,  -1257,  -1163,  -1069,   -975,   -881,   -787,   -693,   -599,   -505,   -411,   -317,   -224,   -130,    -36,
-     56,    150,    243,    337,    430,    523,    617,    710,    803,    896,    988,   1081,   1174,   1266,   1359,   1451,
-   1543,   1635,   1727,   1819,   1910,   2002,   2093,   2184,   2275,   2366,   2456,   2547,   2637,   2727,   2817,   2907,
-   2997,   3086,   3175,   3264,   3353,   3442,   3530,   3618,   3706,   3794,   3882,   3969,   4056,   4143,   4229,   4316,
-   4402,   4488,   4573,   4659,   4744,   4828,   4913,   4997,   5081,   5165,   5248,   5331,   5414,   5497,   5579,   5661,
-   5743,   5824,   5905,   5986,   6066,   6146,   6226,   6305,   6384,   6463,   6541,   6620,   6697,   6775,   6852,   6928,
-   7005,   7081,   7156,   7231,   7306,   7381,   7455,   7528,   7602,   7675,   7747,   7819,   7891,   7963,   8033,   8104,
-   8174,   8244,   8313,   8382,   8451,   8519,   8586,   8654,   8720,   8787,   8853,   8918,   8983,   9048,   9112,   9176,
-   9239,   9302,   9364,   9426,   9488,   9549,   9609,   9669,   9729,   9788,   9847,   9905,   9963,  10020,  10076,  10133,
-  10188,  10244,  10298,  10353,  10407,  10460,  10513,  10565,  10617,  10668,  10719,  10769,  10819,  10868,  10917,  10965,
-  11013,  11060,  11106,  11152,  11198,  11243,  11288,  11332,  11375,  11418,  11460,  11502,  11543,  11584,  11624,  11664,
-  11703,  11742,  11780,  11817,  11854,  11891,  11927,  11962,  11997,  12031,  12064,  12098,  12130,  12162,  12193,  12224,
-  12254,  12284,  12313,  12342,  12370,  12397,  12424,  12450,  12476,  12501,  12526,  12550,  12573,  12596,  12618,  12640,
-  12661,  12682,  12702,  12721,  12740,  12758,  12776,  12793,  12809,  12825,  12840,  12855,  12869,  12883,  12896,  12908,
-  12920,  12931,  12942,  12952,  12962,  12971,  12979,  12987,  12994,  13000,  13006,  13012,  13017,  13021,  13025,  13028,
-  13030,  13032,  13034,  13034,  13035,  13034,  13033,  13032,  13030,  13027,  13024,  13020,  13015,  13010,  13005,  12999,
-  12992,  12985,  12977,  12968,  12960,  12950,  12940,  12929,  12918,  12906,  12894,  12881,  12867,  12853,  12838,  12823,
-  12807,  12791,  12774,  12757,  12739,  12720,  12701,  12681,  12661,  12640,  12619,  12597,  12575,  12552,  12528,  12504,
-  12480,  12455,  12429,  12403,  12376,  12349,  12321,  12293,  12264,  12235,  12205,  12175,  12144,  12112,  12080,  12048,
-  12015,  11981,  11947,  11913,  11878,  11842,  11806,  11770,  11733,  11695,  11657,  11619,  11580,  11541,  11501,  11460,
-  11419,  11378,  11336,  11294,  11251,  11208,  11164,  11120,  11075,  11030,  10984,  10938,  10892,  10845,  10797,  10750,
-  10701,  10653,  10603,  10554,  10504,  10453,  10402,  10351,  10299,  10247,  10195,  10142,  10088,  10034,   9980,   9925,
-   9870,   9815,   9759,   9703,   9646,   9589,   9532,   9474,   9416,   9357,   9299,   9239,   9180,   9120,   9059,   8998,
-   8937,   8876,   8814,   8752,   8690,   8627,   8564,   8500,   8436,   8372,   8308,   8243,   8178,   8112,   8046,   7980,
-   7914,   7847,   7780,   7713,   7645,   7578,   7509,   7441,   7372,   7303,   7234,   7165,   7095,   7025,   6954,   6884,
-   6813,   6742,   6670,   6599,   6527,   6455,   6383,   6310,   6237,   6164,   6091,   6018,   5944,   5870,   5796,   5722,
-   5647,   5573,   5498,   5423,   5348,   5272,   5197,   5121,   5045,   4969,   4893,   4816,   4740,   4663,   4586,   4509,
-   4432,   4354,   4277,   4199,   4122,   4044,   3966,   3888,   3810,   3731,   3653,   3574,   3496,   3417,   3338,   3259,
-   3180,   3101,   3022,   2943,   2863,   2784,   2705,   2625,   2546,   2466,   2386,   2307,   2227,   2147,   2067,   1987,
-   1907,   1828,   1748,   1668,   1588,   1508,   1428,   1348,   1268,   1188,   1108,   1028,    948,    868,    788,    708,
-    628,    548,    469,    389,    309,    229,    150,     70,     -8,    -88,   -167,   -246,   -326,   -405,   -484,   -563,
-   -642,   -721,   -800,   -878,   -957,  -1035,  -1114,  -1192,  -1270,  -1348,  -1426,  -1504,  -1581,  -1659,  -1736,  -1813,
-  -1891,  -1967,  -2044,  -2121,  -2198,  -2274,  -2350,  -2426,  -2502,  -2578,  -2653,  -2729,  -2804,  -2879,  -2954,  -3028,
-  -3103,  -3177,  -3251,  -3325,  -3398,  -3472,  -3545,  -3618,  -3691,  -3763,  -3836,  -3908,  -3980,  -4051,  -4123,  -4194,
-  -4265,  -4336,  -4406,  -4476,  -4546,  -4616,  -4685,  -4755,  -4823,  -4892,  -4960,  -5029,  -5096,  -5164,  -5231,  -5298,
-  -5365,  -5431,  -5497,  -5563,  -5629,  -5694,  -5759,  -5823,  -5888,  -5952,  -6015,  -6079,  -6142,  -6204,  -6267,  -6329,
-  -6390,  -6452,  -6513,  -6574,  -6634,  -6694,  -6754,  -6813,  -6872,  -6931,  -6989,  -7047,  -7104,  -7162,  -7218,  -7275,
-  -7331,  -7387,  -7442,  -7497,  -7552,  -7606,  -7660,  -7713,  -7766,  -7819,  -7871,  -7923,  -7975,  -8026,  -8077,  -8127,
-  -8177,  -8226,  -8276,  -8324,  -8373,  -8421,  -8468,  -8515,  -8562,  -8608,  -8654,  -8699,  -8744,  -8789,  -8833,  -8877,
-  -8920,  -8963,  -9005,  -9047,  -9089,  -9130,  -9170,  -9210,  -9250,  -9290,  -9328,  -9367,  -9405,  -9442,  -9480,  -9516,
-  -9552,  -9588,  -9623,  -9658,  -9693,  -9726,  -9760,  -9793,  -9825,  -9857,  -9889,  -9920,  -9951,  -9981, -10011, -10040,
- -10069, -10097, -10125, -10152, -10179, -10206, -10232, -10257, -10282, -10307, -10331, -10354, -10377, -10400, -10422, -10444,
- -10465, -10485, -10506, -10525, -10544, -10563, -10581, -10599, -10616, -10633, -10649, -10665, -10681, -10695, -10710, -10724,
- -10737, -10750, -10762, -10774, -10786, -10797, -10807, -10817, -10826, -10835, -10844, -10852, -10859, -10866, -10873, -10879,
- -10884, -10889, -10894, -10898, -10902, -10905, -10907, -10909, -10911, -10912, -10913, -10913, -10913, -10912, -10911, -10909,
- -10907, -10904, -10901, -10897, -10893, -10888, -10883, -10877, -10871, -10865, -10857, -10850, -10842, -10833, -10824, -10815,
- -10805, -10795, -10784, -10772, -10761, -10748, -10736, -10722, -10709, -10695, -10680, -10665, -10649, -10633, -10617, -10600,
- -10583, -10565, -10546, -10528, -10508, -10489, -10469, -10448, -10427, -10406, -10384, -10362, -10339, -10316, -10292, -10268,
- -10243, -10218, -10193, -10167, -10141, -10114, -10087, -10059, -10031, -10003,  -9974,  -9945,  -9915,  -9885,  -9855,  -9824,
-  -9792,  -9761,  -9729,  -9696,  -9663,  -9630,  -9596,  -9562,  -9527,  -9492,  -9457,  -9421,  -9385,  -9349,  -9312,  -9275,
-  -9237,  -9199,  -9160,  -9122,  -9083,  -9043,  -9003,  -8963,  -8922,  -8881,  -8840,  -8798,  -8756,  -8714,  -8671,  -8628,
-  -8584,  -8540,  -8496,  -8452,  -8407,  -8362,  -8316,  -8270,  -8224,  -8178,  -8131,  -8084,  -8036,  -7989,  -7941,  -7892,
-  -7843,  -7794,  -7745,  -7695,  -7645,  -7595,  -7545,  -7494,  -7443,  -7391,  -7340,  -7288,  -7236,  -7183,  -7130,  -7077,
-  -7024,  -6970,  -6916,  -6862,  -6808,  -6753,  -6698,  -6643,  -6588,  -6532,  -6476,  -6420,  -6364,  -6307,  -6250,  -6193,
-  -6136,  -6079,  -6021,  -5963,  -5905,  -5846,  -5788,  -5729,  -5670,  -5611,  -5551,  -5492,  -5432,  -5372,  -5312,  -5252,
-  -5191,  -5130,  -5070,  -5009,  -4947,  -4886,  -4824,  -4763,  -4701,  -4639,  -4577,  -4514,  -4452,  -4389,  -4327,  -4264,
-  -4201,  -4138,  -4074,  -4011,  -3947,  -3884,  -3820,  -3756,  -3692,  -3628,  -3564,  -3500,  -3435,  -3371,  -3306,  -3241,
-  -3177,  -3112,  -3047,  -2982,  -2917,  -2852,  -2786,  -2721,  -2656,  -2590,  -2525,  -2459,  -2394,  -2328,  -2263,  -2197,
-  -2131,  -2065,  -2000,  -1934,  -1868,  -1802,  -1736,  -1670,  -1604,  -1538,  -1472,  -1406,  -1340,  -1274,  -1208,  -1142,
-  -1077,  -1011,   -945,   -879,   -813,   -747,   -681,   -615,   -550,   -484,   -418,   -352,   -287,   -221,   -156,    -90,
-    -25,     40,    105,    170,    235,    300,    365,    430,    495,    560,    625,    689,    754,    818,    882,    947,
-   1011,   1075,   1139,   1203,   1266,   1330,   1393,   1457,   1520,   1583,   1646,   1709,   1771,   1834,   1896,   1959,
-   2021,   2083,   2145,   2206,   2268,   2329,   2390,   2451,   2512,   2573,   2634,   2694,   2754,   2814,   2874,   2934,
-   2993,   3052,   3111,   3170,   3229,   3287,   3346,   3404,   3462,   3519,   3577,   3634,   3691,   3748,   3804,   3861,
-   3917,   3973,   4028,   4084,   4139,   4194,   4249,   4303,   4357,   4411,   4465,   4519,   4572,   4625,   4678,   4730,
-   4782,   4834,   4886,   4938,   4989,   5040,   5090,   5140,   5191,   5240,   5290,   5339,   5388,   5437,   5485,   5533,
-   5581,   5628,   5675,   5722,   5769,   5815,   5861,   5907,   5952,   5997,   6042,   6086,   6130,   6174,   6218,   6261,
-   6304,   6346,   6388,   6430,   6472,   6513,   6554,   6594,   6635,   6674,   6714,   6753,   6792,   6831,   6869,   6907,
-   6944,   6981,   7018,   7054,   7091,   7126,   7162,   7197,   7231,   7266,   7300,   7333,   7367,   7399,   7432,   7464,
-   7496,   7527,   7558,   7589,   7619,   7649,   7679,   7708,   7737,   7765,   7793,   7821,   7849,   7875,   7902,   7928,
-   7954,   7979,   8005,   8029,   8054,   8077,   8101,   8124,   8147,   8169,   8191,   8213,   8234,   8255,   8275,   8295,
-   8315,   8334,   8353,   8371,   8389,   8407,   8424,   8441,   8458,   8474,   8490,   8505,   8520,   8534,   8549,   8562,
-   8576,   8589,   8601,   8613,   8625,   8636,   8647,   8658,   8668,   8678,   8687,   8696,   8705,   8713,   8721,   8728,
-   8735,   8742,   8748,   8754,   8759,   8764,   8768,   8773,   8776,   8780,   8783,   8786,   8788,   8790,   8791,   8792,
-   8793,   8793,   8793,   8792,   8791,   8790,   8788,   8786,   8784,   8781,   8777,   8774,   8770,   8765,   8760,   8755,
-   8750,   8744,   8737,   8730,   8723,   8716,   8708,   8700,   8691,   8682,   8672,   8663,   8652,   8642,   8631,   8620,
-   8608,   8596,   8584,   8571,   8558,   8544,   8530,   8516,   8501,   8486,   8471,   8455,   8439,   8423,   8406,   8389,
-   8371,   8353,   8335,   8316,   8297,   8278,   8258,   8238,   8218,   8197,   8176,   8155,   8133,   8111,   8089,   8066,
-   8043,   8020,   7996,   7972,   7947,   7923,   7897,   7872,   7846,   7820,   7794,   7767,   7740,   7713,   7685,   7657,
-   7629,   7600,   7572,   7542,   7513,   7483,   7453,   7423,   7392,   7361,   7329,   7298,   7266,   7234,   7201,   7169,
-   7135,   7102,   7069,   7035,   7000,   6966,   6931,   6896,   6861,   6825,   6790,   6754,   6717,   6681,   6644,   6607,
-   6569,   6532,   6494,   6456,   6417,   6379,   6340,   6301,   6261,   6222,   6182,   6142,   6102,   6061,   6020,   5979,
-   5938,   5897,   5855,   5813,   5771,   5729,   5687,   5644,   5601,   5558,   5515,   5471,   5427,   5383,   5339,   5295,
-   5251,   5206,   5161,   5116,   5071,   5025,   4980,   4934,   4888,   4842,   4796,   4750,   4703,   4656,   4609,   4562,
-   4515,   4468,   4420,   4373,   4325,   4277,   4229,   4181,   4133,   4084,   4036,   3987,   3938,   3889,   3840,   3791,
-   3742,   3692,   3643,   3593,   3543,   3494,   3444,   3394,   3343,   3293,   3243,   3192,   3142,   3091,   3041,   2990,
-   2939,   2888,   2837,   2786,   2735,   2684,   2633,   2582,   2530,   2479,   2427,   2376,   2324,   2273,   2221,   2169,
-   2118,   2066,   2014,   1962,   1911,   1859,   1807,   1755,   1703,   1651,   1599,   1547,   1495,   1443,   1391,   1339,
-   1287,   1235,   1183,   1131,   1079,   1027,    975,    923,    871,    819,    767,    716,    664,    612,    560,    508,
-    457,    405,    354,    302,    250,    199,    148,     96,     45,     -5,    -57,   -108,   -159,   -210,   -261,   -312,
-   -362,   -413,   -464,   -514,   -565,   -615,   -665,   -716,   -766,   -816,   -866,   -916,   -965,  -1015,  -1064,  -1114,
-  -1163,  -1212,  -1261,  -1310,  -1359,  -1408,  -1457,  -1505,  -1553,  -1602,  -1650,  -1698,  -1746,  -1793,  -1841,  -1888,
-  -1936,  -1983,  -2030,  -2077,  -2123,  -2170,  -2216,  -2263,  -2309,  -2355,  -2400,  -2446,  -2491,  -2537,  -2582,  -2627,
-  -2671,  -2716,  -2760,  -2805,  -2849,  -2893,  -2936,  -2980,  -3023,  -3066,  -3109,  -3152,  -3195,  -3237,  -3279,  -3321,
-  -3363,  -3404,  -3446,  -3487,  -3528,  -3569,  -3609,  -3649,  -3690,  -3729,  -3769,  -3809,  -3848,  -3887,  -3926,  -3964,
-  -4003,  -4041,  -4079,  -4116,  -4154,  -4191,  -4228,  -4264,  -4301,  -4337,  -4373,  -4409,  -4445,  -4480,  -4515,  -4550,
-  -4584,  -4618,  -4653,  -4686,  -4720,  -4753,  -4786,  -4819,  -4851,  -4884,  -4916,  -4947,  -4979,  -5010,  -5041,  -5072,
-  -5102,  -5132,  -5162,  -5192,  -5221,  -5250,  -5279,  -5308,  -5336,  -5364,  -5391,  -5419,  -5446,  -5473,  -5499,  -5526,
-  -5552,  -5577,  -5603,  -5628,  -5653,  -5678,  -5702,  -5726,  -5750,  -5773,  -5796,  -5819,  -5842,  -5864,  -5886,  -5908,
-  -5929,  -5950,  -5971,  -5991,  -6012,  -6032,  -6051,  -6071,  -6090,  -6108,  -6127,  -6145,  -6163,  -6180,  -6198,  -6214,
-  -6231,  -6247,  -6263,  -6279,  -6295,  -6310,  -6325,  -6339,  -6353,  -6367,  -6381,  -6394,  -6407,  -6420,  -6432,  -6444,
-  -6456,  -6467,  -6478,  -6489,  -6500,  -6510,  -6520,  -6530,  -6539,  -6548,  -6557,  -6565,  -6573,  -6581,  -6588,  -6596,
-  -6602,  -6609,  -6615,  -6621,  -6627,  -6632,  -6637,  -6642,  -6646,  -6650,  -6654,  -6658,  -6661,  -6664,  -6666,  -6669,
-  -6671,  -6672,  -6674,  -6675,  -6675,  -6676,  -6676,  -6676,  -6675,  -6675,  -6674,  -6672,  -6671,  -6669,  -6666,  -6664,
-  -6661,  -6658,  -6655,  -6651,  -6647,  -6642,  -6638,  -6633,  -6628,  -6622,  -6617,  -6610,  -6604,  -6597,  -6591,  -6583,
-  -6576,  -6568,  -6560,  -6552,  -6543,  -6534,  -6525,  -6515,  -6506,  -6495,  -6485,  -6475,  -6464,  -6452,  -6441,  -6429,
-  -6417,  -6405,  -6392,  -6380,  -6367,  -6353,  -6340,  -6326,  -6312,  -6297,  -6282,  -6268,  -6252,  -6237,  -6221,  -6205,
-  -6189,  -6172,  -6156,  -6139,  -6121,  -6104,  -6086,  -6068,  -6050,  -6031,  -6013,  -5994,  -5974,  -5955,  -5935,  -5915,
-  -5895,  -5874,  -5854,  -5833,  -5812,  -5790,  -5769,  -5747,  -5725,  -5702,  -5680,  -5657,  -5634,  -5611,  -5587,  -5564,
-  -5540,  -5516,  -5492,  -5467,  -5442,  -5417,  -5392,  -5367,  -5341,  -5316,  -5290,  -5264,  -5237,  -5211,  -5184,  -5157,
-  -5130,  -5102,  -5075,  -5047,  -5019,  -4991,  -4963,  -4934,  -4906,  -4877,  -4848,  -4819,  -4789,  -4760,  -4730,  -4700,
-  -4670,  -4640,  -4610,  -4579,  -4548,  -4517,  -4486,  -4455,  -4424,  -4392,  -4361,  -4329,  -4297,  -4265,  -4233,  -4200,
-  -4168,  -4135,  -4102,  -4069,  -4036,  -4003,  -3970,  -3936,  -3903,  -3869,  -3835,  -3801,  -3767,  -3733,  -3698,  -3664,
-  -3629,  -3595,  -3560,  -3525,  -3490,  -3455,  -3420,  -3384,  -3349,  -3313,  -3278,  -3242,  -3206,  -3170,  -3134,  -3098,
-  -3062,  -3026,  -2990,  -2953,  -2917,  -2880,  -2844,  -2807,  -2770,  -2733,  -2696,  -2659,  -2622,  -2585,  -2548,  -2511,
-  -2473,  -2436,  -2399,  -2361,  -2324,  -2286,  -2249,  -2211,  -2173,  -2136,  -2098,  -2060,  -2022,  -1984,  -1946,  -1908,
-  -1871,  -1833,  -1795,  -1757,  -1718,  -1680,  -1642,  -1604,  -1566,  -1528,  -1490,  -1452,  -1414,  -1375,  -1337,  -1299,
-  -1261,  -1223,  -1185,  -1147,  -1108,  -1070,  -1032,   -994,   -956,   -918,   -880,   -842,   -804,   -766,   -728,   -690,
-   -652,   -614,   -576,   -539,   -501,   -463,   -425,   -388,   -350,   -313,   -275,   -238,   -200,   -163,   -125,    -88,
-    -51,    -14,     22,     59,     96,    133,    170,    207,    244,    280,    317,    353,    390,    426,    462,    498,
-    535,    571,    606,    642,    678,    714,    749,    785,    820,    855,    891,    926,    961,    996,   1030,   1065,
-   1100,   1134,   1169,   1203,   1237,   1271,   1305,   1339,   1372,   1406,   1439,   1473,   1506,   1539,   1572,   1605,
-   1637,   1670,   1702,   1735,   1767,   1799,   1831,   1863,   1894,   1926,   1957,   1988,   2019,   2050,   2081,   2112,
-   2142,   2172,   2203,   2233,   2263,   2292,   2322,   2351,   2380,   2410,   2438,   2467,   2496,   2524,   2553,   2581,
-   2609,   2636,   2664,   2691,   2719,   2746,   2773,   2799,   2826,   2852,   2879,   2905,   2931,   2956,   2982,   3007,
-   3032,   3057,   3082,   3107,   3131,   3155,   3179,   3203,   3227,   3250,   3274,   3297,   3320,   3342,   3365,   3387,
-   3409,   3431,   3453,   3475,   3496,   3517,   3538,   3559,   3579,   3600,   3620,   3640,   3660,   3679,   3699,   3718,
-   3737,   3755,   3774,   3792,   3810,   3828,   3846,   3863,   3881,   3898,   3915,   3931,   3948,   3964,   3980,   3996,
-   4011,   4027,   4042,   4057,   4072,   4086,   4100,   4115,   4129,   4142,   4156,   4169,   4182,   4195,   4207,   4220,
-   4232,   4244,   4256,   4267,   4278,   4289,   4300,   4311,   4321,   4332,   4342,   4351,   4361,   4370,   4379,   4388,
-   4397,   4405,   4414,   4422,   4430,   4437,   4445,   4452,   4459,   4465,   4472,   4478,   4484,   4490,   4496,   4501,
-   4506,   4511,   4516,   4521,   4525,   4529,   4533,   4537,   4540,   4543,   4546,   4549,   4552,   4554,   4556,   4558,
-   4560,   4562,   4563,   4564,   4565,   4566,   4566,   4566,   4566,   4566,   4566,   4565,   4564,   4563,   4562,   4561,
-   4559,   4557,   4555,   4553,   4551,   4548,   4545,   4542,   4539,   4535,   4532,   4528,   4524,   4520,   4515,   4510,
-   4506,   4500,   4495,   4490,   4484,   4478,   4472,   4466,   4459,   4453,   4446,   4439,   4432,   4424,   4417,   4409,
-   4401,   4393,   4385,   4376,   4367,   4358,   4349,   4340,   4331,   4321,   4311,   4301,   4291,   4281,   4270,   4260,
-   4249,   4238,   4227,   4215,   4204,   4192,   4180,   4168,   4156,   4143,   4131,   4118,   4105,   4092,   4079,   4065,
-   4052,   4038,   4024,   4010,   3996,   3982,   3967,   3953,   3938,   3923,   3908,   3893,   3877,   3862,   3846,   3830,
-   3814,   3798,   3782,   3765,   3749,   3732,   3715,   3698,   3681,   3664,   3647,   3629,   3612,   3594,   3576,   3558,
-   3540,   3522,   3503,   3485,   3466,   3447,   3428,   3409,   3390,   3371,   3352,   3332,   3313,   3293,   3273,   3253,
-   3233,   3213,   3193,   3173,   3152,   3132,   3111,   3091,   3070,   3049,   3028,   3007,   2985,   2964,   2943,   2921,
-   2900,   2878,   2856,   2835,   2813,   2791,   2769,   2746,   2724,   2702,   2680,   2657,   2635,   2612,   2589,   2567,
-   2544,   2521,   2498,   2475,   2452,   2429,   2406,   2382,   2359,   2336,   2312,   2289,   2265,   2242,   2218,   2195,
-   2171,   2147,   2123,   2099,   2075,   2052,   2028,   2004,   1979,   1955,   1931,   1907,   1883,   1859,   1834,   1810,
-   1786,   1762,   1737,   1713,   1688,   1664,   1639,   1615,   1591,   1566,   1542,   1517,   1492,   1468,   1443,   1419,
-   1394,   1370,   1345,   1320,   1296,   1271,   1247,   1222,   1197,   1173,   1148,   1124,   1099,   1075,   1050,   1025,
-   1001,    976,    952,    927,    903,    878,    854,    830,    805,    781,    757,    732,    708,    684,    659,    635,
-    611,    587,    563,    539,    515,    491,    467,    443,    419,    395,    371,    347,    324,    300,    276,    253,
-    229,    206,    182,    159,    136,    112,     89,     66,     43,     20,     -2,    -25,    -48,    -71,    -94,   -116,
-   -139,   -161,   -184,   -206,   -229,   -251,   -273,   -295,   -317,   -339,   -361,   -383,   -405,   -427,   -448,   -470,
-   -491,   -513,   -534,   -555,   -576,   -597,   -618,   -639,   -660,   -681,   -701,   -722,   -742,   -762,   -783,   -803,
-   -823,   -843,   -863,   -882,   -902,   -922,   -941,   -960,   -980,   -999,  -1018,  -1037,  -1056,  -1075,  -1093,  -1112,
-  -1130,  -1149,  -1167,  -1185,  -1203,  -1221,  -1239,  -1256,  -1274,  -1292,  -1309,  -1326,  -1343,  -1360,  -1377,  -1394,
-  -1411,  -1427,  -1444,  -1460,  -1476,  -1492,  -1508,  -1524,  -1540,  -1556,  -1571,  -1586,  -1602,  -1617,  -1632,  -1647,
-  -1661,  -1676,  -1691,  -1705,  -1719,  -1733,  -1747,  -1761,  -1775,  -1789,  -1802,  -1816,  -1829,  -1842,  -1855,  -1868,
-  -1881,  -1893,  -1906,  -1918,  -1930,  -1942,  -1954,  -1966,  -1978,  -1989,  -2001,  -2012,  -2023,  -2034,  -2045,  -2056,
-  -2067,  -2077,  -2088,  -2098,  -2108,  -2118,  -2128,  -2137,  -2147,  -2156,  -2166,  -2175,  -2184,  -2193,  -2201,  -2210,
-  -2218,  -2227,  -2235,  -2243,  -2251,  -2259,  -2266,  -2274,  -2281,  -2289,  -2296,  -2303,  -2310,  -2316,  -2323,  -2329,
-  -2336,  -2342,  -2348,  -2354,  -2359,  -2365,  -2371,  -2376,  -2381,  -2386,  -2391,  -2396,  -2401,  -2405,  -2410,  -2414,
-  -2418,  -2422,  -2426,  -2430,  -2433,  -2437,  -2440,  -2443,  -2446,  -2449,  -2452,  -2455,  -2457,  -2460,  -2462,  -2464,
-  -2466,  -2468,  -2470,  -2472,  -2473,  -2474,  -2476,  -2477,  -2478,  -2479,  -2479,  -2480,  -2481,  -2481,  -2481,  -2481,
-  -2481,  -2481,  -2481,  -2480,  -2480,  -2479,  -2479,  -2478,  -2477,  -2476,  -2474,  -2473,  -2471,  -2470,  -2468,  -2466,
-  -2464,  -2462,  -2460,  -2458,  -2455,  -2453,  -2450,  -2447,  -2444,  -2441,  -2438,  -2435,  -2432,  -2428,  -2425,  -2421,
-  -2417,  -2413,  -2409,  -2405,  -2401,  -2397,  -2392,  -2388,  -2383,  -2378,  -2373,  -2369,  -2363,  -2358,  -2353,  -2348,
-  -2342,  -2337,  -2331,  -2325,  -2319,  -2313,  -2307,  -2301,  -2295,  -2289,  -2282,  -2276,  -2269,  -2262,  -2256,  -2249,
-  -2242,  -2235,  -2228,  -2220,  -2213,  -2206,  -2198,  -2190,  -2183,  -2175,  -2167,  -2159,  -2151,  -2143,  -2135,  -2127,
-  -2119,  -2110,  -2102,  -2093,  -2085,  -2076,  -2067,  -2058,  -2049,  -2040,  -2031,  -2022,  -2013,  -2004,  -1994,  -1985,
-  -1976,  -1966,  -1956,  -1947,  -1937,  -1927,  -1917,  -1908,  -1898,  -1888,  -1878,  -1867,  -1857,  -1847,  -1837,  -1826,
-  -1816,  -1806,  -1795,  -1784,  -1774,  -1763,  -1752,  -1742,  -1731,  -1720,  -1709,  -1698,  -1687,  -1676,  -1665,  -1654,
-  -1643,  -1632,  -1621,  -1609,  -1598,  -1587,  -1575,  -1564,  -1553,  -1541,  -1530,  -1518,  -1507,  -1495,  -1483,  -1472,
-  -1460,  -1448,  -1437,  -1425,  -1413,  -1401,  -1390,  -1378,  -1366,  -1354,  -1342,  -1330,  -1318,  -1306,  -1295,  -1283,
-  -1271,  -1259,  -1247,  -1235,  -1223,  -1211,  -1199,  -1186,  -1174,  -1162,  -1150,  -1138,  -1126,  -1114,  -1102,  -1090,
-  -1078,  -1066,  -1054,  -1042,  -1029,  -1017,  -1005,   -993,   -981,   -969,   -957,   -945,   -933,   -921,   -909,   -897,
-   -885,   -873,   -861,   -849,   -837,   -825,   -813,   -801,   -789,   -778,   -766,   -754,   -742,   -730,   -718,   -707,
-   -695,   -683,   -672,   -660,   -648,   -637,   -625,   -614,   -602,   -591,   -579,   -568,   -556,   -545,   -534,   -522,
-   -511,   -500,   -489,   -478,   -466,   -455,   -444,   -433,   -422,   -411,   -400,   -390,   -379,   -368,   -357,   -347,
-   -336,   -325,   -315,   -304,   -294,   -283,   -273,   -263,   -252,   -242,   -232,   -222,   -212,   -202,   -192,   -182,
-   -172,   -162,   -152,   -142,   -133,   -123,   -113,   -104,    -94,    -85,    -76,    -66,    -57,    -48,    -39,    -30,
-    -21,    -12,     -3,      5,     14,     22,     31,     40,     48,     57,     65,     73,     82,     90,     98,    106,
-    114,    122,    130,    138,    146,    153,    161,    169,    176,    183,    191,    198,    205,    213,    220,    227,
-    234,    240,    247,    254,    261,    267,    274,    280,    287,    293,    299,    305,    312,    318,    324,    330,
-    335,    341,    347,    352,    358,    363,    369,    374,    379,    385,    390,    395,    400,    405,    409,    414,
-    419,    423,    428,    432,    437,    441,    445,    449,    453,    457,    461,    465,    469,    473,    476,    480,
-    483,    487,    490,    493,    497,    500,    503,    506,    509,    511,    514,    517,    519,    522,    524,    527,
-    529,    531,    534,    536,    538,    540,    542,    543,    545,    547,    548,    550,    551,    553,    554,    555,
-    557,    558,    559,    560,    561,    562,    562,    563,    564,    564,    565,    565,    566,    566,    566,    566,
-    566,    566,    566,    566,    566,    566,    566,    565,    565,    564,    564,    563,    563,    562,    561,    560,
-    559,    559,    558,    556,    555,    554,    553,    552,    550,    549,    547,    546,    544,    543,    541,    539,
-    537,    535,    533,    532,    529,    527,    525,    523,    521,    519,    516,    514,    511,    509,    507,    504,
-    501,    499,    496,    493,    490,    488,    485,    482,    479,    476,    473,    470,    466,    463,    460,    457,
-    454,    450,    447,    443,    440,    436,    433,    429,    426,    422,    419,    415,    411,    407,    404,    400,
-    396,    392,    388,    384,    380,    376,    372,    368,    364,    360,    356,    352,    348,    343,    339,    335,
-    331,    326,    322,    318,    314,    309,    305,    300,    296,    292,    287,    283,    278,    274,    269,    265,
-    260,    256,    251,    247,    242,    238,    233,    229,    224,    219,    215,    210,    206,    201,    196,    192,
-    187,    183,    178,    173,    169,    164,    159,    155,    150,    146,    141,    136,    132,    127,    123,    118,
-    114,    109,    104,    100,     95,     91,     86,     82,     77,     73,     68,     64,     60,     55,     51,     46,
-     42,     38,     33,     29,     25,     21,     16,     12,      8,      4};
+// Prepared by tools/sample_prep.py, trimmed at -60dB
+#define drum_kick_len        17649
+#define drum_kick_peak       31510
+#define drum_kick_gain       3796
+#define drum_kick_loop_start 0
+#define drum_kick_loop_end   0
+const int16_t drum_kick[] = {
+  12883,  22983,  29270,  31500,  29994,  25425,  18640,  10520,   1887,  -6549, -14225, -20728, -25787, -29265, -31133, -31448,
+ -30336, -27971, -24555, -20306, -15447, -10192,  -4743,    714,   6020,  11035,  15642,  19753,  23296,  26227,  28516,  30154,
+  31145,  31507,  31270,  30471,  29155,  27373,  25179,  22629,  19780,  16690,  13415,  10009,   6525,   3011,   -486,  -3925,
+  -7267, -10478, -13527, -16388, -19038, -21459, -23636, -25556, -27213, -28600, -29715, -30558, -31133, -31445, -31500, -31306,
+ -30875, -30217, -29345, -28273, -27015, -25586, -24000, -22275, -20424, -18464, -16411, -14280, -12085,  -9843,  -7567,  -5270,
+  -2967,   -670,   1608,   3858,   6067,   8226,  10326,  12357,  14312,  16184,  17966,  19653,  21239,  22719,  24091,  25351,
+  26497,  27525,  28436,  29229,  29902,  30456,  30893,  31212,  31415,  31505,  31483,  31351,  31114,  30773,  30332,  29795,
+  29166,  28448,  27646,  26763,  25805,  24775,  23679,  22520,  21303,  20033,  18715,  17354,  15953,  14517,  13052,  11561,
+  10049,   8520,   6979,   5429,   3876,   2321,    770,   -772,  -2305,  -3824,  -5325,  -6805,  -8262,  -9691, -11092, -12460,
+ -13794, -15091, -16348, -17565, -18739, -19867, -20950, -21984, -22969, -23904, -24787, -25618, -26396, -27119, -27788, -28402,
+ -28961, -29464, -29911, -30303, -30639, -30920, -31146, -31317, -31434, -31497, -31507, -31465, -31371, -31227, -31032, -30789,
+ -30499, -30161, -29778, -29351, -28880, -28368, -27815, -27223, -26593, -25927, -25226, -24492, -23725, -22928, -22102, -21248,
+ -20368, -19464, -18537, -17589, -16621, -15634, -14631, -13612, -12580, -11536, -10480,  -9416,  -8343,  -7264,  -6180,  -5093,
+  -4003,  -2913,  -1823,   -735,    350,   1430,   2506,   3574,   4635,   5686,   6727,   7757,   8775,   9780,  10770,  11745,
+  12703,  13645,  14569,  15474,  16360,  17225,  18070,  18892,  19693,  20471,  21225,  21955,  22661,  23342,  23998,  24627,
+  25231,  25808,  26358,  26881,  27376,  27844,  28284,  28697,  29081,  29437,  29765,  30064,  30335,  30578,  30792,  30978,
+  31136,  31266,  31369,  31443,  31490,  31509,  31501,  31467,  31405,  31317,  31203,  31064,  30899,  30709,  30494,  30254,
+  29991,  29704,  29395,  29062,  28707,  28331,  27933,  27514,  27075,  26616,  26138,  25641,  25126,  24594,  24043,  23477,
+  22894,  22296,  21683,  21055,  20414,  19759,  19092,  18412,  17721,  17019,  16307,  15585,  14854,  14114,  13366,  12611,
+  11849,  11080,  10306,   9527,   8743,   7955,   7164,   6369,   5573,   4774,   3974,   3174,   2373,   1573,    773,    -24,
+   -821,  -1615,  -2406,  -3194,  -3979,  -4759,  -5534,  -6304,  -7069,  -7827,  -8579,  -9324, -10062, -10793, -11515, -12228,
+ -12933, -13629, -14315, -14992, -15658, -16313, -16958, -17591, -18213, -18824, -19422, -20008, -20582, -21142, -21690, -22224,
+ -22745, -23252, -23746, -24225, -24690, -25141, -25577, -25998, -26404, -26796, -27172, -27533, -27879, -28209, -28524, -28823,
+ -29107, -29374, -29626, -29863, -30083, -30288, -30476, -30649, -30806, -30947, -31072, -31182, -31275, -31353, -31415, -31462,
+ -31492, -31508, -31508, -31492, -31462, -31416, -31355, -31279, -31188, -31083, -30963, -30828, -30679, -30516, -30339, -30148,
+ -29944, -29726, -29494, -29250, -28992, -28722, -28439, -28143, -27835, -27516, -27184, -26841, -26486, -26120, -25743, -25356,
+ -24958, -24549, -24131, -23702, -23264, -22817, -22360, -21895, -21421, -20939, -20448, -19950, -19443, -18930, -18409, -17882,
+ -17347, -16807, -16260, -15707, -15149, -14585, -14017, -13443, -12865, -12282, -11695, -11105, -10511,  -9914,  -9313,  -8710,
+  -8104,  -7496,  -6886,  -6274,  -5660,  -5045,  -4429,  -3813,  -3195,  -2578,  -1960,  -1343,   -725,   -109,    506,   1121,
+   1734,   2346,   2956,   3564,   4169,   4773,   5373,   5971,   6566,   7158,   7746,   8330,   8911,   9487,  10059,  10627,
+  11190,  11748,  12301,  12849,  13392,  13929,  14461,  14986,  15506,  16019,  16526,  17026,  17520,  18007,  18487,  18960,
+  19426,  19884,  20335,  20779,  21214,  21642,  22062,  22473,  22877,  23272,  23659,  24037,  24407,  24768,  25120,  25464,
+  25798,  26124,  26440,  26748,  27046,  27335,  27614,  27884,  28145,  28396,  28637,  28869,  29092,  29304,  29507,  29701,
+  29884,  30058,  30222,  30376,  30520,  30655,  30780,  30894,  30999,  31094,  31180,  31255,  31321,  31377,  31423,  31459,
+  31485,  31502,  31509,  31507,  31495,  31473,  31442,  31401,  31351,  31291,  31222,  31144,  31056,  30960,  30854,  30739,
+  30615,  30482,  30340,  30190,  30031,  29863,  29686,  29502,  29308,  29107,  28897,  28679,  28453,  28219,  27977,  27727,
+  27470,  27205,  26933,  26653,  26366,  26072,  25770,  25462,  25147,  24825,  24497,  24162,  23821,  23473,  23120,  22760,
+  22394,  22023,  21645,  21263,  20874,  20481,  20082,  19679,  19270,  18856,  18438,  18015,  17588,  17157,  16721,  16281,
+  15838,  15390,  14939,  14485,  14027,  13565,  13101,  12634,  12163,  11690,  11215,  10737,  10256,   9774,   9289,   8803,
+   8314,   7824,   7333,   6840,   6345,   5850,   5354,   4856,   4358,   3859,   3360,   2861,   2361,   1861,   1361,    861,
+    361,   -137,   -635,  -1133,  -1631,  -2127,  -2623,  -3117,  -3610,  -4102,  -4592,  -5081,  -5568,  -6053,  -6536,  -7017,
+  -7496,  -7973,  -8447,  -8919,  -9388,  -9855, -10319, -10780, -11238, -11692, -12144, -12592, -13037, -13478, -13916, -14350,
+ -14780, -15206, -15629, -16047, -16461, -16871, -17277, -17678, -18075, -18467, -18854, -19237, -19615, -19988, -20356, -20719,
+ -21078, -21430, -21778, -22120, -22457, -22789, -23115, -23436, -23751, -24060, -24363, -24661, -24953, -25239, -25519, -25794,
+ -26062, -26324, -26580, -26830, -27073, -27311, -27542, -27767, -27986, -28198, -28404, -28603, -28796, -28982, -29162, -29335,
+ -29502, -29662, -29816, -29963, -30104, -30237, -30364, -30485, -30599, -30706, -30806, -30900, -30987, -31067, -31141, -31208,
+ -31268, -31321, -31368, -31408, -31442, -31468, -31489, -31502, -31509, -31509, -31502, -31489, -31470, -31444, -31411, -31372,
+ -31326, -31274, -31215, -31150, -31079, -31001, -30917, -30826, -30730, -30627, -30518, -30402, -30281, -30154, -30020, -29881,
+ -29735, -29584, -29427, -29263, -29095, -28920, -28740, -28554, -28362, -28165, -27963, -27755, -27541, -27323, -27099, -26869,
+ -26635, -26395, -26151, -25901, -25647, -25388, -25124, -24855, -24581, -24303, -24020, -23733, -23442, -23146, -22845, -22541,
+ -22232, -21920, -21603, -21282, -20958, -20629, -20297, -19961, -19622, -19279, -18933, -18583, -18230, -17874, -17514, -17152,
+ -16786, -16418, -16047, -15673, -15296, -14917, -14535, -14150, -13764, -13374, -12983, -12590, -12194, -11796, -11397, -10995,
+ -10592, -10187,  -9781,  -9373,  -8963,  -8553,  -8140,  -7727,  -7312,  -6897,  -6480,  -6063,  -5644,  -5225,  -4806,  -4385,
+  -3964,  -3543,  -3121,  -2699,  -2277,  -1854,  -1432,  -1009,   -587,   -165,    256,    678,   1099,   1520,   1940,   2360,
+   2779,   3197,   3614,   4031,   4446,   4861,   5274,   5686,   6097,   6507,   6915,   7322,   7727,   8130,   8532,   8932,
+   9331,   9727,  10122,  10514,  10905,  11293,  11679,  12063,  12445,  12824,  13201,  13575,  13947,  14316,  14682,  15046,
+  15407,  15765,  16120,  16472,  16821,  17168,  17511,  17850,  18187,  18520,  18850,  19177,  19500,  19820,  20136,  20448,
+  20757,  21063,  21364,  21662,  21956,  22246,  22533,  22815,  23093,  23368,  23638,  23905,  24167,  24425,  24679,  24929,
+  25174,  25415,  25652,  25884,  26112,  26336,  26555,  26770,  26980,  27186,  27387,  27584,  27776,  27963,  28146,  28324,
+  28498,  28666,  28830,  28990,  29144,  29294,  29439,  29579,  29714,  29844,  29970,  30090,  30206,  30317,  30423,  30524,
+  30621,  30712,  30798,  30880,  30956,  31028,  31094,  31156,  31213,  31264,  31311,  31353,  31390,  31422,  31449,  31471,
+  31488,  31500,  31507,  31510,  31507,  31500,  31487,  31470,  31448,  31421,  31389,  31352,  31311,  31264,  31213,  31157,
+  31097,  31031,  30961,  30886,  30807,  30722,  30633,  30540,  30442,  30339,  30232,  30120,  30003,  29882,  29757,  29627,
+  29493,  29354,  29211,  29064,  28912,  28756,  28596,  28432,  28263,  28090,  27914,  27733,  27548,  27358,  27165,  26968,
+  26767,  26563,  26354,  26141,  25925,  25705,  25481,  25254,  25023,  24789,  24550,  24309,  24064,  23815,  23563,  23308,
+  23049,  22788,  22523,  22254,  21983,  21709,  21431,  21151,  20868,  20581,  20292,  20000,  19706,  19408,  19108,  18805,
+  18500,  18192,  17882,  17569,  17254,  16937,  16617,  16295,  15971,  15645,  15316,  14986,  14653,  14319,  13983,  13645,
+  13305,  12963,  12620,  12275,  11928,  11580,  11231,  10880,  10528,  10174,   9819,   9463,   9106,   8747,   8388,   8027,
+   7666,   7303,   6940,   6576,   6211,   5845,   5479,   5112,   4745,   4377,   4009,   3640,   3271,   2902,   2532,   2162,
+   1793,   1423,   1053,    683,    313,    -56,   -426,   -795,  -1164,  -1533,  -1902,  -2270,  -2637,  -3004,  -3371,  -3737,
+  -4102,  -4466,  -4830,  -5193,  -5555,  -5916,  -6276,  -6635,  -6994,  -7351,  -7706,  -8061,  -8415,  -8767,  -9118,  -9467,
+  -9815, -10162, -10507, -10850, -11192, -11532, -11871, -12208, -12543, -12876, -13207, -13537, -13864, -14190, -14513, -14835,
+ -15154, -15471, -15786, -16099, -16410, -16718, -17024, -17328, -17629, -17927, -18224, -18517, -18809, -19097, -19383, -19666,
+ -19947, -20225, -20500, -20772, -21042, -21308, -21572, -21833, -22091, -22345, -22597, -22846, -23092, -23335, -23574, -23811,
+ -24044, -24274, -24501, -24724, -24944, -25161, -25375, -25585, -25792, -25996, -26196, -26393, -26586, -26776, -26962, -27144,
+ -27324, -27499, -27671, -27840, -28004, -28166, -28323, -28477, -28627, -28774, -28917, -29056, -29191, -29323, -29450, -29574,
+ -29695, -29811, -29924, -30033, -30138, -30239, -30337, -30430, -30520, -30606, -30688, -30766, -30840, -30910, -30977, -31039,
+ -31098, -31153, -31203, -31250, -31293, -31333, -31368, -31399, -31427, -31450, -31470, -31485, -31497, -31505, -31509, -31509,
+ -31506, -31498, -31486, -31471, -31452, -31429, -31402, -31371, -31336, -31298, -31256, -31210, -31160, -31106, -31049, -30987,
+ -30922, -30854, -30781, -30705, -30625, -30542, -30455, -30364, -30269, -30171, -30069, -29964, -29855, -29742, -29626, -29507,
+ -29384, -29257, -29127, -28993, -28856, -28716, -28572, -28425, -28274, -28121, -27963, -27803, -27639, -27472, -27302, -27129,
+ -26952, -26772, -26590, -26404, -26215, -26023, -25828, -25629, -25428, -25224, -25018, -24808, -24595, -24380, -24161, -23940,
+ -23716, -23490, -23261, -23029, -22794, -22557, -22318, -22075, -21831, -21584, -21334, -21082, -20827, -20571, -20312, -20050,
+ -19787, -19521, -19253, -18983, -18710, -18436, -18159, -17881, -17601, -17318, -17034, -16748, -16460, -16170, -15878, -15585,
+ -15290, -14993, -14695, -14395, -14094, -13791, -13486, -13180, -12873, -12564, -12254, -11943, -11630, -11316, -11001, -10685,
+ -10367, -10049,  -9729,  -9409,  -9088,  -8765,  -8442,  -8118,  -7793,  -7467,  -7141,  -6813,  -6486,  -6157,  -5828,  -5498,
+  -5168,  -4838,  -4507,  -4175,  -3843,  -3511,  -3179,  -2846,  -2513,  -2180,  -1847,  -1513,  -1180,   -846,   -513,   -179,
+    153,    486,    819,   1152,   1485,   1817,   2149,   2481,   2812,   3143,   3473,   3803,   4133,   4462,   4790,   5118,
+   5445,   5771,   6096,   6421,   6745,   7068,   7391,   7712,   8032,   8352,   8670,   8987,   9304,   9619,   9933,  10246,
+  10557,  10868,  11177,  11484,  11791,  12096,  12399,  12701,  13002,  13301,  13599,  13895,  14189,  14482,  14773,  15063,
+  15351,  15637,  15921,  16203,  16484,  16762,  17039,  17314,  17587,  17858,  18127,  18394,  18659,  18921,  19182,  19440,
+  19697,  19951,  20203,  20452,  20700,  20945,  21187,  21428,  21666,  21902,  22135,  22366,  22594,  22820,  23043,  23264,
+  23482,  23698,  23911,  24122,  24330,  24535,  24738,  24938,  25135,  25329,  25521,  25710,  25896,  26079,  26260,  26438,
+  26613,  26785,  26954,  27120,  27284,  27444,  27602,  27756,  27908,  28056,  28202,  28344,  28484,  28621,  28754,  28885,
+  29012,  29136,  29258,  29376,  29491,  29603,  29712,  29817,  29920,  30019,  30115,  30208,  30298,  30385,  30468,  30549,
+  30626,  30700,  30771,  30838,  30902,  30963,  31021,  31076,  31127,  31175,  31220,  31262,  31301,  31336,  31368,  31396,
+  31422,  31444,  31463,  31479,  31491,  31501,  31507,  31509,  31509,  31505,  31498,  31488,  31475,  31458,  31439,  31416,
+  31389,  31360,  31327,  31292,  31253,  31210,  31165,  31117,  31065,  31010,  30952,  30891,  30827,  30760,  30690,  30616,
+  30540,  30460,  30377,  30291,  30203,  30111,  30016,  29918,  29817,  29714,  29607,  29497,  29384,  29269,  29150,  29029,
+  28904,  28777,  28647,  28514,  28379,  28240,  28099,  27955,  27808,  27658,  27506,  27351,  27193,  27032,  26869,  26704,
+  26535,  26364,  26191,  26015,  25836,  25655,  25471,  25285,  25096,  24905,  24712,  24516,  24318,  24117,  23914,  23709,
+  23501,  23291,  23079,  22865,  22648,  22429,  22208,  21985,  21760,  21533,  21304,  21072,  20839,  20604,  20366,  20127,
+  19886,  19643,  19398,  19151,  18902,  18652,  18400,  18146,  17890,  17633,  17374,  17114,  16851,  16587,  16322,  16055,
+  15787,  15517,  15246,  14973,  14699,  14423,  14147,  13869,  13589,  13308,  13027,  12744,  12459,  12174,  11887,  11600,
+  11311,  11022,  10731,  10439,  10147,   9853,   9559,   9264,   8968,   8671,   8373,   8075,   7776,   7476,   7176,   6875,
+   6573,   6271,   5969,   5665,   5362,   5058,   4753,   4448,   4143,   3837,   3532,   3225,   2919,   2612,   2306,   1999,
+   1692,   1385,   1077,    770,    463,    156,   -150,   -457,   -764,  -1071,  -1378,  -1684,  -1990,  -2296,  -2602,  -2907,
+  -3212,  -3517,  -3821,  -4125,  -4428,  -4731,  -5034,  -5335,  -5637,  -5937,  -6237,  -6537,  -6835,  -7133,  -7431,  -7727,
+  -8023,  -8318,  -8612,  -8905,  -9197,  -9488,  -9779, -10068, -10356, -10644, -10930, -11215, -11499, -11782, -12064, -12345,
+ -12624, -12902, -13179, -13455, -13729, -14002, -14274, -14544, -14813, -15080, -15346, -15610, -15873, -16135, -16395, -16653,
+ -16909, -17165, -17418, -17670, -17920, -18168, -18415, -18660, -18903, -19144, -19383, -19621, -19857, -20091, -20323, -20553,
+ -20781, -21007, -21231, -21454, -21674, -21892, -22108, -22322, -22534, -22744, -22951, -23157, -23360, -23562, -23761, -23957,
+ -24152, -24344, -24534, -24722, -24908, -25091, -25272, -25450, -25626, -25800, -25971, -26140, -26307, -26471, -26633, -26792,
+ -26949, -27103, -27255, -27404, -27551, -27695, -27837, -27976, -28113, -28247, -28379, -28508, -28634, -28758, -28879, -28997,
+ -29113, -29226, -29336, -29444, -29549, -29652, -29752, -29849, -29943, -30035, -30124, -30210, -30293, -30374, -30452, -30528,
+ -30600, -30670, -30737, -30801, -30863, -30921, -30977, -31030, -31081, -31128, -31173, -31215, -31254, -31291, -31324, -31355,
+ -31383, -31408, -31431, -31450, -31467, -31481, -31492, -31501, -31506, -31509, -31509, -31507, -31501, -31493, -31482, -31468,
+ -31451, -31431, -31409, -31384, -31356, -31326, -31292, -31256, -31217, -31176, -31132, -31084, -31035, -30982, -30927, -30869,
+ -30808, -30745, -30679, -30610, -30539, -30465, -30388, -30309, -30227, -30142, -30055, -29965, -29872, -29777, -29680, -29579,
+ -29476, -29371, -29263, -29153, -29040, -28924, -28806, -28686, -28563, -28437, -28309, -28179, -28046, -27911, -27773, -27633,
+ -27491, -27346, -27199, -27050, -26898, -26744, -26588, -26429, -26268, -26105, -25940, -25772, -25603, -25431, -25257, -25080,
+ -24902, -24722, -24539, -24354, -24167, -23979, -23788, -23595, -23400, -23203, -23004, -22804, -22601, -22397, -22190, -21982,
+ -21772, -21560, -21346, -21130, -20913, -20694, -20473, -20250, -20026, -19800, -19572, -19343, -19112, -18880, -18646, -18410,
+ -18173, -17934, -17694, -17453, -17210, -16965, -16719, -16472, -16223, -15974, -15722, -15470, -15216, -14961, -14705, -14447,
+ -14188, -13929, -13668, -13406, -13142, -12878, -12613, -12347, -12079, -11811, -11542, -11272, -11001, -10729, -10456, -10182,
+  -9908,  -9632,  -9356,  -9080,  -8802,  -8524,  -8245,  -7966,  -7686,  -7405,  -7124,  -6842,  -6559,  -6276,  -5993,  -5709,
+  -5425,  -5140,  -4855,  -4570,  -4284,  -3998,  -3712,  -3425,  -3139,  -2852,  -2564,  -2277,  -1990,  -1702,  -1414,  -1126,
+   -839,   -551,   -263,     24,    312,    600,    887,   1175,   1462,   1749,   2036,   2323,   2610,   2896,   3182,   3467,
+   3753,   4038,   4322,   4606,   4890,   5173,   5456,   5739,   6020,   6302,   6582,   6862,   7142,   7421,   7699,   7976,
+   8253,   8529,   8805,   9079,   9353,   9626,   9898,  10169,  10439,  10709,  10977,  11245,  11512,  11777,  12042,  12305,
+  12568,  12829,  13090,  13349,  13607,  13864,  14120,  14374,  14627,  14880,  15130,  15380,  15628,  15875,  16121,  16365,
+  16608,  16849,  17089,  17328,  17565,  17801,  18035,  18267,  18499,  18728,  18956,  19183,  19408,  19631,  19852,  20072,
+  20291,  20507,  20722,  20935,  21147,  21356,  21564,  21770,  21975,  22177,  22378,  22577,  22774,  22969,  23162,  23354,
+  23543,  23730,  23916,  24099,  24281,  24461,  24638,  24814,  24987,  25159,  25328,  25495,  25661,  25824,  25985,  26144,
+  26301,  26455,  26608,  26758,  26906,  27052,  27196,  27338,  27477,  27614,  27749,  27882,  28012,  28140,  28266,  28390,
+  28511,  28630,  28746,  28861,  28973,  29082,  29190,  29295,  29397,  29498,  29595,  29691,  29784,  29875,  29963,  30049,
+  30132,  30214,  30292,  30368,  30442,  30514,  30583,  30649,  30713,  30775,  30834,  30890,  30945,  30996,  31046,  31092,
+  31137,  31178,  31218,  31255,  31289,  31321,  31350,  31377,  31402,  31424,  31443,  31460,  31475,  31487,  31496,  31503,
+  31507,  31510,  31509,  31506,  31501,  31493,  31482,  31469,  31454,  31436,  31416,  31393,  31368,  31340,  31310,  31277,
+  31242,  31204,  31164,  31122,  31077,  31030,  30980,  30928,  30873,  30816,  30757,  30695,  30631,  30564,  30495,  30424,
+  30350,  30274,  30195,  30115,  30031,  29946,  29858,  29768,  29676,  29581,  29484,  29384,  29283,  29179,  29073,  28964,
+  28854,  28741,  28626,  28508,  28389,  28267,  28143,  28017,  27889,  27758,  27626,  27491,  27355,  27216,  27075,  26932,
+  26787,  26639,  26490,  26339,  26186,  26030,  25873,  25714,  25553,  25390,  25224,  25057,  24889,  24718,  24545,  24370,
+  24194,  24016,  23835,  23653,  23470,  23284,  23097,  22908,  22717,  22524,  22330,  22134,  21937,  21737,  21536,  21334,
+  21130,  20924,  20717,  20508,  20297,  20085,  19872,  19657,  19441,  19223,  19003,  18782,  18560,  18337,  18112,  17885,
+  17658,  17429,  17198,  16967,  16734,  16500,  16265,  16028,  15790,  15552,  15312,  15070,  14828,  14585,  14340,  14095,
+  13848,  13600,  13352,  13102,  12852,  12600,  12348,  12094,  11840,  11585,  11329,  11073,  10815,  10557,  10297,  10038,
+   9777,   9516,   9254,   8991,   8728,   8464,   8199,   7934,   7669,   7402,   7136,   6868,   6601,   6332,   6064,   5795,
+   5525,   5255,   4985,   4715,   4444,   4172,   3901,   3629,   3357,   3085,   2813,   2540,   2267,   1995,   1722,   1449,
+   1176,    902,    629,    356,     83,   -190,   -463,   -736,  -1009,  -1282,  -1554,  -1827,  -2099,  -2372,  -2644,  -2915,
+  -3187,  -3458,  -3729,  -4000,  -4270,  -4540,  -4809,  -5079,  -5347,  -5616,  -5884,  -6151,  -6418,  -6684,  -6950,  -7216,
+  -7480,  -7744,  -8008,  -8271,  -8533,  -8795,  -9056,  -9316,  -9575,  -9834, -10092, -10349, -10605, -10861, -11116, -11370,
+ -11622, -11875, -12126, -12376, -12625, -12873, -13121, -13367, -13612, -13857, -14100, -14342, -14583, -14823, -15062, -15299,
+ -15536, -15771, -16005, -16238, -16470, -16700, -16929, -17157, -17384, -17609, -17833, -18056, -18277, -18497, -18715, -18932,
+ -19148, -19362, -19575, -19786, -19996, -20204, -20411, -20616, -20820, -21022, -21222, -21421, -21619, -21814, -22009, -22201,
+ -22392, -22581, -22769, -22954, -23139, -23321, -23502, -23680, -23858, -24033, -24207, -24378, -24548, -24716, -24883, -25047,
+ -25210, -25371, -25530, -25687, -25842, -25995, -26146, -26296, -26443, -26588, -26732, -26873, -27013, -27151, -27286, -27420,
+ -27551, -27681, -27808, -27934, -28057, -28179, -28298, -28415, -28530, -28643, -28754, -28863, -28970, -29074, -29177, -29277,
+ -29375, -29472, -29565, -29657, -29747, -29834, -29920, -30003, -30084, -30162, -30239, -30313, -30385, -30455, -30523, -30588,
+ -30651, -30712, -30771, -30828, -30882, -30934, -30984, -31032, -31077, -31120, -31161, -31200, -31236, -31270, -31302, -31331,
+ -31359, -31384, -31406, -31427, -31445, -31461, -31475, -31486, -31495, -31502, -31507, -31509, -31509, -31507, -31503, -31496,
+ -31487, -31476, -31463, -31447, -31429, -31409, -31386, -31361, -31334, -31305, -31274, -31240, -31204, -31166, -31125, -31083,
+ -31038, -30991, -30942, -30890, -30837, -30781, -30723, -30662, -30600, -30535, -30468, -30399, -30328, -30255, -30180, -30102,
+ -30022, -29941, -29857, -29770, -29682, -29592, -29500, -29405, -29308, -29210, -29109, -29006, -28901, -28795, -28686, -28575,
+ -28462, -28347, -28230, -28111, -27990, -27867, -27742, -27615, -27486, -27356, -27223, -27089, -26952, -26814, -26673, -26531,
+ -26387, -26242, -26094, -25944, -25793, -25640, -25485, -25328, -25170, -25009, -24847, -24684, -24518, -24351, -24182, -24012,
+ -23839, -23665, -23490, -23313, -23134, -22953, -22771, -22588, -22403, -22216, -22028, -21838, -21646, -21454, -21259, -21063,
+ -20866, -20667, -20467, -20266, -20063, -19858, -19653, -19446, -19237, -19027, -18816, -18604, -18390, -18175, -17959, -17742,
+ -17523, -17303, -17082, -16860, -16637, -16412, -16187, -15960, -15732, -15503, -15273, -15042, -14810, -14577, -14343, -14108,
+ -13872, -13635, -13397, -13159, -12919, -12679, -12437, -12195, -11952, -11708, -11463, -11218, -10972, -10725, -10477, -10229,
+  -9980,  -9730,  -9480,  -9229,  -8977,  -8725,  -8472,  -8219,  -7965,  -7711,  -7456,  -7200,  -6944,  -6688,  -6431,  -6174,
+  -5916,  -5658,  -5400,  -5141,  -4882,  -4623,  -4363,  -4103,  -3843,  -3583,  -3322,  -3061,  -2800,  -2539,  -2278,  -2016,
+  -1755,  -1493,  -1231,   -970,   -708,   -446,   -184,     77,    339,    601,    862,   1124,   1385,   1647,   1908,   2169,
+   2430,   2691,   2951,   3212,   3472,   3732,   3991,   4250,   4509,   4768,   5026,   5284,   5541,   5798,   6055,   6311,
+   6567,   6822,   7077,   7331,   7584,   7838,   8090,   8342,   8594,   8844,   9094,   9344,   9593,   9841,  10088,  10335,
+  10581,  10826,  11071,  11315,  11558,  11800,  12041,  12281,  12521,  12760,  12997,  13234,  13470,  13705,  13939,  14172,
+  14404,  14635,  14865,  15094,  15322,  15549,  15775,  16000,  16223,  16446,  16667,  16887,  17106,  17324,  17541,  17756,
+  17970,  18183,  18395,  18605,  18814,  19022,  19229,  19434,  19638,  19840,  20041,  20241,  20439,  20636,  20832,  21026,
+  21218,  21410,  21599,  21787,  21974,  22159,  22343,  22525,  22706,  22885,  23062,  23238,  23413,  23585,  23756,  23926,
+  24094,  24260,  24424,  24587,  24749,  24908,  25066,  25222,  25376,  25529,  25680,  25829,  25976,  26122,  26266,  26408,
+  26548,  26687,  26823,  26958,  27091,  27223,  27352,  27479,  27605,  27729,  27851,  27971,  28089,  28205,  28319,  28431,
+  28542,  28650,  28757,  28862,  28964,  29065,  29164,  29261,  29355,  29448,  29539,  29628,  29715,  29800,  29882,  29963,
+  30042,  30119,  30194,  30267,  30337,  30406,  30473,  30537,  30600,  30660,  30719,  30775,  30829,  30881,  30932,  30980,
+  31026,  31070,  31112,  31151,  31189,  31225,  31258,  31290,  31319,  31346,  31371,  31394,  31415,  31434,  31451,  31466,
+  31478,  31489,  31497,  31503,  31507,  31509,  31509,  31507,  31503,  31497,  31488,  31478,  31465,  31450,  31434,  31415,
+  31394,  31371,  31346,  31318,  31289,  31258,  31224,  31189,  31151,  31112,  31070,  31026,  30980,  30932,  30882,  30831,
+  30777,  30721,  30662,  30602,  30540,  30476,  30410,  30342,  30272,  30200,  30125,  30049,  29971,  29891,  29809,  29725,
+  29639,  29551,  29461,  29370,  29276,  29180,  29083,  28983,  28882,  28778,  28673,  28566,  28457,  28346,  28234,  28119,
+  28003,  27885,  27765,  27643,  27519,  27394,  27267,  27138,  27007,  26874,  26740,  26604,  26466,  26326,  26185,  26042,
+  25898,  25751,  25603,  25453,  25302,  25149,  24994,  24838,  24680,  24521,  24360,  24197,  24033,  23867,  23700,  23531,
+  23360,  23188,  23015,  22840,  22664,  22486,  22306,  22125,  21943,  21760,  21575,  21388,  21200,  21011,  20821,  20629,
+  20435,  20241,  20045,  19848,  19649,  19450,  19249,  19046,  18843,  18638,  18433,  18226,  18017,  17808,  17598,  17386,
+  17173,  16959,  16744,  16528,  16311,  16093,  15874,  15654,  15433,  15211,  14988,  14763,  14538,  14313,  14086,  13858,
+  13629,  13400,  13169,  12938,  12706,  12474,  12240,  12006,  11770,  11535,  11298,  11061,  10823,  10584,  10345,  10104,
+   9864,   9623,   9381,   9138,   8895,   8652,   8407,   8163,   7918,   7672,   7426,   7179,   6932,   6685,   6437,   6189,
+   5940,   5691,   5442,   5192,   4942,   4691,   4441,   4190,   3939,   3688,   3436,   3184,   2932,   2680,   2428,   2175,
+   1923,   1670,   1418,   1165,    912,    659,    406,    153,    -99,   -352,   -604,   -857,  -1110,  -1362,  -1615,  -1867,
+  -2120,  -2372,  -2624,  -2875,  -3127,  -3378,  -3629,  -3880,  -4130,  -4381,  -4631,  -4880,  -5130,  -5378,  -5627,  -5875,
+  -6123,  -6370,  -6617,  -6864,  -7110,  -7355,  -7601,  -7845,  -8089,  -8333,  -8576,  -8818,  -9060,  -9301,  -9542,  -9782,
+ -10021, -10260, -10498, -10735, -10972, -11207, -11443, -11677, -11911, -12143, -12375, -12607, -12837, -13067, -13295, -13523,
+ -13750, -13976, -14201, -14426, -14649, -14871, -15093, -15313, -15533, -15751, -15968, -16185, -16400, -16614, -16827, -17040,
+ -17250, -17460, -17669, -17877, -18083, -18288, -18492, -18695, -18897, -19098, -19297, -19495, -19692, -19887, -20081, -20274,
+ -20466, -20656, -20845, -21033, -21219, -21404, -21587, -21770, -21950, -22130, -22308, -22484, -22659, -22833, -23005, -23176,
+ -23345, -23513, -23679, -23844, -24007, -24168, -24329, -24487, -24644, -24799, -24953, -25106, -25256, -25405, -25553, -25698,
+ -25843, -25985, -26126, -26265, -26403, -26539, -26673, -26805, -26936, -27065, -27192, -27318, -27442, -27564, -27684, -27803,
+ -27920, -28035, -28148, -28260, -28370, -28478, -28584, -28688, -28791, -28891, -28990, -29087, -29183, -29276, -29367, -29457,
+ -29545, -29631, -29715, -29797, -29877, -29956, -30032, -30107, -30180, -30251, -30320, -30387, -30452, -30515, -30576, -30636,
+ -30693, -30748, -30802, -30854, -30903, -30951, -30997, -31041, -31083, -31123, -31161, -31197, -31231, -31263, -31293, -31321,
+ -31348, -31372, -31394, -31414, -31433, -31449, -31464, -31476, -31487, -31495, -31502, -31506, -31509, -31510, -31508, -31505,
+ -31500, -31493, -31483, -31472, -31459, -31444, -31427, -31408, -31387, -31364, -31339, -31312, -31284, -31253, -31220, -31186,
+ -31149, -31111, -31070, -31028, -30984, -30937, -30889, -30839, -30787, -30733, -30677, -30620, -30560, -30499, -30435, -30370,
+ -30303, -30234, -30163, -30090, -30015, -29939, -29860, -29780, -29698, -29614, -29529, -29441, -29352, -29260, -29167, -29073,
+ -28976, -28878, -28777, -28675, -28572, -28466, -28359, -28250, -28139, -28027, -27912, -27796, -27679, -27559, -27438, -27316,
+ -27191, -27065, -26937, -26808, -26677, -26544, -26410, -26274, -26136, -25997, -25856, -25714, -25570, -25424, -25277, -25129,
+ -24978, -24827, -24673, -24519, -24362, -24205, -24045, -23885, -23723, -23559, -23394, -23227, -23060, -22890, -22720, -22547,
+ -22374, -22199, -22023, -21845, -21666, -21486, -21305, -21122, -20938, -20752, -20566, -20378, -20189, -19998, -19807, -19614,
+ -19420, -19225, -19028, -18831, -18632, -18433, -18232, -18030, -17827, -17622, -17417, -17211, -17004, -16795, -16586, -16375,
+ -16164, -15952, -15738, -15524, -15309, -15093, -14876, -14658, -14439, -14219, -13999, -13777, -13555, -13332, -13108, -12884,
+ -12658, -12432, -12205, -11978, -11749, -11520, -11290, -11060, -10829, -10597, -10365, -10132,  -9898,  -9664,  -9429,  -9194,
+  -8958,  -8722,  -8485,  -8247,  -8010,  -7771,  -7532,  -7293,  -7053,  -6813,  -6573,  -6332,  -6091,  -5849,  -5607,  -5365,
+  -5122,  -4879,  -4636,  -4393,  -4149,  -3905,  -3661,  -3416,  -3172,  -2927,  -2682,  -2437,  -2192,  -1947,  -1701,  -1456,
+  -1210,   -965,   -719,   -473,   -228,     17,    263,    508,    754,    999,   1245,   1490,   1735,   1981,   2226,   2470,
+   2715,   2960,   3204,   3448,   3692,   3936,   4179,   4422,   4665,   4907,   5150,   5391,   5633,   5874,   6115,   6355,
+   6595,   6835,   7074,   7313,   7551,   7789,   8026,   8263,   8499,   8735,   8970,   9205,   9439,   9673,   9906,  10138,
+  10370,  10601,  10831,  11061,  11290,  11518,  11746,  11972,  12199,  12424,  12649,  12872,  13096,  13318,  13539,  13760,
+  13980,  14199,  14417,  14634,  14850,  15065,  15280,  15493,  15706,  15917,  16128,  16338,  16546,  16754,  16960,  17166,
+  17371,  17574,  17776,  17978,  18178,  18377,  18575,  18772,  18968,  19162,  19355,  19548,  19739,  19929,  20117,  20305,
+  20491,  20676,  20859,  21042,  21223,  21403,  21581,  21759,  21934,  22109,  22282,  22454,  22625,  22794,  22962,  23128,
+  23293,  23457,  23619,  23780,  23939,  24097,  24254,  24408,  24562,  24714,  24865,  25014,  25161,  25307,  25452,  25595,
+  25736,  25876,  26014,  26151,  26286,  26420,  26552,  26682,  26811,  26938,  27064,  27188,  27310,  27431,  27550,  27667,
+  27783,  27897,  28009,  28120,  28229,  28336,  28442,  28546,  28648,  28748,  28847,  28944,  29040,  29133,  29225,  29315,
+  29403,  29490,  29575,  29658,  29739,  29819,  29896,  29972,  30046,  30119,  30189,  30258,  30325,  30390,  30453,  30515,
+  30575,  30632,  30688,  30743,  30795,  30846,  30894,  30941,  30986,  31029,  31071,  31110,  31148,  31184,  31217,  31250,
+  31280,  31308,  31335,  31359,  31382,  31403,  31422,  31439,  31454,  31468,  31479,  31489,  31497,  31503,  31507,  31509,
+  31510,  31508,  31505,  31499,  31492,  31483,  31472,  31460,  31445,  31429,  31411,  31390,  31368,  31345,  31319,  31291,
+  31262,  31231,  31197,  31163,  31126,  31087,  31047,  31004,  30960,  30914,  30867,  30817,  30766,  30712,  30657,  30600,
+  30542,  30481,  30419,  30355,  30289,  30222,  30152,  30081,  30008,  29933,  29857,  29779,  29699,  29617,  29534,  29448,
+  29362,  29273,  29183,  29090,  28997,  28901,  28804,  28705,  28605,  28502,  28398,  28293,  28186,  28077,  27966,  27854,
+  27740,  27625,  27508,  27389,  27269,  27147,  27023,  26898,  26772,  26644,  26514,  26383,  26250,  26115,  25980,  25842,
+  25703,  25563,  25421,  25278,  25133,  24986,  24839,  24689,  24539,  24386,  24233,  24078,  23922,  23764,  23605,  23444,
+  23282,  23119,  22955,  22789,  22622,  22453,  22283,  22112,  21940,  21766,  21591,  21415,  21237,  21058,  20879,  20697,
+  20515,  20332,  20147,  19961,  19774,  19586,  19396,  19206,  19015,  18822,  18628,  18433,  18237,  18041,  17843,  17644,
+  17443,  17242,  17040,  16837,  16633,  16429,  16223,  16016,  15808,  15599,  15390,  15179,  14968,  14756,  14543,  14329,
+  14114,  13899,  13683,  13465,  13248,  13029,  12810,  12590,  12369,  12147,  11925,  11702,  11478,  11254,  11029,  10804,
+  10578,  10351,  10124,   9896,   9667,   9438,   9209,   8979,   8748,   8517,   8286,   8054,   7821,   7588,   7355,   7121,
+   6887,   6652,   6418,   6182,   5947,   5711,   5474,   5238,   5001,   4764,   4526,   4289,   4051,   3813,   3574,   3336,
+   3097,   2858,   2619,   2380,   2141,   1902,   1662,   1423,   1183,    943,    703,    464,    224,    -15,   -255,   -494,
+   -734,   -974,  -1213,  -1453,  -1692,  -1932,  -2171,  -2410,  -2649,  -2887,  -3126,  -3364,  -3602,  -3840,  -4078,  -4315,
+  -4552,  -4789,  -5026,  -5262,  -5498,  -5734,  -5969,  -6204,  -6439,  -6673,  -6907,  -7140,  -7373,  -7605,  -7837,  -8069,
+  -8300,  -8531,  -8761,  -8990,  -9220,  -9448,  -9676,  -9903, -10130, -10356, -10582, -10807, -11031, -11255, -11478, -11701,
+ -11922, -12143, -12364, -12583, -12802, -13020, -13237, -13454, -13670, -13885, -14099, -14312, -14525, -14736, -14947, -15157,
+ -15366, -15574, -15781, -15988, -16193, -16397, -16601, -16803, -17005, -17206, -17405, -17604, -17801, -17998, -18193, -18388,
+ -18581, -18773, -18964, -19154, -19343, -19531, -19718, -19903, -20088, -20271, -20453, -20634, -20814, -20992, -21170, -21346,
+ -21521, -21694, -21867, -22038, -22207, -22376, -22543, -22709, -22874, -23037, -23199, -23360, -23519, -23677, -23834, -23989,
+ -24143, -24295, -24446, -24596, -24744, -24891, -25036, -25180, -25323, -25464, -25603, -25741, -25878, -26013, -26147, -26279,
+ -26410, -26539, -26666, -26792, -26917, -27040, -27161, -27281, -27400, -27516, -27632, -27745, -27857, -27968, -28076, -28184,
+ -28289, -28393, -28496, -28596, -28695, -28793, -28889, -28983, -29075, -29166, -29255, -29343, -29429, -29513, -29595, -29676,
+ -29755, -29832, -29908, -29982, -30054, -30125, -30194, -30261, -30326, -30390, -30452, -30512, -30570, -30627, -30682, -30735,
+ -30787, -30837, -30884, -30931, -30975, -31018, -31059, -31098, -31135, -31171, -31205, -31237, -31267, -31296, -31322, -31347,
+ -31370, -31392, -31411, -31429, -31445, -31460, -31472, -31483, -31492, -31499, -31504, -31508, -31509, -31509, -31508, -31504,
+ -31499, -31492, -31483, -31472, -31459, -31445, -31429, -31411, -31391, -31370, -31347, -31322, -31295, -31267, -31236, -31204,
+ -31171, -31135, -31098, -31059, -31018, -30975, -30931, -30885, -30837, -30788, -30736, -30683, -30628, -30572, -30514, -30454,
+ -30392, -30329, -30264, -30197, -30129, -30058, -29987, -29913, -29838, -29761, -29682, -29602, -29520, -29436, -29351, -29264,
+ -29176, -29085, -28994, -28900, -28805, -28708, -28610, -28510, -28409, -28306, -28201, -28095, -27987, -27877, -27766, -27654,
+ -27540, -27424, -27307, -27188, -27068, -26946, -26823, -26698, -26572, -26444, -26315, -26184, -26052, -25918, -25783, -25646,
+ -25508, -25369, -25228, -25086, -24942, -24797, -24651, -24503, -24354, -24203, -24051, -23898, -23744, -23588, -23431, -23272,
+ -23112, -22951, -22789, -22625, -22460, -22294, -22127, -21958, -21788, -21617, -21445, -21271, -21097, -20921, -20744, -20566,
+ -20386, -20206, -20024, -19842, -19658, -19473, -19287, -19100, -18912, -18723, -18532, -18341, -18149, -17956, -17762, -17566,
+ -17370, -17173, -16975, -16776, -16576, -16375, -16173, -15971, -15767, -15563, -15357, -15151, -14944, -14736, -14528, -14318,
+ -14108, -13897, -13685, -13473, -13259, -13045, -12831, -12615, -12399, -12182, -11965, -11747, -11528, -11309, -11089, -10868,
+ -10647, -10425, -10202,  -9980,  -9756,  -9532,  -9307,  -9082,  -8857,  -8631,  -8404,  -8177,  -7950,  -7722,  -7494,  -7265,
+  -7036,  -6807,  -6577,  -6347,  -6116,  -5885,  -5654,  -5423,  -5191,  -4959,  -4727,  -4494,  -4261,  -4028,  -3795,  -3562,
+  -3328,  -3094,  -2860,  -2626,  -2392,  -2157,  -1923,  -1688,  -1454,  -1219,   -984,   -749,   -515,   -280,    -45,    189,
+    424,    659,    894,   1128,   1363,   1597,   1832,   2066,   2300,   2535,   2768,   3002,   3236,   3469,   3702,   3935,
+   4168,   4401,   4633,   4865,   5097,   5328,   5559,   5790,   6020,   6250,   6480,   6709,   6938,   7167,   7395,   7623,
+   7850,   8077,   8304,   8530,   8755,   8980,   9205,   9429,   9652,   9875,  10097,  10319,  10540,  10761,  10981,  11200,
+  11419,  11637,  11854,  12071,  12287,  12503,  12717,  12931,  13145,  13357,  13569,  13780,  13990,  14200,  14409,  14616,
+  14824,  15030,  15235,  15440,  15643,  15846,  16048,  16249,  16449,  16648,  16847,  17044,  17241,  17436,  17630,  17824,
+  18016,  18208,  18398,  18588,  18776,  18964,  19150,  19335,  19519,  19702,  19884,  20065,  20245,  20424,  20601,  20778,
+  20953,  21127,  21300,  21472,  21642,  21812,  21980,  22147,  22312,  22477,  22640,  22802,  22963,  23122,  23280,  23437,
+  23593,  23747,  23900,  24051,  24202,  24351,  24498,  24645,  24789,  24933,  25075,  25216,  25355,  25493,  25630,  25765,
+  25899,  26031,  26162,  26291,  26419,  26546,  26671,  26794,  26916,  27037,  27156,  27274,  27390,  27505,  27618,  27729,
+  27839,  27948,  28055,  28160,  28264,  28367,  28468,  28567,  28664,  28761,  28855,  28948,  29039,  29129,  29217,  29304,
+  29389,  29472,  29554,  29634,  29712,  29789,  29864,  29938,  30010,  30080,  30148,  30215,  30281,  30344,  30406,  30467,
+  30525,  30582,  30637,  30691,  30743,  30793,  30842,  30889,  30934,  30977,  31019,  31059,  31098,  31134,  31169,  31203,
+  31234,  31264,  31292,  31319,  31343,  31366,  31388,  31407,  31425,  31441,  31456,  31469,  31480,  31489,  31496,  31502,
+  31506,  31509,  31510,  31509,  31506,  31501,  31495,  31487,  31478,  31466,  31453,  31439,  31422,  31404,  31384,  31363,
+  31339,  31314,  31287,  31259,  31229,  31197,  31164,  31128,  31091,  31053,  31013,  30971,  30927,  30882,  30835,  30786,
+  30736,  30683,  30630,  30574,  30517,  30459,  30398,  30336,  30273,  30207,  30140,  30072,  30002,  29930,  29856,  29781,
+  29705,  29626,  29547,  29465,  29382,  29297,  29211,  29123,  29034,  28943,  28850,  28756,  28660,  28563,  28464,  28364,
+  28262,  28159,  28054,  27947,  27839,  27730,  27619,  27506,  27392,  27277,  27160,  27042,  26922,  26801,  26678,  26554,
+  26428,  26301,  26173,  26043,  25911,  25779,  25645,  25509,  25372,  25234,  25095,  24954,  24811,  24668,  24523,  24377,
+  24229,  24080,  23930,  23779,  23626,  23472,  23317,  23160,  23002,  22843,  22683,  22522,  22359,  22195,  22030,  21864,
+  21696,  21528,  21358,  21187,  21015,  20842,  20667,  20492,  20316,  20138,  19959,  19780,  19599,  19417,  19234,  19050,
+  18865,  18679,  18492,  18304,  18115,  17925,  17735,  17543,  17350,  17156,  16962,  16766,  16570,  16373,  16174,  15975,
+  15775,  15575,  15373,  15171,  14968,  14764,  14559,  14353,  14147,  13940,  13732,  13524,  13314,  13104,  12894,  12682,
+  12470,  12258,  12044,  11830,  11616,  11400,  11185,  10968,  10751,  10533,  10315,  10097,   9877,   9658,   9437,   9217,
+   8995,   8774,   8551,   8329,   8106,   7882,   7658,   7434,   7209,   6984,   6759,   6533,   6307,   6080,   5853,   5626,
+   5399,   5171,   4943,   4715,   4487,   4258,   4029,   3800,   3571,   3341,   3111,   2882,   2652,   2422,   2191,   1961,
+   1731,   1500,   1270,   1039,    808,    577,    347,    116,   -114,   -345,   -575,   -806,  -1037,  -1267,  -1498,  -1728,
+  -1958,  -2188,  -2419,  -2648,  -2878,  -3108,  -3337,  -3566,  -3795,  -4024,  -4253,  -4481,  -4709,  -4937,  -5165,  -5392,
+  -5619,  -5846,  -6072,  -6298,  -6524,  -6749,  -6974,  -7199,  -7423,  -7647,  -7870,  -8093,  -8315,  -8538,  -8759,  -8980,
+  -9201,  -9421,  -9640,  -9860, -10078, -10296, -10514, -10730, -10947, -11162, -11377, -11592, -11806, -12019, -12231, -12443,
+ -12655, -12865, -13075, -13284, -13492, -13700, -13907, -14113, -14319, -14523, -14727, -14930, -15133, -15334, -15535, -15735,
+ -15934, -16132, -16329, -16525, -16721, -16915, -17109, -17302, -17493, -17684, -17874, -18063, -18251, -18438, -18624, -18809,
+ -18993, -19176, -19358, -19539, -19719, -19898, -20076, -20252, -20428, -20602, -20776, -20948, -21119, -21289, -21458, -21626,
+ -21793, -21958, -22122, -22285, -22447, -22608, -22767, -22926, -23083, -23238, -23393, -23546, -23698, -23849, -23999, -24147,
+ -24294, -24439, -24584, -24727, -24869, -25009, -25148, -25286, -25422, -25557, -25691, -25823, -25954, -26083, -26211, -26338,
+ -26464, -26587, -26710, -26831, -26951, -27069, -27186, -27301, -27415, -27527, -27638, -27748, -27856, -27962, -28067, -28171,
+ -28273, -28373, -28472, -28570, -28666, -28760, -28853, -28945, -29035, -29123, -29210, -29295, -29379, -29461, -29541, -29620,
+ -29698, -29774, -29848, -29921, -29992, -30061, -30129, -30196, -30260, -30323, -30385, -30445, -30503, -30560, -30615, -30668,
+ -30720, -30770, -30819, -30866, -30911, -30955, -30997, -31037, -31076, -31113, -31148, -31182, -31214, -31245, -31273, -31301,
+ -31326, -31350, -31372, -31393, -31412, -31429, -31444, -31458, -31471, -31481, -31490, -31497, -31503, -31507, -31509, -31510,
+ -31509, -31506, -31501, -31495, -31488, -31478, -31467, -31455, -31440, -31424, -31407, -31387, -31366, -31344, -31319, -31293,
+ -31266, -31237, -31206, -31173, -31139, -31103, -31066, -31027, -30986, -30944, -30900, -30854, -30807, -30758, -30708, -30656,
+ -30602, -30547, -30490, -30431, -30371, -30309, -30246, -30181, -30115, -30047, -29977, -29906, -29833, -29759, -29683, -29605,
+ -29526, -29446, -29364, -29280, -29195, -29108, -29020, -28930, -28839, -28746, -28652, -28556, -28458, -28360, -28259, -28157,
+ -28054, -27950, -27843, -27736, -27627, -27516, -27404, -27291, -27176, -27059, -26942, -26823, -26702, -26580, -26457, -26332,
+ -26206, -26079, -25950, -25820, -25688, -25555, -25421, -25286, -25149, -25011, -24871, -24730, -24588, -24445, -24300, -24154,
+ -24007, -23859, -23709, -23558, -23406, -23253, -23098, -22943, -22786, -22628, -22468, -22308, -22146, -21983, -21819, -21654,
+ -21488, -21321, -21152, -20983, -20812, -20640, -20467, -20294, -20119, -19943, -19766, -19588, -19408, -19228, -19047, -18865,
+ -18682, -18498, -18313, -18127, -17940, -17753, -17564, -17374, -17184, -16992, -16800, -16607, -16413, -16218, -16022, -15825,
+ -15628, -15430, -15231, -15031, -14831, -14629, -14427, -14224, -14021, -13816, -13611, -13406, -13199, -12992, -12784, -12576,
+ -12367, -12157, -11947, -11736, -11524, -11312, -11099, -10886, -10672, -10458, -10243, -10027,  -9811,  -9595,  -9378,  -9160,
+  -8942,  -8724,  -8505,  -8286,  -8066,  -7846,  -7625,  -7404,  -7183,  -6961,  -6739,  -6517,  -6294,  -6071,  -5848,  -5624,
+  -5400,  -5176,  -4952,  -4727,  -4502,  -4277,  -4051,  -3826,  -3600,  -3374,  -3148,  -2922,  -2695,  -2469,  -2242,  -2015,
+  -1788,  -1561,  -1334,  -1107,   -880,   -653,   -425,   -198,     28,    255,    483,    710,    937,   1164,   1391,   1618,
+   1845,   2072,   2298,   2525,   2751,   2977,   3203,   3429,   3655,   3880,   4106,   4331,   4556,   4780,   5005,   5229,
+   5452,   5676,   5899,   6122,   6345,   6567,   6789,   7010,   7231,   7452,   7672,   7892,   8112,   8331,   8550,   8768,
+   8986,   9203,   9420,   9636,   9852,  10067,  10282,  10496,  10710,  10923,  11136,  11347,  11559,  11770,  11980,  12189,
+  12398,  12606,  12814,  13021,  13227,  13432,  13637,  13841,  14045,  14247,  14449,  14650,  14851,  15050,  15249,  15447,
+  15644,  15841,  16036,  16231,  16425,  16618,  16810,  17001,  17192,  17381,  17570,  17758,  17944,  18130,  18315,  18499,
+  18682,  18864,  19045,  19225,  19404,  19582,  19759,  19935,  20110,  20284,  20457,  20628,  20799,  20969,  21137,  21305,
+  21471,  21636,  21800,  21963,  22125,  22286,  22445,  22604,  22761,  22917,  23072,  23225,  23378,  23529,  23679,  23828,
+  23975,  24121,  24266,  24410,  24553,  24694,  24834,  24972,  25110,  25246,  25381,  25514,  25646,  25777,  25906,  26035,
+  26161,  26287,  26411,  26534,  26655,  26775,  26894,  27011,  27126,  27241,  27354,  27465,  27576,  27684,  27792,  27897,
+  28002,  28105,  28206,  28306,  28405,  28502,  28598,  28692,  28785,  28876,  28966,  29054,  29141,  29226,  29310,  29392,
+  29473,  29552,  29629,  29706,  29780,  29853,  29925,  29995,  30063,  30130,  30196,  30259,  30322,  30382,  30441,  30499,
+  30555,  30609,  30662,  30713,  30763,  30811,  30858,  30903,  30946,  30988,  31028,  31066,  31103,  31139,  31172,  31205,
+  31235,  31264,  31291,  31317,  31341,  31364,  31385,  31404,  31422,  31438,  31452,  31465,  31476,  31486,  31494,  31500,
+  31505,  31508,  31509,  31509,  31508,  31504,  31499,  31493,  31485,  31475,  31463,  31450,  31436,  31420,  31402,  31382,
+  31361,  31338,  31314,  31288,  31261,  31232,  31201,  31169,  31135,  31099,  31062,  31024,  30983,  30942,  30898,  30853,
+  30807,  30758,  30709,  30657,  30604,  30550,  30494,  30436,  30377,  30317,  30254,  30191,  30125,  30059,  29990,  29920,
+  29849,  29776,  29701,  29625,  29548,  29469,  29388,  29306,  29223,  29138,  29051,  28963,  28874,  28783,  28690,  28597,
+  28501,  28404,  28306,  28206,  28105,  28003,  27899,  27793,  27687,  27578,  27469,  27358,  27245,  27131,  27016,  26900,
+  26782,  26662,  26542,  26420,  26296,  26172,  26046,  25918,  25790,  25660,  25528,  25396,  25262,  25127,  24990,  24852,
+  24713,  24573,  24432,  24289,  24145,  24000,  23853,  23706,  23557,  23407,  23256,  23103,  22950,  22795,  22639,  22482,
+  22324,  22164,  22004,  21842,  21680,  21516,  21351,  21185,  21018,  20850,  20681,  20511,  20340,  20167,  19994,  19820,
+  19644,  19468,  19291,  19113,  18933,  18753,  18572,  18390,  18207,  18023,  17838,  17652,  17466,  17278,  17090,  16901,
+  16710,  16519,  16328,  16135,  15942,  15747,  15552,  15357,  15160,  14963,  14764,  14566,  14366,  14166,  13965,  13763,
+  13561,  13357,  13154,  12949,  12744,  12538,  12332,  12125,  11917,  11709,  11500,  11291,  11081,  10871,  10660,  10448,
+  10236,  10023,   9810,   9597,   9382,   9168,   8953,   8737,   8521,   8305,   8088,   7871,   7654,   7436,   7217,   6999,
+   6780,   6560,   6341,   6121,   5900,   5680,   5459,   5238,   5017,   4795,   4573,   4351,   4129,   3906,   3683,   3460,
+   3237,   3014,   2791,   2567,   2344,   2120,   1896,   1672,   1448,   1224,   1000,    776,    551,    327,    103,   -120,
+   -345,   -569,   -793,  -1017,  -1241,  -1465,  -1689,  -1913,  -2137,  -2360,  -2584,  -2807,  -3030,  -3253,  -3476,  -3699,
+  -3921,  -4144,  -4366,  -4587,  -4809,  -5030,  -5251,  -5472,  -5693,  -5913,  -6133,  -6353,  -6572,  -6791,  -7009,  -7228,
+  -7446,  -7663,  -7880,  -8097,  -8313,  -8529,  -8744,  -8959,  -9174,  -9388,  -9602,  -9815, -10027, -10239, -10451, -10662,
+ -10872, -11082, -11291, -11500, -11708, -11916, -12123, -12329, -12535, -12740, -12944, -13148, -13351, -13554, -13756, -13957,
+ -14157, -14356, -14555, -14754, -14951, -15148, -15343, -15538, -15733, -15926, -16119, -16311, -16502, -16692, -16881, -17070,
+ -17257, -17444, -17630, -17815, -17999, -18182, -18365, -18546, -18726, -18906, -19084, -19262, -19438, -19614, -19788, -19962,
+ -20134, -20306, -20476, -20646, -20814, -20981, -21148, -21313, -21477, -21640, -21802, -21963, -22123, -22281, -22439, -22595,
+ -22751, -22905, -23058, -23209, -23360, -23509, -23658, -23805, -23950, -24095, -24238, -24381, -24522, -24661, -24800, -24937,
+ -25073, -25208, -25341, -25473, -25604, -25734, -25862, -25989, -26114, -26239, -26362, -26484, -26604, -26723, -26841, -26957,
+ -27072, -27186, -27298, -27409, -27518, -27626, -27733, -27838, -27942, -28045, -28146, -28245, -28344, -28440, -28536, -28630,
+ -28722, -28813, -28903, -28991, -29078, -29163, -29247, -29329, -29410, -29490, -29567, -29644, -29719, -29792, -29864, -29934,
+ -30003, -30071, -30137, -30201, -30264, -30325, -30385, -30444, -30500, -30556, -30609, -30661, -30712, -30761, -30809, -30855,
+ -30899, -30942, -30984, -31023, -31062, -31098, -31133, -31167, -31199, -31229, -31258, -31286, -31311, -31336, -31358, -31379,
+ -31399, -31417, -31433, -31448, -31461, -31473, -31483, -31491, -31498, -31503, -31507, -31509, -31510, -31509, -31506, -31502,
+ -31496, -31489, -31480, -31470, -31457, -31444, -31429, -31412, -31394, -31374, -31352, -31329, -31305, -31279, -31251, -31222,
+ -31191, -31158, -31124, -31089, -31052, -31013, -30973, -30931, -30888, -30843, -30797, -30749, -30700, -30649, -30596, -30542,
+ -30487, -30430, -30371, -30311, -30249, -30186, -30122, -30056, -29988, -29919, -29848, -29776, -29703, -29628, -29551, -29473,
+ -29394, -29313, -29230, -29147, -29061, -28975, -28886, -28797, -28706, -28613, -28519, -28424, -28327, -28229, -28129, -28028,
+ -27926, -27822, -27717, -27611, -27503, -27394, -27283, -27171, -27058, -26943, -26827, -26710, -26591, -26471, -26350, -26227,
+ -26103, -25978, -25851, -25724, -25595, -25464, -25333, -25200, -25066, -24930, -24794, -24656, -24517, -24377, -24235, -24092,
+ -23948, -23803, -23657, -23510, -23361, -23211, -23060, -22908, -22755, -22601, -22445, -22289, -22131, -21973, -21813, -21652,
+ -21490, -21327, -21163, -20997, -20831, -20664, -20496, -20327, -20156, -19985, -19813, -19639, -19465, -19290, -19114, -18937,
+ -18759, -18580, -18400, -18219, -18038, -17855, -17672, -17487, -17302, -17116, -16929, -16741, -16553, -16364, -16173, -15982,
+ -15791, -15598, -15405, -15211, -15016, -14820, -14624, -14427, -14229, -14031, -13832, -13632, -13432, -13230, -13029, -12826,
+ -12623, -12419, -12215, -12010, -11805, -11599, -11392, -11185, -10977, -10769, -10560, -10351, -10141,  -9931,  -9720,  -9509,
+  -9297,  -9085,  -8872,  -8659,  -8445,  -8231,  -8017,  -7802,  -7587,  -7372,  -7156,  -6940,  -6723,  -6506,  -6289,  -6072,
+  -5854,  -5636,  -5417,  -5199,  -4980,  -4761,  -4542,  -4322,  -4102,  -3882,  -3662,  -3442,  -3221,  -3001,  -2780,  -2559,
+  -2338,  -2117,  -1896,  -1674,  -1453,  -1232,  -1010,   -789,   -567,   -345,   -124,     97,    319,    540,    762,    983,
+   1205,   1426,   1648,   1869,   2090,   2311,   2532,   2753,   2973,   3194,   3414,   3634,   3854,   4074,   4294,   4513,
+   4732,   4951,   5170,   5388,   5606,   5824,   6041,   6259,   6476,   6692,   6908,   7124,   7340,   7555,   7770,   7984,
+   8198,   8412,   8625,   8838,   9050,   9262,   9473,   9684,   9895,  10105,  10314,  10523,  10731,  10939,  11147,  11353,
+  11560,  11765,  11970,  12175,  12378,  12582,  12784,  12986,  13188,  13388,  13588,  13788,  13986,  14184,  14381,  14578,
+  14774,  14969,  15163,  15357,  15549,  15741,  15933,  16123,  16313,  16502,  16690,  16877,  17063,  17249,  17434,  17617,
+  17800,  17982,  18164,  18344,  18523,  18702,  18879,  19056,  19231,  19406,  19580,  19753,  19924,  20095,  20265,  20434,
+  20602,  20768,  20934,  21099,  21262,  21425,  21587,  21747,  21907,  22065,  22222,  22378,  22533,  22687,  22840,  22992,
+  23142,  23292,  23440,  23587,  23733,  23878,  24021,  24164,  24305,  24445,  24584,  24722,  24858,  24993,  25127,  25260,
+  25391,  25521,  25650,  25778,  25904,  26029,  26153,  26276,  26397,  26517,  26636,  26753,  26869,  26984,  27097,  27209,
+  27320,  27429,  27537,  27644,  27749,  27853,  27956,  28057,  28157,  28255,  28352,  28448,  28542,  28635,  28726,  28816,
+  28905,  28992,  29078,  29162,  29245,  29327,  29407,  29485,  29562,  29638,  29712,  29785,  29856,  29926,  29994,  30061,
+  30127,  30190,  30253,  30314,  30373,  30431,  30488,  30543,  30596,  30648,  30699,  30748,  30795,  30841,  30886,  30929,
+  30970,  31010,  31048,  31085,  31120,  31154,  31186,  31217,  31246,  31274,  31300,  31325,  31348,  31369,  31389,  31408,
+  31425,  31440,  31454,  31466,  31477,  31486,  31494,  31500,  31505,  31508,  31509,  31509,  31508,  31505,  31500,  31494,
+  31486,  31477,  31466,  31454,  31440,  31424,  31407,  31389,  31369,  31347,  31324,  31300,  31273,  31246,  31216,  31186,
+  31153,  31120,  31084,  31047,  31009,  30969,  30928,  30885,  30841,  30795,  30747,  30698,  30648,  30596,  30543,  30488,
+  30431,  30373,  30314,  30253,  30191,  30127,  30062,  29995,  29927,  29857,  29786,  29714,  29640,  29564,  29487,  29409,
+  29329,  29248,  29165,  29081,  28996,  28909,  28821,  28731,  28640,  28547,  28454,  28358,  28262,  28164,  28064,  27963,
+  27861,  27758,  27653,  27547,  27439,  27330,  27220,  27109,  26996,  26882,  26766,  26649,  26531,  26412,  26291,  26170,
+  26046,  25922,  25796,  25669,  25541,  25411,  25281,  25149,  25016,  24881,  24746,  24609,  24471,  24332,  24191,  24050,
+  23907,  23763,  23618,  23472,  23325,  23177,  23027,  22876,  22724,  22572,  22418,  22263,  22106,  21949,  21791,  21632,
+  21471,  21310,  21147,  20984,  20819,  20654,  20487,  20320,  20151,  19982,  19811,  19640,  19467,  19294,  19120,  18945,
+  18768,  18591,  18414,  18235,  18055,  17875,  17693,  17511,  17328,  17144,  16959,  16773,  16587,  16400,  16212,  16023,
+  15833,  15643,  15452,  15260,  15067,  14874,  14680,  14485,  14290,  14094,  13897,  13699,  13501,  13303,  13103,  12903,
+  12702,  12501,  12299,  12097,  11894,  11690,  11486,  11281,  11076,  10870,  10663,  10456,  10249,  10041,   9833,   9624,
+   9415,   9205,   8995,   8784,   8573,   8362,   8150,   7937,   7725,   7512,   7298,   7085,   6871,   6656,   6442,   6227,
+   6011,   5796,   5580,   5364,   5147,   4931,   4714,   4497,   4279,   4062,   3844,   3626,   3408,   3190,   2971,   2753,
+   2534,   2316,   2097,   1878,   1659,   1440,   1220,   1001,    782,    563,    343,    124,    -95,   -314,   -533,   -753,
+   -972,  -1191,  -1410,  -1629,  -1848,  -2067,  -2286,  -2505,  -2723,  -2941,  -3160,  -3378,  -3596,  -3814,  -4031,  -4248,
+  -4466,  -4683,  -4899,  -5116,  -5332,  -5548,  -5764,  -5979,  -6194,  -6409,  -6623,  -6837,  -7051,  -7265,  -7478,  -7691,
+  -7903,  -8115,  -8327,  -8538,  -8748,  -8959,  -9169,  -9378,  -9587,  -9796, -10004, -10211, -10418, -10625, -10831, -11036,
+ -11241, -11446, -11650, -11853, -12056, -12258, -12459, -12660, -12861, -13060, -13259, -13458, -13655, -13852, -14049, -14245,
+ -14440, -14634, -14828, -15020, -15213, -15404, -15595, -15785, -15974, -16162, -16350, -16537, -16723, -16908, -17092, -17276,
+ -17458, -17640, -17821, -18001, -18181, -18359, -18537, -18713, -18889, -19064, -19237, -19410, -19582, -19753, -19923, -20093,
+ -20261, -20428, -20594, -20759, -20923, -21086, -21249, -21410, -21570, -21729, -21887, -22044, -22199, -22354, -22508, -22660,
+ -22812, -22962, -23112, -23260, -23407, -23553, -23697, -23841, -23984, -24125, -24265, -24404, -24542, -24678, -24814, -24948,
+ -25081, -25213, -25343, -25473, -25601, -25728, -25854, -25978, -26101, -26223, -26344, -26463, -26581, -26698, -26813, -26928,
+ -27040, -27152, -27262, -27371, -27479, -27585, -27690, -27794, -27896, -27997, -28097, -28195, -28292, -28388, -28482, -28575,
+ -28666, -28756, -28845, -28932, -29018, -29103, -29186, -29267, -29348, -29426, -29504, -29580, -29654, -29728, -29799, -29870,
+ -29939, -30006, -30072, -30136, -30200, -30261, -30321, -30380, -30437, -30493, -30547, -30600, -30652, -30702, -30750, -30797,
+ -30842, -30886, -30929, -30970, -31009, -31047, -31084, -31119, -31152, -31185, -31215, -31244, -31272, -31298, -31322, -31345,
+ -31367, -31387, -31405, -31422, -31438, -31452, -31464, -31475, -31485, -31493, -31499, -31504, -31507, -31509, -31510, -31508,
+ -31506, -31502, -31496, -31489, -31480, -31470, -31458, -31445, -31430, -31414, -31396, -31377, -31356, -31334, -31310, -31285,
+ -31258, -31230, -31200, -31169, -31136, -31102, -31066, -31029, -30990, -30950, -30908, -30865, -30820, -30774, -30727, -30678,
+ -30627, -30575, -30522, -30467, -30410, -30352, -30293, -30232, -30170, -30106, -30041, -29975, -29907, -29838, -29767, -29694,
+ -29621, -29546, -29469, -29391, -29312, -29231, -29149, -29066, -28981, -28894, -28807, -28718, -28627, -28535, -28442, -28348,
+ -28252, -28155, -28056, -27956, -27855, -27752, -27649, -27543, -27437, -27329, -27220, -27109, -26998, -26884, -26770, -26655,
+ -26538, -26420, -26300, -26179, -26058, -25934, -25810, -25684, -25557, -25429, -25300, -25170, -25038, -24905, -24771, -24636,
+ -24499, -24362, -24223, -24083, -23942, -23800, -23656, -23512, -23366, -23219, -23072, -22923, -22773, -22622, -22469, -22316,
+ -22162, -22006, -21850, -21693, -21534, -21375, -21214, -21053, -20890, -20726, -20562, -20396, -20230, -20062, -19894, -19725,
+ -19554, -19383, -19211, -19038, -18864, -18689, -18513, -18337, -18159, -17981, -17802, -17622, -17441, -17259, -17077, -16893,
+ -16709, -16524, -16338, -16152, -15964, -15776, -15588, -15398, -15208, -15017, -14825, -14633, -14440, -14246, -14051, -13856,
+ -13661, -13464, -13267, -13069, -12871, -12672, -12473, -12272, -12072, -11870, -11669, -11466, -11263, -11060, -10856, -10651,
+ -10446, -10241, -10035,  -9828,  -9622,  -9414,  -9206,  -8998,  -8789,  -8580,  -8371,  -8161,  -7951,  -7740,  -7529,  -7318,
+  -7106,  -6894,  -6681,  -6469,  -6256,  -6042,  -5829,  -5615,  -5401,  -5187,  -4972,  -4757,  -4542,  -4327,  -4111,  -3896,
+  -3680,  -3464,  -3248,  -3031,  -2815,  -2598,  -2382,  -2165,  -1948,  -1731,  -1514,  -1296,  -1079,   -862,   -645,   -427,
+   -210,      6,    224,    441,    658,    876,   1093,   1310,   1527,   1744,   1961,   2178,   2395,   2611,   2828,   3044,
+   3260,   3476,   3692,   3908,   4123,   4339,   4554,   4769,   4983,   5198,   5412,   5626,   5839,   6053,   6266,   6479,
+   6691,   6903,   7115,   7326,   7537,   7748,   7958,   8168,   8378,   8587,   8796,   9004,   9212,   9420,   9627,   9833,
+  10039,  10245,  10450,  10655,  10859,  11062,  11265,  11468,  11670,  11871,  12072,  12272,  12472,  12671,  12869,  13067,
+  13265,  13461,  13657,  13852,  14047,  14241,  14434,  14627,  14819,  15010,  15201,  15390,  15579,  15768,  15955,  16142,
+  16328,  16513,  16698,  16881,  17064,  17246,  17427,  17608,  17787,  17966,  18144,  18321,  18497,  18672,  18846,  19020,
+  19192,  19364,  19535,  19704,  19873,  20041,  20208,  20374,  20539,  20703,  20866,  21028,  21189,  21349,  21508,  21666,
+  21823,  21979,  22134,  22288,  22441,  22592,  22743,  22893,  23041,  23188,  23335,  23480,  23624,  23767,  23909,  24049,
+  24189,  24327,  24464,  24601,  24735,  24869,  25002,  25133,  25263,  25392,  25520,  25647,  25772,  25896,  26019,  26141,
+  26261,  26380,  26498,  26615,  26730,  26844,  26957,  27069,  27179,  27288,  27396,  27502,  27607,  27711,  27814,  27915,
+  28015,  28113,  28210,  28306,  28401,  28494,  28586,  28676,  28765,  28853,  28940,  29025,  29108,  29190,  29271,  29351,
+  29429,  29506,  29581,  29655,  29727,  29799,  29868,  29937,  30003,  30069,  30133,  30196,  30257,  30317,  30375,  30432,
+  30487,  30541,  30594,  30645,  30695,  30743,  30789,  30835,  30879,  30921,  30962,  31001,  31039,  31076,  31111,  31145,
+  31177,  31207,  31237,  31264,  31291,  31315,  31339,  31360,  31381,  31399,  31417,  31433,  31447,  31460,  31471,  31481,
+  31490,  31497,  31502,  31506,  31509,  31510,  31509,  31507,  31504,  31499,  31492,  31484,  31475,  31464,  31452,  31438,
+  31423,  31406,  31387,  31368,  31346,  31324,  31300,  31274,  31247,  31218,  31188,  31156,  31123,  31089,  31053,  31015,
+  30977,  30936,  30894,  30851,  30806,  30760,  30713,  30664,  30613,  30561,  30508,  30453,  30397,  30339,  30280,  30219,
+  30157,  30094,  30029,  29963,  29895,  29826,  29756,  29684,  29611,  29536,  29460,  29383,  29304,  29224,  29142,  29059,
+  28975,  28889,  28802,  28714,  28624,  28533,  28441,  28347,  28252,  28156,  28058,  27959,  27859,  27757,  27654,  27550,
+  27444,  27337,  27229,  27120,  27009,  26897,  26784,  26669,  26554,  26437,  26319,  26199,  26078,  25956,  25833,  25709,
+  25583,  25457,  25329,  25200,  25069,  24938,  24805,  24671,  24536,  24400,  24263,  24125,  23985,  23844,  23703,  23560,
+  23416,  23271,  23124,  22977,  22829,  22679,  22529,  22377,  22225,  22071,  21916,  21761,  21604,  21446,  21288,  21128,
+  20967,  20805,  20643,  20479,  20314,  20149,  19982,  19815,  19647,  19477,  19307,  19136,  18964,  18791,  18617,  18443,
+  18267,  18091,  17914,  17736,  17557,  17377,  17197,  17015,  16833,  16650,  16467,  16282,  16097,  15911,  15724,  15537,
+  15349,  15160,  14970,  14780,  14589,  14398,  14205,  14012,  13819,  13624,  13429,  13234,  13038,  12841,  12644,  12446,
+  12247,  12048,  11848,  11648,  11447,  11246,  11044,  10842,  10639,  10436,  10232,  10028,   9823,   9618,   9412,   9206,
+   8999,   8792,   8585,   8377,   8169,   7961,   7752,   7542,   7333,   7123,   6913,   6702,   6491,   6280,   6068,   5857,
+   5645,   5432,   5220,   5007,   4794,   4581,   4367,   4153,   3940,   3726,   3511,   3297,   3082,   2868,   2653,   2438,
+   2223,   2008,   1793,   1577,   1362,   1147,    931,    716,    500,    285,     69,   -146,   -361,   -577,   -792,  -1008,
+  -1223,  -1439,  -1654,  -1869,  -2084,  -2299,  -2514,  -2729,  -2943,  -3158,  -3372,  -3587,  -3801,  -4014,  -4228,  -4442,
+  -4655,  -4868,  -5081,  -5293,  -5505,  -5717,  -5929,  -6141,  -6352,  -6563,  -6773,  -6984,  -7194,  -7403,  -7612,  -7821,
+  -8030,  -8238,  -8446,  -8653,  -8860,  -9066,  -9273,  -9478,  -9683,  -9888, -10092, -10296, -10500, -10702, -10905, -11107,
+ -11308, -11509, -11709, -11909, -12108, -12306, -12504, -12702, -12898, -13095, -13290, -13485, -13679, -13873, -14066, -14258,
+ -14450, -14641, -14831, -15021, -15210, -15398, -15586, -15772, -15958, -16144, -16328, -16512, -16695, -16877, -17058, -17239,
+ -17419, -17598, -17776, -17953, -18130, -18305, -18480, -18654, -18827, -18999, -19171, -19341, -19510, -19679, -19846, -20013,
+ -20179, -20344, -20508, -20671, -20832, -20993, -21153, -21312, -21470, -21627, -21783, -21938, -22092, -22245, -22397, -22548,
+ -22698, -22846, -22994, -23141, -23286, -23430, -23574, -23716, -23857, -23997, -24136, -24274, -24410, -24546, -24680, -24813,
+ -24945, -25076, -25206, -25334, -25461, -25587, -25712, -25836, -25959, -26080, -26200, -26319, -26436, -26553, -26668, -26782,
+ -26895, -27006, -27116, -27225, -27333, -27439, -27544, -27648, -27750, -27852, -27951, -28050, -28147, -28243, -28338, -28431,
+ -28523, -28614, -28703, -28791, -28878, -28963, -29047, -29130, -29211, -29291, -29370, -29447, -29523, -29597, -29670, -29742,
+ -29812, -29881, -29949, -30015, -30079, -30143, -30205, -30265, -30324, -30382, -30438, -30493, -30546, -30598, -30649, -30698,
+ -30746, -30792, -30837, -30881, -30923, -30963, -31002, -31040, -31076, -31111, -31144, -31176, -31207, -31236, -31263, -31289,
+ -31314, -31337, -31359, -31379, -31398, -31415, -31431, -31446, -31459, -31470, -31480, -31489, -31496, -31501, -31506, -31508,
+ -31510, -31509, -31508, -31505, -31500, -31494, -31486, -31477, -31467, -31455, -31442, -31427, -31411, -31393, -31374, -31353,
+ -31331, -31307, -31282, -31256, -31228, -31199, -31168, -31135, -31102, -31067, -31030, -30992, -30952, -30912, -30869, -30825,
+ -30780, -30734, -30686, -30636, -30585, -30533, -30479, -30424, -30367, -30309, -30250, -30189, -30127, -30063, -29999, -29932,
+ -29864, -29795, -29725, -29653, -29580, -29505, -29429, -29352, -29273, -29193, -29111, -29029, -28945, -28859, -28772, -28684,
+ -28595, -28504, -28412, -28318, -28224, -28128, -28030, -27932, -27832, -27730, -27628, -27524, -27419, -27313, -27205, -27096,
+ -26986, -26875, -26762, -26648, -26533, -26417, -26300, -26181, -26061, -25940, -25817, -25694, -25569, -25443, -25316, -25188,
+ -25058, -24928, -24796, -24663, -24529, -24394, -24258, -24120, -23982, -23842, -23701, -23560, -23417, -23273, -23128, -22982,
+ -22834, -22686, -22537, -22386, -22235, -22083, -21929, -21775, -21619, -21463, -21305, -21147, -20988, -20827, -20666, -20504,
+ -20340, -20176, -20011, -19845, -19678, -19510, -19342, -19172, -19002, -18830, -18658, -18485, -18311, -18136, -17960, -17784,
+ -17607, -17428, -17250, -17070, -16889, -16708, -16526, -16343, -16160, -15975, -15790, -15605, -15418, -15231, -15043, -14854,
+ -14665, -14475, -14285, -14093, -13901, -13709, -13516, -13322, -13127, -12932, -12737, -12541, -12344, -12147, -11949, -11750,
+ -11551, -11352, -11152, -10951, -10750, -10548, -10346, -10144,  -9941,  -9737,  -9534,  -9329,  -9124,  -8919,  -8714,  -8508,
+  -8301,  -8095,  -7888,  -7680,  -7472,  -7264,  -7056,  -6847,  -6638,  -6428,  -6218,  -6008,  -5798,  -5588,  -5377,  -5166,
+  -4954,  -4743,  -4531,  -4319,  -4107,  -3895,  -3682,  -3470,  -3257,  -3044,  -2831,  -2618,  -2404,  -2191,  -1977,  -1764,
+  -1550,  -1336,  -1122,   -908,   -694,   -480,   -266,    -52,    161,    375,    589,    803,   1016,   1230,   1444,   1658,
+   1871,   2085,   2298,   2512,   2725,   2938,   3151,   3364,   3576,   3789,   4001,   4213,   4425,   4637,   4848,   5060,
+   5271,   5481,   5692,   5902,   6112,   6322,   6531,   6740,   6949,   7158,   7366,   7573,   7781,   7988,   8195,   8401,
+   8607,   8812,   9018,   9222,   9426,   9630,   9834,  10037,  10239,  10441,  10643,  10844,  11044,  11244,  11444,  11643,
+  11841,  12039,  12236,  12433,  12629,  12825,  13020,  13214,  13408,  13601,  13793,  13985,  14177,  14367,  14557,  14746,
+  14935,  15123,  15310,  15496,  15682,  15867,  16051,  16235,  16418,  16600,  16781,  16962,  17141,  17320,  17498,  17676,
+  17852,  18028,  18203,  18377,  18550,  18722,  18894,  19064,  19234,  19403,  19571,  19738,  19904,  20069,  20233,  20397,
+  20559,  20720,  20881,  21040,  21199,  21357,  21513,  21669,  21823,  21977,  22130,  22281,  22432,  22581,  22730,  22877,
+  23023,  23169,  23313,  23456,  23598,  23739,  23879,  24018,  24156,  24292,  24428,  24562,  24695,  24827,  24958,  25088,
+  25217,  25344,  25470,  25596,  25719,  25842,  25964,  26084,  26203,  26321,  26438,  26554,  26668,  26781,  26893,  27004,
+  27113,  27221,  27328,  27434,  27538,  27641,  27743,  27844,  27943,  28041,  28138,  28233,  28327,  28420,  28512,  28602,
+  28691,  28778,  28865,  28950,  29033,  29116,  29196,  29276,  29354,  29431,  29507,  29581,  29654,  29725,  29795,  29864,
+  29932,  29998,  30062,  30125,  30187,  30248,  30307,  30365,  30421,  30476,  30529,  30581,  30632,  30681,  30729,  30776,
+  30821,  30864,  30907,  30948,  30987,  31025,  31062,  31097,  31130,  31163,  31194,  31223,  31251,  31277,  31303,  31326,
+  31349,  31369,  31389,  31407,  31423,  31438,  31452,  31464,  31475,  31484,  31492,  31498,  31503,  31507,  31509,  31510,
+  31509,  31507,  31503,  31498,  31491,  31483,  31474,  31463,  31450,  31437,  31421,  31405,  31387,  31367,  31346,  31324,
+  31300,  31275,  31248,  31220,  31190,  31159,  31127,  31093,  31058,  31021,  30983,  30943,  30902,  30860,  30816,  30771,
+  30725,  30677,  30627,  30576,  30524,  30471,  30416,  30359,  30302,  30242,  30182,  30120,  30057,  29992,  29926,  29859,
+  29790,  29720,  29648,  29575,  29501,  29426,  29349,  29271,  29191,  29110,  29028,  28944,  28859,  28773,  28686,  28597,
+  28507,  28415,  28323,  28229,  28133,  28037,  27939,  27840,  27739,  27638,  27535,  27431,  27325,  27218,  27110,  27001,
+  26891,  26779,  26666,  26552,  26437,  26320,  26203,  26084,  25964,  25842,  25720,  25596,  25472,  25346,  25218,  25090,
+  24961,  24830,  24699,  24566,  24432,  24297,  24161,  24023,  23885,  23746,  23605,  23464,  23321,  23177,  23032,  22887,
+  22740,  22592,  22443,  22293,  22142,  21990,  21837,  21683,  21528,  21372,  21215,  21057,  20898,  20739,  20578,  20416,
+  20254,  20090,  19926,  19760,  19594,  19427,  19259,  19090,  18920,  18749,  18578,  18406,  18232,  18058,  17884,  17708,
+  17532,  17354,  17176,  16997,  16818,  16638,  16456,  16275,  16092,  15909,  15725,  15540,  15354,  15168,  14981,  14794,
+  14606,  14417,  14227,  14037,  13846,  13655,  13463,  13270,  13077,  12883,  12688,  12493,  12298,  12102,  11905,  11708,
+  11510,  11312,  11113,  10914,  10714,  10514,  10313,  10112,   9910,   9708,   9505,   9302,   9099,   8895,   8691,   8486,
+   8281,   8076,   7870,   7664,   7457,   7250,   7043,   6836,   6628,   6420,   6212,   6003,   5794,   5585,   5376,   5166,
+   4956,   4746,   4536,   4325,   4114,   3903,   3692,   3481,   3270,   3058,   2847,   2635,   2423,   2211,   1999,   1786,
+   1574,   1362,   1149,    937,    724,    512,    299,     87,   -125,   -337,   -550,   -763,   -975,  -1187,  -1400,  -1612,
+  -1824,  -2037,  -2249,  -2461,  -2672,  -2884,  -3096,  -3307,  -3518,  -3729,  -3940,  -4151,  -4362,  -4572,  -4782,  -4992,
+  -5202,  -5411,  -5621,  -5830,  -6038,  -6247,  -6455,  -6663,  -6870,  -7077,  -7284,  -7491,  -7697,  -7903,  -8108,  -8313,
+  -8518,  -8723,  -8926,  -9130,  -9333,  -9536,  -9738,  -9940, -10141, -10342, -10543, -10743, -10942, -11141, -11339, -11537,
+ -11735, -11932, -12128, -12324, -12519, -12713, -12908, -13101, -13294, -13486, -13678, -13869, -14059, -14249, -14438, -14626,
+ -14814, -15001, -15188, -15373, -15558, -15743, -15926, -16109, -16291, -16473, -16653, -16833, -17012, -17191, -17368, -17545,
+ -17721, -17896, -18070, -18244, -18417, -18588, -18759, -18930, -19099, -19267, -19435, -19601, -19767, -19932, -20096, -20259,
+ -20421, -20582, -20743, -20902, -21060, -21218, -21374, -21530, -21684, -21838, -21990, -22142, -22292, -22442, -22590, -22738,
+ -22884, -23029, -23174, -23317, -23459, -23600, -23740, -23879, -24017, -24154, -24290, -24424, -24558, -24690, -24822, -24952,
+ -25081, -25209, -25335, -25461, -25585, -25709, -25831, -25952, -26071, -26190, -26307, -26424, -26539, -26652, -26765, -26876,
+ -26986, -27095, -27203, -27309, -27415, -27518, -27621, -27723, -27823, -27922, -28019, -28116, -28211, -28305, -28397, -28489,
+ -28579, -28667, -28755, -28841, -28925, -29009, -29091, -29172, -29251, -29330, -29406, -29482, -29556, -29629, -29700, -29771,
+ -29839, -29907, -29973, -30038, -30101, -30163, -30224, -30283, -30341, -30397, -30453, -30506, -30559, -30610, -30659, -30708,
+ -30754, -30800, -30844, -30887, -30928, -30968, -31006, -31043, -31079, -31113, -31146, -31177, -31207, -31236, -31263, -31289,
+ -31313, -31336, -31358, -31378, -31396, -31414, -31429, -31444, -31457, -31468, -31478, -31487, -31495, -31500, -31505, -31508,
+ -31509, -31510, -31508, -31506, -31502, -31496, -31489, -31481, -31471, -31460, -31447, -31433, -31417, -31400, -31382, -31362,
+ -31341, -31319, -31295, -31269, -31242, -31214, -31184, -31153, -31121, -31087, -31052, -31015, -30977, -30937, -30897, -30854,
+ -30811, -30766, -30719, -30671, -30622, -30571, -30519, -30466, -30411, -30355, -30298, -30239, -30179, -30117, -30054, -29990,
+ -29924, -29857, -29789, -29719, -29648, -29576, -29502, -29427, -29350, -29273, -29194, -29113, -29032, -28949, -28864, -28779,
+ -28692, -28604, -28514, -28424, -28332, -28238, -28144, -28048, -27951, -27852, -27753, -27652, -27550, -27446, -27342, -27236,
+ -27129, -27020, -26911, -26800, -26688, -26575, -26461, -26345, -26229, -26111, -25992, -25871, -25750, -25627, -25504, -25379,
+ -25253, -25126, -24997, -24868, -24737, -24606, -24473, -24339, -24204, -24068, -23931, -23793, -23653, -23513, -23372, -23229,
+ -23086, -22941, -22796, -22649, -22501, -22353, -22203, -22052, -21901, -21748, -21595, -21440, -21284, -21128, -20970, -20812,
+ -20653, -20493, -20331, -20169, -20006, -19842, -19678, -19512, -19345, -19178, -19010, -18840, -18671, -18500, -18328, -18156,
+ -17982, -17808, -17633, -17458, -17281, -17104, -16926, -16747, -16567, -16387, -16206, -16024, -15842, -15659, -15475, -15290,
+ -15105, -14919, -14732, -14545, -14357, -14169, -13979, -13790, -13599, -13408, -13216, -13024, -12831, -12638, -12444, -12249,
+ -12054, -11859, -11663, -11466, -11269, -11071, -10873, -10674, -10475, -10275, -10075,  -9875,  -9674,  -9472,  -9270,  -9068,
+  -8865,  -8662,  -8459,  -8255,  -8051,  -7846,  -7641,  -7436,  -7231,  -7025,  -6818,  -6612,  -6405,  -6198,  -5991,  -5783,
+  -5575,  -5367,  -5159,  -4950,  -4741,  -4532,  -4323,  -4113,  -3904,  -3694,  -3484,  -3274,  -3064,  -2853,  -2643,  -2432,
+  -2221,  -2010,  -1799,  -1588,  -1377,  -1166,   -955,   -744,   -533,   -321,   -110,    100,    312,    523,    734,    945,
+   1157,   1368,   1579,   1790,   2001,   2211,   2422,   2633,   2843,   3053,   3264,   3474,   3684,   3893,   4103,   4312,
+   4521,   4730,   4939,   5147,   5356,   5564,   5772,   5979,   6186,   6393,   6600,   6806,   7012,   7218,   7424,   7629,
+   7833,   8038,   8242,   8446,   8649,   8852,   9054,   9256,   9458,   9659,   9860,  10060,  10260,  10460,  10658,  10857,
+  11055,  11252,  11449,  11646,  11842,  12037,  12232,  12426,  12620,  12813,  13006,  13198,  13389,  13580,  13770,  13960,
+  14149,  14337,  14525,  14712,  14898,  15084,  15269,  15453,  15637,  15820,  16002,  16183,  16364,  16544,  16723,  16902,
+  17080,  17257,  17433,  17608,  17783,  17957,  18130,  18302,  18473,  18644,  18814,  18983,  19151,  19318,  19484,  19650,
+  19814,  19978,  20140,  20302,  20463,  20623,  20782,  20940,  21098,  21254,  21409,  21564,  21717,  21869,  22021,  22171,
+  22321,  22469,  22616,  22763,  22908,  23053,  23196,  23338,  23479,  23620,  23759,  23897,  24034,  24170,  24304,  24438,
+  24571,  24702,  24833,  24962,  25090,  25217,  25343,  25468,  25591,  25714,  25835,  25955,  26074,  26192,  26309,  26424,
+  26539,  26652,  26764,  26874,  26984,  27092,  27199,  27305,  27410,  27513,  27615,  27716,  27816,  27914,  28012,  28108,
+  28202,  28296,  28388,  28479,  28568,  28657,  28744,  28829,  28914,  28997,  29079,  29159,  29239,  29317,  29393,  29469,
+  29543,  29615,  29687,  29757,  29825,  29893,  29959,  30023,  30087,  30148,  30209,  30268,  30326,  30383,  30438,  30492,
+  30544,  30595,  30645,  30693,  30740,  30786,  30830,  30873,  30915,  30955,  30993,  31031,  31067,  31101,  31134,  31166,
+  31196,  31225,  31253,  31279,  31304,  31327,  31349,  31370,  31389,  31406,  31423,  31438,  31451,  31463,  31474,  31483,
+  31491,  31498,  31503,  31506,  31509,  31510,  31509,  31507,  31504,  31499,  31493,  31485,  31476,  31466,  31454,  31441,
+  31426,  31410,  31393,  31374,  31353,  31332,  31309,  31284,  31258,  31231,  31203,  31173,  31141,  31108,  31074,  31039,
+  31002,  30963,  30923,  30882,  30840,  30796,  30751,  30704,  30656,  30607,  30556,  30504,  30450,  30395,  30339,  30282,
+  30223,  30163,  30101,  30038,  29974,  29908,  29841,  29773,  29703,  29632,  29560,  29487,  29412,  29336,  29258,  29179,
+  29099,  29018,  28935,  28851,  28766,  28679,  28591,  28502,  28412,  28320,  28227,  28133,  28037,  27941,  27843,  27744,
+  27643,  27542,  27439,  27335,  27229,  27123,  27015,  26906,  26796,  26684,  26572,  26458,  26343,  26227,  26110,  25992,
+  25872,  25751,  25629,  25506,  25382,  25257,  25131,  25003,  24874,  24745,  24614,  24482,  24349,  24215,  24080,  23943,
+  23806,  23668,  23528,  23388,  23246,  23103,  22960,  22815,  22670,  22523,  22375,  22227,  22077,  21926,  21775,  21622,
+  21469,  21314,  21159,  21002,  20845,  20687,  20528,  20368,  20207,  20045,  19882,  19718,  19554,  19388,  19222,  19055,
+  18887,  18718,  18549,  18378,  18207,  18035,  17862,  17688,  17514,  17338,  17162,  16986,  16808,  16630,  16451,  16271,
+  16091,  15909,  15728,  15545,  15362,  15178,  14993,  14808,  14622,  14435,  14248,  14060,  13871,  13682,  13493,  13302,
+  13111,  12920,  12728,  12535,  12342,  12148,  11954,  11759,  11564,  11368,  11171,  10975,  10777,  10579,  10381,  10182,
+   9983,   9784,   9584,   9383,   9182,   8981,   8779,   8577,   8374,   8172,   7968,   7765,   7561,   7357,   7152,   6947,
+   6742,   6537,   6331,   6125,   5918,   5712,   5505,   5298,   5090,   4883,   4675,   4467,   4259,   4051,   3842,   3633,
+   3425,   3216,   3006,   2797,   2588,   2378,   2169,   1959,   1749,   1539,   1329,   1119,    909,    699,    489,    279,
+     69,   -140,   -350,   -561,   -771,   -981,  -1191,  -1401,  -1611,  -1820,  -2030,  -2240,  -2449,  -2659,  -2868,  -3077,
+  -3286,  -3495,  -3704,  -3912,  -4121,  -4329,  -4537,  -4745,  -4952,  -5160,  -5367,  -5574,  -5780,  -5987,  -6193,  -6399,
+  -6604,  -6809,  -7014,  -7219,  -7423,  -7627,  -7831,  -8034,  -8237,  -8440,  -8642,  -8844,  -9045,  -9246,  -9447,  -9647,
+  -9846, -10046, -10245, -10443, -10641, -10838, -11035, -11232, -11428, -11623, -11818, -12013, -12206, -12400, -12593, -12785,
+ -12976, -13167, -13358, -13548, -13737, -13926, -14114, -14301, -14488, -14674, -14860, -15044, -15229, -15412, -15595, -15777,
+ -15958, -16139, -16319, -16498, -16677, -16854, -17031, -17208, -17383, -17558, -17732, -17905, -18077, -18249, -18420, -18589,
+ -18759, -18927, -19094, -19261, -19426, -19591, -19755, -19918, -20081, -20242, -20402, -20562, -20720, -20878, -21035, -21191,
+ -21345, -21499, -21652, -21804, -21955, -22105, -22254, -22402, -22550, -22696, -22841, -22985, -23128, -23270, -23411, -23551,
+ -23690, -23827, -23964, -24100, -24235, -24368, -24501, -24632, -24762, -24892, -25020, -25147, -25273, -25397, -25521, -25643,
+ -25765, -25885, -26004, -26122, -26239, -26354, -26469, -26582, -26694, -26805, -26914, -27023, -27130, -27236, -27341, -27445,
+ -27547, -27649, -27749, -27847, -27945, -28041, -28136, -28230, -28323, -28414, -28504, -28593, -28680, -28766, -28851, -28935,
+ -29017, -29099, -29178, -29257, -29334, -29410, -29485, -29558, -29630, -29701, -29770, -29838, -29905, -29970, -30034, -30097,
+ -30159, -30219, -30277, -30335, -30391, -30446, -30499, -30551, -30602, -30651, -30699, -30745, -30791, -30834, -30877, -30918,
+ -30958, -30996, -31033, -31069, -31103, -31136, -31167, -31198, -31226, -31254, -31280, -31304, -31327, -31349, -31370, -31389,
+ -31406, -31423, -31438, -31451, -31463, -31474, -31483, -31491, -31498, -31503, -31506, -31509, -31510, -31509, -31507, -31504,
+ -31499, -31493, -31486, -31477, -31467, -31455, -31442, -31428, -31412, -31395, -31377, -31357, -31335, -31313, -31288, -31263,
+ -31236, -31208, -31178, -31147, -31115, -31081, -31046, -31009, -30972, -30932, -30892, -30850, -30806, -30762, -30716, -30668,
+ -30619, -30569, -30518, -30465, -30411, -30355, -30298, -30240, -30181, -30120, -30058, -29994, -29929, -29863, -29796, -29727,
+ -29657, -29585, -29512, -29438, -29363, -29286, -29208, -29129, -29049, -28967, -28884, -28799, -28714, -28627, -28539, -28449,
+ -28359, -28267, -28173, -28079, -27983, -27886, -27788, -27689, -27588, -27486, -27383, -27279, -27174, -27067, -26959, -26850,
+ -26740, -26628, -26516, -26402, -26287, -26171, -26054, -25935, -25816, -25695, -25573, -25450, -25326, -25201, -25075, -24947,
+ -24819, -24689, -24558, -24427, -24294, -24160, -24025, -23889, -23751, -23613, -23474, -23334, -23192, -23050, -22907, -22762,
+ -22617, -22471, -22323, -22175, -22026, -21875, -21724, -21572, -21419, -21264, -21109, -20953, -20796, -20639, -20480, -20320,
+ -20160, -19998, -19836, -19673, -19508, -19343, -19178, -19011, -18844, -18675, -18506, -18336, -18165, -17994, -17821, -17648,
+ -17474, -17299, -17124, -16948, -16771, -16593, -16415, -16235, -16055, -15875, -15693, -15511, -15329, -15145, -14961, -14777,
+ -14591, -14405, -14219, -14031, -13843, -13655, -13466, -13276, -13086, -12895, -12703, -12511, -12319, -12126, -11932, -11738,
+ -11543, -11348, -11152, -10956, -10760, -10562, -10365, -10167,  -9968,  -9769,  -9570,  -9370,  -9170,  -8969,  -8768,  -8567,
+  -8365,  -8163,  -7960,  -7757,  -7554,  -7350,  -7147,  -6942,  -6738,  -6533,  -6328,  -6123,  -5917,  -5711,  -5505,  -5298,
+  -5092,  -4885,  -4678,  -4471,  -4263,  -4055,  -3848,  -3640,  -3431,  -3223,  -3015,  -2806,  -2597,  -2388,  -2179,  -1970,
+  -1761,  -1552,  -1343,  -1133,   -924,   -715,   -505,   -296,    -86,    123,    332,    541,    751,    960,   1170,   1379,
+   1588,   1798,   2007,   2216,   2425,   2634,   2842,   3051,   3259,   3468,   3676,   3884,   4092,   4299,   4507,   4714,
+   4921,   5128,   5334,   5541,   5747,   5953,   6158,   6364,   6569,   6773,   6978,   7182,   7386,   7589,   7793,   7995,
+   8198,   8400,   8602,   8803,   9004,   9205,   9405,   9605,   9804,  10003,  10201,  10399,  10597,  10794,  10990,  11186,
+  11382,  11577,  11772,  11966,  12159,  12352,  12545,  12737,  12928,  13119,  13309,  13499,  13688,  13876,  14064,  14251,
+  14438,  14624,  14809,  14993,  15177,  15361,  15543,  15725,  15906,  16087,  16267,  16446,  16624,  16802,  16978,  17155,
+  17330,  17504,  17678,  17851,  18024,  18195,  18366,  18536,  18705,  18873,  19040,  19207,  19372,  19537,  19701,  19864,
+  20026,  20188,  20348,  20507,  20666,  20824,  20981,  21136,  21291,  21445,  21598,  21750,  21901,  22052,  22201,  22349,
+  22496,  22642,  22788,  22932,  23075,  23217,  23358,  23498,  23637,  23775,  23912,  24048,  24183,  24317,  24450,  24581,
+  24712,  24841,  24969,  25097,  25223,  25348,  25472,  25594,  25716,  25837,  25956,  26074,  26191,  26307,  26422,  26535,
+  26648,  26759,  26869,  26978,  27086,  27192,  27297,  27401,  27504,  27606,  27706,  27805,  27903,  28000,  28095,  28190,
+  28283,  28374,  28465,  28554,  28642,  28729,  28814,  28898,  28981,  29063,  29143,  29222,  29300,  29376,  29451,  29525,
+  29598,  29669,  29739,  29807,  29875,  29941,  30005,  30069,  30131,  30191,  30250,  30308,  30365,  30420,  30474,  30527,
+  30578,  30628,  30677,  30724,  30770,  30814,  30857,  30899,  30939,  30978,  31016,  31052,  31087,  31120,  31153,  31183,
+  31213,  31241,  31267,  31293,  31316,  31339,  31360,  31380,  31398,  31415,  31430,  31445,  31457,  31469,  31479,  31487,
+  31494,  31500,  31505,  31508,  31509,  31510,  31508,  31506,  31502,  31497,  31490,  31482,  31472,  31461,  31449,  31435,
+  31420,  31404,  31386,  31367,  31346,  31324,  31300,  31276,  31250,  31222,  31193,  31163,  31131,  31098,  31064,  31028,
+  30991,  30952,  30912,  30871,  30828,  30784,  30739,  30692,  30644,  30594,  30544,  30491,  30438,  30383,  30327,  30269,
+  30210,  30150,  30089,  30026,  29962,  29896,  29829,  29761,  29692,  29621,  29549,  29475,  29401,  29325,  29247,  29169,
+  29089,  29008,  28925,  28842,  28757,  28670,  28583,  28494,  28404,  28312,  28220,  28126,  28031,  27935,  27837,  27738,
+  27638,  27537,  27435,  27331,  27226,  27120,  27013,  26904,  26795,  26684,  26572,  26459,  26344,  26229,  26112,  25994,
+  25875,  25755,  25634,  25512,  25388,  25263,  25138,  25011,  24883,  24754,  24624,  24492,  24360,  24226,  24092,  23956,
+  23820,  23682,  23543,  23404,  23263,  23121,  22978,  22834,  22689,  22544,  22397,  22249,  22100,  21950,  21799,  21648,
+  21495,  21341,  21187,  21031,  20875,  20717,  20559,  20400,  20240,  20079,  19917,  19754,  19590,  19426,  19260,  19094,
+  18927,  18759,  18590,  18421,  18250,  18079,  17907,  17734,  17561,  17386,  17211,  17036,  16859,  16682,  16503,  16325,
+  16145,  15965,  15784,  15602,  15420,  15237,  15053,  14869,  14684,  14498,  14312,  14125,  13937,  13749,  13560,  13371,
+  13181,  12990,  12799,  12607,  12415,  12222,  12029,  11835,  11640,  11445,  11250,  11054,  10857,  10661,  10463,  10265,
+  10067,   9868,   9669,   9469,   9269,   9069,   8868,   8667,   8465,   8263,   8061,   7858,   7655,   7452,   7248,   7044,
+   6840,   6635,   6430,   6225,   6019,   5814,   5607,   5401,   5195,   4988,   4781,   4574,   4366,   4159,   3951,   3743,
+   3535,   3327,   3118,   2910,   2701,   2492,   2283,   2074,   1865,   1656,   1447,   1238,   1028,    819,    609,    400,
+    190,    -18,   -228,   -437,   -647,   -856,  -1066,  -1275,  -1484,  -1693,  -1903,  -2112,  -2321,  -2530,  -2738,  -2947,
+  -3156,  -3364,  -3572,  -3780,  -3988,  -4196,  -4403,  -4611,  -4818,  -5025,  -5232,  -5438,  -5644,  -5850,  -6056,  -6262,
+  -6467,  -6672,  -6876,  -7081,  -7285,  -7488,  -7692,  -7895,  -8097,  -8299,  -8501,  -8703,  -8904,  -9105,  -9305,  -9505,
+  -9705,  -9904, -10102, -10301, -10498, -10696, -10893, -11089, -11285, -11480, -11675, -11869, -12063, -12256, -12449, -12641,
+ -12833, -13024, -13215, -13404, -13594, -13782, -13971, -14158, -14345, -14531, -14717, -14902, -15086, -15269, -15452, -15635,
+ -15816, -15997, -16177, -16357, -16535, -16713, -16891, -17067, -17243, -17418, -17592, -17765, -17938, -18110, -18281, -18451,
+ -18621, -18789, -18957, -19124, -19290, -19455, -19620, -19783, -19946, -20107, -20268, -20428, -20587, -20745, -20903, -21059,
+ -21214, -21369, -21522, -21675, -21826, -21977, -22127, -22275, -22423, -22570, -22715, -22860, -23004, -23146, -23288, -23429,
+ -23568, -23707, -23844, -23981, -24116, -24250, -24384, -24516, -24647, -24777, -24906, -25034, -25160, -25286, -25410, -25534,
+ -25656, -25777, -25897, -26016, -26133, -26250, -26365, -26479, -26592, -26704, -26814, -26924, -27032, -27139, -27245, -27350,
+ -27453, -27555, -27656, -27756, -27855, -27952, -28048, -28143, -28237, -28329, -28420, -28510, -28598, -28686, -28772, -28857,
+ -28940, -29022, -29103, -29183, -29261, -29338, -29414, -29489, -29562, -29634, -29704, -29773, -29841, -29908, -29973, -30037,
+ -30100, -30161, -30221, -30280, -30337, -30393, -30448, -30501, -30553, -30603, -30653, -30700, -30747, -30792, -30836, -30878,
+ -30919, -30959, -30997, -31034, -31070, -31104, -31137, -31168, -31198, -31227, -31254, -31280, -31305, -31328, -31350, -31370,
+ -31389, -31407, -31423, -31438, -31451, -31463, -31474, -31483, -31491, -31498, -31503, -31506, -31509, -31510, -31509, -31507,
+ -31504, -31499, -31493, -31486, -31477, -31467, -31455, -31442, -31428, -31412, -31395, -31376, -31356, -31335, -31312, -31288,
+ -31263, -31236, -31208, -31178, -31147, -31115, -31081, -31046, -31009, -30971, -30932, -30892, -30850, -30806, -30761, -30715,
+ -30668, -30619, -30569, -30518, -30465, -30411, -30355, -30298, -30240, -30180, -30120, -30057, -29994, -29929, -29863, -29795,
+ -29726, -29656, -29585, -29512, -29438, -29363, -29286, -29208, -29129, -29048, -28967, -28883, -28799, -28713, -28626, -28538,
+ -28449, -28358, -28266, -28173, -28079, -27983, -27886, -27788, -27688, -27588, -27486, -27383, -27279, -27173, -27066, -26959,
+ -26850, -26739, -26628, -26515, -26402, -26287, -26170, -26053, -25935, -25815, -25695, -25573, -25450, -25326, -25200, -25074,
+ -24947, -24818, -24689, -24558, -24426, -24293, -24159, -24024, -23888, -23751, -23613, -23473, -23333, -23192, -23049, -22906,
+ -22762, -22616, -22470, -22323, -22174, -22025, -21875, -21723, -21571, -21418, -21264, -21109, -20953, -20796, -20638, -20479,
+ -20319, -20159, -19997, -19835, -19672, -19508, -19343, -19177, -19010, -18843, -18674, -18503, -18330, -18157, -17983, -17808,
+ -17632, -17456, -17279, -17101, -16923, -16744, -16564, -16383, -16202, -16020, -15838, -15655, -15471, -15286, -15101, -14916,
+ -14729, -14543, -14355, -14167, -13978, -13789, -13600, -13409, -13218, -13027, -12835, -12643, -12450, -12257, -12063, -11868,
+ -11674, -11478, -11282, -11086, -10890, -10693, -10495, -10297, -10099,  -9900,  -9701,  -9502,  -9302,  -9102,  -8902,  -8701,
+  -8500,  -8298,  -8097,  -7895,  -7692,  -7490,  -7287,  -7084,  -6880,  -6676,  -6473,  -6268,  -6064,  -5859,  -5655,  -5450,
+  -5245,  -5039,  -4834,  -4628,  -4422,  -4217,  -4011,  -3804,  -3598,  -3392,  -3185,  -2979,  -2772,  -2566,  -2359,  -2152,
+  -1945,  -1738,  -1532,  -1325,  -1118,   -911,   -704,   -497,   -291,    -84,    122,    328,    535,    741,    948,   1154,
+   1360,   1566,   1772,   1977,   2183,   2389,   2594,   2799,   3004,   3208,   3413,   3617,   3821,   4025,   4229,   4432,
+   4635,   4838,   5041,   5243,   5445,   5647,   5848,   6049,   6250,   6450,   6651,   6850,   7050,   7249,   7447,   7645,
+   7843,   8041,   8238,   8434,   8630,   8826,   9021,   9216,   9411,   9605,   9798,   9991,  10183,  10375,  10567,  10757,
+  10948,  11138,  11327,  11516,  11704,  11891,  12078,  12265,  12450,  12636,  12820,  13004,  13187,  13370,  13552,  13733,
+  13914,  14094,  14274,  14452,  14630,  14808,  14984,  15160,  15335,  15510,  15683,  15856,  16029,  16200,  16371,  16541,
+  16710,  16878,  17045,  17212,  17378,  17543,  17707,  17871,  18034,  18195,  18356,  18516,  18675,  18834,  18991,  19148,
+  19303,  19458,  19612,  19765,  19917,  20068,  20218,  20367,  20516,  20663,  20809,  20955,  21099,  21242,  21385,  21526,
+  21667,  21806,  21945,  22082,  22219,  22354,  22489,  22622,  22754,  22886,  23016,  23145,  23273,  23400,  23526,  23651,
+  23775,  23897,  24019,  24140,  24259,  24377,  24494,  24611,  24725,  24839,  24952,  25064,  25174,  25283,  25391,  25498,
+  25604,  25709,  25812,  25915,  26016,  26116,  26214,  26312,  26408,  26503,  26597,  26690,  26782,  26872,  26961,  27049,
+  27136,  27221,  27306,  27389,  27470,  27551,  27630,  27708,  27785,  27860,  27935,  28008,  28080,  28150,  28219,  28287,
+  28354,  28419,  28483,  28546,  28608,  28668,  28727,  28785,  28841,  28896,  28950,  29003,  29054,  29104,  29153,  29200,
+  29246,  29291,  29334,  29376,  29417,  29457,  29495,  29532,  29567,  29601,  29634,  29666,  29696,  29725,  29752,  29779,
+  29804,  29827,  29850,  29871,  29890,  29908,  29925,  29941,  29955,  29968,  29980,  29990,  29999,  30007,  30013,  30018,
+  30022,  30025,  30026,  30025,  30024,  30021,  30016,  30011,  30004,  29996,  29986,  29975,  29963,  29949,  29934,  29918,
+  29901,  29882,  29862,  29840,  29817,  29793,  29768,  29741,  29713,  29684,  29653,  29621,  29588,  29553,  29518,  29480,
+  29442,  29402,  29361,  29319,  29275,  29231,  29184,  29137,  29088,  29038,  28987,  28935,  28881,  28826,  28770,  28712,
+  28653,  28593,  28532,  28469,  28406,  28341,  28274,  28207,  28138,  28068,  27997,  27925,  27851,  27776,  27700,  27623,
+  27545,  27465,  27384,  27302,  27219,  27135,  27049,  26963,  26875,  26786,  26696,  26604,  26512,  26418,  26323,  26228,
+  26131,  26032,  25933,  25833,  25731,  25629,  25525,  25420,  25314,  25207,  25099,  24990,  24880,  24768,  24656,  24543,
+  24428,  24313,  24196,  24078,  23960,  23840,  23720,  23598,  23475,  23351,  23227,  23101,  22974,  22847,  22718,  22589,
+  22458,  22327,  22194,  22061,  21927,  21791,  21655,  21518,  21380,  21241,  21101,  20961,  20819,  20677,  20533,  20389,
+  20244,  20098,  19952,  19804,  19656,  19506,  19356,  19205,  19054,  18901,  18748,  18594,  18439,  18284,  18127,  17970,
+  17812,  17654,  17495,  17335,  17174,  17012,  16850,  16687,  16524,  16359,  16195,  16029,  15863,  15696,  15528,  15360,
+  15191,  15022,  14852,  14681,  14510,  14338,  14166,  13993,  13819,  13645,  13471,  13296,  13120,  12944,  12767,  12590,
+  12412,  12233,  12055,  11875,  11696,  11516,  11335,  11154,  10972,  10790,  10608,  10425,  10242,  10059,   9875,   9690,
+   9506,   9320,   9135,   8949,   8763,   8577,   8390,   8203,   8015,   7828,   7640,   7451,   7263,   7074,   6885,   6696,
+   6506,   6317,   6127,   5936,   5746,   5555,   5365,   5174,   4983,   4791,   4600,   4408,   4216,   4025,   3833,   3641,
+   3448,   3256,   3064,   2871,   2679,   2486,   2294,   2101,   1908,   1716,   1523,   1330,   1137,    945,    752,    559,
+    367,    174,    -18,   -210,   -402,   -595,   -787,   -979,  -1171,  -1363,  -1555,  -1747,  -1938,  -2130,  -2321,  -2512,
+  -2703,  -2894,  -3084,  -3275,  -3465,  -3655,  -3845,  -4034,  -4223,  -4412,  -4601,  -4790,  -4978,  -5166,  -5353,  -5541,
+  -5728,  -5915,  -6101,  -6287,  -6473,  -6658,  -6843,  -7028,  -7212,  -7396,  -7580,  -7763,  -7946,  -8128,  -8310,  -8492,
+  -8673,  -8854,  -9034,  -9214,  -9393,  -9572,  -9750,  -9928, -10105, -10282, -10458, -10634, -10810, -10984, -11159, -11332,
+ -11505, -11678, -11850, -12021, -12192, -12362, -12532, -12701, -12869, -13037, -13204, -13371, -13537, -13702, -13867, -14030,
+ -14194, -14356, -14518, -14679, -14840, -14999, -15159, -15317, -15474, -15631, -15787, -15943, -16097, -16251, -16404, -16557,
+ -16708, -16859, -17009, -17158, -17306, -17454, -17601, -17747, -17892, -18036, -18179, -18322, -18464, -18604, -18744, -18883,
+ -19022, -19159, -19295, -19431, -19565, -19699, -19832, -19964, -20095, -20225, -20354, -20482, -20609, -20735, -20861, -20985,
+ -21108, -21231, -21352, -21473, -21592, -21710, -21828, -21944, -22060, -22174, -22288, -22400, -22511, -22622, -22731, -22839,
+ -22946, -23053, -23158, -23262, -23365, -23467, -23567, -23667, -23766, -23863, -23960, -24055, -24150, -24243, -24335, -24426,
+ -24516, -24605, -24692, -24779, -24864, -24949, -25032, -25114, -25195, -25275, -25353, -25431, -25507, -25582, -25656, -25729,
+ -25801, -25871, -25941, -26009, -26076, -26142, -26206, -26270, -26332, -26393, -26453, -26512, -26569, -26626, -26681, -26735,
+ -26788, -26839, -26890, -26939, -26987, -27033, -27079, -27123, -27166, -27208, -27249, -27288, -27326, -27363, -27399, -27434,
+ -27467, -27499, -27530, -27560, -27588, -27615, -27641, -27666, -27689, -27712, -27733, -27752, -27771, -27788, -27804, -27819,
+ -27833, -27845, -27856, -27866, -27875, -27882, -27889, -27893, -27897, -27900, -27901, -27901, -27900, -27897, -27894, -27889,
+ -27883, -27875, -27867, -27857, -27846, -27833, -27820, -27805, -27789, -27772, -27753, -27734, -27713, -27691, -27667, -27643,
+ -27617, -27590, -27562, -27533, -27502, -27470, -27437, -27403, -27368, -27331, -27293, -27254, -27214, -27173, -27130, -27086,
+ -27041, -26995, -26948, -26899, -26850, -26799, -26747, -26694, -26639, -26584, -26527, -26469, -26410, -26350, -26289, -26227,
+ -26163, -26098, -26033, -25966, -25898, -25828, -25758, -25687, -25614, -25540, -25466, -25390, -25313, -25235, -25156, -25075,
+ -24994, -24912, -24828, -24744, -24658, -24571, -24484, -24395, -24305, -24214, -24122, -24029, -23935, -23840, -23744, -23647,
+ -23549, -23450, -23350, -23249, -23146, -23043, -22939, -22834, -22728, -22621, -22513, -22404, -22294, -22184, -22072, -21959,
+ -21845, -21731, -21615, -21499, -21382, -21263, -21144, -21024, -20903, -20781, -20659, -20535, -20411, -20285, -20159, -20032,
+ -19904, -19775, -19646, -19516, -19384, -19252, -19120, -18986, -18852, -18716, -18580, -18444, -18306, -18168, -18029, -17889,
+ -17748, -17607, -17465, -17322, -17179, -17035, -16890, -16744, -16598, -16451, -16303, -16155, -16006, -15856, -15706, -15555,
+ -15403, -15251, -15098, -14945, -14791, -14636, -14481, -14325, -14169, -14012, -13854, -13696, -13537, -13378, -13218, -13058,
+ -12897, -12736, -12574, -12411, -12249, -12085, -11921, -11757, -11592, -11427, -11261, -11095, -10929, -10762, -10594, -10426,
+ -10258, -10090,  -9921,  -9751,  -9581,  -9411,  -9241,  -9070,  -8899,  -8727,  -8555,  -8383,  -8211,  -8038,  -7865,  -7691,
+  -7518,  -7344,  -7169,  -6995,  -6820,  -6645,  -6470,  -6295,  -6119,  -5943,  -5767,  -5591,  -5414,  -5238,  -5061,  -4884,
+  -4707,  -4529,  -4352,  -4174,  -3997,  -3819,  -3641,  -3463,  -3285,  -3107,  -2928,  -2750,  -2572,  -2393,  -2215,  -2036,
+  -1857,  -1679,  -1500,  -1322,  -1143,   -964,   -786,   -607,   -429,   -250,    -72,    106,    284,    462,    640,    819,
+    997,   1174,   1352,   1530,   1707,   1885,   2062,   2239,   2416,   2593,   2769,   2946,   3122,   3298,   3474,   3650,
+   3825,   4000,   4175,   4350,   4524,   4698,   4872,   5046,   5219,   5392,   5565,   5737,   5910,   6081,   6253,   6424,
+   6595,   6765,   6936,   7105,   7275,   7444,   7612,   7780,   7948,   8116,   8283,   8449,   8615,   8781,   8946,   9111,
+   9276,   9439,   9603,   9766,   9928,  10090,  10252,  10413,  10573,  10733,  10892,  11051,  11209,  11367,  11524,  11681,
+  11837,  11992,  12147,  12302,  12455,  12608,  12761,  12913,  13064,  13215,  13365,  13514,  13663,  13811,  13958,  14105,
+  14251,  14396,  14541,  14685,  14828,  14971,  15113,  15254,  15394,  15534,  15673,  15811,  15948,  16085,  16221,  16356,
+  16491,  16624,  16757,  16889,  17021,  17151,  17281,  17410,  17538,  17665,  17791,  17917,  18042,  18166,  18289,  18411,
+  18532,  18653,  18772,  18891,  19009,  19126,  19242,  19357,  19472,  19585,  19698,  19809,  19920,  20030,  20138,  20246,
+  20353,  20459,  20565,  20669,  20772,  20874,  20975,  21076,  21175,  21273,  21371,  21467,  21563,  21657,  21751,  21843,
+  21935,  22025,  22115,  22203,  22291,  22377,  22462,  22547,  22630,  22713,  22794,  22874,  22953,  23031,  23109,  23185,
+  23260,  23334,  23407,  23478,  23549,  23619,  23688,  23755,  23822,  23887,  23952,  24015,  24077,  24138,  24198,  24257,
+  24315,  24372,  24427,  24482,  24535,  24587,  24639,  24689,  24738,  24786,  24832,  24878,  24923,  24966,  25008,  25050,
+  25090,  25128,  25166,  25203,  25239,  25273,  25306,  25338,  25369,  25399,  25428,  25456,  25482,  25508,  25532,  25555,
+  25577,  25598,  25617,  25636,  25653,  25669,  25684,  25698,  25711,  25723,  25733,  25743,  25751,  25758,  25764,  25769,
+  25772,  25775,  25776,  25777,  25776,  25774,  25770,  25766,  25761,  25754,  25746,  25737,  25727,  25716,  25704,  25691,
+  25676,  25660,  25644,  25626,  25607,  25586,  25565,  25543,  25519,  25494,  25469,  25442,  25414,  25384,  25354,  25323,
+  25290,  25257,  25222,  25186,  25149,  25111,  25072,  25032,  24991,  24948,  24905,  24860,  24815,  24768,  24720,  24671,
+  24621,  24570,  24518,  24465,  24411,  24355,  24299,  24242,  24183,  24124,  24063,  24001,  23939,  23875,  23810,  23745,
+  23678,  23610,  23541,  23471,  23400,  23329,  23256,  23182,  23107,  23031,  22954,  22876,  22798,  22718,  22637,  22555,
+  22472,  22389,  22304,  22218,  22132,  22044,  21956,  21866,  21776,  21685,  21593,  21499,  21405,  21310,  21215,  21118,
+  21020,  20921,  20822,  20722,  20620,  20518,  20415,  20311,  20207,  20101,  19995,  19887,  19779,  19670,  19561,  19450,
+  19339,  19226,  19113,  18999,  18885,  18769,  18653,  18536,  18418,  18300,  18180,  18060,  17939,  17818,  17695,  17572,
+  17448,  17324,  17198,  17072,  16946,  16818,  16690,  16561,  16432,  16302,  16171,  16039,  15907,  15774,  15641,  15507,
+  15372,  15236,  15100,  14964,  14826,  14689,  14550,  14411,  14271,  14131,  13990,  13849,  13707,  13564,  13421,  13278,
+  13134,  12989,  12844,  12698,  12552,  12405,  12258,  12110,  11962,  11813,  11664,  11515,  11365,  11214,  11063,  10912,
+  10760,  10608,  10455,  10302,  10149,   9995,   9840,   9686,   9531,   9375,   9220,   9064,   8907,   8751,   8593,   8436,
+   8278,   8120,   7962,   7803,   7644,   7485,   7326,   7166,   7006,   6846,   6685,   6525,   6364,   6202,   6041,   5879,
+   5718,   5556,   5393,   5231,   5068,   4906,   4743,   4580,   4417,   4253,   4090,   3926,   3763,   3599,   3435,   3271,
+   3107,   2943,   2779,   2614,   2450,   2286,   2121,   1957,   1792,   1628,   1463,   1299,   1134,    970,    805,    641,
+    476,    312,    148,    -16,   -180,   -344,   -508,   -672,   -836,  -1000,  -1164,  -1327,  -1491,  -1654,  -1817,  -1980,
+  -2143,  -2306,  -2469,  -2631,  -2793,  -2955,  -3117,  -3279,  -3441,  -3602,  -3763,  -3924,  -4084,  -4245,  -4405,  -4565,
+  -4724,  -4884,  -5043,  -5202,  -5360,  -5518,  -5676,  -5834,  -5991,  -6148,  -6305,  -6461,  -6617,  -6773,  -6928,  -7083,
+  -7237,  -7391,  -7545,  -7698,  -7851,  -8004,  -8156,  -8308,  -8459,  -8610,  -8760,  -8910,  -9060,  -9209,  -9358,  -9506,
+  -9653,  -9801,  -9947, -10094, -10239, -10385, -10529, -10673, -10817, -10960, -11103, -11245, -11386, -11527, -11668, -11807,
+ -11947, -12085, -12223, -12361, -12498, -12634, -12770, -12905, -13039, -13173, -13306, -13438, -13570, -13702, -13832, -13962,
+ -14091, -14220, -14348, -14475, -14602, -14727, -14852, -14977, -15101, -15224, -15346, -15468, -15588, -15708, -15828, -15946,
+ -16064, -16181, -16298, -16413, -16528, -16642, -16755, -16868, -16980, -17090, -17201, -17310, -17418, -17526, -17633, -17739,
+ -17844, -17949, -18052, -18155, -18257, -18358, -18458, -18557, -18656, -18753, -18850, -18946, -19041, -19135, -19228, -19321,
+ -19412, -19503, -19592, -19681, -19769, -19856, -19942, -20027, -20111, -20194, -20277, -20358, -20439, -20518, -20597, -20675,
+ -20751, -20827, -20902, -20976, -21049, -21121, -21192, -21262, -21331, -21399, -21466, -21532, -21597, -21662, -21725, -21787,
+ -21848, -21909, -21968, -22026, -22083, -22140, -22195, -22249, -22302, -22355, -22406, -22456, -22505, -22554, -22601, -22647,
+ -22692, -22736, -22779, -22821, -22862, -22902, -22941, -22979, -23016, -23052, -23087, -23121, -23154, -23185, -23216, -23246,
+ -23274, -23302, -23329, -23354, -23379, -23402, -23424, -23446, -23466, -23485, -23503, -23521, -23537, -23552, -23566, -23579,
+ -23591, -23601, -23611, -23620, -23628, -23634, -23640, -23645, -23648, -23651, -23652, -23652, -23652, -23650, -23647, -23643,
+ -23639, -23633, -23626, -23618, -23609, -23599, -23587, -23575, -23562, -23548, -23533, -23516, -23499, -23481, -23461, -23441,
+ -23419, -23397, -23373, -23349, -23323, -23296, -23269, -23240, -23211, -23180, -23148, -23115, -23082, -23047, -23011, -22975,
+ -22937, -22898, -22858, -22818, -22776, -22733, -22689, -22645, -22599, -22552, -22505, -22456, -22406, -22356, -22304, -22252,
+ -22198, -22144, -22089, -22032, -21975, -21917, -21857, -21797, -21736, -21674, -21611, -21547, -21482, -21417, -21350, -21282,
+ -21214, -21144, -21074, -21003, -20931, -20858, -20784, -20709, -20633, -20557, -20479, -20401, -20321, -20241, -20160, -20079,
+ -19996, -19912, -19828, -19743, -19657, -19570, -19482, -19393, -19304, -19214, -19123, -19031, -18938, -18845, -18750, -18655,
+ -18560, -18463, -18366, -18267, -18168, -18069, -17968, -17867, -17765, -17662, -17559, -17455, -17350, -17244, -17138, -17030,
+ -16923, -16814, -16705, -16595, -16484, -16373, -16261, -16148, -16035, -15921, -15806, -15691, -15575, -15458, -15341, -15223,
+ -15105, -14986, -14866, -14745, -14624, -14503, -14381, -14258, -14135, -14011, -13886, -13761, -13636, -13509, -13383, -13255,
+ -13128, -12999, -12870, -12741, -12611, -12481, -12350, -12218, -12087, -11954, -11821, -11688, -11554, -11420, -11285, -11150,
+ -11015, -10879, -10742, -10605, -10468, -10330, -10192, -10054,  -9915,  -9776,  -9636,  -9496,  -9355,  -9215,  -9074,  -8932,
+  -8790,  -8648,  -8506,  -8363,  -8220,  -8077,  -7933,  -7789,  -7645,  -7500,  -7355,  -7210,  -7065,  -6919,  -6773,  -6627,
+  -6481,  -6334,  -6188,  -6041,  -5893,  -5746,  -5598,  -5451,  -5303,  -5154,  -5006,  -4858,  -4709,  -4560,  -4411,  -4262,
+  -4113,  -3964,  -3814,  -3665,  -3515,  -3365,  -3215,  -3065,  -2915,  -2765,  -2615,  -2465,  -2315,  -2164,  -2014,  -1864,
+  -1713,  -1563,  -1413,  -1262,  -1112,   -961,   -811,   -661,   -510,   -360,   -210,    -60,     90,    240,    390,    540,
+    689,    839,    989,   1138,   1288,   1437,   1586,   1735,   1884,   2033,   2182,   2330,   2478,   2627,   2775,   2922,
+   3070,   3217,   3365,   3512,   3658,   3805,   3951,   4097,   4243,   4389,   4534,   4679,   4824,   4969,   5113,   5257,
+   5401,   5544,   5687,   5830,   5973,   6115,   6257,   6398,   6539,   6680,   6820,   6961,   7100,   7240,   7379,   7517,
+   7656,   7793,   7931,   8068,   8204,   8341,   8476,   8612,   8747,   8881,   9015,   9149,   9282,   9414,   9547,   9678,
+   9809,   9940,  10070,  10200,  10329,  10458,  10586,  10714,  10841,  10968,  11094,  11219,  11344,  11469,  11593,  11716,
+  11839,  11961,  12083,  12204,  12324,  12444,  12563,  12682,  12800,  12917,  13034,  13150,  13266,  13380,  13495,  13608,
+  13721,  13834,  13945,  14056,  14167,  14276,  14385,  14493,  14601,  14708,  14814,  14920,  15025,  15129,  15232,  15335,
+  15437,  15538,  15638,  15738,  15837,  15935,  16033,  16130,  16226,  16321,  16416,  16509,  16602,  16695,  16786,  16877,
+  16967,  17056,  17144,  17231,  17318,  17404,  17489,  17573,  17657,  17740,  17821,  17902,  17983,  18062,  18140,  18218,
+  18295,  18371,  18446,  18520,  18594,  18666,  18738,  18809,  18879,  18948,  19017,  19084,  19151,  19216,  19281,  19345,
+  19408,  19470,  19531,  19592,  19651,  19710,  19768,  19824,  19880,  19935,  19989,  20042,  20095,  20146,  20197,  20246,
+  20295,  20342,  20389,  20435,  20480,  20524,  20567,  20609,  20650,  20691,  20730,  20768,  20806,  20842,  20878,  20913,
+  20946,  20979,  21011,  21042,  21072,  21101,  21129,  21156,  21182,  21207,  21232,  21255,  21277,  21299,  21319,  21339,
+  21357,  21375,  21391,  21407,  21422,  21436,  21448,  21460,  21471,  21481,  21490,  21498,  21505,  21511,  21517,  21521,
+  21524,  21526,  21528,  21528,  21528,  21526,  21524,  21520,  21516,  21511,  21504,  21497,  21489,  21480,  21470,  21459,
+  21447,  21434,  21420,  21405,  21390,  21373,  21355,  21337,  21317,  21297,  21276,  21253,  21230,  21206,  21181,  21155,
+  21128,  21100,  21071,  21042,  21011,  20980,  20947,  20914,  20880,  20844,  20808,  20771,  20733,  20695,  20655,  20614,
+  20573,  20530,  20487,  20443,  20398,  20352,  20305,  20257,  20209,  20159,  20109,  20058,  20006,  19953,  19899,  19844,
+  19789,  19733,  19675,  19617,  19558,  19499,  19438,  19377,  19314,  19251,  19188,  19123,  19057,  18991,  18924,  18856,
+  18787,  18717,  18647,  18576,  18504,  18431,  18357,  18283,  18208,  18132,  18056,  17978,  17900,  17821,  17741,  17661,
+  17580,  17498,  17415,  17332,  17247,  17163,  17077,  16991,  16904,  16816,  16727,  16638,  16548,  16458,  16367,  16275,
+  16182,  16089,  15995,  15900,  15805,  15709,  15612,  15515,  15417,  15319,  15219,  15120,  15019,  14918,  14816,  14714,
+  14611,  14508,  14404,  14299,  14194,  14088,  13981,  13874,  13767,  13658,  13550,  13440,  13331,  13220,  13109,  12998,
+  12886,  12774,  12661,  12547,  12433,  12319,  12204,  12088,  11972,  11856,  11739,  11621,  11503,  11385,  11266,  11147,
+  11027,  10907,  10787,  10666,  10544,  10422,  10300,  10178,  10055,   9931,   9807,   9683,   9559,   9434,   9308,   9183,
+   9057,   8930,   8804,   8677,   8549,   8422,   8294,   8165,   8037,   7908,   7779,   7649,   7520,   7389,   7259,   7129,
+   6998,   6867,   6735,   6604,   6472,   6340,   6208,   6075,   5942,   5809,   5676,   5543,   5410,   5276,   5142,   5008,
+   4874,   4739,   4605,   4470,   4336,   4201,   4066,   3931,   3795,   3660,   3524,   3389,   3253,   3117,   2982,   2846,
+   2710,   2574,   2438,   2301,   2165,   2029,   1893,   1757,   1620,   1484,   1348,   1211,   1075,    939,    803,    666,
+    530,    394,    258,    122,    -13,   -149,   -285,   -421,   -557,   -693,   -828,   -964,  -1099,  -1234,  -1369,  -1504,
+  -1639,  -1774,  -1909,  -2043,  -2178,  -2312,  -2446,  -2580,  -2713,  -2847,  -2980,  -3113,  -3246,  -3379,  -3512,  -3644,
+  -3776,  -3908,  -4039,  -4171,  -4302,  -4433,  -4564,  -4694,  -4824,  -4954,  -5083,  -5213,  -5342,  -5470,  -5599,  -5727,
+  -5855,  -5982,  -6109,  -6236,  -6363,  -6489,  -6615,  -6740,  -6865,  -6990,  -7114,  -7238,  -7362,  -7485,  -7608,  -7731,
+  -7853,  -7974,  -8096,  -8217,  -8337,  -8457,  -8577,  -8696,  -8815,  -8933,  -9051,  -9168,  -9285,  -9401,  -9517,  -9633,
+  -9748,  -9863,  -9977, -10090, -10203, -10316, -10428, -10539, -10650, -10761, -10871, -10980, -11089, -11198, -11306, -11413,
+ -11520, -11626, -11731, -11836, -11941, -12045, -12148, -12251, -12353, -12454, -12555, -12656, -12756, -12855, -12953, -13051,
+ -13148, -13245, -13341, -13436, -13531, -13625, -13719, -13812, -13904, -13995, -14086, -14176, -14266, -14355, -14443, -14530,
+ -14617, -14703, -14789, -14873, -14957, -15041, -15123, -15205, -15286, -15367, -15447, -15526, -15604, -15682, -15758, -15835,
+ -15910, -15985, -16059, -16132, -16204, -16276, -16347, -16417, -16486, -16555, -16623, -16690, -16756, -16822, -16887, -16951,
+ -17014, -17076, -17138, -17199, -17259, -17318, -17377, -17435, -17492, -17548, -17603, -17657, -17711, -17764, -17816, -17867,
+ -17918, -17967, -18016, -18064, -18111, -18158, -18203, -18248, -18292, -18335, -18377, -18419, -18459, -18499, -18538, -18576,
+ -18613, -18649, -18685, -18719, -18753, -18786, -18818, -18849, -18880, -18909, -18938, -18966, -18993, -19019, -19044, -19069,
+ -19092, -19115, -19137, -19158, -19178, -19198, -19216, -19234, -19250, -19266, -19281, -19295, -19309, -19321, -19333, -19343,
+ -19353, -19362, -19370, -19377, -19384, -19389, -19394, -19398, -19401, -19403, -19404, -19404, -19404, -19402, -19400, -19397,
+ -19393, -19388, -19383, -19376, -19369, -19361, -19352, -19342, -19331, -19319, -19307, -19293, -19279, -19264, -19248, -19232,
+ -19214, -19196, -19176, -19156, -19135, -19114, -19091, -19067, -19043, -19018, -18992, -18965, -18938, -18909, -18880, -18850,
+ -18819, -18787, -18755, -18722, -18687, -18652, -18617, -18580, -18543, -18504, -18465, -18426, -18385, -18344, -18301, -18259,
+ -18215, -18170, -18125, -18079, -18032, -17984, -17936, -17886, -17836, -17786, -17734, -17682, -17629, -17575, -17521, -17465,
+ -17409, -17352, -17295, -17237, -17178, -17118, -17057, -16996, -16934, -16872, -16808, -16744, -16679, -16614, -16548, -16481,
+ -16413, -16345, -16276, -16206, -16136, -16065, -15993, -15921, -15847, -15774, -15699, -15624, -15548, -15472, -15395, -15317,
+ -15239, -15160, -15081, -15000, -14919, -14838, -14756, -14673, -14590, -14506, -14421, -14336, -14251, -14164, -14077, -13990,
+ -13902, -13813, -13724, -13634, -13544, -13453, -13362, -13270, -13177, -13084, -12991, -12896, -12802, -12707, -12611, -12515,
+ -12418, -12321, -12223, -12125, -12026, -11927, -11827, -11727, -11626, -11525, -11424, -11322, -11219, -11116, -11013, -10909,
+ -10805, -10700, -10595, -10490, -10384, -10278, -10171, -10064,  -9956,  -9848,  -9740,  -9631,  -9522,  -9413,  -9303,  -9193,
+  -9082,  -8971,  -8860,  -8749,  -8637,  -8525,  -8412,  -8299,  -8186,  -8073,  -7959,  -7845,  -7731,  -7616,  -7501,  -7386,
+  -7270,  -7155,  -7039,  -6922,  -6806,  -6689,  -6572,  -6455,  -6337,  -6220,  -6102,  -5984,  -5866,  -5747,  -5628,  -5509,
+  -5390,  -5271,  -5152,  -5032,  -4912,  -4792,  -4672,  -4552,  -4431,  -4311,  -4190,  -4069,  -3949,  -3828,  -3706,  -3585,
+  -3464,  -3342,  -3221,  -3099,  -2978,  -2856,  -2734,  -2612,  -2490,  -2368,  -2246,  -2124,  -2002,  -1880,  -1758,  -1635,
+  -1513,  -1391,  -1269,  -1147,  -1024,   -902,   -780,   -658,   -536,   -414,   -292,   -170,    -48,     73,    195,    317,
+    438,    560,    681,    803,    924,   1045,   1166,   1287,   1408,   1529,   1650,   1770,   1891,   2011,   2131,   2251,
+   2371,   2490,   2610,   2729,   2848,   2967,   3085,   3204,   3322,   3440,   3558,   3676,   3793,   3911,   4028,   4144,
+   4261,   4377,   4493,   4609,   4724,   4840,   4955,   5069,   5184,   5298,   5412,   5525,   5638,   5751,   5864,   5976,
+   6088,   6200,   6311,   6422,   6533,   6643,   6753,   6862,   6972,   7081,   7189,   7297,   7405,   7512,   7619,   7726,
+   7832,   7938,   8043,   8148,   8253,   8357,   8461,   8564,   8667,   8769,   8871,   8973,   9074,   9175,   9275,   9375,
+   9474,   9573,   9671,   9769,   9866,   9963,  10059,  10155,  10251,  10346,  10440,  10534,  10627,  10720,  10812,  10904,
+  10995,  11086,  11176,  11266,  11355,  11444,  11532,  11619,  11706,  11792,  11878,  11963,  12048,  12132,  12215,  12298,
+  12381,  12462,  12543,  12624,  12704,  12783,  12862,  12940,  13017,  13094,  13171,  13246,  13321,  13396,  13469,  13542,
+  13615,  13687,  13758,  13828,  13898,  13967,  14036,  14104,  14171,  14238,  14304,  14369,  14434,  14498,  14561,  14623,
+  14685,  14747,  14807,  14867,  14926,  14985,  15042,  15099,  15156,  15211,  15266,  15321,  15374,  15427,  15479,  15531,
+  15581,  15631,  15681,  15729,  15777,  15824,  15870,  15916,  15961,  16005,  16049,  16091,  16133,  16175,  16215,  16255,
+  16294,  16332,  16370,  16407,  16443,  16478,  16513,  16546,  16579,  16612,  16643,  16674,  16704,  16733,  16762,  16790,
+  16817,  16843,  16869,  16893,  16917,  16940,  16963,  16985,  17006,  17026,  17045,  17064,  17082,  17099,  17115,  17131,
+  17145,  17159,  17173,  17185,  17197,  17208,  17218,  17227,  17236,  17244,  17251,  17257,  17263,  17268,  17272,  17275,
+  17278,  17279,  17280,  17281,  17280,  17279,  17277,  17274,  17270,  17266,  17261,  17255,  17248,  17241,  17232,  17223,
+  17214,  17203,  17192,  17180,  17167,  17154,  17139,  17124,  17109,  17092,  17075,  17057,  17038,  17019,  16998,  16978,
+  16956,  16933,  16910,  16886,  16862,  16836,  16810,  16783,  16755,  16727,  16698,  16668,  16638,  16607,  16575,  16542,
+  16509,  16474,  16440,  16404,  16368,  16331,  16293,  16255,  16216,  16176,  16136,  16095,  16053,  16010,  15967,  15923,
+  15879,  15833,  15787,  15741,  15694,  15646,  15597,  15548,  15498,  15447,  15396,  15344,  15291,  15238,  15184,  15130,
+  15075,  15019,  14962,  14905,  14848,  14789,  14730,  14671,  14611,  14550,  14488,  14426,  14364,  14301,  14237,  14172,
+  14107,  14042,  13975,  13909,  13841,  13773,  13705,  13636,  13566,  13496,  13425,  13354,  13282,  13209,  13136,  13063,
+  12989,  12914,  12839,  12763,  12687,  12610,  12533,  12455,  12377,  12298,  12219,  12139,  12059,  11978,  11897,  11815,
+  11733,  11650,  11567,  11483,  11399,  11315,  11230,  11144,  11058,  10972,  10885,  10798,  10710,  10622,  10534,  10445,
+  10355,  10266,  10176,  10085,   9994,   9903,   9811,   9719,   9626,   9533,   9440,   9346,   9252,   9158,   9063,   8968,
+   8873,   8777,   8681,   8585,   8488,   8391,   8293,   8196,   8098,   7999,   7901,   7802,   7702,   7603,   7503,   7403,
+   7303,   7202,   7101,   7000,   6899,   6797,   6695,   6593,   6491,   6388,   6285,   6182,   6079,   5976,   5872,   5768,
+   5664,   5560,   5455,   5350,   5246,   5141,   5035,   4930,   4825,   4719,   4613,   4507,   4401,   4295,   4188,   4082,
+   3975,   3869,   3762,   3655,   3548,   3440,   3333,   3226,   3118,   3011,   2903,   2796,   2688,   2580,   2472,   2364,
+   2257,   2149,   2041,   1933,   1824,   1716,   1608,   1500,   1392,   1284,   1176,   1068,    960,    852,    743,    635,
+    527,    419,    312,    204,     96,    -11,   -119,   -226,   -334,   -441,   -549,   -656,   -763,   -871,   -978,  -1085,
+  -1191,  -1298,  -1405,  -1511,  -1618,  -1724,  -1830,  -1936,  -2042,  -2147,  -2253,  -2358,  -2463,  -2569,  -2673,  -2778,
+  -2883,  -2987,  -3091,  -3195,  -3299,  -3402,  -3505,  -3608,  -3711,  -3814,  -3916,  -4019,  -4121,  -4222,  -4324,  -4425,
+  -4526,  -4627,  -4727,  -4827,  -4927,  -5027,  -5126,  -5225,  -5324,  -5423,  -5521,  -5619,  -5716,  -5814,  -5911,  -6007,
+  -6104,  -6200,  -6295,  -6391,  -6486,  -6580,  -6675,  -6769,  -6862,  -6956,  -7048,  -7141,  -7233,  -7325,  -7416,  -7507,
+  -7598,  -7688,  -7778,  -7868,  -7957,  -8045,  -8134,  -8222,  -8309,  -8396,  -8483,  -8569,  -8655,  -8740,  -8825,  -8909,
+  -8993,  -9077,  -9160,  -9243,  -9325,  -9406,  -9488,  -9569,  -9649,  -9729,  -9808,  -9887,  -9965, -10043, -10121, -10198,
+ -10274, -10350, -10426, -10501, -10575, -10649, -10722, -10795, -10868, -10939, -11011, -11081, -11152, -11221, -11291, -11359,
+ -11427, -11495, -11562, -11628, -11694, -11760, -11824, -11889, -11952, -12015, -12078, -12140, -12201, -12262, -12322, -12382,
+ -12441, -12499, -12557, -12615, -12671, -12727, -12783, -12838, -12892, -12946, -12999, -13051, -13103, -13154, -13205, -13255,
+ -13305, -13353, -13402, -13449, -13496, -13542, -13588, -13633, -13677, -13721, -13764, -13807, -13849, -13890, -13931, -13971,
+ -14010, -14049, -14087, -14124, -14161, -14197, -14232, -14267, -14301, -14335, -14367, -14400, -14431, -14462, -14492, -14522,
+ -14550, -14579, -14606, -14633, -14659, -14685, -14710, -14734, -14757, -14780, -14802, -14824, -14845, -14865, -14885, -14903,
+ -14922, -14939, -14956, -14972, -14988, -15002, -15016, -15030, -15043, -15055, -15066, -15077, -15087, -15096, -15105, -15113,
+ -15121, -15127, -15133, -15139, -15143, -15147, -15151, -15153, -15155, -15157, -15157, -15157, -15157, -15155, -15153, -15150,
+ -15147, -15143, -15138, -15133, -15127, -15120, -15113, -15104, -15096, -15086, -15076, -15066, -15054, -15042, -15029, -15016,
+ -15002, -14987, -14972, -14956, -14939, -14922, -14904, -14885, -14866, -14846, -14826, -14804, -14783, -14760, -14737, -14713,
+ -14689, -14664, -14638, -14612, -14585, -14557, -14529, -14500, -14471, -14441, -14410, -14379, -14347, -14314, -14281, -14247,
+ -14213, -14178, -14142, -14106, -14069, -14032, -13994, -13955, -13916, -13876, -13835, -13794, -13753, -13711, -13668, -13625,
+ -13581, -13536, -13491, -13445, -13399, -13352, -13305, -13257, -13209, -13160, -13110, -13060, -13009, -12958, -12906, -12854,
+ -12801, -12748, -12694, -12639, -12584, -12529, -12473, -12416, -12359, -12302, -12244, -12185, -12126, -12066, -12006, -11946,
+ -11885, -11823, -11761, -11698, -11635, -11572, -11508, -11443, -11378, -11313, -11247, -11181, -11114, -11047, -10979, -10911,
+ -10843, -10774, -10704, -10634, -10564, -10493, -10422, -10351, -10279, -10206, -10133, -10060,  -9987,  -9913,  -9838,  -9764,
+  -9688,  -9613,  -9537,  -9461,  -9384,  -9307,  -9229,  -9152,  -9073,  -8995,  -8916,  -8837,  -8757,  -8678,  -8597,  -8517,
+  -8436,  -8355,  -8273,  -8191,  -8109,  -8027,  -7944,  -7861,  -7778,  -7694,  -7610,  -7526,  -7441,  -7357,  -7272,  -7186,
+  -7101,  -7015,  -6929,  -6842,  -6756,  -6669,  -6582,  -6494,  -6407,  -6319,  -6231,  -6143,  -6054,  -5966,  -5877,  -5788,
+  -5698,  -5609,  -5519,  -5429,  -5339,  -5249,  -5158,  -5068,  -4977,  -4886,  -4795,  -4704,  -4613,  -4521,  -4429,  -4337,
+  -4246,  -4153,  -4061,  -3969,  -3876,  -3784,  -3691,  -3598,  -3506,  -3413,  -3319,  -3226,  -3133,  -3040,  -2946,  -2853,
+  -2759,  -2666,  -2572,  -2478,  -2385,  -2291,  -2197,  -2103,  -2009,  -1915,  -1821,  -1727,  -1633,  -1539,  -1445,  -1351,
+  -1257,  -1163,  -1069,   -975,   -881,   -787,   -693,   -599,   -505,   -411,   -317,   -224,   -130,    -36,     56,    150,
+    243,    337,    430,    523,    617,    710,    803,    896,    988,   1081,   1174,   1266,   1359,   1451,   1543,   1635,
+   1727,   1819,   1910,   2002,   2093,   2184,   2275,   2366,   2456,   2547,   2637,   2727,   2817,   2907,   2997,   3086,
+   3175,   3264,   3353,   3442,   3530,   3618,   3706,   3794,   3882,   3969,   4056,   4143,   4229,   4316,   4402,   4488,
+   4573,   4659,   4744,   4828,   4913,   4997,   5081,   5165,   5248,   5331,   5414,   5497,   5579,   5661,   5743,   5824,
+   5905,   5986,   6066,   6146,   6226,   6305,   6384,   6463,   6541,   6620,   6697,   6775,   6852,   6928,   7005,   7081,
+   7156,   7231,   7306,   7381,   7455,   7528,   7602,   7675,   7747,   7819,   7891,   7963,   8033,   8104,   8174,   8244,
+   8313,   8382,   8451,   8519,   8586,   8654,   8720,   8787,   8853,   8918,   8983,   9048,   9112,   9176,   9239,   9302,
+   9364,   9426,   9488,   9549,   9609,   9669,   9729,   9788,   9847,   9905,   9963,  10020,  10076,  10133,  10188,  10244,
+  10298,  10353,  10407,  10460,  10513,  10565,  10617,  10668,  10719,  10769,  10819,  10868,  10917,  10965,  11013,  11060,
+  11106,  11152,  11198,  11243,  11288,  11332,  11375,  11418,  11460,  11502,  11543,  11584,  11624,  11664,  11703,  11742,
+  11780,  11817,  11854,  11891,  11927,  11962,  11997,  12031,  12064,  12098,  12130,  12162,  12193,  12224,  12254,  12284,
+  12313,  12342,  12370,  12397,  12424,  12450,  12476,  12501,  12526,  12550,  12573,  12596,  12618,  12640,  12661,  12682,
+  12702,  12721,  12740,  12758,  12776,  12793,  12809,  12825,  12840,  12855,  12869,  12883,  12896,  12908,  12920,  12931,
+  12942,  12952,  12962,  12971,  12979,  12987,  12994,  13000,  13006,  13012,  13017,  13021,  13025,  13028,  13030,  13032,
+  13034,  13034,  13035,  13034,  13033,  13032,  13030,  13027,  13024,  13020,  13015,  13010,  13005,  12999,  12992,  12985,
+  12977,  12968,  12960,  12950,  12940,  12929,  12918,  12906,  12894,  12881,  12867,  12853,  12838,  12823,  12807,  12791,
+  12774,  12757,  12739,  12720,  12701,  12681,  12661,  12640,  12619,  12597,  12575,  12552,  12528,  12504,  12480,  12455,
+  12429,  12403,  12376,  12349,  12321,  12293,  12264,  12235,  12205,  12175,  12144,  12112,  12080,  12048,  12015,  11981,
+  11947,  11913,  11878,  11842,  11806,  11770,  11733,  11695,  11657,  11619,  11580,  11541,  11501,  11460,  11419,  11378,
+  11336,  11294,  11251,  11208,  11164,  11120,  11075,  11030,  10984,  10938,  10892,  10845,  10797,  10750,  10701,  10653,
+  10603,  10554,  10504,  10453,  10402,  10351,  10299,  10247,  10195,  10142,  10088,  10034,   9980,   9925,   9870,   9815,
+   9759,   9703,   9646,   9589,   9532,   9474,   9416,   9357,   9299,   9239,   9180,   9120,   9059,   8998,   8937,   8876,
+   8814,   8752,   8690,   8627,   8564,   8500,   8436,   8372,   8308,   8243,   8178,   8112,   8046,   7980,   7914,   7847,
+   7780,   7713,   7645,   7578,   7509,   7441,   7372,   7303,   7234,   7165,   7095,   7025,   6954,   6884,   6813,   6742,
+   6670,   6599,   6527,   6455,   6383,   6310,   6237,   6164,   6091,   6018,   5944,   5870,   5796,   5722,   5647,   5573,
+   5498,   5423,   5348,   5272,   5197,   5121,   5045,   4969,   4893,   4816,   4740,   4663,   4586,   4509,   4432,   4354,
+   4277,   4199,   4122,   4044,   3966,   3888,   3810,   3731,   3653,   3574,   3496,   3417,   3338,   3259,   3180,   3101,
+   3022,   2943,   2863,   2784,   2705,   2625,   2546,   2466,   2386,   2307,   2227,   2147,   2067,   1987,   1907,   1828,
+   1748,   1668,   1588,   1508,   1428,   1348,   1268,   1188,   1108,   1028,    948,    868,    788,    708,    628,    548,
+    469,    389,    309,    229,    150,     70,     -8,    -88,   -167,   -246,   -326,   -405,   -484,   -563,   -642,   -721,
+   -800,   -878,   -957,  -1035,  -1114,  -1192,  -1270,  -1348,  -1426,  -1504,  -1581,  -1659,  -1736,  -1813,  -1891,  -1967,
+  -2044,  -2121,  -2198,  -2274,  -2350,  -2426,  -2502,  -2578,  -2653,  -2729,  -2804,  -2879,  -2954,  -3028,  -3103,  -3177,
+  -3251,  -3325,  -3398,  -3472,  -3545,  -3618,  -3691,  -3763,  -3836,  -3908,  -3980,  -4051,  -4123,  -4194,  -4265,  -4336,
+  -4406,  -4476,  -4546,  -4616,  -4685,  -4755,  -4823,  -4892,  -4960,  -5029,  -5096,  -5164,  -5231,  -5298,  -5365,  -5431,
+  -5497,  -5563,  -5629,  -5694,  -5759,  -5823,  -5888,  -5952,  -6015,  -6079,  -6142,  -6204,  -6267,  -6329,  -6390,  -6452,
+  -6513,  -6574,  -6634,  -6694,  -6754,  -6813,  -6872,  -6931,  -6989,  -7047,  -7104,  -7162,  -7218,  -7275,  -7331,  -7387,
+  -7442,  -7497,  -7552,  -7606,  -7660,  -7713,  -7766,  -7819,  -7871,  -7923,  -7975,  -8026,  -8077,  -8127,  -8177,  -8226,
+  -8276,  -8324,  -8373,  -8421,  -8468,  -8515,  -8562,  -8608,  -8654,  -8699,  -8744,  -8789,  -8833,  -8877,  -8920,  -8963,
+  -9005,  -9047,  -9089,  -9130,  -9170,  -9210,  -9250,  -9290,  -9328,  -9367,  -9405,  -9442,  -9480,  -9516,  -9552,  -9588,
+  -9623,  -9658,  -9693,  -9726,  -9760,  -9793,  -9825,  -9857,  -9889,  -9920,  -9951,  -9981, -10011, -10040, -10069, -10097,
+ -10125, -10152, -10179, -10206, -10232, -10257, -10282, -10307, -10331, -10354, -10377, -10400, -10422, -10444, -10465, -10485,
+ -10506, -10525, -10544, -10563, -10581, -10599, -10616, -10633, -10649, -10665, -10681, -10695, -10710, -10724, -10737, -10750,
+ -10762, -10774, -10786, -10797, -10807, -10817, -10826, -10835, -10844, -10852, -10859, -10866, -10873, -10879, -10884, -10889,
+ -10894, -10898, -10902, -10905, -10907, -10909, -10911, -10912, -10913, -10913, -10913, -10912, -10911, -10909, -10907, -10904,
+ -10901, -10897, -10893, -10888, -10883, -10877, -10871, -10865, -10857, -10850, -10842, -10833, -10824, -10815, -10805, -10795,
+ -10784, -10772, -10761, -10748, -10736, -10722, -10709, -10695, -10680, -10665, -10649, -10633, -10617, -10600, -10583, -10565,
+ -10546, -10528, -10508, -10489, -10469, -10448, -10427, -10406, -10384, -10362, -10339, -10316, -10292, -10268, -10243, -10218,
+ -10193, -10167, -10141, -10114, -10087, -10059, -10031, -10003,  -9974,  -9945,  -9915,  -9885,  -9855,  -9824,  -9792,  -9761,
+  -9729,  -9696,  -9663,  -9630,  -9596,  -9562,  -9527,  -9492,  -9457,  -9421,  -9385,  -9349,  -9312,  -9275,  -9237,  -9199,
+  -9160,  -9122,  -9083,  -9043,  -9003,  -8963,  -8922,  -8881,  -8840,  -8798,  -8756,  -8714,  -8671,  -8628,  -8584,  -8540,
+  -8496,  -8452,  -8407,  -8362,  -8316,  -8270,  -8224,  -8178,  -8131,  -8084,  -8036,  -7989,  -7941,  -7892,  -7843,  -7794,
+  -7745,  -7695,  -7645,  -7595,  -7545,  -7494,  -7443,  -7391,  -7340,  -7288,  -7236,  -7183,  -7130,  -7077,  -7024,  -6970,
+  -6916,  -6862,  -6808,  -6753,  -6698,  -6643,  -6588,  -6532,  -6476,  -6420,  -6364,  -6307,  -6250,  -6193,  -6136,  -6079,
+  -6021,  -5963,  -5905,  -5846,  -5788,  -5729,  -5670,  -5611,  -5551,  -5492,  -5432,  -5372,  -5312,  -5252,  -5191,  -5130,
+  -5070,  -5009,  -4947,  -4886,  -4824,  -4763,  -4701,  -4639,  -4577,  -4514,  -4452,  -4389,  -4327,  -4264,  -4201,  -4138,
+  -4074,  -4011,  -3947,  -3884,  -3820,  -3756,  -3692,  -3628,  -3564,  -3500,  -3435,  -3371,  -3306,  -3241,  -3177,  -3112,
+  -3047,  -2982,  -2917,  -2852,  -2786,  -2721,  -2656,  -2590,  -2525,  -2459,  -2394,  -2328,  -2263,  -2197,  -2131,  -2065,
+  -2000,  -1934,  -1868,  -1802,  -1736,  -1670,  -1604,  -1538,  -1472,  -1406,  -1340,  -1274,  -1208,  -1142,  -1077,  -1011,
+   -945,   -879,   -813,   -747,   -681,   -615,   -550,   -484,   -418,   -352,   -287,   -221,   -156,    -90,    -25,     40,
+    105,    170,    235,    300,    365,    430,    495,    560,    625,    689,    754,    818,    882,    947,   1011,   1075,
+   1139,   1203,   1266,   1330,   1393,   1457,   1520,   1583,   1646,   1709,   1771,   1834,   1896,   1959,   2021,   2083,
+   2145,   2206,   2268,   2329,   2390,   2451,   2512,   2573,   2634,   2694,   2754,   2814,   2874,   2934,   2993,   3052,
+   3111,   3170,   3229,   3287,   3346,   3404,   3462,   3519,   3577,   3634,   3691,   3748,   3804,   3861,   3917,   3973,
+   4028,   4084,   4139,   4194,   4249,   4303,   4357,   4411,   4465,   4519,   4572,   4625,   4678,   4730,   4782,   4834,
+   4886,   4938,   4989,   5040,   5090,   5140,   5191,   5240,   5290,   5339,   5388,   5437,   5485,   5533,   5581,   5628,
+   5675,   5722,   5769,   5815,   5861,   5907,   5952,   5997,   6042,   6086,   6130,   6174,   6218,   6261,   6304,   6346,
+   6388,   6430,   6472,   6513,   6554,   6594,   6635,   6674,   6714,   6753,   6792,   6831,   6869,   6907,   6944,   6981,
+   7018,   7054,   7091,   7126,   7162,   7197,   7231,   7266,   7300,   7333,   7367,   7399,   7432,   7464,   7496,   7527,
+   7558,   7589,   7619,   7649,   7679,   7708,   7737,   7765,   7793,   7821,   7849,   7875,   7902,   7928,   7954,   7979,
+   8005,   8029,   8054,   8077,   8101,   8124,   8147,   8169,   8191,   8213,   8234,   8255,   8275,   8295,   8315,   8334,
+   8353,   8371,   8389,   8407,   8424,   8441,   8458,   8474,   8490,   8505,   8520,   8534,   8549,   8562,   8576,   8589,
+   8601,   8613,   8625,   8636,   8647,   8658,   8668,   8678,   8687,   8696,   8705,   8713,   8721,   8728,   8735,   8742,
+   8748,   8754,   8759,   8764,   8768,   8773,   8776,   8780,   8783,   8786,   8788,   8790,   8791,   8792,   8793,   8793,
+   8793,   8792,   8791,   8790,   8788,   8786,   8784,   8781,   8777,   8774,   8770,   8765,   8760,   8755,   8750,   8744,
+   8737,   8730,   8723,   8716,   8708,   8700,   8691,   8682,   8672,   8663,   8652,   8642,   8631,   8620,   8608,   8596,
+   8584,   8571,   8558,   8544,   8530,   8516,   8501,   8486,   8471,   8455,   8439,   8423,   8406,   8389,   8371,   8353,
+   8335,   8316,   8297,   8278,   8258,   8238,   8218,   8197,   8176,   8155,   8133,   8111,   8089,   8066,   8043,   8020,
+   7996,   7972,   7947,   7923,   7897,   7872,   7846,   7820,   7794,   7767,   7740,   7713,   7685,   7657,   7629,   7600,
+   7572,   7542,   7513,   7483,   7453,   7423,   7392,   7361,   7329,   7298,   7266,   7234,   7201,   7169,   7135,   7102,
+   7069,   7035,   7000,   6966,   6931,   6896,   6861,   6825,   6790,   6754,   6717,   6681,   6644,   6607,   6569,   6532,
+   6494,   6456,   6417,   6379,   6340,   6301,   6261,   6222,   6182,   6142,   6102,   6061,   6020,   5979,   5938,   5897,
+   5855,   5813,   5771,   5729,   5687,   5644,   5601,   5558,   5515,   5471,   5427,   5383,   5339,   5295,   5251,   5206,
+   5161,   5116,   5071,   5025,   4980,   4934,   4888,   4842,   4796,   4750,   4703,   4656,   4609,   4562,   4515,   4468,
+   4420,   4373,   4325,   4277,   4229,   4181,   4133,   4084,   4036,   3987,   3938,   3889,   3840,   3791,   3742,   3692,
+   3643,   3593,   3543,   3494,   3444,   3394,   3343,   3293,   3243,   3192,   3142,   3091,   3041,   2990,   2939,   2888,
+   2837,   2786,   2735,   2684,   2633,   2582,   2530,   2479,   2427,   2376,   2324,   2273,   2221,   2169,   2118,   2066,
+   2014,   1962,   1911,   1859,   1807,   1755,   1703,   1651,   1599,   1547,   1495,   1443,   1391,   1339,   1287,   1235,
+   1183,   1131,   1079,   1027,    975,    923,    871,    819,    767,    716,    664,    612,    560,    508,    457,    405,
+    354,    302,    250,    199,    148,     96,     45,     -5,    -57,   -108,   -159,   -210,   -261,   -312,   -362,   -413,
+   -464,   -514,   -565,   -615,   -665,   -716,   -766,   -816,   -866,   -916,   -965,  -1015,  -1064,  -1114,  -1163,  -1212,
+  -1261,  -1310,  -1359,  -1408,  -1457,  -1505,  -1553,  -1602,  -1650,  -1698,  -1746,  -1793,  -1841,  -1888,  -1936,  -1983,
+  -2030,  -2077,  -2123,  -2170,  -2216,  -2263,  -2309,  -2355,  -2400,  -2446,  -2491,  -2537,  -2582,  -2627,  -2671,  -2716,
+  -2760,  -2805,  -2849,  -2893,  -2936,  -2980,  -3023,  -3066,  -3109,  -3152,  -3195,  -3237,  -3279,  -3321,  -3363,  -3404,
+  -3446,  -3487,  -3528,  -3569,  -3609,  -3649,  -3690,  -3729,  -3769,  -3809,  -3848,  -3887,  -3926,  -3964,  -4003,  -4041,
+  -4079,  -4116,  -4154,  -4191,  -4228,  -4264,  -4301,  -4337,  -4373,  -4409,  -4445,  -4480,  -4515,  -4550,  -4584,  -4618,
+  -4653,  -4686,  -4720,  -4753,  -4786,  -4819,  -4851,  -4884,  -4916,  -4947,  -4979,  -5010,  -5041,  -5072,  -5102,  -5132,
+  -5162,  -5192,  -5221,  -5250,  -5279,  -5308,  -5336,  -5364,  -5391,  -5419,  -5446,  -5473,  -5499,  -5526,  -5552,  -5577,
+  -5603,  -5628,  -5653,  -5678,  -5702,  -5726,  -5750,  -5773,  -5796,  -5819,  -5842,  -5864,  -5886,  -5908,  -5929,  -5950,
+  -5971,  -5991,  -6012,  -6032,  -6051,  -6071,  -6090,  -6108,  -6127,  -6145,  -6163,  -6180,  -6198,  -6214,  -6231,  -6247,
+  -6263,  -6279,  -6295,  -6310,  -6325,  -6339,  -6353,  -6367,  -6381,  -6394,  -6407,  -6420,  -6432,  -6444,  -6456,  -6467,
+  -6478,  -6489,  -6500,  -6510,  -6520,  -6530,  -6539,  -6548,  -6557,  -6565,  -6573,  -6581,  -6588,  -6596,  -6602,  -6609,
+  -6615,  -6621,  -6627,  -6632,  -6637,  -6642,  -6646,  -6650,  -6654,  -6658,  -6661,  -6664,  -6666,  -6669,  -6671,  -6672,
+  -6674,  -6675,  -6675,  -6676,  -6676,  -6676,  -6675,  -6675,  -6674,  -6672,  -6671,  -6669,  -6666,  -6664,  -6661,  -6658,
+  -6655,  -6651,  -6647,  -6642,  -6638,  -6633,  -6628,  -6622,  -6617,  -6610,  -6604,  -6597,  -6591,  -6583,  -6576,  -6568,
+  -6560,  -6552,  -6543,  -6534,  -6525,  -6515,  -6506,  -6495,  -6485,  -6475,  -6464,  -6452,  -6441,  -6429,  -6417,  -6405,
+  -6392,  -6380,  -6367,  -6353,  -6340,  -6326,  -6312,  -6297,  -6282,  -6268,  -6252,  -6237,  -6221,  -6205,  -6189,  -6172,
+  -6156,  -6139,  -6121,  -6104,  -6086,  -6068,  -6050,  -6031,  -6013,  -5994,  -5974,  -5955,  -5935,  -5915,  -5895,  -5874,
+  -5854,  -5833,  -5812,  -5790,  -5769,  -5747,  -5725,  -5702,  -5680,  -5657,  -5634,  -5611,  -5587,  -5564,  -5540,  -5516,
+  -5492,  -5467,  -5442,  -5417,  -5392,  -5367,  -5341,  -5316,  -5290,  -5264,  -5237,  -5211,  -5184,  -5157,  -5130,  -5102,
+  -5075,  -5047,  -5019,  -4991,  -4963,  -4934,  -4906,  -4877,  -4848,  -4819,  -4789,  -4760,  -4730,  -4700,  -4670,  -4640,
+  -4610,  -4579,  -4548,  -4517,  -4486,  -4455,  -4424,  -4392,  -4361,  -4329,  -4297,  -4265,  -4233,  -4200,  -4168,  -4135,
+  -4102,  -4069,  -4036,  -4003,  -3970,  -3936,  -3903,  -3869,  -3835,  -3801,  -3767,  -3733,  -3698,  -3664,  -3629,  -3595,
+  -3560,  -3525,  -3490,  -3455,  -3420,  -3384,  -3349,  -3313,  -3278,  -3242,  -3206,  -3170,  -3134,  -3098,  -3062,  -3026,
+  -2990,  -2953,  -2917,  -2880,  -2844,  -2807,  -2770,  -2733,  -2696,  -2659,  -2622,  -2585,  -2548,  -2511,  -2473,  -2436,
+  -2399,  -2361,  -2324,  -2286,  -2249,  -2211,  -2173,  -2136,  -2098,  -2060,  -2022,  -1984,  -1946,  -1908,  -1871,  -1833,
+  -1795,  -1757,  -1718,  -1680,  -1642,  -1604,  -1566,  -1528,  -1490,  -1452,  -1414,  -1375,  -1337,  -1299,  -1261,  -1223,
+  -1185,  -1147,  -1108,  -1070,  -1032,   -994,   -956,   -918,   -880,   -842,   -804,   -766,   -728,   -690,   -652,   -614,
+   -576,   -539,   -501,   -463,   -425,   -388,   -350,   -313,   -275,   -238,   -200,   -163,   -125,    -88,    -51,    -14,
+     22,     59,     96,    133,    170,    207,    244,    280,    317,    353,    390,    426,    462,    498,    535,    571,
+    606,    642,    678,    714,    749,    785,    820,    855,    891,    926,    961,    996,   1030,   1065,   1100,   1134,
+   1169,   1203,   1237,   1271,   1305,   1339,   1372,   1406,   1439,   1473,   1506,   1539,   1572,   1605,   1637,   1670,
+   1702,   1735,   1767,   1799,   1831,   1863,   1894,   1926,   1957,   1988,   2019,   2050,   2081,   2112,   2142,   2172,
+   2203,   2233,   2263,   2292,   2322,   2351,   2380,   2410,   2438,   2467,   2496,   2524,   2553,   2581,   2609,   2636,
+   2664,   2691,   2719,   2746,   2773,   2799,   2826,   2852,   2879,   2905,   2931,   2956,   2982,   3007,   3032,   3057,
+   3082,   3107,   3131,   3155,   3179,   3203,   3227,   3250,   3274,   3297,   3320,   3342,   3365,   3387,   3409,   3431,
+   3453,   3475,   3496,   3517,   3538,   3559,   3579,   3600,   3620,   3640,   3660,   3679,   3699,   3718,   3737,   3755,
+   3774,   3792,   3810,   3828,   3846,   3863,   3881,   3898,   3915,   3931,   3948,   3964,   3980,   3996,   4011,   4027,
+   4042,   4057,   4072,   4086,   4100,   4115,   4129,   4142,   4156,   4169,   4182,   4195,   4207,   4220,   4232,   4244,
+   4256,   4267,   4278,   4289,   4300,   4311,   4321,   4332,   4342,   4351,   4361,   4370,   4379,   4388,   4397,   4405,
+   4414,   4422,   4430,   4437,   4445,   4452,   4459,   4465,   4472,   4478,   4484,   4490,   4496,   4501,   4506,   4511,
+   4516,   4521,   4525,   4529,   4533,   4537,   4540,   4543,   4546,   4549,   4552,   4554,   4556,   4558,   4560,   4562,
+   4563,   4564,   4565,   4566,   4566,   4566,   4566,   4566,   4566,   4565,   4564,   4563,   4562,   4561,   4559,   4557,
+   4555,   4553,   4551,   4548,   4545,   4542,   4539,   4535,   4532,   4528,   4524,   4520,   4515,   4510,   4506,   4500,
+   4495,   4490,   4484,   4478,   4472,   4466,   4459,   4453,   4446,   4439,   4432,   4424,   4417,   4409,   4401,   4393,
+   4385,   4376,   4367,   4358,   4349,   4340,   4331,   4321,   4311,   4301,   4291,   4281,   4270,   4260,   4249,   4238,
+   4227,   4215,   4204,   4192,   4180,   4168,   4156,   4143,   4131,   4118,   4105,   4092,   4079,   4065,   4052,   4038,
+   4024,   4010,   3996,   3982,   3967,   3953,   3938,   3923,   3908,   3893,   3877,   3862,   3846,   3830,   3814,   3798,
+   3782,   3765,   3749,   3732,   3715,   3698,   3681,   3664,   3647,   3629,   3612,   3594,   3576,   3558,   3540,   3522,
+   3503,   3485,   3466,   3447,   3428,   3409,   3390,   3371,   3352,   3332,   3313,   3293,   3273,   3253,   3233,   3213,
+   3193,   3173,   3152,   3132,   3111,   3091,   3070,   3049,   3028,   3007,   2985,   2964,   2943,   2921,   2900,   2878,
+   2856,   2835,   2813,   2791,   2769,   2746,   2724,   2702,   2680,   2657,   2635,   2612,   2589,   2567,   2544,   2521,
+   2498,   2475,   2452,   2429,   2406,   2382,   2359,   2336,   2312,   2289,   2265,   2242,   2218,   2195,   2171,   2147,
+   2123,   2099,   2075,   2052,   2028,   2004,   1979,   1955,   1931,   1907,   1883,   1859,   1834,   1810,   1786,   1762,
+   1737,   1713,   1688,   1664,   1639,   1615,   1591,   1566,   1542,   1517,   1492,   1468,   1443,   1419,   1394,   1370,
+   1345,   1320,   1296,   1271,   1247,   1222,   1197,   1173,   1148,   1124,   1099,   1075,   1050,   1025,   1001,    976,
+    952,    927,    903,    878,    854,    830,    805,    781,    757,    732,    708,    684,    659,    635,    611,    587,
+    563,    539,    515,    491,    467,    443,    419,    395,    371,    347,    324,    300,    276,    253,    229,    206,
+    182,    159,    136,    112,     89,     66,     43,     20,     -2,    -25,    -48,    -71,    -94,   -116,   -139,   -161,
+   -184,   -206,   -229,   -251,   -273,   -295,   -317,   -339,   -361,   -383,   -405,   -427,   -448,   -470,   -491,   -513,
+   -534,   -555,   -576,   -597,   -618,   -639,   -660,   -681,   -701,   -722,   -742,   -762,   -783,   -803,   -823,   -843,
+   -863,   -882,   -902,   -922,   -941,   -960,   -980,   -999,  -1018,  -1037,  -1056,  -1075,  -1093,  -1112,  -1130,  -1149,
+  -1167,  -1185,  -1203,  -1221,  -1239,  -1256,  -1274,  -1292,  -1309,  -1326,  -1343,  -1360,  -1377,  -1394,  -1411,  -1427,
+  -1444,  -1460,  -1476,  -1492,  -1508,  -1524,  -1540,  -1556,  -1571,  -1586,  -1602,  -1617,  -1632,  -1647,  -1661,  -1676,
+  -1691,  -1705,  -1719,  -1733,  -1747,  -1761,  -1775,  -1789,  -1802,  -1816,  -1829,  -1842,  -1855,  -1868,  -1881,  -1893,
+  -1906,  -1918,  -1930,  -1942,  -1954,  -1966,  -1978,  -1989,  -2001,  -2012,  -2023,  -2034,  -2045,  -2056,  -2067,  -2077,
+  -2088,  -2098,  -2108,  -2118,  -2128,  -2137,  -2147,  -2156,  -2166,  -2175,  -2184,  -2193,  -2201,  -2210,  -2218,  -2227,
+  -2235,  -2243,  -2251,  -2259,  -2266,  -2274,  -2281,  -2289,  -2296,  -2303,  -2310,  -2316,  -2323,  -2329,  -2336,  -2342,
+  -2348,  -2354,  -2359,  -2365,  -2371,  -2376,  -2381,  -2386,  -2391,  -2396,  -2401,  -2405,  -2410,  -2414,  -2418,  -2422,
+  -2426,  -2430,  -2433,  -2437,  -2440,  -2443,  -2446,  -2449,  -2452,  -2455,  -2457,  -2460,  -2462,  -2464,  -2466,  -2468,
+  -2470,  -2472,  -2473,  -2474,  -2476,  -2477,  -2478,  -2479,  -2479,  -2480,  -2481,  -2481,  -2481,  -2481,  -2481,  -2481,
+  -2481,  -2480,  -2480,  -2479,  -2479,  -2478,  -2477,  -2476,  -2474,  -2473,  -2471,  -2470,  -2468,  -2466,  -2464,  -2462,
+  -2460,  -2458,  -2455,  -2453,  -2450,  -2447,  -2444,  -2441,  -2438,  -2435,  -2432,  -2428,  -2425,  -2421,  -2417,  -2413,
+  -2409,  -2405,  -2401,  -2397,  -2392,  -2388,  -2383,  -2378,  -2373,  -2369,  -2363,  -2358,  -2353,  -2348,  -2342,  -2337,
+  -2331,  -2325,  -2319,  -2313,  -2307,  -2301,  -2295,  -2289,  -2282,  -2276,  -2269,  -2262,  -2256,  -2249,  -2242,  -2235,
+  -2228,  -2220,  -2213,  -2206,  -2198,  -2190,  -2183,  -2175,  -2167,  -2159,  -2151,  -2143,  -2135,  -2127,  -2119,  -2110,
+  -2102,  -2093,  -2085,  -2076,  -2067,  -2058,  -2049,  -2040,  -2031,  -2022,  -2013,  -2004,  -1994,  -1985,  -1976,  -1966,
+  -1956,  -1947,  -1937,  -1927,  -1917,  -1908,  -1898,  -1888,  -1878,  -1867,  -1857,  -1847,  -1837,  -1826,  -1816,  -1806,
+  -1795,  -1784,  -1774,  -1763,  -1752,  -1742,  -1731,  -1720,  -1709,  -1698,  -1687,  -1676,  -1665,  -1654,  -1643,  -1632,
+  -1621,  -1609,  -1598,  -1587,  -1575,  -1564,  -1553,  -1541,  -1530,  -1518,  -1507,  -1495,  -1483,  -1472,  -1460,  -1448,
+  -1437,  -1425,  -1413,  -1401,  -1390,  -1378,  -1366,  -1354,  -1342,  -1330,  -1318,  -1306,  -1295,  -1283,  -1271,  -1259,
+  -1247,  -1235,  -1223,  -1211,  -1199,  -1186,  -1174,  -1162,  -1150,  -1138,  -1126,  -1114,  -1102,  -1090,  -1078,  -1066,
+  -1054,  -1042,  -1029,  -1017,  -1005,   -993,   -981,   -969,   -957,   -945,   -933,   -921,   -909,   -897,   -885,   -873,
+   -861,   -849,   -837,   -825,   -813,   -801,   -789,   -778,   -766,   -754,   -742,   -730,   -718,   -707,   -695,   -683,
+   -672,   -660,   -648,   -637,   -625,   -614,   -602,   -591,   -579,   -568,   -556,   -545,   -534,   -522,   -511,   -500,
+   -489,   -478,   -466,   -455,   -444,   -433,   -422,   -411,   -400,   -390,   -379,   -368,   -357,   -347,   -336,   -325,
+   -315,   -304,   -294,   -283,   -273,   -263,   -252,   -242,   -232,   -222,   -212,   -202,   -192,   -182,   -172,   -162,
+   -152,   -142,   -133,   -123,   -113,   -104,    -94,    -85,    -76,    -66,    -57,    -48,    -39,    -30,    -21,    -12,
+     -3,      5,     14,     22,     31,     40,     48,     57,     65,     73,     82,     90,     98,    106,    114,    122,
+    130,    138,    146,    153,    161,    169,    176,    183,    191,    198,    205,    213,    220,    227,    234,    240,
+    247,    254,    261,    267,    274,    280,    287,    293,    299,    305,    312,    318,    324,    330,    335,    341,
+    347,    352,    358,    363,    369,    374,    379,    385,    390,    395,    400,    405,    409,    414,    419,    423,
+    428,    432,    437,    441,    445,    449,    453,    457,    461,    465,    469,    473,    476,    480,    483,    487,
+    490,    493,    497,    500,    503,    506,    509,    511,    514,    517,    519,    522,    524,    527,    529,    531,
+    534,    536,    538,    540,    542,    543,    545,    547,    548,    550,    551,    553,    554,    555,    557,    558,
+    559,    560,    561,    562,    562,    563,    564,    564,    565,    565,    566,    566,    566,    566,    566,    566,
+    566,    566,    566,    566,    566,    565,    565,    564,    564,    563,    563,    562,    561,    560,    559,    559,
+    558,    556,    555,    554,    553,    552,    550,    549,    547,    546,    544,    543,    541,    539,    537,    535,
+    533,    532,    529,    527,    525,    523,    521,    519,    516,    514,    511,    509,    507,    504,    501,    499,
+    496,    493,    490,    488,    485,    482,    479,    476,    473,    470,    466,    463,    460,    457,    454,    450,
+    447,    443,    440,    436,    433,    429,    426,    422,    419,    415,    411,    407,    404,    400,    396,    392,
+    388,    384,    380,    376,    372,    368,    364,    360,    356,    352,    348,    343,    339,    335,    331,    326,
+    322,    318,    314,    309,    305,    300,    296,    292,    287,    283,    278,    274,    269,    265,    260,    256,
+    251,    247,    242,    238,    233,    229,    224,    219,    215,    210,    206,    201,    196,    192,    187,    183,
+    178,    173,    169,    164,    159,    155,    150,    146,    141,    136,    132,    127,    123,    118,    114,    109,
+    104,    100,     95,     91,     86,     82,     77,     73,     68,     64,     60,     55,     51,     46,     42,     38,
+     33
+};
@@ -1,183 +1,151 @@
-const int16_t drum_perc[] = { 0, 
-
-  -5453,  -6705,  -7894,  -9063, -10185, -11281, -12352, -13402, -14427, -15431, -16413, -17372, -18312, -19231, -20130,
- -21009, -21867, -22707, -23527, -24329, -25114, -25881, -26630, -27363, -28209, -27627, -26780, -25922, -25172, -24566, -24094,
- -23728, -23436, -23189, -22966, -22754, -22546, -22336, -22124, -21909, -21692, -21472, -21245, -20685, -18862, -16062, -13756,
- -11744,  -9846,  -8418,  -7106,  -5977,  -5005,  -4072,  -3234,  -2447,  -1709,  -1009,   -353,    264,    844,   1383,   1891,
-   2364,   2821,   3257,   3641,   3967,   4239,   4460,   4638,   4777,   4883,   4958,   5007,   5030,   5032,   5012,   4972,
-   4914,   4838,   4747,   4640,   4519,   4385,   4238,   4080,   3911,   3731,   3542,   3344,   3137,   2920,   2354,    251,
-  -3279,  -6238,  -8642, -10891, -12484, -13835, -14947, -15801, -16581, -17221, -17772, -18245, -18652, -18989, -19263, -19477,
- -19628, -19727, -19773, -19768, -19714, -19614, -19472, -19290, -19072, -18820, -18536, -18223, -17883, -17518, -17130, -16721,
- -16291, -15842, -15376, -14895, -14398, -13887, -13364, -12829, -12282, -11725, -11159, -10583,  -9999,  -9407,  -8808,  -8201,
-  -7321,  -4977,   -973,   2611,   5499,   8263,  10350,  12126,  13678,  14932,  16103,  17130,  18055,  18898,  19669,  20367,
-  20995,  21561,  22058,  22500,  22885,  23215,  23492,  23719,  23901,  24040,  24139,  24201,  24229,  24225,  24190,  24128,
-  24039,  23926,  23790,  23633,  23456,  23259,  23046,  22815,  22569,  22308,  22033,  21744,  21443,  21131,  20806,  20471,
-  20125,  19769,  19206,  17314,  13606,  10099,   7397,   4802,   2856,   1289,    -82,  -1134,  -2096,  -2921,  -3640,  -4279,
-  -4847,  -5347,  -5778,  -6152,  -6459,  -6715,  -6917,  -7067,  -7168,  -7223,  -7237,  -7211,  -7149,  -7054,  -6929,  -6776,
-  -6597,  -6394,  -6169,  -5925,  -5662,  -5381,  -5086,  -4775,  -4452,  -4116,  -3769,  -3411,  -3044,  -2668,  -2284,  -1892,
-  -1493,  -1088,   -676,   -258,    290,   2002,   5604,   9246,  12005,  14646,  16689,  18284,  19702,  20785,  21760,  22605,
-  23330,  23975,  24543,  25042,  25468,  25833,  26131,  26373,  26558,  26689,  26768,  26799,  26785,  26730,  26636,  26506,
-  26344,  26152,  25931,  25685,  25415,  25122,  24809,  24476,  24126,  23760,  23378,  22982,  22573,  22152,  21719,  21276,
-  20823,  20361,  19889,  19410,  18922,  18427,  17852,  16289,  12837,   9087,   6247,   3555,   1381,   -289,  -1803,  -2986,
-  -4043,  -4985,  -5804,  -6546,  -7212,  -7813,  -8343,  -8815,  -9224,  -9579,  -9880, -10129, -10328, -10482, -10593, -10665,
- -10701, -10703, -10675, -10619, -10536, -10430, -10301, -10152,  -9985,  -9800,  -9599,  -9383,  -9154,  -8912,  -8659,  -8395,
-  -8121,  -7839,  -7547,  -7248,  -6941,  -6627,  -6307,  -5981,  -5609,  -4432,  -1430,   2111,   4759,   7207,   9227,  10699,
-  12024,  13030,  13891,  14650,  15282,  15838,  16319,  16737,  17086,  17378,  17608,  17786,  17911,  17985,  18011,  17992,
-  17932,  17833,  17699,  17533,  17337,  17113,  16864,  16592,  16299,  15986,  15655,  15307,  14944,  14567,  14176,  13774,
-  13361,  12938,  12506,  12065,  11617,  11161,  10698,  10229,   9754,   9273,   8768,   7626,   4776,   1172,  -1601,  -4109,
-  -6279,  -7878,  -9327, -10483, -11471, -12372, -13144, -13842, -14466, -15030, -15526, -15967, -16349, -16676, -16954, -17185,
- -17368, -17508, -17608, -17670, -17698, -17694, -17660, -17599, -17514, -17405, -17276, -17127, -16960, -16776, -16577, -16364,
- -16138, -15900, -15651, -15392, -15123, -14845, -14559, -14266, -13965, -13657, -13343, -13024, -12690, -11868,  -9488,  -6175,
-  -3592,  -1345,    649,   2068,   3328,   4326,   5140,   5878,   6491,   7033,   7504,   7919,   8271,   8570,   8815,   9007,
-   9155,   9257,   9316,   9335,   9316,   9262,   9176,   9060,   8918,   8751,   8561,   8351,   8121,   7874,   7611,   7333,
-   7042,   6739,   6424,   6099,   5764,   5421,   5070,   4712,   4347,   3976,   3600,   3218,   2832,   2441,   2042,   1282,
-   -858,  -4063,  -6672,  -8871, -10889, -12347, -13623, -14673, -15522, -16302, -16962, -17550, -18070, -18535, -18940, -19293,
- -19594, -19844, -20050, -20213, -20333, -20414, -20457, -20467, -20445, -20394, -20317, -20215, -20090, -19945, -19780, -19598,
- -19400, -19187, -18959, -18720, -18468, -18206, -17934, -17653, -17363, -17065, -16760, -16449, -16131, -15807, -15478, -15144,
- -14804, -14203, -12405,  -9456,  -6949,  -4912,  -3000,  -1614,   -434,    555,   1336,   2055,   2662,   3198,   3671,   4093,
-   4460,   4777,   5049,   5271,   5455,   5598,   5701,   5769,   5802,   5805,   5778,   5725,   5648,   5549,   5429,   5291,
-   5135,   4964,   4778,   4579,   4369,   4147,   3915,   3674,   3424,   3167,   2903,   2632,   2355,   2073,   1786,   1494,
-   1198,    898,    594,    109,  -1386,  -4067,  -6472,  -8363, -10161, -11481, -12568, -13498, -14213, -14867, -15419, -15898,
- -16320, -16690, -17010, -17281, -17510, -17692, -17836, -17942, -18010, -18043, -18044, -18015, -17958, -17876, -17771, -17643,
- -17497, -17332, -17150, -16953, -16742, -16518, -16283, -16036, -15779, -15514, -15239, -14957, -14668, -14373, -14071, -13764,
- -13452, -13135, -12813, -12488, -12158, -11706, -10421,  -7956,  -5601,  -3784,  -2043,   -721,    343,   1279,   2005,   2667,
-   3240,   3741,   4188,   4588,   4942,   5250,   5519,   5745,   5936,   6092,   6213,   6302,   6361,   6392,   6398,   6380,
-   6341,   6283,   6206,   6112,   6004,   5881,   5746,   5599,   5441,   5274,   5097,   4913,   4720,   4521,   4316,   4105,
-   3888,   3667,   3441,   3211,   2977,   2740,   2499,   2187,   1198,   -922,  -3094,  -4726,  -6280,  -7481,  -8404,  -9221,
-  -9836, -10383, -10853, -11250, -11600, -11903, -12165, -12383, -12566, -12709, -12820, -12897, -12942, -12957, -12944, -12906,
- -12844, -12760, -12656, -12533, -12394, -12240, -12071, -11890, -11696, -11492, -11278, -11055, -10823, -10584, -10338, -10085,
-  -9827,  -9564,  -9295,  -9022,  -8746,  -8465,  -8181,  -7894,  -7603,  -7274,  -6412,  -4495,  -2390,   -800,    696,   1908,
-   2829,   3660,   4304,   4874,   5379,   5814,   6204,   6550,   6859,   7128,   7364,   7564,   7733,   7872,   7981,   8062,
-   8118,   8150,   8159,   8149,   8120,   8075,   8013,   7938,   7849,   7748,   7636,   7514,   7383,   7244,   7096,   6942,
-   6781,   6614,   6442,   6265,   6083,   5897,   5708,   5514,   5318,   5118,   4916,   4693,   4063,   2485,    602,   -810,
-  -2107,  -3185,  -3970,  -4674,  -5211,  -5668,  -6072,  -6408,  -6704,  -6960,  -7182,  -7368,  -7524,  -7647,  -7743,  -7810,
-  -7852,  -7868,  -7861,  -7832,  -7784,  -7717,  -7634,  -7536,  -7423,  -7299,  -7162,  -7015,  -6858,  -6692,  -6518,  -6336,
-  -6148,  -5954,  -5754,  -5549,  -5340,  -5126,  -4909,  -4688,  -4464,  -4237,  -4008,  -3776,  -3542,  -3298,  -2755,  -1385,
-    373,   1725,   2936,   3985,   4749,   5435,   5978,   6436,   6850,   7200,   7513,   7788,   8034,   8246,   8431,   8587,
-   8715,   8819,   8900,   8958,   8995,   9011,   9010,   8992,   8959,   8912,   8852,   8780,   8697,   8605,   8503,   8393,
-   8276,   8151,   8021,   7884,   7743,   7596,   7446,   7291,   7133,   6971,   6806,   6639,   6469,   6297,   6122,   5942,
-   5551,   4461,   2933,   1733,    698,   -224,   -881,  -1461,  -1921,  -2295,  -2633,  -2913,  -3159,  -3373,  -3560,  -3717,
-  -3850,  -3959,  -4042,  -4105,  -4147,  -4169,  -4173,  -4159,  -4129,  -4085,  -4028,  -3958,  -3878,  -3787,  -3687,  -3579,
-  -3463,  -3340,  -3210,  -3075,  -2935,  -2790,  -2641,  -2488,  -2331,  -2171,  -2009,  -1844,  -1676,  -1507,  -1336,  -1163,
-   -988,   -811,   -491,    394,   1735,   2832,   3747,   4588,   5191,   5714,   6142,   6483,   6795,   7055,   7284,   7484,
-   7661,   7812,   7940,   8047,   8132,   8198,   8247,   8277,   8291,   8290,   8274,   8246,   8206,   8154,   8093,   8023,
-   7945,   7859,   7767,   7668,   7563,   7453,   7338,   7220,   7097,   6971,   6841,   6709,   6574,   6437,   6298,   6157,
-   6014,   5869,   5723,   5576,   5336,   4656,   3538,   2579,   1808,   1085,    562,    122,   -245,   -531,   -793,  -1011,
-  -1201,  -1367,  -1513,  -1637,  -1742,  -1829,  -1897,  -1950,  -1988,  -2010,  -2019,  -2015,  -1999,  -1972,  -1935,  -1890,
-  -1836,  -1775,  -1707,  -1633,  -1553,  -1469,  -1379,  -1286,  -1189,  -1089,   -986,   -880,   -772,   -661,   -549,   -435,
-   -320,   -203,    -86,     32,    151,    272,    448,    948,   1840,   2646,   3274,   3869,   4305,   4658,   4959,   5188,
-   5393,   5565,   5711,   5837,   5945,   6037,   6111,   6171,   6215,   6247,   6265,   6271,   6265,   6249,   6223,   6188,
-   6144,   6093,   6036,   5972,   5903,   5828,   5749,   5666,   5579,   5488,   5395,   5299,   5200,   5100,   4997,   4893,
-   4787,   4681,   4572,   4463,   4354,   4243,   4132,   4020,   3878,   3513,   2827,   2166,   1661,   1182,    819,    532,
-    281,     91,    -78,   -223,   -347,   -455,   -549,   -630,   -697,   -753,   -797,   -830,   -854,   -868,   -873,   -870,
-   -859,   -841,   -817,   -787,   -752,   -713,   -669,   -622,   -571,   -517,   -461,   -402,   -341,   -279,   -214,   -148,
-    -81,    -14,     54,    124,    194,    265,    335,    407,    478,    549,    634,    856,   1312,   1779,   2127,   2452,
-   2701,   2887,   3048,   3165,   3265,   3348,   3414,   3468,   3512,   3547,   3571,   3587,   3594,   3594,   3587,   3573,
-   3552,   3525,   3493,   3456,   3414,   3369,   3320,   3268,   3213,   3155,   3096,   3034,   2970,   2906,   2839,   2772,
-   2704,   2635,   2566,   2496,   2426,   2355,   2284,   2214,   2143,   2073,   2003,   1933,   1859,   1717,   1440,   1141,
-    915,    709,    544,    422,    315,    234,    166,    109,     62,     22,    -10,    -37,    -57,    -73,    -83,    -88,
-    -89,    -86,    -78,    -68,    -54,    -38,    -18,      2,     25,     50,     76,    104,    132,    162,    192,    223,
-    254,    285,    317,    349,    380,    412,    443,    474,    505,    535,    565,    594,    623,    651,    679,    722,
-    796,    876,    932,    977,   1008,   1024,   1033,   1034,   1028,   1019,   1006,    990,    970,    949,    925,    899,
-    871,    840,    801,    762,    727,    695,    666,    640,    616,    593,    572,    552,    533,    514,    496,    479,
-    462,    447,    432,    417,    403,    390,    377,    365,    354,    342,    332,    322,    312,    302,    293,    285,
-    277,    269,    261,    253,    246,    239,    233,    226,    220,    214,    208,    202,    196,    190,    185,    180,
-    174,    169,    164,    159,    154,    149,    144,    139,    134,    129,    124,    119,    114,    109,    105,    100,
-     95,     90,     85,     80,     75,     70,     65,     60,     54,     49,     44,     39,     34,     28,     23,     18,
-     12,      7,      2,     -3,     -8,    -14,    -19,    -25,    -31,    -36,    -42,    -47,    -53,    -59,    -64,    -70,
-    -76,    -81,    -87,    -93,    -98,   -104,   -110,   -115,   -121,   -127,   -132,   -138,   -144,   -149,   -155,   -160,
-   -166,   -171,   -177,   -182,   -188,   -193,   -199,   -204,   -209,   -214,   -220,   -225,   -230,   -235,   -240,   -245,
-   -250,   -255,   -260,   -265,   -270,   -275,   -279,   -284,   -289,   -293,   -298,   -302,   -307,   -311,   -316,   -320,
-   -324,   -328,   -333,   -337,   -341,   -345,   -349,   -353,   -356,   -360,   -364,   -368,   -371,   -375,   -379,   -382,
-   -386,   -389,   -392,   -396,   -399,   -402,   -405,   -408,   -411,   -415,   -417,   -420,   -423,   -426,   -429,   -432,
-   -434,   -437,   -440,   -442,   -445,   -447,   -450,   -452,   -455,   -457,   -459,   -461,   -464,   -466,   -468,   -470,
-   -472,   -474,   -476,   -478,   -480,   -482,   -484,   -485,   -487,   -489,   -491,   -492,   -494,   -495,   -497,   -498,
-   -500,   -501,   -503,   -504,   -505,   -507,   -508,   -509,   -510,   -512,   -513,   -514,   -515,   -516,   -517,   -518,
-   -519,   -520,   -521,   -522,   -522,   -523,   -524,   -525,   -525,   -526,   -527,   -527,   -528,   -529,   -529,   -530,
-   -530,   -531,   -531,   -532,   -532,   -532,   -533,   -533,   -533,   -534,   -534,   -534,   -534,   -534,   -534,   -535,
-   -535,   -535,   -535,   -535,   -535,   -535,   -535,   -535,   -534,   -534,   -534,   -534,   -534,   -534,   -533,   -533,
-   -533,   -532,   -532,   -532,   -531,   -531,   -530,   -530,   -530,   -529,   -529,   -528,   -527,   -527,   -526,   -526,
-   -525,   -524,   -524,   -523,   -522,   -522,   -521,   -520,   -519,   -518,   -518,   -517,   -516,   -515,   -514,   -513,
-   -512,   -511,   -510,   -509,   -508,   -507,   -506,   -505,   -504,   -503,   -502,   -501,   -500,   -499,   -497,   -496,
-   -495,   -494,   -493,   -491,   -490,   -489,   -487,   -486,   -485,   -484,   -482,   -481,   -479,   -478,   -477,   -475,
-   -474,   -472,   -471,   -469,   -468,   -467,   -465,   -464,   -462,   -460,   -459,   -457,   -456,   -454,   -453,   -451,
-   -449,   -448,   -446,   -445,   -443,   -441,   -440,   -438,   -436,   -434,   -433,   -431,   -429,   -428,   -426,   -424,
-   -422,   -421,   -419,   -417,   -415,   -413,   -412,   -410,   -408,   -406,   -404,   -403,   -401,   -399,   -397,   -395,
-   -393,   -391,   -389,   -388,   -386,   -384,   -382,   -380,   -378,   -376,   -374,   -372,   -370,   -368,   -367,   -365,
-   -363,   -361,   -359,   -357,   -355,   -353,   -351,   -349,   -347,   -345,   -343,   -341,   -339,   -337,   -335,   -333,
-   -331,   -329,   -327,   -325,   -323,   -321,   -319,   -317,   -315,   -313,   -311,   -309,   -307,   -305,   -303,   -301,
-   -299,   -297,   -295,   -293,   -291,   -289,   -287,   -285,   -283,   -281,   -279,   -277,   -275,   -273,   -271,   -269,
-   -267,   -265,   -263,   -261,   -259,   -257,   -255,   -253,   -251,   -249,   -247,   -245,   -243,   -241,   -239,   -237,
-   -235,   -233,   -231,   -229,   -227,   -225,   -224,   -222,   -220,   -218,   -216,   -214,   -212,   -210,   -208,   -206,
-   -204,   -202,   -200,   -199,   -197,   -195,   -193,   -191,   -189,   -187,   -185,   -183,   -182,   -180,   -178,   -176,
-   -174,   -172,   -170,   -169,   -167,   -165,   -163,   -161,   -159,   -158,   -156,   -154,   -152,   -150,   -149,   -147,
-   -145,   -143,   -142,   -140,   -138,   -136,   -135,   -133,   -131,   -129,   -128,   -126,   -124,   -123,   -121,   -119,
-   -117,   -116,   -114,   -112,   -111,   -109,   -107,   -106,   -104,   -103,   -101,    -99,    -98,    -96,    -94,    -93,
-    -91,    -90,    -88,    -86,    -85,    -83,    -82,    -80,    -79,    -77,    -76,    -74,    -73,    -71,    -70,    -68,
-    -67,    -65,    -64,    -62,    -61,    -59,    -58,    -56,    -55,    -54,    -52,    -51,    -49,    -48,    -47,    -45,
-    -44,    -42,    -41,    -40,    -38,    -37,    -36,    -34,    -33,    -32,    -30,    -29,    -28,    -27,    -25,    -24,
-    -23,    -22,    -20,    -19,    -18,    -17,    -15,    -14,    -13,    -12,    -11,     -9,     -8,     -7,     -6,     -5,
-     -4,     -2,     -1,      0,      0,      1,      2,      3,      4,      5,      6,      8,      9,     10,     11,     12,
-     13,     14,     15,     16,     17,     18,     19,     20,     21,     22,     23,     23,     24,     25,     26,     27,
-     28,     29,     30,     31,     32,     32,     33,     34,     35,     36,     37,     38,     38,     39,     40,     41,
-     42,     42,     43,     44,     45,     45,     46,     47,     48,     48,     49,     50,     50,     51,     52,     52,
-     53,     54,     54,     55,     56,     56,     57,     58,     58,     59,     59,     60,     61,     61,     62,     62,
-     63,     63,     64,     65,     65,     66,     66,     67,     67,     68,     68,     69,     69,     70,     70,     70,
-     71,     71,     72,     72,     73,     73,     74,     74,     74,     75,     75,     76,     76,     76,     77,     77,
-     77,     78,     78,     78,     79,     79,     79,     80,     80,     80,     81,     81,     81,     81,     82,     82,
-     82,     82,     83,     83,     83,     83,     84,     84,     84,     84,     84,     85,     85,     85,     85,     85,
-     86,     86,     86,     86,     86,     86,     86,     87,     87,     87,     87,     87,     87,     87,     87,     87,
+// Prepared by tools/sample_prep.py, trimmed at -60dB
+#define drum_perc_len        2282
+#define drum_perc_peak       28209
+#define drum_perc_gain       4240
+#define drum_perc_loop_start 0
+#define drum_perc_loop_end   0
+const int16_t drum_perc[] = {
+  -5453,  -6705,  -7894,  -9063, -10185, -11281, -12352, -13402, -14427, -15431, -16413, -17372, -18312, -19231, -20130, -21009,
+ -21867, -22707, -23527, -24329, -25114, -25881, -26630, -27363, -28209, -27627, -26780, -25922, -25172, -24566, -24094, -23728,
+ -23436, -23189, -22966, -22754, -22546, -22336, -22124, -21909, -21692, -21472, -21245, -20685, -18862, -16062, -13756, -11744,
+  -9846,  -8418,  -7106,  -5977,  -5005,  -4072,  -3234,  -2447,  -1709,  -1009,   -353,    264,    844,   1383,   1891,   2364,
+   2821,   3257,   3641,   3967,   4239,   4460,   4638,   4777,   4883,   4958,   5007,   5030,   5032,   5012,   4972,   4914,
+   4838,   4747,   4640,   4519,   4385,   4238,   4080,   3911,   3731,   3542,   3344,   3137,   2920,   2354,    251,  -3279,
+  -6238,  -8642, -10891, -12484, -13835, -14947, -15801, -16581, -17221, -17772, -18245, -18652, -18989, -19263, -19477, -19628,
+ -19727, -19773, -19768, -19714, -19614, -19472, -19290, -19072, -18820, -18536, -18223, -17883, -17518, -17130, -16721, -16291,
+ -15842, -15376, -14895, -14398, -13887, -13364, -12829, -12282, -11725, -11159, -10583,  -9999,  -9407,  -8808,  -8201,  -7321,
+  -4977,   -973,   2611,   5499,   8263,  10350,  12126,  13678,  14932,  16103,  17130,  18055,  18898,  19669,  20367,  20995,
+  21561,  22058,  22500,  22885,  23215,  23492,  23719,  23901,  24040,  24139,  24201,  24229,  24225,  24190,  24128,  24039,
+  23926,  23790,  23633,  23456,  23259,  23046,  22815,  22569,  22308,  22033,  21744,  21443,  21131,  20806,  20471,  20125,
+  19769,  19206,  17314,  13606,  10099,   7397,   4802,   2856,   1289,    -82,  -1134,  -2096,  -2921,  -3640,  -4279,  -4847,
+  -5347,  -5778,  -6152,  -6459,  -6715,  -6917,  -7067,  -7168,  -7223,  -7237,  -7211,  -7149,  -7054,  -6929,  -6776,  -6597,
+  -6394,  -6169,  -5925,  -5662,  -5381,  -5086,  -4775,  -4452,  -4116,  -3769,  -3411,  -3044,  -2668,  -2284,  -1892,  -1493,
+  -1088,   -676,   -258,    290,   2002,   5604,   9246,  12005,  14646,  16689,  18284,  19702,  20785,  21760,  22605,  23330,
+  23975,  24543,  25042,  25468,  25833,  26131,  26373,  26558,  26689,  26768,  26799,  26785,  26730,  26636,  26506,  26344,
+  26152,  25931,  25685,  25415,  25122,  24809,  24476,  24126,  23760,  23378,  22982,  22573,  22152,  21719,  21276,  20823,
+  20361,  19889,  19410,  18922,  18427,  17852,  16289,  12837,   9087,   6247,   3555,   1381,   -289,  -1803,  -2986,  -4043,
+  -4985,  -5804,  -6546,  -7212,  -7813,  -8343,  -8815,  -9224,  -9579,  -9880, -10129, -10328, -10482, -10593, -10665, -10701,
+ -10703, -10675, -10619, -10536, -10430, -10301, -10152,  -9985,  -9800,  -9599,  -9383,  -9154,  -8912,  -8659,  -8395,  -8121,
+  -7839,  -7547,  -7248,  -6941,  -6627,  -6307,  -5981,  -5609,  -4432,  -1430,   2111,   4759,   7207,   9227,  10699,  12024,
+  13030,  13891,  14650,  15282,  15838,  16319,  16737,  17086,  17378,  17608,  17786,  17911,  17985,  18011,  17992,  17932,
+  17833,  17699,  17533,  17337,  17113,  16864,  16592,  16299,  15986,  15655,  15307,  14944,  14567,  14176,  13774,  13361,
+  12938,  12506,  12065,  11617,  11161,  10698,  10229,   9754,   9273,   8768,   7626,   4776,   1172,  -1601,  -4109,  -6279,
+  -7878,  -9327, -10483, -11471, -12372, -13144, -13842, -14466, -15030, -15526, -15967, -16349, -16676, -16954, -17185, -17368,
+ -17508, -17608, -17670, -17698, -17694, -17660, -17599, -17514, -17405, -17276, -17127, -16960, -16776, -16577, -16364, -16138,
+ -15900, -15651, -15392, -15123, -14845, -14559, -14266, -13965, -13657, -13343, -13024, -12690, -11868,  -9488,  -6175,  -3592,
+  -1345,    649,   2068,   3328,   4326,   5140,   5878,   6491,   7033,   7504,   7919,   8271,   8570,   8815,   9007,   9155,
+   9257,   9316,   9335,   9316,   9262,   9176,   9060,   8918,   8751,   8561,   8351,   8121,   7874,   7611,   7333,   7042,
+   6739,   6424,   6099,   5764,   5421,   5070,   4712,   4347,   3976,   3600,   3218,   2832,   2441,   2042,   1282,   -858,
+  -4063,  -6672,  -8871, -10889, -12347, -13623, -14673, -15522, -16302, -16962, -17550, -18070, -18535, -18940, -19293, -19594,
+ -19844, -20050, -20213, -20333, -20414, -20457, -20467, -20445, -20394, -20317, -20215, -20090, -19945, -19780, -19598, -19400,
+ -19187, -18959, -18720, -18468, -18206, -17934, -17653, -17363, -17065, -16760, -16449, -16131, -15807, -15478, -15144, -14804,
+ -14203, -12405,  -9456,  -6949,  -4912,  -3000,  -1614,   -434,    555,   1336,   2055,   2662,   3198,   3671,   4093,   4460,
+   4777,   5049,   5271,   5455,   5598,   5701,   5769,   5802,   5805,   5778,   5725,   5648,   5549,   5429,   5291,   5135,
+   4964,   4778,   4579,   4369,   4147,   3915,   3674,   3424,   3167,   2903,   2632,   2355,   2073,   1786,   1494,   1198,
+    898,    594,    109,  -1386,  -4067,  -6472,  -8363, -10161, -11481, -12568, -13498, -14213, -14867, -15419, -15898, -16320,
+ -16690, -17010, -17281, -17510, -17692, -17836, -17942, -18010, -18043, -18044, -18015, -17958, -17876, -17771, -17643, -17497,
+ -17332, -17150, -16953, -16742, -16518, -16283, -16036, -15779, -15514, -15239, -14957, -14668, -14373, -14071, -13764, -13452,
+ -13135, -12813, -12488, -12158, -11706, -10421,  -7956,  -5601,  -3784,  -2043,   -721,    343,   1279,   2005,   2667,   3240,
+   3741,   4188,   4588,   4942,   5250,   5519,   5745,   5936,   6092,   6213,   6302,   6361,   6392,   6398,   6380,   6341,
+   6283,   6206,   6112,   6004,   5881,   5746,   5599,   5441,   5274,   5097,   4913,   4720,   4521,   4316,   4105,   3888,
+   3667,   3441,   3211,   2977,   2740,   2499,   2187,   1198,   -922,  -3094,  -4726,  -6280,  -7481,  -8404,  -9221,  -9836,
+ -10383, -10853, -11250, -11600, -11903, -12165, -12383, -12566, -12709, -12820, -12897, -12942, -12957, -12944, -12906, -12844,
+ -12760, -12656, -12533, -12394, -12240, -12071, -11890, -11696, -11492, -11278, -11055, -10823, -10584, -10338, -10085,  -9827,
+  -9564,  -9295,  -9022,  -8746,  -8465,  -8181,  -7894,  -7603,  -7274,  -6412,  -4495,  -2390,   -800,    696,   1908,   2829,
+   3660,   4304,   4874,   5379,   5814,   6204,   6550,   6859,   7128,   7364,   7564,   7733,   7872,   7981,   8062,   8118,
+   8150,   8159,   8149,   8120,   8075,   8013,   7938,   7849,   7748,   7636,   7514,   7383,   7244,   7096,   6942,   6781,
+   6614,   6442,   6265,   6083,   5897,   5708,   5514,   5318,   5118,   4916,   4693,   4063,   2485,    602,   -810,  -2107,
+  -3185,  -3970,  -4674,  -5211,  -5668,  -6072,  -6408,  -6704,  -6960,  -7182,  -7368,  -7524,  -7647,  -7743,  -7810,  -7852,
+  -7868,  -7861,  -7832,  -7784,  -7717,  -7634,  -7536,  -7423,  -7299,  -7162,  -7015,  -6858,  -6692,  -6518,  -6336,  -6148,
+  -5954,  -5754,  -5549,  -5340,  -5126,  -4909,  -4688,  -4464,  -4237,  -4008,  -3776,  -3542,  -3298,  -2755,  -1385,    373,
+   1725,   2936,   3985,   4749,   5435,   5978,   6436,   6850,   7200,   7513,   7788,   8034,   8246,   8431,   8587,   8715,
+   8819,   8900,   8958,   8995,   9011,   9010,   8992,   8959,   8912,   8852,   8780,   8697,   8605,   8503,   8393,   8276,
+   8151,   8021,   7884,   7743,   7596,   7446,   7291,   7133,   6971,   6806,   6639,   6469,   6297,   6122,   5942,   5551,
+   4461,   2933,   1733,    698,   -224,   -881,  -1461,  -1921,  -2295,  -2633,  -2913,  -3159,  -3373,  -3560,  -3717,  -3850,
+  -3959,  -4042,  -4105,  -4147,  -4169,  -4173,  -4159,  -4129,  -4085,  -4028,  -3958,  -3878,  -3787,  -3687,  -3579,  -3463,
+  -3340,  -3210,  -3075,  -2935,  -2790,  -2641,  -2488,  -2331,  -2171,  -2009,  -1844,  -1676,  -1507,  -1336,  -1163,   -988,
+   -811,   -491,    394,   1735,   2832,   3747,   4588,   5191,   5714,   6142,   6483,   6795,   7055,   7284,   7484,   7661,
+   7812,   7940,   8047,   8132,   8198,   8247,   8277,   8291,   8290,   8274,   8246,   8206,   8154,   8093,   8023,   7945,
+   7859,   7767,   7668,   7563,   7453,   7338,   7220,   7097,   6971,   6841,   6709,   6574,   6437,   6298,   6157,   6014,
+   5869,   5723,   5576,   5336,   4656,   3538,   2579,   1808,   1085,    562,    122,   -245,   -531,   -793,  -1011,  -1201,
+  -1367,  -1513,  -1637,  -1742,  -1829,  -1897,  -1950,  -1988,  -2010,  -2019,  -2015,  -1999,  -1972,  -1935,  -1890,  -1836,
+  -1775,  -1707,  -1633,  -1553,  -1469,  -1379,  -1286,  -1189,  -1089,   -986,   -880,   -772,   -661,   -549,   -435,   -320,
+   -203,    -86,     32,    151,    272,    448,    948,   1840,   2646,   3274,   3869,   4305,   4658,   4959,   5188,   5393,
+   5565,   5711,   5837,   5945,   6037,   6111,   6171,   6215,   6247,   6265,   6271,   6265,   6249,   6223,   6188,   6144,
+   6093,   6036,   5972,   5903,   5828,   5749,   5666,   5579,   5488,   5395,   5299,   5200,   5100,   4997,   4893,   4787,
+   4681,   4572,   4463,   4354,   4243,   4132,   4020,   3878,   3513,   2827,   2166,   1661,   1182,    819,    532,    281,
+     91,    -78,   -223,   -347,   -455,   -549,   -630,   -697,   -753,   -797,   -830,   -854,   -868,   -873,   -870,   -859,
+   -841,   -817,   -787,   -752,   -713,   -669,   -622,   -571,   -517,   -461,   -402,   -341,   -279,   -214,   -148,    -81,
+    -14,     54,    124,    194,    265,    335,    407,    478,    549,    634,    856,   1312,   1779,   2127,   2452,   2701,
+   2887,   3048,   3165,   3265,   3348,   3414,   3468,   3512,   3547,   3571,   3587,   3594,   3594,   3587,   3573,   3552,
+   3525,   3493,   3456,   3414,   3369,   3320,   3268,   3213,   3155,   3096,   3034,   2970,   2906,   2839,   2772,   2704,
+   2635,   2566,   2496,   2426,   2355,   2284,   2214,   2143,   2073,   2003,   1933,   1859,   1717,   1440,   1141,    915,
+    709,    544,    422,    315,    234,    166,    109,     62,     22,    -10,    -37,    -57,    -73,    -83,    -88,    -89,
+    -86,    -78,    -68,    -54,    -38,    -18,      2,     25,     50,     76,    104,    132,    162,    192,    223,    254,
+    285,    317,    349,    380,    412,    443,    474,    505,    535,    565,    594,    623,    651,    679,    722,    796,
+    876,    932,    977,   1008,   1024,   1033,   1034,   1028,   1019,   1006,    990,    970,    949,    925,    899,    871,
+    840,    801,    762,    727,    695,    666,    640,    616,    593,    572,    552,    533,    514,    496,    479,    462,
+    447,    432,    417,    403,    390,    377,    365,    354,    342,    332,    322,    312,    302,    293,    285,    277,
+    269,    261,    253,    246,    239,    233,    226,    220,    214,    208,    202,    196,    190,    185,    180,    174,
+    169,    164,    159,    154,    149,    144,    139,    134,    129,    124,    119,    114,    109,    105,    100,     95,
+     90,     85,     80,     75,     70,     65,     60,     54,     49,     44,     39,     34,     28,     23,     18,     12,
+      7,      2,     -3,     -8,    -14,    -19,    -25,    -31,    -36,    -42,    -47,    -53,    -59,    -64,    -70,    -76,
+    -81,    -87,    -93,    -98,   -104,   -110,   -115,   -121,   -127,   -132,   -138,   -144,   -149,   -155,   -160,   -166,
+   -171,   -177,   -182,   -188,   -193,   -199,   -204,   -209,   -214,   -220,   -225,   -230,   -235,   -240,   -245,   -250,
+   -255,   -260,   -265,   -270,   -275,   -279,   -284,   -289,   -293,   -298,   -302,   -307,   -311,   -316,   -320,   -324,
+   -328,   -333,   -337,   -341,   -345,   -349,   -353,   -356,   -360,   -364,   -368,   -371,   -375,   -379,   -382,   -386,
+   -389,   -392,   -396,   -399,   -402,   -405,   -408,   -411,   -415,   -417,   -420,   -423,   -426,   -429,   -432,   -434,
+   -437,   -440,   -442,   -445,   -447,   -450,   -452,   -455,   -457,   -459,   -461,   -464,   -466,   -468,   -470,   -472,
+   -474,   -476,   -478,   -480,   -482,   -484,   -485,   -487,   -489,   -491,   -492,   -494,   -495,   -497,   -498,   -500,
+   -501,   -503,   -504,   -505,   -507,   -508,   -509,   -510,   -512,   -513,   -514,   -515,   -516,   -517,   -518,   -519,
+   -520,   -521,   -522,   -522,   -523,   -524,   -525,   -525,   -526,   -527,   -527,   -528,   -529,   -529,   -530,   -530,
+   -531,   -531,   -532,   -532,   -532,   -533,   -533,   -533,   -534,   -534,   -534,   -534,   -534,   -534,   -535,   -535,
+   -535,   -535,   -535,   -535,   -535,   -535,   -535,   -534,   -534,   -534,   -534,   -534,   -534,   -533,   -533,   -533,
+   -532,   -532,   -532,   -531,   -531,   -530,   -530,   -530,   -529,   -529,   -528,   -527,   -527,   -526,   -526,   -525,
+   -524,   -524,   -523,   -522,   -522,   -521,   -520,   -519,   -518,   -518,   -517,   -516,   -515,   -514,   -513,   -512,
+   -511,   -510,   -509,   -508,   -507,   -506,   -505,   -504,   -503,   -502,   -501,   -500,   -499,   -497,   -496,   -495,
+   -494,   -493,   -491,   -490,   -489,   -487,   -486,   -485,   -484,   -482,   -481,   -479,   -478,   -477,   -475,   -474,
+   -472,   -471,   -469,   -468,   -467,   -465,   -464,   -462,   -460,   -459,   -457,   -456,   -454,   -453,   -451,   -449,
+   -448,   -446,   -445,   -443,   -441,   -440,   -438,   -436,   -434,   -433,   -431,   -429,   -428,   -426,   -424,   -422,
+   -421,   -419,   -417,   -415,   -413,   -412,   -410,   -408,   -406,   -404,   -403,   -401,   -399,   -397,   -395,   -393,
+   -391,   -389,   -388,   -386,   -384,   -382,   -380,   -378,   -376,   -374,   -372,   -370,   -368,   -367,   -365,   -363,
+   -361,   -359,   -357,   -355,   -353,   -351,   -349,   -347,   -345,   -343,   -341,   -339,   -337,   -335,   -333,   -331,
+   -329,   -327,   -325,   -323,   -321,   -319,   -317,   -315,   -313,   -311,   -309,   -307,   -305,   -303,   -301,   -299,
+   -297,   -295,   -293,   -291,   -289,   -287,   -285,   -283,   -281,   -279,   -277,   -275,   -273,   -271,   -269,   -267,
+   -265,   -263,   -261,   -259,   -257,   -255,   -253,   -251,   -249,   -247,   -245,   -243,   -241,   -239,   -237,   -235,
+   -233,   -231,   -229,   -227,   -225,   -224,   -222,   -220,   -218,   -216,   -214,   -212,   -210,   -208,   -206,   -204,
+   -202,   -200,   -199,   -197,   -195,   -193,   -191,   -189,   -187,   -185,   -183,   -182,   -180,   -178,   -176,   -174,
+   -172,   -170,   -169,   -167,   -165,   -163,   -161,   -159,   -158,   -156,   -154,   -152,   -150,   -149,   -147,   -145,
+   -143,   -142,   -140,   -138,   -136,   -135,   -133,   -131,   -129,   -128,   -126,   -124,   -123,   -121,   -119,   -117,
+   -116,   -114,   -112,   -111,   -109,   -107,   -106,   -104,   -103,   -101,    -99,    -98,    -96,    -94,    -93,    -91,
+    -90,    -88,    -86,    -85,    -83,    -82,    -80,    -79,    -77,    -76,    -74,    -73,    -71,    -70,    -68,    -67,
+    -65,    -64,    -62,    -61,    -59,    -58,    -56,    -55,    -54,    -52,    -51,    -49,    -48,    -47,    -45,    -44,
+    -42,    -41,    -40,    -38,    -37,    -36,    -34,    -33,    -32,    -30,    -29,    -28,    -27,    -25,    -24,    -23,
+    -22,    -20,    -19,    -18,    -17,    -15,    -14,    -13,    -12,    -11,     -9,     -8,     -7,     -6,     -5,     -4,
+     -2,     -1,      0,      0,      1,      2,      3,      4,      5,      6,      8,      9,     10,     11,     12,     13,
+     14,     15,     16,     17,     18,     19,     20,     21,     22,     23,     23,     24,     25,     26,     27,     28,
+     29,     30,     31,     32,     32,     33,     34,     35,     36,     37,     38,     38,     39,     40,     41,     42,
+     42,     43,     44,     45,     45,     46,     47,     48,     48,     49,     50,     50,     51,     52,     52,     53,
+     54,     54,     55,     56,     56,     57,     58,     58,     59,     59,     60,     61,     61,     62,     62,     63,
+     63,     64,     65,     65,     66,     66,     67,     67,     68,     68,     69,     69,     70,     70,     70,     71,
+     71,     72,     72,     73,     73,     74,     74,     74,     75,     75,     76,     76,     76,     77,     77,     77,
+     78,     78,     78,     79,     79,     79,     80,     80,     80,     81,     81,     81,     81,     82,     82,     82,
+     82,     83,     83,     83,     83,     84,     84,     84,     84,     84,     85,     85,     85,     85,     85,     86,
+     86,     86,     86,     86,     86,     86,     87,     87,     87,     87,     87,     87,     87,     87,     87,     88,
      88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,
      88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,     88,
-     88,     88,     88,     88,     88,     88,     88,     87,     87,     87,     87,     87,     87,     87,     87,     87,
-     87,     86,     86,     86,     86,     86,     86,     86,     86,     85,     85,     85,     85,     85,     85,     84,
-     84,     84,     84,     84,     84,     83,     83,     83,     83,     83,     82,     82,     82,     82,     82,     81,
-     81,     81,     81,     81,     80,     80,     80,     80,     80,     79,     79,     79,     79,     78,     78,     78,
-     78,     77,     77,     77,     77,     76,     76,     76,     76,     75,     75,     75,     75,     74,     74,     74,
-     73,     73,     73,     73,     72,     72,     72,     71,     71,     71,     71,     70,     70,     70,     69,     69,
-     69,     68,     68,     68,     68,     67,     67,     67,     66,     66,     66,     65,     65,     65,     64,     64,
-     64,     64,     63,     63,     63,     62,     62,     62,     61,     61,     61,     60,     60,     60,     59,     59,
-     59,     58,     58,     58,     57,     57,     57,     56,     56,     56,     55,     55,     55,     54,     54,     54,
-     53,     53,     53,     52,     52,     52,     51,     51,     51,     50,     50,     50,     49,     49,     49,     48,
-     48,     48,     47,     47,     47,     46,     46,     46,     45,     45,     45,     44,     44,     44,     43,     43,
-     43,     42,     42,     42,     41,     41,     40,     40,     40,     39,     39,     39,     38,     38,     38,     37,
-     37,     37,     37,     36,     36,     36,     35,     35,     35,     34,     34,     34,     33,     33,     33,     32,
-     32,     32,     31,     31,     31,     30,     30,     30,     29,     29,     29,     28,     28,     28,     28,     27,
-     27,     27,     26,     26,     26,     25,     25,     25,     24,     24,     24,     24,     23,     23,     23,     22,
-     22,     22,     22,     21,     21,     21,     20,     20,     20,     20,     19,     19,     19,     18,     18,     18,
-     18,     17,     17,     17,     16,     16,     16,     16,     15,     15,     15,     15,     14,     14,     14,     14,
-     13,     13,     13,     12,     12,     12,     12,     11,     11,     11,     11,     10,     10,     10,     10,     10,
-      9,      9,      9,      9,      8,      8,      8,      8,      7,      7,      7,      7,      6,      6,      6,      6,
-      6,      5,      5,      5,      5,      5,      4,      4,      4,      4,      3,      3,      3,      3,      3,      2,
-      2,      2,      2,      2,      1,      1,      1,      1,      1,      0,      0,      0,      0,      0,      0,      0,
-      0,      0,      0,      0,     -1,     -1,     -1,     -1,     -1,     -1,     -2,     -2,     -2,     -2,     -2,     -2,
-     -2,     -3,     -3,     -3,     -3,     -3,     -3,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -5,     -5,
-     -5,     -5,     -5,     -5,     -5,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -7,     -7,     -7,
-     -7,     -7,     -7,     -7,     -7,     -7,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,
-     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,    -10,    -10,    -10,    -10,    -10,    -10,
-    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,
-    -11,    -11,    -11,    -11,    -11,    -11,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,
-    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -13,    -13,    -13,    -13,
-    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,
-    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,
-    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,
-    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,
-    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,
-    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -13,    -12,    -12,    -12,    -12,    -12,
-    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,
-    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -12,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,
-    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -11,    -10,
-    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,    -10,
-    -10,    -10,    -10,    -10,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,
-     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -9,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,
-     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -8,     -7,     -7,     -7,     -7,     -7,
-     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -7,     -6,     -6,
-     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,     -6,
-     -6,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,     -5,
-     -5,     -5,     -5,     -5,     -5,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,
-     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -4,     -3,     -3,     -3,     -3,     -3,     -3,
-     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,     -3,
-     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,
-     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -2,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,
-     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,     -1,
-     -1,     -1};
+     88,     88,     88,     88,     88,     88,     87,     87,     87,     87,     87,     87,     87,     87,     87,     87,
+     86,     86,     86,     86,     86,     86,     86,     86,     85,     85,     85,     85,     85,     85,     84,     84,
+     84,     84,     84,     84,     83,     83,     83,     83,     83,     82,     82,     82,     82,     82,     81,     81,
+     81,     81,     81,     80,     80,     80,     80,     80,     79,     79,     79,     79,     78,     78,     78,     78,
+     77,     77,     77,     77,     76,     76,     76,     76,     75,     75,     75,     75,     74,     74,     74,     73,
+     73,     73,     73,     72,     72,     72,     71,     71,     71,     71,     70,     70,     70,     69,     69,     69,
+     68,     68,     68,     68,     67,     67,     67,     66,     66,     66,     65,     65,     65,     64,     64,     64,
+     64,     63,     63,     63,     62,     62,     62,     61,     61,     61,     60,     60,     60,     59,     59,     59,
+     58,     58,     58,     57,     57,     57,     56,     56,     56,     55,     55,     55,     54,     54,     54,     53,
+     53,     53,     52,     52,     52,     51,     51,     51,     50,     50,     50,     49,     49,     49,     48,     48,
+     48,     47,     47,     47,     46,     46,     46,     45,     45,     45,     44,     44,     44,     43,     43,     43,
+     42,     42,     42,     41,     41,     40,     40,     40,     39,     39,     39,     38,     38,     38,     37,     37,
+     37,     37,     36,     36,     36,     35,     35,     35,     34,     34,     34,     33,     33,     33,     32,     32,
+     32,     31,     31,     31,     30,     30,     30,     29,     29,     29
+};
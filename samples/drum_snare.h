@@ -1,547 +1,524 @@
-const int16_t drum_snare[] = { 0, 
-
-  14860,   8117,  16622,  28024,  22417,  -2420,  22814,  12765, -16668, -15089,  -7795,   1277,   8865, -14499, -24092,
- -10641,  -1054,  25448,  25126, -25629, -14262,   7942,   -116, -15616, -17787,  18606,  24842,  -5049, -19443, -31655, -27872,
- -17564,   1106,  30809,  29443,  29252,  28693,   3082, -21592,   6879,  15656, -25244, -25947,  -9514, -25430, -25565, -21219,
- -30582,  -1050,  30434,  26545, -22192, -18228, -31202, -31210,  -8433,  29634,  21947, -16929,  21976,  28799,  28549,  27827,
-   5523, -30147, -27818, -25591, -28856, -26776, -18356,  -7906, -23365, -20827,    984, -16443, -26906,   -487,  21378,   2341,
- -27991,  -9036,    270, -18271, -20890,  12597,  15685,  13833,  21477,  15956,  16010,  16309, -10975, -18603, -25069, -24946,
- -27756, -30034, -25442, -23436, -28907, -31254, -29778, -16582, -23457, -22230,  -9583, -14236, -27781, -27128, -24680, -24466,
- -16829,   9088,  -9936, -28862, -27111, -16681,  -1802,  19544,  17312,  28112,  27732,  26783,  24700, -14892, -26357, -20880,
- -16556, -13724, -20846, -25179, -27584, -26475, -17257, -24186, -29843, -27616, -14592, -20225, -28246, -24374, -15806,  22047,
-  26468,  13502,  -8773, -16549, -10985, -21841, -19723,  -9782, -23227, -28463, -24888,   2400,   4406,    -16, -19305, -13020,
-  12530,  17481,  27322,   5594, -28710, -22596,   -426,  24743,  29617,  27378,  25491,  26144,  24081,  27274,  29513,  23312,
-   3407,  -7919,   -611,  21614,  20712,    630,  17112,  20655,   3811,   3823,  17806,  17497,   3012,    689,  -1694,   9656,
-  15597,  15852,  21627,  20430,  21126,  27020,  27278,  25942,  28190,  28765,  28590,  27616,  26247,  27926,  23379,  15554,
-  23507,  24102,   5809,  -1112,  14137,   5908,  15234,  29036,  28260,  27332,  29411,  21991,   4726,  19368,  23788,  14387,
-   5617,  -2359, -13644,  -8408,    928,   7846,   4485,  -2037, -20136, -27121, -14178,  12415,   8578,   1686,  12668,  16938,
-  19286,  19441,  13051,  10749,   1859,    170,   2902,  -4807,    515,  14669,  19333,   7666,   5100,  11770,  13844,   4577,
-    350,   2821,   5623,  -5172,   2830,   3424, -11526,  -7621,  -4543,  -9244, -23935, -19618, -16631, -23777, -17844,   4848,
-   -830,  -5448, -10110, -15889,  -6631,   1383,   -716,   6611,  13342,  10231, -11731,  -6169,  -1038, -10774, -17270, -15002,
- -17996, -18603, -12129,  -7273, -18972, -18918, -20058, -21243,   5471,  -1340, -22788, -22630,  -9557,    459,  -4546, -18227,
- -22493, -19935, -22360, -21621, -18937, -16523,  -9861,  -2241,   -787,   6056,   2797, -11763,  -3101,  12573,  18169,  15888,
-   5806, -10457,     26,   8326,   3711,   4995,   6883,   3938,  15218,  20717,  11987,  14524,   9872,  -6551, -16173, -19161,
- -17198,  -4928,   7451,  13218,   7933,   6657,  14538,  15121,  10423,   5029,  -3497,    485,   9639,  14278,  10825, -11773,
- -19715,  -7278,  -2909, -16098, -13341,  -3123,  -6810,  -3128,  10704,   8356,   3380,  10765,  19681,  20965,  15761,   7430,
-   8990,  14749,   9863,   3251,   2273,   8158,   9284,   6729,   4383,  -2140,    501,   2031, -17945, -23266,  -9393,  -7705,
-  -7214,   2329,   3853,  -9254,   2572,   9772,   3391,  -1244,   4836,   7797,  10478,   3266,  -1272,   2492,   5422,  10121,
-   5305,   2243,    256,  -9170, -21793, -19196,  -6668, -15664, -22385, -24657, -21168,  -5326, -21433, -23634,  -4908,   2660,
-  -8195, -12791, -12679, -12078,  -9045,  -6320, -12909, -15332,  -7163,   8131,    909, -12354, -15698, -14100,  -5150,  -1982,
-  -4812,  -1298,  -1632,  -6391,  -5475,  -8151, -12906,  -9497,  -5503,  -5242, -11329, -16088,  -8627,  -9497, -13459, -14912,
- -23362, -23018, -15736, -19352, -19270,  -2982,  -5258, -19819, -23532, -21272, -14112, -12929,  -8214,   1017,  -3834, -13612,
- -11331,  -5913,   7424,  11963,  -1453, -13620, -12511,  -4340,   2403,    390,  -5609, -10561, -15983, -14594, -12745, -13440,
-  -9362,   6356,   7607,  -7493, -15266,  -1664,  13787,  11522,  11185,  18949,  16244,   8854,   9219,  12159,  17366,  13624,
-   5015,    286,  -4933, -12015,  -7642,    -18,   6700,  15589,  11006,    -79,   4035,  13239,  15747,  21659,  24853,  21027,
-   9195,  13263,  18435,  19748,  21311,  22211,  22402,  18179,  14722,  13207,  16318,  20468,  22274,  22327,  19126,  16827,
-  19945,  21269,  20099,  18261,  22213,  24077,  21713,  22491,  23107,  19654,  15430,  16700,  20628,  21814,  23354,  23223,
-  17371,  12975,  14954,  16029,  18567,  21948,  21533,  23253,  27740,  26350,  18935,  14034,   9420,  22231,  27550,  23262,
-  10308,  12235,  22875,  20144,  16583,   9085,   7315,  16846,  16530,  13285,   6478,  -2556,  -2339,    162,  -3922,  -5408,
-   1379,   7255,  16118,  14741,   8473,  10726,  10799,   4321,   2182,   5642,   7444,  -1169,  -1238,  -1677,  -2377,   4434,
-   4613,  -6003, -19439,  -8624,   2392,  -4017, -18145, -15653,  -9373, -15487, -20788, -25814, -19196, -11993, -15160,  -6592,
-  -4087,  -3773,  -5319, -17460, -17079, -13449, -18259, -20210, -21940, -20269, -18372, -22253, -21237, -18774, -17566, -14703,
- -16638, -20831, -24835, -28119, -29704, -28498, -25597, -23961, -25646, -26196, -25061, -27283, -28475, -24951, -19842, -23148,
- -25276, -25099, -25205, -24815, -21479, -17973, -16521, -16003, -18686, -21066, -25125, -25517, -23629, -19564, -11317, -15493,
- -22141, -22068, -18439, -17257, -20679, -19946, -22818, -23987, -20050, -11622, -12091, -15900, -11574, -10894, -16462, -18284,
-  -6340,  -3028,  -6910,  -4740,  -7189, -13782, -15170,  -8183,  -9080, -21485, -20027, -13784,  -7251,  -5463,   4757,   4167,
- -13724, -19976,  -9626,  -5869,    983,   5150,   2800,  10107,  15924,  -2412,  -5406,   1179,   7691,   7201,   7108,   8931,
-  12888,   7541,   1352,   4035,  16685,  19989,   7672,   3001,  13305,  17011,    471,   3078,  22547,  20692,   6029,   5423,
-  12024,  17541,  20088,  19625,  14412,  21263,  20640,   9746,   8124,  14621,  13762,  11172,  13607,  16628,  21249,  22274,
-  21071,  25249,  24141,  18110,  12354,  13091,  19256,  18470,  17137,  14259,  18762,  19342,  15728,  16626,  16106,  13528,
-  19202,  14125,   7527,  10182,   4480,  -1918,  15217,  22040,  19633,  18188,  21597,  20233,  18223,  22172,  18157,  10125,
-   9086,  14560,  24441,  26979,  26822,  17241,   9695,  15075,  19114,  12866,  19416,  24306,  20557,   3209,  -6871,   1829,
-  17212,  18701,  19611,  13718,   7318,   4967,   6924,  13745,  16435,  14308,  16395,  17906,  -3790,  -7131,   6073,  12593,
-   7345,  -2572,    736,   8498,  10011,  12155,  14589,  13071,  10929,  12689,  19837,  21771,  20158,  17210,   9448,   2281,
-  -1057,    531,   2366,   6760,  10377,   2997,  -3295,    446,    618,  -3556,  -4866,  -5784,  -9350,  -5860,    149,   5114,
-   7933,   7259,   7607,   9405,   6239,   2018,  -1207,  -4651,  -4823,   -540,   -152,   1511,  -4292, -12097, -12549,  -8168,
-  -6725,  -7864,  -5099,  -4897,  -5157,   3358,  -5870, -16659, -14606,  -9334,   5453,   9812,   4642,    358,  -6003,  -8535,
-  -1907,  -4987, -14531, -11563,  -5688,  -5527,  -6201,   -988,    187,  -4369,  -6740,   -595,  -7105, -14547, -15436, -10519,
- -10023, -14073, -18118, -20175, -21059, -19634, -14106, -11170, -12106, -18127, -19504, -15820, -12923, -16013, -17301, -19807,
- -20952, -14968,  -9373, -13058, -14309, -13059, -12164, -14079, -10009,  -3173,  -4206,  -7764,  -6159,  -5231, -10629, -10537,
-  -5232,  -8821, -19360, -19548, -19608, -22718, -20714, -13906, -18859, -25949, -26469, -23947, -22003, -18135,  -3890,  -4534,
- -14541, -17304, -17325, -19090, -15308,  -9885, -10494, -10921, -10654, -17191, -19020, -15142,  -7237,  -5175,  -6678,  -3950,
-  -1423,  -4861, -13817, -11772,  -9243,  -5957,  -6966, -14302, -14258,  -8498,  -8172,  -7047,  -3270,   -517,  -4242,  -6984,
-  -1683,  -3553,  -8288,  -3919,  -2846,  -5087,  -9751, -10124,  -8514,  -5798,  -7679,  -5957,  -3809,  -2827,  -2723,  -5009,
-  -3452,  -2755,  -2472,   1266,   1466,   1845,   5825,   4098,   2944,  11453,  18213,  12341,   2615,   -906,   3431,   9914,
-  17248,  21882,  13721,    857,   1528,   8604,  14870,  10802,  10111,  11856,  10792,   5661,   3155,   5624,   2462,  -1766,
-   -828,   4454,   8099,   9570,   4512,   2418,  -3291,  -7785,  -8508,  -4898,  -1539,  13937,  24997,  20049,   5031,   9162,
-  16366,  13224,   3765,   7521,  21396,  24442,  19532,  20474,  26090,  21545,  11712,   8839,  16693,  23915,  24476,  15791,
-  10864,   7366,   1617,  -1790,   5542,  11339,   6343,   7167,  12701,  10691,  12971,  13454,  16814,   9524,   1188,   2350,
-  16196,  14882,   8083,   3123,   1581,  10668,  16730,  10102,  10451,  13538,  12232,   9778,   6242,   7373,  15765,  17215,
-   7186,    148,  10116,   8447,   5901,   5714,   7035,   -754,   1404,  14321,   7758,   4534,  13861,  13714,   7531,   4480,
-   -401,     64,   8254,  15710,  13444,   7450,   4321,   6657,   7699,   1784,  -6889,  -3763,   2082,    601,    477,  -1786,
-  -6632,  -6705,   6326,  12888,  10573,   4614,  -2566,   3676,   8799,   5170,   6151,   4971,  -4680,  -8557,  -5706,  -5162,
-  -1224,   3251,  -5651,  -2421,   2213,   5035,    345,  -4921,  -5901,  -7165,  -9189,  -6892,  -3983,  -5253,  -7820,  -5158,
-  -1569,  -5909,  -7328,  -4208,  -6110,  -8263,  -9036,  -8873,  -9470,  -9747, -11301, -10952,  -3473,   4850,   2713,   -332,
-  -1117,  -3503,  -3604,  -8794, -11361,  -2722,   5528,  -3969,  -8603,  -3869,  -7035,  -2622,  -4282, -19725, -19244, -17357,
-  -8621,   -211,  -8423, -11011,  -8545,  -8692, -11103, -12976,  -9110,   -689,  -3227, -20944, -27294, -21085,  -5492,  -8106,
- -15633, -17227, -10993,    133,  -1295, -10964,  -8370,  -5051,  -8408,  -8707, -15166, -22181, -19758, -11547,  -5170,  -8180,
- -13131, -13952, -14109, -12730, -12091, -14878,  -8815,  -4369,  -5932, -12298, -17554, -16951, -14118, -15426, -10686,  -5452,
-  -8823,  -8730,  -7995,  -3270,  -4785,  -5571,  -1759,  -2311,  -5289, -10727, -16158, -18162, -18161, -11390,  -5044,  -5321,
-  -6356,  -9188, -15404,  -8890,    331,  -2096,  -4830,  -4960,  -5337,  -2788,   4203,   5985,   2740,  -4748,  -5586,    331,
-   -262,  -7930,  -4072,   8316,   9588,  -6424,  -7987,   5359,   7086,    420,  -1299,  -5921, -13121,  -8012,   3893,  -1818,
-  -8138,   1529,  10544,   9118,  12277,  11019,   3457,   2191,   5935,  18716,  25633,  15771,   2176,   2080,   3129,   8125,
-   6898,   3940,   7917,   9210,   8233,   7499,  10032,  11778,   6064,   2176,  13619,   8622,  10559,  16019,  14701,  15064,
-  13666,  17639,  21590,   9707,    214,   2486,   5062,  12047,  13950,   4198,  -1307,   2391,   9438,  16710,  20958,  20844,
-  15589,   9116,   9954,  15739,  24093,  23358,   9403,   5643,   8306,  10019,  17150,  13470,   1605,   6687,  11329,  10205,
-  14829,  20774,  13666,   4002,   2247,   7478,  14664,  13608,  10263,   6153,   4068,  11002,  19351,  19994,  14207,   8189,
-   6920,  11569,  16140,  19382,  17233,   5257,  -6423,  -3877,   9814,   8342,  -3582,  -6604,  -1139,   6815,  10387,   5604,
-   1064,   4660,  -1490,  -8292,  -6207,   8560,  15574,   6263,   1390,   6920,  12795,   2874,    513,   7947,  12776,  15928,
-  10262,   5740,  11346,   5629,  -3799,  -6879,  -1530,  -1360,  -4827,  -4258,  -2241,   2229,   1951,  -2831, -11075,  -6931,
-  -7325, -11768,  -9440,  -2437,  -4038, -10845, -15685, -10166,   2048,   2133,   -937,  -1244,   -584,  -6774,  -6571,   2503,
-   1143,  -3942,   -798,     57,  -9978,  -9737,  -6676,  -6169,  -4633, -11271, -24033, -19711, -12480,  -7775,  -7244, -16628,
- -17477,  -8730,  -9526, -10100,  -6613,  -1335,   1060,  -2511,  -6606,  -3633,  -1731,  -1438,  -6658, -10019,  -7742,  -7285,
-  -6591,  -4454,  -4998,  -9713, -10243, -11781, -12800, -11069, -14192, -19057, -20582, -22280, -18444, -10762, -14817, -20074,
- -13844,  -3797,   1740,  -3959,  -7146, -15178, -13228,  -6923,  -2721,  -3911,  -4873,  -1705,   1793,   3950,  -2921, -12355,
- -11367,  -6093,   -305,   1969, -10621, -17094, -11870,  -7358,  -7727, -13178,  -9066,  -5659,  -6123,  -6857,  -8406,  -6848,
-  -3231,  -3354,  -7212,  -4187,   2117,   5323,  -1850, -12437,  -5840,   6635,   4938,  -2239,  -5738,  -2316,   1726,    104,
-   3515,   6391,    895,  -8771, -11843,  -3998,   1365,   3582,  -1260,  -6473,  -2496,    420,    618,   1185,     44,   1861,
-   3251,  -1672,  -5676,  -1441,   2086,    -54,   7100,  14274,  11116,   4647,   -447,   3856,   5289,   8969,   6060,     69,
-  -2852,   5585,   4265,   -860,   1461,   1414,  -1050,    430,   -755,  -2581,   5185,   9518,  11411,   8829,   -586,  -4776,
-  -1375,   6482,  13081,  11228,   4139,  -1991,  -1693,  -4421,  -4403,   5142,  18669,  19702,   5138,  -5185,   4444,  15989,
-  11330,   8792,  10300,   9617,   4523,   3436,   6638,  10320,   6859,   4574,   4090,   2317,   6298,  15852,  10966,  -2775,
-   -946,   4482,   3449,   7276,  14645,   7157,   1905,   9561,  13157,   1041,  -6152,  -2163,   3304,   3693,  10115,  12001,
-   8758,   7843,   5891,   6705,   9041,   8924,    250,   -796,  10849,  14998,  12377,  19480,  20143,   9823,   1673,  -2032,
-  -3360,   -267,   1971,   3941,   6403,   3682,   2169,   3079,   1106,   3378,   6095,   9281,   6121,  -1146,  -5203,    908,
-  11206,  12641,   6758,   7965,  12752,  19551,  17885,   3300,   -572,   4553,   8220,   7063,   -971,  -9544,  -8496,   1375,
-   8315,   5510,  -2406,  -6550,  -1648,   1204,  -8207, -11576,  -4795,  -5742,  -6798,   -716,   1808,  -7661, -10232,  -3052,
-   1126,   3496,   6172,   9398,   5248,   2255,   2387,    113,  -5418,  -2319,   4786,   7897,   4025,  -2705,  -6181,   3379,
-   7530,   2777,    842,    516,  -2235,   4435,   5262,   1268,  -2009,  -6886, -18995, -19822,  -7536,  -4585,  -7732, -10154,
- -10008,  -9185,  -5772,  -5806, -10846,  -2218,   3497,  -4257,  -4434,  -2679,  -3166,  -3923,    356,   -551,  -5749,  -9357,
-  -7779,  -6433,  -6463,  -6766,  -8830,  -9423,  -8339,  -8258,  -6520,  -1992,  -1094,  -4007,  -3499,  -3896,  -9965,  -8543,
-  -1398,  -3193,  -6469,  -2722,  -4511, -12206,  -9774,  -6644, -12544, -15026,  -8440,  -6324,  -8617,  -3198,  -5734,  -6046,
-  -3914,  -8747, -13333,  -7712,  -4871,  -6293,  -4360,  -3990,  -3932,   1482,  -3893, -13389,  -4511,   7596,  -1724, -12633,
-  -3245,   9540,   1910,  -6648,  -8844,  -8409,  -2622,  -1118,  -6008,  -2362,    887,  -9154, -15025, -13371,  -8664,   1573,
-    484, -15925, -15294,  -7440,   -384,  -6110,  -3873,   -922,   3632,   7432,   2286,  -2185,    567,   -280,  -4954,  -4554,
-   3747,   7827,   5329,  -1204,  -6726,   -524,   6343,  -4589, -12843,   -884,   4241,  -6678, -11102,  -3235,   3947,   8484,
-   6747,  -1648,  -2738,   2153,   1986,   1648,   2104,   -843,   -674,    438,  -1823,   5275,  10576,   7955,   4852,   6288,
-   8992,   7797,   5139,   7443,   5488,   5604,  15202,  15291,   8481,   6822,    153,  -1565,   3551,   8298,   4150,   -217,
-   3075,    367,  -1882,    223,    -63,   2126,   2948,   1475,   2050,   5180,   7946,   3719,   4150,   5465,   5867,   2415,
-   5938,  11368,   8948,   6557,   3463,   4036,   6793,   5870,   3065,   2771,  12642,  13572,   9519,   6171,   2645,  -2042,
-   -744,   9067,  11649,  13687,  13071,  10127,   8907,   3602,  -2373,   1952,   4469,   5538,   6582,   1963,  -2868,  -1115,
-  -2610,  -3290,   2573,   9821,   3118,  -3884,   2821,   7255,   1988,   2082,   5369,   1706,  -2845,   -885,   3446,    571,
-  -2130,   4090,   8782,   5976,  -3443,  -2206,   6645,   9502,   9750,   5747,   1446,   4127,   8869,  12155,   8059,  -2717,
-  -2875,   2249,   8253,   8808,  -3696, -13164,  -8684,  -2499,   -342,  -5841,  -8729,  -6511,  -3277,   1222,   3729,   1422,
-  -2575,  -3390,  -1961,   -336,   1010,    562,   -782,   1882,   1606,  -3751,  -1914,   1560,    882,   -968,   2050,   4939,
-   -560,  -4865,  -6277,  -2598,   1580,  -1313,  -9523,  -5700,  -4019,  -8241,    303,   9700,   6107,  -6680,  -8383,  -5241,
-  -4190,  -8562,  -9361,  -8643,  -2990,   2974,  -1135, -10003, -10985,  -4160,    348,   1658,   2584,  -5820, -11841,  -2420,
-   5321,   3783,    247,    435,  -4708, -12971, -14614,  -4426,   3245,    780,  -3478,  -2760,   4888,   3050,  -7342,  -8818,
-    415,   3126,  -6621,  -9442,  -1470,   2910,   2677,  -1267,  -7211,  -6174,  -7873,  -7949,  -1768,   -240,  -1681,  -7582,
-  -6755,  -1228,  -2135,  -7917,  -5993,   5706,   2025,  -6700,  -7146,  -4816,  -4705,   3150,   6076,    450,  -3618,  -1106,
-    765,   2172,   5449,   3043,  -2018,  -6197,  -6520,  -4092,   2627,    820,  -7381,  -5317,   -783,   1276,  -3615, -12917,
-  -4403,   9420,   9875,  -3092, -12565,  -7029,   -831,  -1956,    -65,   2048,    -42,  -3645,  -4179,   3615,   5113,  -5070,
-  -9226,  -8664,  -2960,   5069,   1525,  -1601,  -1010,   2954,   4976,   2996,   4146,  11102,   7669,  -1392,  -2754,    851,
-   4957,   1411,  -7137,  -1035,   3243,   1482,    182,  -8191,  -5856,  -1300,   1718,   2536,  -1770,  -4180,  -4612,  -5033,
-  -5791,  -2895,   4063,  -1037,  -5315,   6854,  13873,   4092,  -1235,     59,   5309,   8279,   7447,   6749,   9737,   4636,
-   1389,   4874,   5216,   4457,   3122,  -2180,  -8686,  -2829,   5611,   3094,   3790,   7083,   3745,    136,   -731,   3290,
-   5143,   8917,   6734,    -72,   2981,  11034,   8336,   1360,  -2496,  -3346,   -950,   2618,   2661,   1969,   -995,    476,
-   6183,   2824,   -381,   7394,   8685,    985,     11,    555,   1291,   2682,   2692,    415,  -3869,  -6893,   6759,  10239,
-   4079,  -1088,   1427,   6786,   2821,  -3396,   2843,   8210,   1620,  -3445,  -7600,  -1135,   4175,   1558,    927,   3344,
-   5033,   1844,  -3359,  -2479,   6629,   5787,   3764,   -734,   -659,   5516,      1,  -3670,    838,  -1881,  -4470,  -9463,
-  -6291,    -17,   2531,   4764,   3165,   4085,     45,  -6582,  -9438,  -5078,   3258,   3131,  -4527,  -3777,   5964,   7615,
-   2292,  -3202,   -421,   6171,   7328,   6583,   6021,    414,  -3850,   -533,   4289,   3662,  -2301,  -5853,  -8367,  -9167,
-  -7264,  -1654,   5964,   3739,  -4573,  -3524,  -2935,  -5174,  -2209,   1951,  -3345,  -5182,   -205,   2946,   5757,   2468,
-  -4179,  -6490,  -3207,   1656,   6368,  -2570,  -9794,  -4944,  -3998,  -3095,   6751,  11997,   4711,  -1805,   1121,   4969,
-   8154,   9772,   -495,  -9868,  -3850,   3123,   3397,  -3300,  -9618,  -6433,  -5481,  -5952,    343,     52,  -2432,   5606,
-  12285,   3808,  -5187,  -1641,    300,  -3637,  -6473,  -2590,   3388,   6043,  -1467,  -7325,  -5992,    342,  -1027,  -2767,
-   1664,   2784,   -966,  -2627,   2717,   6896,   4370,  -1063,    626,    835,   1414,   1093,  -3948, -10573,  -7584,    894,
-  -1913, -10107, -11086,  -2126,   1510,  -2924,  -3100,   2093,   8709,   7881,   -990,  -6960,  -6748,  -7498,  -7373,  -3608,
-   -460,   3499,   6358,   4684,   3165,   3965,   5246,    364,  -9136,  -7682,  -2628,   2752,   9327,   8021,   2452,   1041,
-   -483,  -6434,  -9753,   -796,    429,  -4889,  -5841,    804,  -4730,  -9152,  -4228,    722,  -1547,  -5742,  -4320,  -2112,
-  -6566,  -2727,   6204,   7709,   7976,   4261,    922,   2939,  -1995,  -7826,  -4469,   1658,    903,  -4119,  -8976,    -32,
-    936,  -6054,  -3120,   1601,  -2096,  -1516,  -2764,  -8620,  -4747,   4579,   2724,  -6075,  -9868,   1233,   3042,    377,
-   2446,   7606,  11407,  11368,  -2090,  -7034,  -3232,   3154,   5667,  -1453,  -3419,    170,   8476,   9899,   1359,  -5368,
-  -1416,   4540,   2908,  -3447,  -4201,   1196,    207,  -5324,   -159,   4042,  -6027,  -6225,   2359,   2782,   3772,   9470,
-   4156,  -6454, -11743, -12300,  -5362,  -1944,   3504,   5619,   4358,   2712,  -1016,   3685,   8300,   5694,   2183,   4125,
-   5744,   1363,   3674,   8197,   1181,   -332,   1071,   3742,   9578,   6140,   -601,   -353,   -606,  -1377,  -2837,  -4089,
-  -3561,  -6351,  -9411,  -2520,   3002,   1521,    304,    600,     39,    640,   6582,  11350,   7551,   3557,   6388,  12386,
-   6563,  -6667,  -8939,  -1950,  -2729,  -2197,  -4693,  -3892,  -4908,  -2331,   1706,  -6108, -10086,   2270,   3924,    258,
-   1064,   4645,   4444,    393,   5599,   5280,   2849,   -593,  -1412,   1621,   3215,   5394,   9834,   7423,     95,  -9928,
-  -8224,  -3098,  -5092,  -4945,  -6340,  -7368,    334,  -1071,  -2752,   -915,   6080,  -1154,  -6372,  -6208,  -5743,  -6625,
-  -4579,   -578,     56,  -3676,  -3377,   -829,  -2159,  -7111,  -4083,   2337,   4093,   3592,   3616,   1936,   5292,   5776,
-   1867,  -1033,   3698,   6034,   2334,   1067,   2670,   4787,    890,  -5088,  -3606,  -2406,   1209,   4239,   3645,   1060,
-  -3192,  -4810,  -6421,  -4140,   2770,   4567,    788,   5474,   8215,   4741,     75,  -3301,   1694,   3595,    372,  -2741,
-    542,   2037,   5997,   3294,  -5993,  -5721,    373,   1588,   6339,   6443,   1557,  -5876,  -7609,  -1699,   2085,   3255,
-   5067,   6704,   3675,   3162,   7685,   7428,   8032,   4119,    298,   1167,   6295,  10857,  13602,  10033,   5883,   7172,
-   4708,  -1345,  -1510,   2081,  -2498,  -5254,  -5911,  -7401,  -4394,   2446,    272,   1700,   4491,   1890,  -4370,    257,
-   5578,   2904,   4773,   9208,   5848,  -2734,  -1969,   2510,     80,  -5623,   3048,  12744,   9571,    -46,  -5549,  -2375,
-   1787,    862,  -3475,  -3452,   2785,   3641,  -4570,  -7424,   -608,  -2778,  -4050,    733,  -2540, -10002,  -9196,   1048,
-   2324,   -607,   -549,   3356,  -3329,  -3193,   3872,   6726,   2728,   -424,   -588,    937,   5552,   6179,   1156,   -477,
-  -4336,  -3801,  -2985,  -2431,  -1953,   -581,  -2130,  -3305,  -6917, -10448,  -2476,  -3226, -10686, -12210,  -6560,  -5026,
-  -6051,  -3212,  -1919,  -4208,  -2383,    -79,   1365,   2999,   2460,  -4566,  -3000,   2972,    587,  -6299,  -7666,  -7115,
-  -6071,  -3405,  -1229,  -1388,  -7957,  -9907,  -3537,   -486,   -298,  -1273,  -5504,  -5651,  -4165,    241,   4641,   1480,
-  -7632,  -6473,   4162,   4622,   1963,  -5125,  -6074,  -1085,   3789,   3135,  -7236,  -9705,  -6314,   1233,   2293,    775,
-   -456,    185,   1660,  -1521,  -3405,  -4522,  -3268,  -3043,  -4202,  -3532,  -1662,   -187,   -277,   7622,   7805,   -478,
-  -1341,    861,   -883,  -2762,  -6458,  -3667,   -572,    155,   6457,   6043,   4891,   2195,  -3011,  -6955,  -5806,   4963,
-  10382,   1505,  -5317,    431,   7429,  -1314,  -6950,  -2742,   6020,   -964,  -8981,  -3985,  -1876,  -4091,  -7529,   -663,
-   7176,   7878,   1207,  -2018,   -308,   1533,  10722,  10596,   7031,   1864,  -2314,    230,   2375,   -811,    450,   2676,
-   2744,   4262,   -182,  -6914,  -3916,    -52,  -4487,  -5436,     31,   6368,   3953,  -1087,  -4117,  -3698,  -2849,   2334,
-   7408,   1275,  -2682,   2873,   4462,  -1872,  -3424,  -1589,   1409,    550,   4170,   6923,   4484,   3451,   -319,  -4258,
-   1298,   7454,   2270,  -8616,  -8236,    840,   2642,   1356,   4389,   7276,   3144,  -1651,  -5109,  -2735,   4053,   7440,
-   7091,   5485,   4453,    495,   2556,   6001,   6150,   3356,  -3968,   1007,  10542,   5924,  -4827,  -4827,   -878,  -2267,
-  -2262,  -2301,  -1874,   3399,   5973,   1473,   -631,   1859,  -1827,  -7673,  -3292,   1855,   3066,  -1243,   3437,   7800,
-    525,  -2786,  -2345,   1305,   3046,   4734,   6219,   9087,   7611,   1405,   1331,  10787,   7664,    -55,  -1195,   7535,
-  13566,  10608,   -901,  -6839,  -3090,    992,  -1617,  -5131,  -1884,   -663,  -2173,  -4022,  -3840,    -81,   1642,   4196,
-   4553,   5953,   1100,  -1148,   1712,   7068,   5450,  -3580,  -3891,   3694,   8282,   3501,  -3708,  -6929,   -469,   6210,
-   4744,  -5660,  -6090,    733,    866,  -2495,  -1521,   3722,   3120,  -4149,  -6783,  -1360,   7863,  11013,   4186,   1011,
-  -1075,    127,    715,   6691,   5454,  -1815,  -5704,  -9503,  -8354,    348,  -1583, -12393,  -9017,   3927,  11062,   6772,
-   1455,   2450,    169,  -3681,  -3643,  -2788,  -1953,  -5972,  -7821,   3937,  10257,   3297,  -4561, -13726,  -7859,   -412,
-   -861,  -5341,  -3743,   2236,   3489,  -5953, -12453,  -1702,   8568,   5431,  -5065,  -7727,    294,   3538,    -62,   -721,
-   3303,   1769,  -3640,  -3661,    -38,  -2944,  -7973, -11777,  -7832,   2704,    435,  -8164,  -1219,   3315,  -4754,  -2629,
-   6820,     75, -10151, -11412,  -2143,   2633,  -4318, -13414,  -9669,   -985,   1898,  -2970,  -6285,  -3677,    809,  -4872,
- -11462,  -4863,   6250,   9274,   4049,  -1853,    586,   2071,  -1255,   -619,   3891,   2446,   5214,   7054,   2748,   1708,
-  -1596,  -9606,  -9485,  -7569,  -7970,  -7013,  -5525,  -5971,  -5449,  -8028,  -3557,   -490,  -5350,  -4288,    757,   6273,
-   3457,  -2260,    208,   3519,   2586,   1704,   2830,   6602,  10620,   5066,  -3725,  -5102,  -3221,  -4024,  -5527,  -5967,
-  -1538,   2286,   2771,   3417,    -23,  -2522,    234,   6058,   8435,   7186,   4579,   2145,   3770,   5991,   5070,   2467,
-   3141,   1536,  -3661,   1022,   6522,   2815,   1167,   1541,  -5140,  -8718,  -4662,    -29,   2899,    606,  -2766,  -1551,
-   1077,  -2602,  -7537,  -4412,   2570,   6317,   5084,  -2530,  -1218,   5222,   6064,   6079,   8432,  11119,  14191,   8889,
-   1960,   3887,   6570,   8692,   7223,   3034,   2476,    837,  -4752,  -1750,   5700,   5647,    143,     97,   2770,  -3292,
-  -5949,   -781,   2811,    586,  -5077,  -2685,  -2454,  -1578,   1374,    791,   1904,   3265,   5618,   5534,   2116,   1518,
-   6533,  12180,   7726,   3937,   4517,   2173,  -2289,  -2295,   3317,   -406,  -3418,    944,   3476,   2916,  -4142,  -6303,
-   -587,   2262,   3130,   1505,    716,   2338,  -2701,  -5369,   -471,   5916,   6942,   5656,   2211,  -4370,  -4271,     87,
-   1554,  -1189,   -798,  -1686,  -1143,   2717,   1133,   -223,   1666,  -3120,  -4882,  -3314,  -4299,  -2493,   3666,   1190,
-  -3226,  -6442,  -4071,  -2877,  -5366,  -3502,   -718,   2623,   3535,   -556,  -1820,  -3168,  -5583,  -5433,   -198,   5417,
-   -500,  -8126,  -9044,  -3318,   5798,   4208,   1740,   2122,     88,  -4984,  -8003,  -9309,  -4002,   2195,   2326,   -199,
-  -2568,  -1388,   1135,   3302,   1574,  -5011,  -4872,    775,    876,  -1998,  -6024,  -7001,  -1819,  -1289,  -3597,  -3765,
-  -3543,  -3185,  -5659,  -2381,    680,  -1965,  -4783,  -6360,  -2673,   5659,   5225,    444,  -1760,    788,  -1334,  -1681,
-   4449,   5173,  -2953,  -7757,  -1054,   2189,  -1081,  -3125,  -2146,  -2230,   1559,   2625,  -1579,  -2079,   -104,   2145,
-   3597,  -1584,  -2969,   2678,   2879,   3767,   1719,   1737,    577,   4410,   5554,     -1,  -4435,  -4558,  -3998,   -872,
-   -726,    -36,  -2101,  -1208,  -1182,  -1823,   2000,   2773,    618,    715,  -1617,  -3281,  -3597,    709,   2029,   -715,
-  -2681,   1692,   7443,   4379,   2017,   2302,   2656,   1419,   5314,   5948,   1214,   4161,   8871,   7348,   4020,    257,
-  -2343,  -1217,  -2011,  -1326,    775,  -1653,  -5500,  -1082,   1499,  -4104,    740,   5760,  -4004, -11805,  -4166,   2883,
-   6413,   8233,   2048,   -329,  -3062,  -4433,  -1697,    -92,   4940,   7865,   6293,   4458,   4235,   8593,   6480,  -4578,
-  -9301,  -3282,   7169,   7962,   -544,  -7953,  -4721,    792,   -828,  -3248,   2489,   8327,   5468,    905,  -1432,    952,
-    725,   1519,   5850,   4135,  -2577,  -8613,  -3479,   4666,   3767,  -1467,  -2155,    417,   2455,   1863,  -2153,  -4597,
-  -4913,  -6244,  -1226,   2320,   1395,   1086,  -1678,   -468,   3922,   6041,    495,   -939,  -1149,  -1772,  -3559,   1891,
-   7455,   4082,  -2028,  -3004,   2719,   5762,   2979,   1131,   -505,   -424,  -3183,   -458,   3602,   1062,   3191,   4968,
-  -2831,  -7338,  -2291,     63,  -2101,  -4179,  -1771,   2469,   1616,  -3345,  -5132,  -2216,  -1469,   1831,   3363,  -1677,
-  -2436,   1157,   4497,   1261,  -3806,  -1882,   2594,  -2188,  -5720,  -5265,  -4145,  -4801,  -2993,   2069,   3642,   2798,
-  -1723,  -4204,   -534,   6963,   7155,   2577,  -4797,  -5548,  -1691,    514,  -1300,  -3860,  -1716,   3179,   4047,   3927,
-   2353,   2149,  -2759,  -7582,  -3097,   4557,   2236,  -4125,  -7848,  -4625,   3289,    769,  -4223,    480,   -830,  -4677,
-  -3456,   -693,    313,  -2501,  -5119,  -3848,  -1813,  -5578,  -9661,  -4593,   2624,   2470,   1812,   4753,   6397,  -1877,
-  -2622,   6278,   5743,   1397,  -4168,  -7138,  -5377,    119,  -5097,  -9649,  -6455,  -1949,  -2167,   3137,   3195,   2748,
-   2079,    926,    783,     97,  -1065,   1932,   3953,   4476,    324,   -736,   1754,   -986,  -5848,  -7009,  -5412,  -3104,
-  -2970,  -1616,  -2152,  -5505,  -6545,  -6765,  -6333,      4,   7453,   4746,   -131,   -129,     86,   2170,   7099,   4336,
-   -833,     88,  -1945,    978,   8022,   8952,  -1094,  -5279,    167,   4874,   7843,   1472,  -6695,  -2831,   2571,   2302,
-   -742,  -3097,  -2020,    539,   1501,   -200,    199,   4313,     55,  -5799,  -2569,   5143,   4234,   1136,   2073,   3184,
-   2723,   6172,   3770,  -1489,    -73,  -1121,    322,   2111,   1803,   3422,   1089,  -4241,  -7020,  -4173,   2301,   8495,
-   5340,    847,   5747,   3549,  -3327,   1707,   7682,   4267,   1903,    813,   2443,    730,  -1376,   1316,    -20,   -658,
-    821,    171,   2907,   3358,    201,  -2346,  -1722,   2664,   8186,   7487,   2580,   2247,   1989,    159,    972,   4013,
-   7081,   6043,    358,    278,   2087,    -58,  -7057,  -5876,   -192,   1800,  -1932,  -3762,  -2240,   -388,   2112,   2477,
-    579,   -384,   6877,  10886,   1897,  -3300,    721,   4808,   3523,   -707,  -1741,  -1200,   4395,   9108,   1539,  -6324,
-  -4351,  -3315,  -3827,  -1840,   -593,  -2164,  -1301,  -1829,  -1633,  -2479,  -1308,   -996,    902,    518,   -899,   2682,
-   5226,   6202,   5627,   4922,   2843,  -1399,   -372,   2318,   1444,    745,     37,  -1395,  -3044,  -4591,  -4955,  -6669,
-  -7435,  -3638,  -1374,  -2250,  -4245,  -7269,  -5604,   1652,   8639,   5086,   3055,  -1884,  -7596,   -937,   5029,   1654,
-  -1997,  -5662,   -512,   4993,   1674,  -2983,  -3074,  -4004,  -3225,   1884,   1893,  -2561,  -5438,  -1041,   1832,  -2126,
-  -5882,  -6322,  -1365,   2515,   1376,  -1478,   -142,   -470,  -4146,  -2369,  -2017,  -4425,  -4386,    190,    364,   3284,
-   5856,   -339,  -4078,  -1720,    696,   2213,   2686,   2898,   1116,  -2885,  -2016,   5764,   3750,  -3306,  -7033,  -7066,
-  -5178,  -4095,  -6470,  -4702,     43,   1658,  -1402,  -3383,  -4077,  -2255,   -543,   1692,   3415,   3394,  -1039,  -2059,
-  -1456,   4322,   8662,   5655,   -296,  -4165,     24,   6562,   5163,    640,  -2529,  -2580,   1390,   3041,    446,  -2567,
-  -5342,  -5177,   1644,   4344,  -1422,   -157,  -2775,  -5461,  -3996,    -94,   3094,    934,  -1427,  -1593,   1055,   5353,
-   3507,   2662,   4484,   2487,  -1485,   -992,   -714,   1151,   3427,   1337,  -8124,  -8514,     18,   3371,   3531,    -88,
-    458,   2512,   3219,   2224,    175,  -2468,   2301,   3831,  -1724,  -4208,   2125,   8310,   3324,   -511,  -3887,  -4512,
-    764,   4613,  -1503,  -8635,  -3814,   4974,   3211,   -374,  -2863,    636,   3568,   2282,   1023,  -2620,  -6298,  -3861,
-  -1776,  -1505,    423,   -540,   -860,    621,   -193,  -1423,   3065,   5075,    198,   2153,   5756,   5197,    767,  -1538,
-  -3628,  -4097,   3780,   5968,   1060,  -3515,   -770,   2847,   1742,   -336,     90,    -35,  -3523,  -2504,  -1284,   1705,
-   5216,   -114,  -4894,   -750,   3555,   1371,    130,  -3652,  -2722,   2253,   2746,  -2783,  -4102,  -4606,  -5570,   -273,
-   5131,   4252,  -1494,  -4742,  -4964,  -1939,   1700,   4531,   2420,    430,   2119,    455,  -2710,    228,   6223,   5253,
-  -1297,   2749,   7113,    701,  -1374,   -779,  -1392,   2381,   5271,    -93,  -5902,  -7223,  -4357,  -2657,  -3506,  -1166,
-   -890,  -2330,   1195,    314,  -3391,  -1527,   2650,   7247,   6429,   2100,    397,   -926,   -487,   2613,   1586,  -2486,
-  -4771,   -258,   6035,   2287,  -2902,    191,   1063,  -4007,  -2691,   4927,   3477,  -4573,  -2457,   3531,   4288,   3650,
-    674,   -434,   -344,  -1681,   1540,   1747,  -3547,  -4527,  -2531,    686,    407,   1031,    838,  -1328,   -568,    383,
-   1057,   5882,   5099,   -788,  -5271,  -1087,   4441,   1023,  -1351,    308,   2160,    360,    912,   2567,   1291,   1515,
-   1495,   1320,  -1014,    535,    760,  -1983,  -1111,   2705,   -802,  -1420,   1242,  -1165,  -3240,  -2766,  -6052,  -4794,
-   1304,   2210,   1304,   -627,  -2979,  -1598,   2948,   7703,   4323,    623,  -2077,   -633,   4251,   1980,   -666,  -1194,
-   1439,   5232,   2974,  -1103,    622,   4933,   4887,   1566,   3308,  -1029,  -4678,  -1639,   1277,  -2226,  -8646,  -7637,
-   1177,   2116,  -3362,  -7979,  -3030,   2172,    427,   1154,   3601,   4252,   1694,  -4223,   -602,   3050,    985,   -144,
-   1713,   4396,   3144,    956,   -734,  -3315,  -1593,  -1621,  -2393,   3787,   5920,  -2085,  -7272, -10565,  -5534,    168,
-   2430,   3787,   5154,    518,  -1826,   -659,    304,   2363,   5468,   1792,  -1749,  -6254,  -8712,  -4758,   1415,   4616,
-  -3015,  -8268,  -5376,  -1143,   3230,   -743,  -2543,    492,   2182,  -1727,  -4682,  -4030,   -642,   2317,   2967,    623,
-  -4273,  -5215,  -3432,  -2251,  -1650,  -1638,   3866,   2806,   -957,   -158,  -1148,    -44,    909,  -2466,  -3007,   -260,
-   1060,  -2483,  -2314,   1665,  -1040,  -3282,  -2725,   -882,  -1588,  -3079,  -2653,  -1827,  -2007,  -2748,  -5566,  -3343,
-   -789,  -2073,   3436,   5383,    324,  -2441,  -2393,    -73,    790,   2394,   1049,  -2681,    680,  -2138,  -1825,    318,
-  -2772,  -1612,   3250,   4492,   1742,   2387,   2534,   -522,  -3537,  -2844,   -532,   -292,   -913,    444,   1504,   1320,
-  -1251,  -3180,  -1869,   1910,   1055,   4766,   8085,   -268,  -2313,   4871,   5143,   2227,   1614,     87,   1465,   2410,
-   -929,    360,   4778,   2117,   -592,  -2071,    333,   3207,   2054,     21,   -382,   3391,   3913,    899,    519,   1213,
-   3674,   3830,    487,  -1863,   4673,   5559,  -1386,  -2726,   -395,  -1273,  -2533,    -48,   4299,   7478,   7048,   2912,
-   -576,    279,    923,   1113,   3806,   5865,   3641,   -974,   -837,   5106,   3564,  -1125,   -390,   1453,  -1037,  -5029,
-    771,   8926,   5469,  -1116,  -1235,   3407,   3264,   5998,   7233,   4069,   3493,   3784,   4843,    770,    827,   1869,
-   -747,  -1650,  -2645,  -1990,  -2703,  -1580,    -14,   -587,  -3452,  -4246,   -498,   -145,  -2598,  -1336,   3779,   5511,
-   1979,    545,   2641,   1746,   1881,    632,    134,    543,   1346,   -801,   -539,    623,  -1206,    479,   2515,  -1429,
-  -6028,  -3783,    100,  -1343,  -3820,  -2425,   -291,   -169,  -1669,  -2968,  -1814,   -569,   1361,   1784,   1517,   -333,
-   -830,   2786,   -498,  -6368,  -3930,   2275,    938,  -1219,  -3224,  -4626,   -983,   3360,   1352,  -4107,  -2829,   2026,
-   -708,  -5687,  -5797,  -1062,   -870,  -3887,  -1584,   -406,   -309,  -1341,  -1943,  -2524,  -3064,   -597,   -665,  -2268,
-  -1225,  -2039,  -2966,  -2899,  -4375,  -3682,    288,   5651,   3639,  -6322,  -7224,  -2673,  -2309,  -3875,  -2637,   -547,
-   -736,    593,  -2147,  -6343,  -3424,   -242,   -339,   -899,     71,     34,   -916,  -2693,  -2595,  -1227,  -3576,  -2837,
-    818,    720,   1322,    120,  -1943,    770,   4393,   3908,    832,  -3926,  -4811,  -2068,   1628,   2087,  -1889,  -3038,
-  -2128,  -2213,   -710,   3323,   3741,   -440,  -2212,   -665,  -2746,  -3262,   -184,   -391,  -2231,  -2961,  -2363,   -975,
-   -605,  -1369,  -1073,   1156,   2799,   3844,   1365,  -3691,  -5673,  -2194,   2986,   4826,   3822,    728,   -590,  -1295,
-     64,   2031,   2747,   3193,   1607,     71,   1151,   2156,   3937,   4646,   4663,   2838,  -1798,  -2589,   -240,   1255,
-    -83,    474,   1374,   3992,   3362,   -950,  -3018,  -1311,    999,   2807,   2042,   -786,  -1400,     80,   1480,    -24,
-   -453,   2220,   3756,   3610,   2674,   -176,    261,    949,  -1489,  -1232,   2514,   2754,   3599,   5058,   4750,   2674,
-   1444,   1270,   -672,  -1547,   1557,   4341,   3386,    552,   -417,   -206,   1027,   2635,   5381,   3825,  -1062,  -2948,
-    655,   2961,    509,  -2710,     -2,   1341,  -1588,  -2475,    889,    493,  -2926,   -256,   3305,   4095,   3734,   1165,
-    968,   3032,   2245,  -1101,    617,   4458,   4205,   2954,   3242,   1652,   -423,   -236,   2504,   3541,    569,   -728,
-   1875,   3161,   -861,  -2128,   1030,   1906,  -1164,  -3718,  -3151,  -3323,  -4021,  -3691,  -2058,    886,   2202,  -2607,
-  -5039,  -1061,   2462,   2250,    523,  -1464,   1452,   4235,   2609,   3338,   4533,   4151,   2350,    515,   1561,   2507,
-    118,  -3562,  -3432,  -1687,  -3302,  -5394,  -5788,  -4426,  -3277,    504,   2265,   -767,  -4006,  -5095,  -4455,  -1254,
-   2117,    430,  -1613,  -1176,  -1304,    467,    128,  -2391,  -1710,  -1554,    100,   3362,   5461,    611,  -3132,  -4099,
-  -2398,   1071,   1800,   -625,  -1934,   -693,   -762,  -3699,  -4996,  -5034,  -5253,  -5639,  -2099,   1846,    176,  -3707,
-  -4023,   -118,   1643,   -381,   -829,   -425,   1649,    150,  -2535,  -1595,  -1368,  -1783,   -189,    232,  -1256,    -32,
-   -133,   -837,    820,    -13,  -3632,  -3910,   -640,    459,    159,    471,  -2623,  -4039,    -66,     82,  -1103,  -2200,
-  -4208,  -3104,  -1385,    183,   2670,   3790,   -811,  -4014,  -1472,   -507,   -224,   -354,  -1226,  -2924,  -3725,  -2157,
-     68,   -415,  -2466,  -2456,   1305,   3863,   2471,   -917,    -59,    564,    536,   1712,    555,   -833,   -517,    -74,
-    776,   1908,   2909,   2702,   1567,    100,  -2020,   -286,   1290,   -184,   -175,   -805,   -170,     32,    -44,   -479,
-    380,   1169,   2595,    916,  -1859,   -803,   2880,   6654,   3580,  -3829,  -3671,   -376,    179,   2155,   2034,    641,
-    199,     59,   2832,   2783,   1155,   1082,    467,   -912,   -152,   -330,   -311,   -491,   -412,   2291,   3478,   1801,
-   -345,   -117,   3484,   6062,   4575,   3172,   3884,   5061,   3764,    852,    471,    313,   1900,   2736,    539,     27,
-   1343,   1028,    108,   -837,  -2564,  -1149,  -1151,   -682,   -727,   -966,  -1436,  -2763,  -1797,    854,   -308,   1306,
-   4627,   3203,   2455,    866,    927,   2612,   3505,   5741,   5423,   3234,   3044,   2846,   1590,    499,   1555,   2728,
-   3793,   1623,  -2981,  -2515,   -156,   -964,  -2489,  -1593,   1346,    586,  -2277,  -1284,   1368,   1584,    877,   -860,
-   -528,    720,    157,   1001,   2264,  -1118,  -2626,   -493,   2273,   1386,  -2394,  -2639,   1837,   4595,   2253,  -1820,
-  -2986,    598,   2552,   1837,   1046,    684,    -48,   -710,   -366,    282,   1209,    462,    -95,   -745,   -829,    309,
-     42,  -1043,  -2321,  -2133,    957,   -219,  -4848,  -4362,  -1170,  -1498,  -2796,  -2152,  -2375,   -596,    251,    500,
-   -197,   -972,    890,   1778,   2103,   1347,   -367,  -1733,  -2744,   -385,   2986,    -34,  -3801,  -4716,  -3655,  -1229,
-    133,   -303,  -1300,  -2661,  -2735,  -2054,  -2283,  -1585,   1651,   2413,  -1029,  -3185,  -1918,   -346,   -176,    267,
-     29,  -1330,  -2781,  -3260,  -2783,  -1778,    -56,    859,   1268,   -961,  -2760,   -564,     64,   -623,  -1201,   -692,
-   -346,   -980,  -2758,  -3559,  -2610,  -2723,  -2065,  -1027,  -1165,   -815,    969,   2525,   1568,   -224,   -744,   2060,
-   2421,  -1739,  -2389,   -614,  -1274,  -2568,  -1440,  -1805,  -1970,   -156,     65,  -2426,  -2582,   -769,    338,   -720,
-   -573,     88,  -1246,  -2308,  -1270,   -607,   1824,   3049,   1626,   -356,   -850,    168,   1892,   1542,   -296,    969,
-    411,  -1369,    387,     90,   -474,   1679,   2494,   -867,  -3073,     -3,   2271,    449,  -1996,  -1889,   -194,    580,
-   1794,   1843,    393,   -636,    638,   1808,   1960,    939,    597,   2231,   3174,   2531,   -834,  -2427,   -419,    966,
-    527,    241,   2213,   2404,   -523,   -997,   1160,    848,    225,   1044,    441,   -479,   -243,   1749,   1807,    553,
-    257,  -1566,  -2303,   1087,   5066,   3874,   1362,    414,   -478,   -296,    507,   1057,   1870,   1546,    -10,   -930,
-   1179,   2875,   2656,   1540,    174,    -39,    578,   1336,   1818,    968,    -92,   -531,    806,    864,    875,   1519,
-   1584,    930,   -781,    411,   3569,   3188,   1073,  -1172,  -1778,  -1271,  -1038,     21,    685,   1396,   1648,    486,
-    195,    747,    957,    610,   -127,   -270,    911,   1733,   1338,    382,    451,    -56,     17,   1195,   2059,    674,
-   -133,   1450,   2825,   1979,  -1294,  -2496,  -1264,  -1384,   -490,   1042,    359,  -1325,   -879,    220,  -1343,  -2080,
-   -399,   1045,   1994,   1390,    433,    855,   1892,    685,  -1927,  -1682,  -2085,  -1894,    761,   1003,  -1289,  -1865,
-  -1700,   -434,   1523,   1213,    266,   -377,    127,   1806,   3143,   1748,   -187,   -426,    401,     12,    722,   -224,
-  -1477,   1084,   1787,  -1375,  -3628,  -3544,  -1305,    474,   -148,  -2434,  -2144,  -1104,  -1273,  -1360,  -2788,  -3355,
-  -2531,  -2752,  -1994,  -1364,   -820,   -294,   -357,   -747,   -228,   1960,   2728,   1992,   1691,   1214,     83,    -83,
-   -690,   -666,   -592,  -2002,  -2380,  -1371,    631,   1583,    -41,  -2438,  -2101,   -512,    660,    161,      5,    517,
-  -1358,  -2545,  -1434,   -657,   -828,  -1827,  -1061,    -89,   -152,  -2195,  -2819,  -1017,   -181,    345,    211,   -181,
-  -1274,  -2400,  -1454,   -450,   -963,  -1587,  -1612,   -782,   -155,   -295,    -71,    289,    779,    510,   1013,   2223,
-   2240,    295,   1058,    784,   -254,    437,    908,    943,   1231,    470,  -2218,  -3311,     -6,   -550,  -2872,  -2500,
-   -229,   1250,    223,  -2628,  -2702,    365,   2203,    -91,  -1624,  -1065,     55,    357,    385,    621,   1674,    595,
-   -293,    383,    281,    930,   1529,    890,  -1329,  -1811,   -868,   -129,    -77,   1065,    316,   -433,    258,    735,
-   3265,   3623,     13,  -1972,  -1149,    430,    916,    772,    118,   -423,    440,   2337,   2681,    473,   -797,   1215,
-   1207,   -762,   -596,   1617,   2594,   1524,   1195,     46,   -999,   -513,   -327,   -778,  -1205,   -438,   1157,   1012,
-   -402,  -1095,  -1102,   -861,    433,    427,    109,    392,    315,   -262,   1002,   1750,    326,   -271,    -92,    380,
-    996,   1353,   1270,   1990,   2046,   1783,    973,   -550,   -100,    924,   1367,    380,     63,   1553,   1425,   -169,
-  -1417,   -979,    658,   2125,   1116,   -790,  -1890,  -1579,    183,   1396,   -354,  -1641,  -1329,   -519,   1324,   1783,
-    193,   -333,   -711,    404,   1338,   1378,    621,   -211,   -561,   -481,    591,   2024,   1742,      2,    -26,    220,
-    -68,   -202,    594,   1216,   1102,   -438,  -1084,    817,   1084,   -947,  -2783,  -2565,   -557,   1344,    386,   -399,
-    847,   2197,   1014,  -1175,  -1712,   -218,   1077,   1770,   1012,     40,   -432,  -1462,  -1063,    229,   -199,     47,
-    844,    672,  -1002,  -2116,  -1818,     81,    349,    323,    765,   -277,  -1228,  -1286,  -1217,   -260,   -306,  -1103,
-  -1018,   1230,   1907,     33,   -181,    676,   1441,    839,    565,   1093,   1663,    952,   -206,    428,    691,   -292,
-   -685,    236,    589,   -584,  -1597,  -1777,  -1799,  -1247,   -572,   -457,   -866,  -1133,   -991,   -605,   -517,    538,
-    132,  -1229,  -1755,  -1102,   -192,    -93,   -289,   -315,     -7,    616,    171,  -1545,   -411,   1118,    471,   -130,
-   -830,    286,    859,   -697,  -1257,   -306,    509,   2394,   2703,    238,   -485,   1380,   1460,    166,   -566,  -1397,
-  -1111,   -942,  -1582,  -3085,  -3660,  -2777,  -1607,  -1090,  -1553,  -1636,   -340,   1240,   1610,    810,   -630,   -647,
-   1286,   1818,   1551,   2037,   1230,   -200,   -240,    380,   1042,    514,   -893,   -912,   -482,  -1698,  -2211,   -394,
-    788,    -48,   -757,   -433,    118,    828,   1763,   2257,    861,  -1215,  -1755,  -1093,   -589,   -575,   -863,   -580,
-   -643,    212,    336,  -1056,  -1435,   -233,   1061,   1455,    518,   -822,   -883,     82,    377,    549,    580,    462,
-     34,   -376,   -487,    275,   1561,   1477,    724,    -59,    388,   1504,   1331,    710,    141,    243,   -208,     26,
-    546,    116,   -473,   -611,   -362,   -170,   -294,   -276,    -79,     79,   -357,    425,   1134,    441,    166,    452,
-    684,    317,     66,    750,    810,   1149,    601,   -688,  -1003,   -194,    -30,   -640,     55,    617,   -315,    202,
-   1648,   1358,   -382,   -493,    -85,   -881,     89,    953,   -318,   -354,    369,    629,    245,   -223,    618,   1234,
-     30,   -279,    597,   2236,   1976,    435,     77,   1160,   2117,   1149,    137,   -189,   -773,   -983,    -71,    509,
-    -92,  -1218,  -1204,    354,      1,  -1408,  -1634,   -464,    -66,    -45,    785,    136,   -858,   -338,   -618,  -1239,
-   -645,     -4,    462,    681,    846,    197,   -135,    750,   1672,   1613,    716,    889,    447,    104,    515,    913,
-    969,    283,   -446,   -227,   -153,   -181,    -45,   -595,  -1802,  -1185,    -32,   -234,   -807,   -682,   -749,   -301,
-   -240,   -442,   -593,    318,    271,    149,     78,   -228,    448,     21,   -886,   -838,  -1111,   -964,   -706,   -625,
-   -458,    420,    572,   -527,  -1232,   -802,   -191,    285,   1060,   1140,    425,   -167,   -410,     17,   -496,   -124,
-    730,    294,   -269,   -723,   -348,    214,   -226,   -824,   -324,    395,     28,   -877,   -881,   -772,     11,   1206,
-    211,  -1406,   -966,    -41,     69,     35,   -727,  -1545,   -828,    160,    396,    650,    277,   -380,  -1294,  -1336,
-   -256,    770,    115,  -1287,   -163,    603,   -180,   -744,    210,    599,    626,    709,    352,     61,   -208,    181,
-    -84,   -518,   -295,    -41,   -185,   -120,    338,    659,     21,   -778,  -1137,    700,   2090,   1035,   -814,  -1130,
-    145,    574,   -230,   -978,   -651,    308,    382,   -641,   -415,     13,   -440,    155,    652,    388,     41,   -407,
-    142,    833,   -150,   -809,   -642,   -132,   -123,   -218,    365,   1123,    437,   -204,     29,    215,    458,    397,
-    482,   1287,   1277,    249,    243,    678,    258,    272,    950,    670,    356,    -59,     39,   -332,  -1274,   -482,
-   -572,   -887,   -307,   -533,   -610,   -148,     79,    165,    268,    487,    298,    187,   1073,    856,     31,   -313,
-    346,    786,   1013,    122,   -602,   -319,    261,    770,    322,   -294,    220,   1106,   1312,    709,     44,    377,
-    494,    315,    281,    138,    381,    343,     22,   -149,   -532,   -918,   -680,   -226,   -103,   -225,   -603,   -499,
-   -249,    743,   1007,   -286,   -988,   -393,    414,   1266,   1093,    519,    453,    793,    703,   -117,   -213,     86,
-    242,    307,    349,    -93,   -626,    437,    836,    -35,   -575,     85,    297,    155,   -262,   -518,   -106,    510,
-    289,    -29,   -588,   -269,    274,    308,   -231,  -1054,    -57,    962,    178,   -528,   -569,    -32,    -47,   -659,
-   -480,    527,    470,    247,    848,    971,    272,    220,    473,    299,    193,    312,   -116,   -317,   -290,   -696,
-   -261,   -392,   -696,   -495,   -864,  -1215,   -768,     51,     85,   -333,   -305,   -452,   -334,    338,    210,   -141,
-    -62,    155,    147,    329,    196,    -80,    199,     99,     20,   -495,   -545,    487,    881,    571,   -529,   -954,
-   -433,   -176,    179,     30,   -426,  -1022,  -1237,   -486,   -181,   -977,  -1360,   -370,    293,    245,    -28,   -760,
-   -553,   -414,   -274,    359,    821,    579,    100,    233,    257,    127,     47,   -210,   -532,   -455,   -273,    -69,
-   -222,   -611,  -1024,  -1229,   -732,      0,   -111,   -214,   -115,    134,    469,    311,     52,    -21,    151,    424,
-    282,   -321,    -89,    141,   -920,  -1123,   -405,     82,     28,   -372,   -463,    132,    349,   -369,   -933,   -403,
-    330,    401,   -194,   -411,      7,    300,     61,   -174,     46,    372,    108,    161,    332,    177,   -105,    -92,
-    276,    342,     31,    -71,    153,    -57,   -581,   -352,    233,    153,    -15,    194,    480,    911,    703,   -327,
-    105,   1197,    816,    -90,   -295,    303,     20,   -397,    255,    487,   -546,   -672,    168,    636,    388,   -315,
-   -602,   -317,   -205,    198,    208,   -208,   -114,    385,    560,    244,    114,    479,    680,    774,    664,    642,
-    245,   -315,    181,    527,    346,    439,    140,    -94,    220,    500,    213,     -6,    -41,   -100,     -3,     43,
-    198,     48,   -271,     31,    366,    770,   1053,     64,   -775,   -314,   -133,     30,    174,    166,    588,    821,
-    364,      0,    -79,     77,    129,    311,    964,    939,    127,   -318,   -253,    142,    273,      0,      0,    261,
-    277,   -163,   -243,    456,    521,   -157,   -733,   -738,   -317,    330,    364,     85,     -1,     44,     94,     43,
-    -84,    -29,     52,    -70,   -295,     99,    202,   -263,   -584,    -65,    208,   -143,     34,    259,    148,     81,
-     89,    117,    130,     43,   -314,   -596,   -339,   -224,   -339,     -6,    134,   -149,   -148,    -83,   -217,    185,
-    112,   -235,   -225,   -104,    173,     57,   -251,     -1,    272,   -190,   -518,   -186,   -210,    -70,   -223,   -513,
-   -519,     43,    533,     60,   -421,   -470,   -353,    -99,    -93,   -342,   -552,   -458,    138,    223,     24,   -225,
-   -365,   -101,    389,    239,    -73,   -391,   -443,   -662,   -580,    -55,    279,    -72,   -600,   -357,    246,    -73,
-   -463,   -288,    200,    536,    364,    -35,   -337,   -235,     62,    -99,   -579,   -410,    -78,    -81,   -173,   -229,
-   -366,   -369,     53,    194,     98,   -200,     77,    663,    539,      5,   -238,    337,    643,    367,    197,    547,
-    473,    200,     65,   -260,   -420,   -613,   -598,   -276,    -89,   -495,   -660,   -385,   -510,   -604,   -316,   -217,
-   -402,   -268,    126,    402,    393,    200,     80,    223,    129,     29,    194,    304,    576,    956,    993,    435,
-    272,    165,    109,   -169,   -409,   -262,    -85,    585,    815,    208,   -353,   -195,    188,    -22,   -361,    -67,
-    272,    -60,   -400,   -138,   -130,   -371,   -198,    159,    254,    -12,    -45,    275,    335,    108,    -20,   -119,
-    164,    345,    298,    356,    640,    514,    224,    185,    462,    271,   -348,   -482,     -5,    127,     22,    -45,
-   -184,   -294,   -306,   -372,   -329,    212,    374,    -39,     15,     84,    327,    394,     16,   -145,   -100,    -41,
-    409,    323,    304,    659,    424,   -118,   -328,   -221,     33,    322,    265,     30,   -219,   -463,   -388,    -32,
-    -23,   -277,   -197,    -29,    -62,    -17,    136,    287,    176,    -45,    297,    458,     76,     -3,    137,    -89,
-    198,    359,     -2,   -239,   -336,     74,    550,    464,   -261,   -303,    -20,     37,     65,    189,    215,     48,
-   -111,   -104,   -151,   -236,   -164,   -106,    -26,   -118,   -305,   -231,   -181,   -173,    268,    552,    349,     50,
-    -28,      7,    135,    121,    -27,   -118,    112,     91,   -159,   -134,     47,    216,     89,   -177,   -441,   -523,
-   -193,    139,     34,   -203,    -89,   -200,   -120,     79,    -60,   -219,    -84,     15,    -42,     59,     69,     79,
-    117,    225,    276,     25,     44,     92,   -255,   -250,    214,    258,   -127,   -258,   -227,   -256,   -247,    -85,
-    -23,   -241,   -465,   -255,   -189,     54,    221,     50,   -306,   -243,    -31,    209,     25,    -52,   -285,   -349,
-     -1,    -86,   -268,   -286,   -333,   -112,    -68,     83,    364,    425,    112,   -216,    -63,    331,    311,     13,
-   -291,   -269,    -10,     90,     52,   -104,   -331,   -102,    178,     38,   -162,    -58,     42,    101,    143,   -303,
-   -436,      4,    241,     10,   -403,   -408,   -139,      7,    -10,   -193,   -278,   -382,   -250,    -29,    217,    343,
-    292,    177,    206,    140,     22,     92,     86,     55,    172,    240,    248,    306,    179,      1,   -139,   -223,
-    -37,     11,    123,    234,     95,   -291,   -409,   -147,   -137,   -200,   -118,     81,     46,     75,     58,    -43,
-     67,    258,    119,    174,    357,    408,    239,    120,    258,    363,    298,    119,    100,     36,   -200,      6,
-    284,     39,   -203,   -118,     -9,    -42,    -74,    130,    161,   -118,   -181,     25,    164,    121,      3,    156,
-    236,    280,    318,    184,    151,    173,    113,     43,    -16,     56,    128,   -110,   -136,    -18,   -142,   -139,
-     45,    101,   -160,   -409,   -267,     23,    134,    254,    309,    142,    194,    437,    292,    145,    227,    217,
-    -49,   -125,     21,     48,    -93,   -116,   -138,   -164,    -95,     51,    125,    165,    216,    210,    163,    -32,
-   -188,   -122,     33,    141,    141,    -28,   -250,   -288,   -315,   -180,    -55,    -67,     45,    206,    206,    108,
-    -32,    -80,    -92,   -119,   -223,   -223,    -47,     -4,    -35,     -4,    115,    161,    106,    -66,    -78,     88,
-     75,     32,   -151,   -222,   -155,   -190,   -182,   -160,   -231,   -184,    164,    241,     48,   -124,   -158,   -164,
-   -107,   -163,   -217,   -129,     10,     39,   -122,    -96,    132,    119,    -53,   -150,    -66,    -79,    -81,    -86,
-   -169,   -122,    -19,    -23,    -30,   -108,      5,    132,    -13,   -246,   -190,   -126,   -135,   -131,   -109,    -51,
-    -40,      4,    -13,    -77,   -109,    -57,    -49,    -43,   -102,   -194,   -224,   -213,    -79,     87,      1,   -115,
-   -101,    -94,    -25,     62,     52,    -50,    -86,     -5,     -5,     -2,     94,    198,    317,    147,    -26,   -100,
-   -101,     11,    105,      3,   -185,   -139,     92,    164,      7,   -194,   -175,    -59,    -17,    -20,   -129,   -107,
-     36,    121,     94,    -14,   -132,   -128,    -23,    121,    252,    135,     -1,     -1,     39,    100,     83,    -32,
-      0,     43,     63,    157,     88,     -2,     52,    105,     87,     15,      4,     -1,    -92,   -134,    -11,     62,
-    102,     83,     83,    113,    136,    174,    182,    130,     79,     10,     85,    150,    129,     88,     20,     42,
-    150,    120,    -26,    -94,   -111,   -105,    -84,   -107,   -114,    -71,     59,    157,    126,    -33,    -64,    126,
-    188,    206,    265,     85,   -113,    -87,      8,     39,    -38,   -110,    -45,     54,     32,     -4,     57,    113,
-    110,     54,     53,    -19,   -109,   -102,    -97,   -119,     -3,    176,    154,    120,    195,    176,    163,    169,
-    118,     48,    -42,   -116,    -43,    -52,   -117,    -90,    -31,    -68,   -146,   -138,    -81,   -106,   -184,   -103,
-    -11,     21,     92,    134,    150,    155,    177,    126,     41,     61,     85,     93,    146,    137,    111,     14,
-   -119,   -174,   -214,   -210,   -140,    -48,     17,    -22,    -13,     99,    141,    175,    259,    224,    159,    155,
-     94,      6,    -15,     -7,     -4,    -10,    -45,    -90,   -100,   -123,   -116,   -110,    -99,    -61,    -29,    -20,
-    -78,   -161,    -78,     23,     27,     33,     30,     51,    127,    135,    166,    130,     38,    -44,   -102,    -93,
-    -46,     30,    105,    109,     48,    -61,    -55,    -24,     17,     17,     -5,     40,     40,     -8,    -33,    -25,
-     19,     65,     36,      3,    -50,   -107,   -116,   -153,   -185,   -121,   -132,   -189,   -117,    -37,    -60,   -115,
-   -106,    -44,     31,     54,     30,     95,    200,    165,     97,    115,    134,     55,    -40,    -97,    -79,    -47,
-    -51,    -88,   -106,    -69,    -13,    -59,   -185,   -242,   -165,   -127,   -164,   -165,   -122,    -72,    -69,    -90,
-    -34,     43,     38,      3,     59,    147,    227,    265,    217,    118,      7,    -48,    -52,    -56,    -48,    -37,
-    -56,   -142,   -239,   -272,   -196,    -84,    -55,    -33,      2,      3,      1,    -49,    -99,    -47,     18,      3,
-    -22,     37,    117,    126,     98,     22,    -47,    -67,    -55,    -86,   -160,   -142,    -54,     -5,     -7,     32,
-    124,    155,     87,     -6,    -84,   -110,    -53,    -16,      2,     48,     42,      6,     -6,     13,    -57,    -95,
-    -34,    -38,    -65,     -9,     24,     72,     78,     56,     57,     87,     74,    -21,    -93,    -64,    -10,     38,
-     59,     76,    114,    112,     50,    -33,    -63,    -10,      6,    -49,   -132,   -146,    -75,    -17,     -4,     -4,
-     18,     40,     55,     97,    131,    128,    115,    133,    144,    106,     20,     37,     88,     59,    -12,    -29,
-      0,     50,     70,     73,     93,    109,     98,    112,     76,      6,      7,     -8,    -69,    -34,     60,     99,
-     55,      3,    -81,   -108,     -6,     70,     79,     99,    108,     86,     71,     76,     19,    -16,     16,     37,
-     36,     37,     15,     27,     34,    -21,    -86,    -75,    -64,    -59,    -74,    -53,      0,     43,     66,     49,
-     42,    103,     97,     66,     83,     17,    -66,    -41,      2,     81,    125,     84,     51,     42,     42,     62,
-     48,      9,    -13,    -63,   -111,    -84,    -54,    -61,    -76,    -56,    -16,    -34,   -104,    -75,     24,     76,
-     73,     18,    -36,    -19,     36,     11,    -70,    -48,     14,    -19,    -76,    -48,    -24,    -46,    -62,    -73,
-   -101,   -114,    -89,    -20,     29,     45,     42,     51,     82,     79,     62,     79,     40,      2,     -9,    -23,
-    -15,    -35,   -106,   -147,   -159,   -152,   -106,    -88,    -61,    -19,     -7,    -11,    -18,    -10,      0,    -28,
-    -39,     -7,     10,    -17,    -51,    -65,    -31,     23,     38,     34,     20,     10,     47,    153,    184,     50,
-    -78,    -68,    -15,      4,    -31,    -83,    -91,    -53,    -46,    -58,    -36,      4,    -33,    -79,    -90,   -112,
-    -93,    -46,     -5,     24,      1,    -62,    -67,    -10,     58,     89,    109,    107,     89,     99,     54,    -33,
-    -22,     34,     35,     33,     37,    -30,    -75,    -42,    -35,    -53,    -47,    -35,    -16,     -5,     36,    106,
-     73,     -6,    -37,    -34,     -3,     19,     23,     -8,    -64,    -66,    -46,    -46,    -49,    -25,      8,    -14,
-    -61,    -36,    -42,    -52,     31,     92,     63,     24,     54,    101,    113,    109,    115,    117,     97,     48,
-     14,    -15,    -25,    -13,    -25,    -45,     -6,     27,     19,    -23,    -64,    -22,     44,     52,     13,    -15,
-    -30,    -45,    -57,    -64,    -40,    -27,    -45,    -50,    -18,      7,    -12,    -19,     21,     83,     96,     24,
-      2,     89,    126,     64,     16,     30,     58,     33,     -5,     -2,     14,      2,    -12,      0,     -5,    -20,
-     -6,    -13,    -37,    -33,     -7,      4,      4,     10,     14,     -3,    -16,      2,     43,     31,      0,     18,
-     26,     15,     28,     38,     18,      0,    -15,    -36,    -25,     -5,      4,     35,     69,     36,    -31,    -57,
-    -38,    -17,      0,     15,     43,     66,     37,      3,     17,     -4,    -17,    -23,    -25,    -20,    -10,     29,
-     73,     71,     18,    -16,     21,     51,     46,     17,    -24,    -50,    -42,    -45,    -86,    -76,    -19,    -13,
-    -25,    -25,     -6,     36,     50,     27,     12,     32,     90,    112,     63,     60,     64,      9,    -14,      4,
-      2,    -30,    -54,    -94,    -99,    -49,    -33,    -41,    -11,     12,     -7,    -33,    -44,    -45,    -18,     32,
-     73,     69,     52,      8,    -23,     -5,     29,     30,     -4,    -22,     -1,     -8,    -27,    -24,    -28,    -36,
-    -38,    -31,     15,     23,     -8,    -30,    -47,    -53,    -56,    -34,    -21,    -54,    -48,     13,     47,     12,
-    -51,    -56,    -17,     -4,    -26,    -36,    -14,     -5,      8,     12,      9,      4,      3,     -3,      0,      4,
-     -5,    -31,    -43,    -21,     23,     50,     35,      2,    -14,    -20,    -14,    -41,    -79,    -78,    -71,    -62,
-    -59,    -51,    -19,     11,     35,     30,     23,     32,      5,    -16,    -25,     -3,     38,     24,    -29,    -53,
-    -56,    -49,    -22,     21,     48,     21,     -6,     13,     34,     39,     31,     24,     12,     10,     41,     48,
-     17,     -2,    -12,    -23,    -27,    -38,    -26,     15,     69,     83,     63,     -3,    -47,    -27,    -24,    -25,
-     -8,      0,      0,      8,     24,     39,     22,      3,     15,     47,     34,     -3,     20,     81,    100,     86,
-     63,     48,     36,     10,    -13,    -51,    -71,    -52,    -22,      4,      5,     -3,      4,     -4,    -10,      3,
-     17,     -1,    -23,    -13,     11,     39,     60,     59,     40,     23,     34,     46,     12,    -22,    -10,      4,
-     10,     17,     41,     22,    -32,    -38,     -7,     36,     62,     38,      3,     20,     24,     -6,    -34,    -39,
-    -28,    -21,    -16,     -2,    -34,    -56,    -41,    -18,      4,      4,    -40,    -69,    -24,     24,     11,    -13,
-    -26,    -33,      0,     44,     41,     10,    -17,    -26,    -19,      0,     15,     -6,    -41,    -38,    -21,      0,
-     27,     47,     42,     25,     -4,    -13,      1,    -10,    -14,    -12,    -18,    -12,      0,      9,    -12,    -42,
-    -46,    -36,    -39,    -31,     -7,     -5,     -3,     20,      3,      0,      5,    -30,    -35,     11,     38,     25,
-     11,     20,      4,    -18,     -9,     -7,    -23,     -6,     12,     13,      2,    -26,    -36,      3,     36,     44,
-     39,     10,     -1,     24,     50,     33,    -20,    -35,    -12,     12,     -6,    -42,    -32,    -10,     -9,     13,
-     43,     25,     -9,    -20,    -13,     -9,    -14,     -7,      2,      8,     19,     17,    -10,      5,     70,     73,
-     30,     -1,    -20,    -15,     -2,     10,     19,     39,     38,     15,      2,     -5,    -16,    -22,    -14,     -5,
-     -4,    -18,    -47,    -56,    -47,    -38,    -32,    -26,    -20,      1,     28,     52,     50,     53,     52,     30,
-     17,     16,      1,    -21,    -36,    -24,     -7,      0,    -11,    -27,    -26,    -17,    -25,    -32,    -18,      1,
-      4,     -7,    -26,    -28,      3,     37,     56,     63,     30,      0,     -5,     -6,      0,     -6,    -34,    -50,
-    -45,    -21,    -12,    -16,    -13,     -7,      0,      8,     -2,    -16,    -13,     -9,    -19,    -25,    -33,    -27,
-     -1,     12,      2,     -6,      2,     22,     21,     -9,    -20,     -2,      2,     -6,     -2,     20,     32,     10,
-     -4,      5,     13,     15,      9,     13,     33,     30,     22,     13,      3,     -5,    -27,    -37,    -19,    -21,
-    -53,    -49,    -23,    -21,    -18,      4,     17,     17,     20,     34,     42,     57,     44,     29,     33,     36,
-     41,     38,      5,     -6,     16,     31,     32,     33,     19,     11,     19,     17,      0,    -17,    -35,    -46,
-    -38,    -17,    -11,    -22,    -21,     -8,     15,     33,     26,     13,      9,      4,      6,     11,     13,     11,
-     -2,    -12,     13,     33,     13,      7,     33,     31,      9,     14,     27,     17,      7,      6,     25,     36,
-      1,    -20,     -5,      3,     -4,     -8,     -8,    -17,    -21,    -19,    -25,    -21,     -2,     18,     22,     11,
-      0,     -7,     -3,      3,     -6,    -21,    -14,     -5,     -7,    -12,     -8,     -8,     -5,      0,      6,     13,
-     14,     11,     17,     21,     15,      4,      0,     -4,    -12,    -14,    -12,     -3,     10,     15,     20,     22,
-      9,    -13,    -25,    -19,     -4,     -7,    -11,    -16,    -26,    -28,    -27,    -35,    -38,    -29,    -28,    -40,
-    -32,    -14,    -11,    -25,    -22,    -10,      0,     10,     16,     21,     43,     61,     41,     15,     10,      4,
-     -5,    -18,    -14,      4,      1,    -21,    -28,    -19,    -25,    -33,    -19,    -10,    -13,    -11,    -10,    -20,
-    -18,     -4,      1,     15,     29,      4,    -26,    -29,    -27,    -33,    -26,    -18,    -16,     -7,      5,     21,
-     32,     30,     20,      9,      4,      2,      0,     -9,    -17,    -21,    -33,    -37,    -25,    -16,    -15,     -6,
-      6,      8,     12,     11,     10,     15,     14,      8,      0,     -7,    -10,    -10,    -11,     -6,      7,     11,
-      1,     -7,     -4,      6,     16,     11,      7,     10,     18,     11,    -11,    -25,    -14,     10,     19,      7,
-      5,      3,     -3,     10,     22,     22,     15,      2,      0,      4,      9,     17,      2,    -23,    -32,    -27,
-    -13,      9,     26,     27,     29,     33,     20,      8,      3,     -7,    -14,    -12,     -5,      1,     12,     18,
-     13,      6,      1,      2,     -4,    -17,    -24,    -25,    -26,    -12,      6,     20,     27,     16,      7,     14,
-     17,     14,     13,     11,      7,     -8,    -19,    -11,     -1,      6,     14,     16,      6,      5,     20,     28,
-     23,      9,     -8,    -17,     -5,     15,     14,     -5,    -18,    -21,    -20,    -10,     -3,      0,      5,      3,
-     -8,     -7,     -3,    -14,    -17,     -7,    -17,    -29,    -15,      0,     -2,     -4,      7,     23,     29,     33,
-     32,     20,     11,      3,     -5,     -2,      0,     -6,     -1,     13,     17,     21,     17,     11,     14,     15,
-      1,     -9,      2,     12,      0,    -21,    -27,    -17,    -17,    -23,    -24,    -25,    -16,     -3,      1,      0,
-     -9,      0,     15,     16,     10,      8,      6,      2,      4,     12,      5,     -6,     -2,      3,      4,      3,
-     -4,     -7,     -2,      3,      7,     21,     19,     -1,     -7,     -2,      1,      6,      2,     -7,     -7,     -2,
-     -7,    -14,    -18,    -10,     -1,      3,      3,     -3,    -11,    -15,    -11,    -10,    -18,    -22,    -15,     -6,
-    -10,    -14,     -1,     18,     21,      9,      1,      9,     10,      0,     -2,      2,      7,      7,     -1,     -3,
-      5,      0,    -16,    -10,      2,      4,      6,      1,     -2,     -2,      6,     10,     -4,    -16,    -16,     -9,
-     -4,    -15,    -27,    -23,    -27,    -32,    -18,      0,     10,      8,      5,      2,      0,      0,     -2,     -3,
-      5,     20,     24,     19,      6,     -7,    -10,     -6,     -9,    -16,    -12,     -1,      4,      6,      6,      6,
-      7,      6,     12,      5,     -1,      2,     10,     16,      8,     -4,     -5,     -3,     -8,    -25,    -31,    -24,
-    -15,     -2,      6,      8,      8,     17,     25,     19,      7,      5,     11,      4,      0,     -1,      2,      5,
-      4,      5,      5,      3,      2,     10,     14,      3,     -5,     -4,      1,      9,      4,     -4,     -9,    -11,
-     -9,     -9,     -7,     -5,     -4,      4,     16,     16,     10,      8,      9,     12,     10,     10,     13,      2,
-     -7,     -5,    -10,     -5,     10,     17,     12,      7,      8,      9,      9,     10,     10,      8,      8,      8,
-      8,     -2,     -8,     -6,     -2,     -2,     -8,    -18,    -21,     -6,      5,      2,      7,     13,      7,     -5,
-    -14,    -10,      0,     12,      9,     -4,     -8,     -5,     -7,      2,     16,     17,      9,      1,     -3,     -8,
-    -11,     -9,     -4,      7,     10,      0,     -6,     -8,     -9,    -15,    -22,    -26,    -17,     -3,      2,      3,
-     15,     24,     20,     12,      8,     -2,    -11,     -5,     -3,     -6,     -8,     -6,      0,      5,      5,      0,
-     -2,      0,     -2,     -3,      6,      3,     -5,     -4,     -9,    -19,    -14,    -10,     -8,     -8,     -6,      0,
-      5,      2,      0,      3,      8,      6,     -3,      0,     11,     12,      5,      1,      0,     -8,     -6,      0,
-      6,      8,      1,     -7,     -8,     -4,     -4,     -5,     -2,      6,      7,     -3,    -11,    -11,    -15,    -18,
-    -19,    -17,    -14,     -6,      2,      6,     10,     18,     24,     23,     10,     -7,    -15,     -5,      9,      5,
-     -5,     -6,      1,     11,     11,      0,     -4,     -4,      6,     12,      8,      4,     -2,    -10,    -16,    -15,
-    -13,     -6,     -2,     -1,     -5,     -1,      3,     -2,     -4,     -4,     -5,     -6,     -5,     -7,     -6,      0,
-      3,      5,      5,      2,      0,     -1,      1,      3,     -2,    -11,    -12,     -4,      0,     -2,     -2,      0,
-      1,      2,      3,      2,     -1,     -5,     -4,     -1,     -1,     -3,     -8,     -5,     -1,     -2,     -4,      1,
-      2,      2,      2,      3,      0,     -6,     -5,      0,      7,      5,      1,      5,      8,      6,      4,      4,
-      3,      5,      4,      5,      5,      4,      7,      7,      4,      4,      4,      2,      0,     -1,      0,     -1,
-     -4,     -3,      0,      0,     -2,      0,     -2,      2,      9,      6,      4,      4,      5,      3,      3,      1,
-      1,      6,     10,      8,      6,      5,      3,      7,      7,      6,      8,      6,      0,      0,     -1,     -3,
-      0,      0,     -2,     -1,     -2,      0,      4,      1,     -1,     -1,      0,      1,      0,      0,      6,      7,
-      5,      7,      6,      5,      2,     -1,      0,      0,      0,      0,      0,     -2,     -1,      0,      3,      1,
-     -1,     -2,     -2,      0,     -1,     -6,     -4,      0,     -1,     -2,     -5,     -9,     -8,     -4,     -5,     -8,
-     -7,     -5,     -4,     -2,     -1,      0,      1,      0,      1,      1,      2,      3,      0,     -1,     -1,      0,
-      0,     -1,      0,      2,      1,      0,     -3,     -1,      0,     -3,     -3,     -3,     -3,     -2,      0,      0,
-     -2,     -3,     -3,     -5,     -7,     -4,     -2,     -1,      0,      1,      0,     -1,     -2,     -2,     -2,     -2,
-     -3,     -2,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0};
+// Prepared by tools/sample_prep.py, trimmed at -60dB
+#define drum_snare_len        8245
+#define drum_snare_peak       31655
+#define drum_snare_gain       3779
+#define drum_snare_loop_start 0
+#define drum_snare_loop_end   0
+const int16_t drum_snare[] = {
+  14860,   8117,  16622,  28024,  22417,  -2420,  22814,  12765, -16668, -15089,  -7795,   1277,   8865, -14499, -24092, -10641,
+  -1054,  25448,  25126, -25629, -14262,   7942,   -116, -15616, -17787,  18606,  24842,  -5049, -19443, -31655, -27872, -17564,
+   1106,  30809,  29443,  29252,  28693,   3082, -21592,   6879,  15656, -25244, -25947,  -9514, -25430, -25565, -21219, -30582,
+  -1050,  30434,  26545, -22192, -18228, -31202, -31210,  -8433,  29634,  21947, -16929,  21976,  28799,  28549,  27827,   5523,
+ -30147, -27818, -25591, -28856, -26776, -18356,  -7906, -23365, -20827,    984, -16443, -26906,   -487,  21378,   2341, -27991,
+  -9036,    270, -18271, -20890,  12597,  15685,  13833,  21477,  15956,  16010,  16309, -10975, -18603, -25069, -24946, -27756,
+ -30034, -25442, -23436, -28907, -31254, -29778, -16582, -23457, -22230,  -9583, -14236, -27781, -27128, -24680, -24466, -16829,
+   9088,  -9936, -28862, -27111, -16681,  -1802,  19544,  17312,  28112,  27732,  26783,  24700, -14892, -26357, -20880, -16556,
+ -13724, -20846, -25179, -27584, -26475, -17257, -24186, -29843, -27616, -14592, -20225, -28246, -24374, -15806,  22047,  26468,
+  13502,  -8773, -16549, -10985, -21841, -19723,  -9782, -23227, -28463, -24888,   2400,   4406,    -16, -19305, -13020,  12530,
+  17481,  27322,   5594, -28710, -22596,   -426,  24743,  29617,  27378,  25491,  26144,  24081,  27274,  29513,  23312,   3407,
+  -7919,   -611,  21614,  20712,    630,  17112,  20655,   3811,   3823,  17806,  17497,   3012,    689,  -1694,   9656,  15597,
+  15852,  21627,  20430,  21126,  27020,  27278,  25942,  28190,  28765,  28590,  27616,  26247,  27926,  23379,  15554,  23507,
+  24102,   5809,  -1112,  14137,   5908,  15234,  29036,  28260,  27332,  29411,  21991,   4726,  19368,  23788,  14387,   5617,
+  -2359, -13644,  -8408,    928,   7846,   4485,  -2037, -20136, -27121, -14178,  12415,   8578,   1686,  12668,  16938,  19286,
+  19441,  13051,  10749,   1859,    170,   2902,  -4807,    515,  14669,  19333,   7666,   5100,  11770,  13844,   4577,    350,
+   2821,   5623,  -5172,   2830,   3424, -11526,  -7621,  -4543,  -9244, -23935, -19618, -16631, -23777, -17844,   4848,   -830,
+  -5448, -10110, -15889,  -6631,   1383,   -716,   6611,  13342,  10231, -11731,  -6169,  -1038, -10774, -17270, -15002, -17996,
+ -18603, -12129,  -7273, -18972, -18918, -20058, -21243,   5471,  -1340, -22788, -22630,  -9557,    459,  -4546, -18227, -22493,
+ -19935, -22360, -21621, -18937, -16523,  -9861,  -2241,   -787,   6056,   2797, -11763,  -3101,  12573,  18169,  15888,   5806,
+ -10457,     26,   8326,   3711,   4995,   6883,   3938,  15218,  20717,  11987,  14524,   9872,  -6551, -16173, -19161, -17198,
+  -4928,   7451,  13218,   7933,   6657,  14538,  15121,  10423,   5029,  -3497,    485,   9639,  14278,  10825, -11773, -19715,
+  -7278,  -2909, -16098, -13341,  -3123,  -6810,  -3128,  10704,   8356,   3380,  10765,  19681,  20965,  15761,   7430,   8990,
+  14749,   9863,   3251,   2273,   8158,   9284,   6729,   4383,  -2140,    501,   2031, -17945, -23266,  -9393,  -7705,  -7214,
+   2329,   3853,  -9254,   2572,   9772,   3391,  -1244,   4836,   7797,  10478,   3266,  -1272,   2492,   5422,  10121,   5305,
+   2243,    256,  -9170, -21793, -19196,  -6668, -15664, -22385, -24657, -21168,  -5326, -21433, -23634,  -4908,   2660,  -8195,
+ -12791, -12679, -12078,  -9045,  -6320, -12909, -15332,  -7163,   8131,    909, -12354, -15698, -14100,  -5150,  -1982,  -4812,
+  -1298,  -1632,  -6391,  -5475,  -8151, -12906,  -9497,  -5503,  -5242, -11329, -16088,  -8627,  -9497, -13459, -14912, -23362,
+ -23018, -15736, -19352, -19270,  -2982,  -5258, -19819, -23532, -21272, -14112, -12929,  -8214,   1017,  -3834, -13612, -11331,
+  -5913,   7424,  11963,  -1453, -13620, -12511,  -4340,   2403,    390,  -5609, -10561, -15983, -14594, -12745, -13440,  -9362,
+   6356,   7607,  -7493, -15266,  -1664,  13787,  11522,  11185,  18949,  16244,   8854,   9219,  12159,  17366,  13624,   5015,
+    286,  -4933, -12015,  -7642,    -18,   6700,  15589,  11006,    -79,   4035,  13239,  15747,  21659,  24853,  21027,   9195,
+  13263,  18435,  19748,  21311,  22211,  22402,  18179,  14722,  13207,  16318,  20468,  22274,  22327,  19126,  16827,  19945,
+  21269,  20099,  18261,  22213,  24077,  21713,  22491,  23107,  19654,  15430,  16700,  20628,  21814,  23354,  23223,  17371,
+  12975,  14954,  16029,  18567,  21948,  21533,  23253,  27740,  26350,  18935,  14034,   9420,  22231,  27550,  23262,  10308,
+  12235,  22875,  20144,  16583,   9085,   7315,  16846,  16530,  13285,   6478,  -2556,  -2339,    162,  -3922,  -5408,   1379,
+   7255,  16118,  14741,   8473,  10726,  10799,   4321,   2182,   5642,   7444,  -1169,  -1238,  -1677,  -2377,   4434,   4613,
+  -6003, -19439,  -8624,   2392,  -4017, -18145, -15653,  -9373, -15487, -20788, -25814, -19196, -11993, -15160,  -6592,  -4087,
+  -3773,  -5319, -17460, -17079, -13449, -18259, -20210, -21940, -20269, -18372, -22253, -21237, -18774, -17566, -14703, -16638,
+ -20831, -24835, -28119, -29704, -28498, -25597, -23961, -25646, -26196, -25061, -27283, -28475, -24951, -19842, -23148, -25276,
+ -25099, -25205, -24815, -21479, -17973, -16521, -16003, -18686, -21066, -25125, -25517, -23629, -19564, -11317, -15493, -22141,
+ -22068, -18439, -17257, -20679, -19946, -22818, -23987, -20050, -11622, -12091, -15900, -11574, -10894, -16462, -18284,  -6340,
+  -3028,  -6910,  -4740,  -7189, -13782, -15170,  -8183,  -9080, -21485, -20027, -13784,  -7251,  -5463,   4757,   4167, -13724,
+ -19976,  -9626,  -5869,    983,   5150,   2800,  10107,  15924,  -2412,  -5406,   1179,   7691,   7201,   7108,   8931,  12888,
+   7541,   1352,   4035,  16685,  19989,   7672,   3001,  13305,  17011,    471,   3078,  22547,  20692,   6029,   5423,  12024,
+  17541,  20088,  19625,  14412,  21263,  20640,   9746,   8124,  14621,  13762,  11172,  13607,  16628,  21249,  22274,  21071,
+  25249,  24141,  18110,  12354,  13091,  19256,  18470,  17137,  14259,  18762,  19342,  15728,  16626,  16106,  13528,  19202,
+  14125,   7527,  10182,   4480,  -1918,  15217,  22040,  19633,  18188,  21597,  20233,  18223,  22172,  18157,  10125,   9086,
+  14560,  24441,  26979,  26822,  17241,   9695,  15075,  19114,  12866,  19416,  24306,  20557,   3209,  -6871,   1829,  17212,
+  18701,  19611,  13718,   7318,   4967,   6924,  13745,  16435,  14308,  16395,  17906,  -3790,  -7131,   6073,  12593,   7345,
+  -2572,    736,   8498,  10011,  12155,  14589,  13071,  10929,  12689,  19837,  21771,  20158,  17210,   9448,   2281,  -1057,
+    531,   2366,   6760,  10377,   2997,  -3295,    446,    618,  -3556,  -4866,  -5784,  -9350,  -5860,    149,   5114,   7933,
+   7259,   7607,   9405,   6239,   2018,  -1207,  -4651,  -4823,   -540,   -152,   1511,  -4292, -12097, -12549,  -8168,  -6725,
+  -7864,  -5099,  -4897,  -5157,   3358,  -5870, -16659, -14606,  -9334,   5453,   9812,   4642,    358,  -6003,  -8535,  -1907,
+  -4987, -14531, -11563,  -5688,  -5527,  -6201,   -988,    187,  -4369,  -6740,   -595,  -7105, -14547, -15436, -10519, -10023,
+ -14073, -18118, -20175, -21059, -19634, -14106, -11170, -12106, -18127, -19504, -15820, -12923, -16013, -17301, -19807, -20952,
+ -14968,  -9373, -13058, -14309, -13059, -12164, -14079, -10009,  -3173,  -4206,  -7764,  -6159,  -5231, -10629, -10537,  -5232,
+  -8821, -19360, -19548, -19608, -22718, -20714, -13906, -18859, -25949, -26469, -23947, -22003, -18135,  -3890,  -4534, -14541,
+ -17304, -17325, -19090, -15308,  -9885, -10494, -10921, -10654, -17191, -19020, -15142,  -7237,  -5175,  -6678,  -3950,  -1423,
+  -4861, -13817, -11772,  -9243,  -5957,  -6966, -14302, -14258,  -8498,  -8172,  -7047,  -3270,   -517,  -4242,  -6984,  -1683,
+  -3553,  -8288,  -3919,  -2846,  -5087,  -9751, -10124,  -8514,  -5798,  -7679,  -5957,  -3809,  -2827,  -2723,  -5009,  -3452,
+  -2755,  -2472,   1266,   1466,   1845,   5825,   4098,   2944,  11453,  18213,  12341,   2615,   -906,   3431,   9914,  17248,
+  21882,  13721,    857,   1528,   8604,  14870,  10802,  10111,  11856,  10792,   5661,   3155,   5624,   2462,  -1766,   -828,
+   4454,   8099,   9570,   4512,   2418,  -3291,  -7785,  -8508,  -4898,  -1539,  13937,  24997,  20049,   5031,   9162,  16366,
+  13224,   3765,   7521,  21396,  24442,  19532,  20474,  26090,  21545,  11712,   8839,  16693,  23915,  24476,  15791,  10864,
+   7366,   1617,  -1790,   5542,  11339,   6343,   7167,  12701,  10691,  12971,  13454,  16814,   9524,   1188,   2350,  16196,
+  14882,   8083,   3123,   1581,  10668,  16730,  10102,  10451,  13538,  12232,   9778,   6242,   7373,  15765,  17215,   7186,
+    148,  10116,   8447,   5901,   5714,   7035,   -754,   1404,  14321,   7758,   4534,  13861,  13714,   7531,   4480,   -401,
+     64,   8254,  15710,  13444,   7450,   4321,   6657,   7699,   1784,  -6889,  -3763,   2082,    601,    477,  -1786,  -6632,
+  -6705,   6326,  12888,  10573,   4614,  -2566,   3676,   8799,   5170,   6151,   4971,  -4680,  -8557,  -5706,  -5162,  -1224,
+   3251,  -5651,  -2421,   2213,   5035,    345,  -4921,  -5901,  -7165,  -9189,  -6892,  -3983,  -5253,  -7820,  -5158,  -1569,
+  -5909,  -7328,  -4208,  -6110,  -8263,  -9036,  -8873,  -9470,  -9747, -11301, -10952,  -3473,   4850,   2713,   -332,  -1117,
+  -3503,  -3604,  -8794, -11361,  -2722,   5528,  -3969,  -8603,  -3869,  -7035,  -2622,  -4282, -19725, -19244, -17357,  -8621,
+   -211,  -8423, -11011,  -8545,  -8692, -11103, -12976,  -9110,   -689,  -3227, -20944, -27294, -21085,  -5492,  -8106, -15633,
+ -17227, -10993,    133,  -1295, -10964,  -8370,  -5051,  -8408,  -8707, -15166, -22181, -19758, -11547,  -5170,  -8180, -13131,
+ -13952, -14109, -12730, -12091, -14878,  -8815,  -4369,  -5932, -12298, -17554, -16951, -14118, -15426, -10686,  -5452,  -8823,
+  -8730,  -7995,  -3270,  -4785,  -5571,  -1759,  -2311,  -5289, -10727, -16158, -18162, -18161, -11390,  -5044,  -5321,  -6356,
+  -9188, -15404,  -8890,    331,  -2096,  -4830,  -4960,  -5337,  -2788,   4203,   5985,   2740,  -4748,  -5586,    331,   -262,
+  -7930,  -4072,   8316,   9588,  -6424,  -7987,   5359,   7086,    420,  -1299,  -5921, -13121,  -8012,   3893,  -1818,  -8138,
+   1529,  10544,   9118,  12277,  11019,   3457,   2191,   5935,  18716,  25633,  15771,   2176,   2080,   3129,   8125,   6898,
+   3940,   7917,   9210,   8233,   7499,  10032,  11778,   6064,   2176,  13619,   8622,  10559,  16019,  14701,  15064,  13666,
+  17639,  21590,   9707,    214,   2486,   5062,  12047,  13950,   4198,  -1307,   2391,   9438,  16710,  20958,  20844,  15589,
+   9116,   9954,  15739,  24093,  23358,   9403,   5643,   8306,  10019,  17150,  13470,   1605,   6687,  11329,  10205,  14829,
+  20774,  13666,   4002,   2247,   7478,  14664,  13608,  10263,   6153,   4068,  11002,  19351,  19994,  14207,   8189,   6920,
+  11569,  16140,  19382,  17233,   5257,  -6423,  -3877,   9814,   8342,  -3582,  -6604,  -1139,   6815,  10387,   5604,   1064,
+   4660,  -1490,  -8292,  -6207,   8560,  15574,   6263,   1390,   6920,  12795,   2874,    513,   7947,  12776,  15928,  10262,
+   5740,  11346,   5629,  -3799,  -6879,  -1530,  -1360,  -4827,  -4258,  -2241,   2229,   1951,  -2831, -11075,  -6931,  -7325,
+ -11768,  -9440,  -2437,  -4038, -10845, -15685, -10166,   2048,   2133,   -937,  -1244,   -584,  -6774,  -6571,   2503,   1143,
+  -3942,   -798,     57,  -9978,  -9737,  -6676,  -6169,  -4633, -11271, -24033, -19711, -12480,  -7775,  -7244, -16628, -17477,
+  -8730,  -9526, -10100,  -6613,  -1335,   1060,  -2511,  -6606,  -3633,  -1731,  -1438,  -6658, -10019,  -7742,  -7285,  -6591,
+  -4454,  -4998,  -9713, -10243, -11781, -12800, -11069, -14192, -19057, -20582, -22280, -18444, -10762, -14817, -20074, -13844,
+  -3797,   1740,  -3959,  -7146, -15178, -13228,  -6923,  -2721,  -3911,  -4873,  -1705,   1793,   3950,  -2921, -12355, -11367,
+  -6093,   -305,   1969, -10621, -17094, -11870,  -7358,  -7727, -13178,  -9066,  -5659,  -6123,  -6857,  -8406,  -6848,  -3231,
+  -3354,  -7212,  -4187,   2117,   5323,  -1850, -12437,  -5840,   6635,   4938,  -2239,  -5738,  -2316,   1726,    104,   3515,
+   6391,    895,  -8771, -11843,  -3998,   1365,   3582,  -1260,  -6473,  -2496,    420,    618,   1185,     44,   1861,   3251,
+  -1672,  -5676,  -1441,   2086,    -54,   7100,  14274,  11116,   4647,   -447,   3856,   5289,   8969,   6060,     69,  -2852,
+   5585,   4265,   -860,   1461,   1414,  -1050,    430,   -755,  -2581,   5185,   9518,  11411,   8829,   -586,  -4776,  -1375,
+   6482,  13081,  11228,   4139,  -1991,  -1693,  -4421,  -4403,   5142,  18669,  19702,   5138,  -5185,   4444,  15989,  11330,
+   8792,  10300,   9617,   4523,   3436,   6638,  10320,   6859,   4574,   4090,   2317,   6298,  15852,  10966,  -2775,   -946,
+   4482,   3449,   7276,  14645,   7157,   1905,   9561,  13157,   1041,  -6152,  -2163,   3304,   3693,  10115,  12001,   8758,
+   7843,   5891,   6705,   9041,   8924,    250,   -796,  10849,  14998,  12377,  19480,  20143,   9823,   1673,  -2032,  -3360,
+   -267,   1971,   3941,   6403,   3682,   2169,   3079,   1106,   3378,   6095,   9281,   6121,  -1146,  -5203,    908,  11206,
+  12641,   6758,   7965,  12752,  19551,  17885,   3300,   -572,   4553,   8220,   7063,   -971,  -9544,  -8496,   1375,   8315,
+   5510,  -2406,  -6550,  -1648,   1204,  -8207, -11576,  -4795,  -5742,  -6798,   -716,   1808,  -7661, -10232,  -3052,   1126,
+   3496,   6172,   9398,   5248,   2255,   2387,    113,  -5418,  -2319,   4786,   7897,   4025,  -2705,  -6181,   3379,   7530,
+   2777,    842,    516,  -2235,   4435,   5262,   1268,  -2009,  -6886, -18995, -19822,  -7536,  -4585,  -7732, -10154, -10008,
+  -9185,  -5772,  -5806, -10846,  -2218,   3497,  -4257,  -4434,  -2679,  -3166,  -3923,    356,   -551,  -5749,  -9357,  -7779,
+  -6433,  -6463,  -6766,  -8830,  -9423,  -8339,  -8258,  -6520,  -1992,  -1094,  -4007,  -3499,  -3896,  -9965,  -8543,  -1398,
+  -3193,  -6469,  -2722,  -4511, -12206,  -9774,  -6644, -12544, -15026,  -8440,  -6324,  -8617,  -3198,  -5734,  -6046,  -3914,
+  -8747, -13333,  -7712,  -4871,  -6293,  -4360,  -3990,  -3932,   1482,  -3893, -13389,  -4511,   7596,  -1724, -12633,  -3245,
+   9540,   1910,  -6648,  -8844,  -8409,  -2622,  -1118,  -6008,  -2362,    887,  -9154, -15025, -13371,  -8664,   1573,    484,
+ -15925, -15294,  -7440,   -384,  -6110,  -3873,   -922,   3632,   7432,   2286,  -2185,    567,   -280,  -4954,  -4554,   3747,
+   7827,   5329,  -1204,  -6726,   -524,   6343,  -4589, -12843,   -884,   4241,  -6678, -11102,  -3235,   3947,   8484,   6747,
+  -1648,  -2738,   2153,   1986,   1648,   2104,   -843,   -674,    438,  -1823,   5275,  10576,   7955,   4852,   6288,   8992,
+   7797,   5139,   7443,   5488,   5604,  15202,  15291,   8481,   6822,    153,  -1565,   3551,   8298,   4150,   -217,   3075,
+    367,  -1882,    223,    -63,   2126,   2948,   1475,   2050,   5180,   7946,   3719,   4150,   5465,   5867,   2415,   5938,
+  11368,   8948,   6557,   3463,   4036,   6793,   5870,   3065,   2771,  12642,  13572,   9519,   6171,   2645,  -2042,   -744,
+   9067,  11649,  13687,  13071,  10127,   8907,   3602,  -2373,   1952,   4469,   5538,   6582,   1963,  -2868,  -1115,  -2610,
+  -3290,   2573,   9821,   3118,  -3884,   2821,   7255,   1988,   2082,   5369,   1706,  -2845,   -885,   3446,    571,  -2130,
+   4090,   8782,   5976,  -3443,  -2206,   6645,   9502,   9750,   5747,   1446,   4127,   8869,  12155,   8059,  -2717,  -2875,
+   2249,   8253,   8808,  -3696, -13164,  -8684,  -2499,   -342,  -5841,  -8729,  -6511,  -3277,   1222,   3729,   1422,  -2575,
+  -3390,  -1961,   -336,   1010,    562,   -782,   1882,   1606,  -3751,  -1914,   1560,    882,   -968,   2050,   4939,   -560,
+  -4865,  -6277,  -2598,   1580,  -1313,  -9523,  -5700,  -4019,  -8241,    303,   9700,   6107,  -6680,  -8383,  -5241,  -4190,
+  -8562,  -9361,  -8643,  -2990,   2974,  -1135, -10003, -10985,  -4160,    348,   1658,   2584,  -5820, -11841,  -2420,   5321,
+   3783,    247,    435,  -4708, -12971, -14614,  -4426,   3245,    780,  -3478,  -2760,   4888,   3050,  -7342,  -8818,    415,
+   3126,  -6621,  -9442,  -1470,   2910,   2677,  -1267,  -7211,  -6174,  -7873,  -7949,  -1768,   -240,  -1681,  -7582,  -6755,
+  -1228,  -2135,  -7917,  -5993,   5706,   2025,  -6700,  -7146,  -4816,  -4705,   3150,   6076,    450,  -3618,  -1106,    765,
+   2172,   5449,   3043,  -2018,  -6197,  -6520,  -4092,   2627,    820,  -7381,  -5317,   -783,   1276,  -3615, -12917,  -4403,
+   9420,   9875,  -3092, -12565,  -7029,   -831,  -1956,    -65,   2048,    -42,  -3645,  -4179,   3615,   5113,  -5070,  -9226,
+  -8664,  -2960,   5069,   1525,  -1601,  -1010,   2954,   4976,   2996,   4146,  11102,   7669,  -1392,  -2754,    851,   4957,
+   1411,  -7137,  -1035,   3243,   1482,    182,  -8191,  -5856,  -1300,   1718,   2536,  -1770,  -4180,  -4612,  -5033,  -5791,
+  -2895,   4063,  -1037,  -5315,   6854,  13873,   4092,  -1235,     59,   5309,   8279,   7447,   6749,   9737,   4636,   1389,
+   4874,   5216,   4457,   3122,  -2180,  -8686,  -2829,   5611,   3094,   3790,   7083,   3745,    136,   -731,   3290,   5143,
+   8917,   6734,    -72,   2981,  11034,   8336,   1360,  -2496,  -3346,   -950,   2618,   2661,   1969,   -995,    476,   6183,
+   2824,   -381,   7394,   8685,    985,     11,    555,   1291,   2682,   2692,    415,  -3869,  -6893,   6759,  10239,   4079,
+  -1088,   1427,   6786,   2821,  -3396,   2843,   8210,   1620,  -3445,  -7600,  -1135,   4175,   1558,    927,   3344,   5033,
+   1844,  -3359,  -2479,   6629,   5787,   3764,   -734,   -659,   5516,      1,  -3670,    838,  -1881,  -4470,  -9463,  -6291,
+    -17,   2531,   4764,   3165,   4085,     45,  -6582,  -9438,  -5078,   3258,   3131,  -4527,  -3777,   5964,   7615,   2292,
+  -3202,   -421,   6171,   7328,   6583,   6021,    414,  -3850,   -533,   4289,   3662,  -2301,  -5853,  -8367,  -9167,  -7264,
+  -1654,   5964,   3739,  -4573,  -3524,  -2935,  -5174,  -2209,   1951,  -3345,  -5182,   -205,   2946,   5757,   2468,  -4179,
+  -6490,  -3207,   1656,   6368,  -2570,  -9794,  -4944,  -3998,  -3095,   6751,  11997,   4711,  -1805,   1121,   4969,   8154,
+   9772,   -495,  -9868,  -3850,   3123,   3397,  -3300,  -9618,  -6433,  -5481,  -5952,    343,     52,  -2432,   5606,  12285,
+   3808,  -5187,  -1641,    300,  -3637,  -6473,  -2590,   3388,   6043,  -1467,  -7325,  -5992,    342,  -1027,  -2767,   1664,
+   2784,   -966,  -2627,   2717,   6896,   4370,  -1063,    626,    835,   1414,   1093,  -3948, -10573,  -7584,    894,  -1913,
+ -10107, -11086,  -2126,   1510,  -2924,  -3100,   2093,   8709,   7881,   -990,  -6960,  -6748,  -7498,  -7373,  -3608,   -460,
+   3499,   6358,   4684,   3165,   3965,   5246,    364,  -9136,  -7682,  -2628,   2752,   9327,   8021,   2452,   1041,   -483,
+  -6434,  -9753,   -796,    429,  -4889,  -5841,    804,  -4730,  -9152,  -4228,    722,  -1547,  -5742,  -4320,  -2112,  -6566,
+  -2727,   6204,   7709,   7976,   4261,    922,   2939,  -1995,  -7826,  -4469,   1658,    903,  -4119,  -8976,    -32,    936,
+  -6054,  -3120,   1601,  -2096,  -1516,  -2764,  -8620,  -4747,   4579,   2724,  -6075,  -9868,   1233,   3042,    377,   2446,
+   7606,  11407,  11368,  -2090,  -7034,  -3232,   3154,   5667,  -1453,  -3419,    170,   8476,   9899,   1359,  -5368,  -1416,
+   4540,   2908,  -3447,  -4201,   1196,    207,  -5324,   -159,   4042,  -6027,  -6225,   2359,   2782,   3772,   9470,   4156,
+  -6454, -11743, -12300,  -5362,  -1944,   3504,   5619,   4358,   2712,  -1016,   3685,   8300,   5694,   2183,   4125,   5744,
+   1363,   3674,   8197,   1181,   -332,   1071,   3742,   9578,   6140,   -601,   -353,   -606,  -1377,  -2837,  -4089,  -3561,
+  -6351,  -9411,  -2520,   3002,   1521,    304,    600,     39,    640,   6582,  11350,   7551,   3557,   6388,  12386,   6563,
+  -6667,  -8939,  -1950,  -2729,  -2197,  -4693,  -3892,  -4908,  -2331,   1706,  -6108, -10086,   2270,   3924,    258,   1064,
+   4645,   4444,    393,   5599,   5280,   2849,   -593,  -1412,   1621,   3215,   5394,   9834,   7423,     95,  -9928,  -8224,
+  -3098,  -5092,  -4945,  -6340,  -7368,    334,  -1071,  -2752,   -915,   6080,  -1154,  -6372,  -6208,  -5743,  -6625,  -4579,
+   -578,     56,  -3676,  -3377,   -829,  -2159,  -7111,  -4083,   2337,   4093,   3592,   3616,   1936,   5292,   5776,   1867,
+  -1033,   3698,   6034,   2334,   1067,   2670,   4787,    890,  -5088,  -3606,  -2406,   1209,   4239,   3645,   1060,  -3192,
+  -4810,  -6421,  -4140,   2770,   4567,    788,   5474,   8215,   4741,     75,  -3301,   1694,   3595,    372,  -2741,    542,
+   2037,   5997,   3294,  -5993,  -5721,    373,   1588,   6339,   6443,   1557,  -5876,  -7609,  -1699,   2085,   3255,   5067,
+   6704,   3675,   3162,   7685,   7428,   8032,   4119,    298,   1167,   6295,  10857,  13602,  10033,   5883,   7172,   4708,
+  -1345,  -1510,   2081,  -2498,  -5254,  -5911,  -7401,  -4394,   2446,    272,   1700,   4491,   1890,  -4370,    257,   5578,
+   2904,   4773,   9208,   5848,  -2734,  -1969,   2510,     80,  -5623,   3048,  12744,   9571,    -46,  -5549,  -2375,   1787,
+    862,  -3475,  -3452,   2785,   3641,  -4570,  -7424,   -608,  -2778,  -4050,    733,  -2540, -10002,  -9196,   1048,   2324,
+   -607,   -549,   3356,  -3329,  -3193,   3872,   6726,   2728,   -424,   -588,    937,   5552,   6179,   1156,   -477,  -4336,
+  -3801,  -2985,  -2431,  -1953,   -581,  -2130,  -3305,  -6917, -10448,  -2476,  -3226, -10686, -12210,  -6560,  -5026,  -6051,
+  -3212,  -1919,  -4208,  -2383,    -79,   1365,   2999,   2460,  -4566,  -3000,   2972,    587,  -6299,  -7666,  -7115,  -6071,
+  -3405,  -1229,  -1388,  -7957,  -9907,  -3537,   -486,   -298,  -1273,  -5504,  -5651,  -4165,    241,   4641,   1480,  -7632,
+  -6473,   4162,   4622,   1963,  -5125,  -6074,  -1085,   3789,   3135,  -7236,  -9705,  -6314,   1233,   2293,    775,   -456,
+    185,   1660,  -1521,  -3405,  -4522,  -3268,  -3043,  -4202,  -3532,  -1662,   -187,   -277,   7622,   7805,   -478,  -1341,
+    861,   -883,  -2762,  -6458,  -3667,   -572,    155,   6457,   6043,   4891,   2195,  -3011,  -6955,  -5806,   4963,  10382,
+   1505,  -5317,    431,   7429,  -1314,  -6950,  -2742,   6020,   -964,  -8981,  -3985,  -1876,  -4091,  -7529,   -663,   7176,
+   7878,   1207,  -2018,   -308,   1533,  10722,  10596,   7031,   1864,  -2314,    230,   2375,   -811,    450,   2676,   2744,
+   4262,   -182,  -6914,  -3916,    -52,  -4487,  -5436,     31,   6368,   3953,  -1087,  -4117,  -3698,  -2849,   2334,   7408,
+   1275,  -2682,   2873,   4462,  -1872,  -3424,  -1589,   1409,    550,   4170,   6923,   4484,   3451,   -319,  -4258,   1298,
+   7454,   2270,  -8616,  -8236,    840,   2642,   1356,   4389,   7276,   3144,  -1651,  -5109,  -2735,   4053,   7440,   7091,
+   5485,   4453,    495,   2556,   6001,   6150,   3356,  -3968,   1007,  10542,   5924,  -4827,  -4827,   -878,  -2267,  -2262,
+  -2301,  -1874,   3399,   5973,   1473,   -631,   1859,  -1827,  -7673,  -3292,   1855,   3066,  -1243,   3437,   7800,    525,
+  -2786,  -2345,   1305,   3046,   4734,   6219,   9087,   7611,   1405,   1331,  10787,   7664,    -55,  -1195,   7535,  13566,
+  10608,   -901,  -6839,  -3090,    992,  -1617,  -5131,  -1884,   -663,  -2173,  -4022,  -3840,    -81,   1642,   4196,   4553,
+   5953,   1100,  -1148,   1712,   7068,   5450,  -3580,  -3891,   3694,   8282,   3501,  -3708,  -6929,   -469,   6210,   4744,
+  -5660,  -6090,    733,    866,  -2495,  -1521,   3722,   3120,  -4149,  -6783,  -1360,   7863,  11013,   4186,   1011,  -1075,
+    127,    715,   6691,   5454,  -1815,  -5704,  -9503,  -8354,    348,  -1583, -12393,  -9017,   3927,  11062,   6772,   1455,
+   2450,    169,  -3681,  -3643,  -2788,  -1953,  -5972,  -7821,   3937,  10257,   3297,  -4561, -13726,  -7859,   -412,   -861,
+  -5341,  -3743,   2236,   3489,  -5953, -12453,  -1702,   8568,   5431,  -5065,  -7727,    294,   3538,    -62,   -721,   3303,
+   1769,  -3640,  -3661,    -38,  -2944,  -7973, -11777,  -7832,   2704,    435,  -8164,  -1219,   3315,  -4754,  -2629,   6820,
+     75, -10151, -11412,  -2143,   2633,  -4318, -13414,  -9669,   -985,   1898,  -2970,  -6285,  -3677,    809,  -4872, -11462,
+  -4863,   6250,   9274,   4049,  -1853,    586,   2071,  -1255,   -619,   3891,   2446,   5214,   7054,   2748,   1708,  -1596,
+  -9606,  -9485,  -7569,  -7970,  -7013,  -5525,  -5971,  -5449,  -8028,  -3557,   -490,  -5350,  -4288,    757,   6273,   3457,
+  -2260,    208,   3519,   2586,   1704,   2830,   6602,  10620,   5066,  -3725,  -5102,  -3221,  -4024,  -5527,  -5967,  -1538,
+   2286,   2771,   3417,    -23,  -2522,    234,   6058,   8435,   7186,   4579,   2145,   3770,   5991,   5070,   2467,   3141,
+   1536,  -3661,   1022,   6522,   2815,   1167,   1541,  -5140,  -8718,  -4662,    -29,   2899,    606,  -2766,  -1551,   1077,
+  -2602,  -7537,  -4412,   2570,   6317,   5084,  -2530,  -1218,   5222,   6064,   6079,   8432,  11119,  14191,   8889,   1960,
+   3887,   6570,   8692,   7223,   3034,   2476,    837,  -4752,  -1750,   5700,   5647,    143,     97,   2770,  -3292,  -5949,
+   -781,   2811,    586,  -5077,  -2685,  -2454,  -1578,   1374,    791,   1904,   3265,   5618,   5534,   2116,   1518,   6533,
+  12180,   7726,   3937,   4517,   2173,  -2289,  -2295,   3317,   -406,  -3418,    944,   3476,   2916,  -4142,  -6303,   -587,
+   2262,   3130,   1505,    716,   2338,  -2701,  -5369,   -471,   5916,   6942,   5656,   2211,  -4370,  -4271,     87,   1554,
+  -1189,   -798,  -1686,  -1143,   2717,   1133,   -223,   1666,  -3120,  -4882,  -3314,  -4299,  -2493,   3666,   1190,  -3226,
+  -6442,  -4071,  -2877,  -5366,  -3502,   -718,   2623,   3535,   -556,  -1820,  -3168,  -5583,  -5433,   -198,   5417,   -500,
+  -8126,  -9044,  -3318,   5798,   4208,   1740,   2122,     88,  -4984,  -8003,  -9309,  -4002,   2195,   2326,   -199,  -2568,
+  -1388,   1135,   3302,   1574,  -5011,  -4872,    775,    876,  -1998,  -6024,  -7001,  -1819,  -1289,  -3597,  -3765,  -3543,
+  -3185,  -5659,  -2381,    680,  -1965,  -4783,  -6360,  -2673,   5659,   5225,    444,  -1760,    788,  -1334,  -1681,   4449,
+   5173,  -2953,  -7757,  -1054,   2189,  -1081,  -3125,  -2146,  -2230,   1559,   2625,  -1579,  -2079,   -104,   2145,   3597,
+  -1584,  -2969,   2678,   2879,   3767,   1719,   1737,    577,   4410,   5554,     -1,  -4435,  -4558,  -3998,   -872,   -726,
+    -36,  -2101,  -1208,  -1182,  -1823,   2000,   2773,    618,    715,  -1617,  -3281,  -3597,    709,   2029,   -715,  -2681,
+   1692,   7443,   4379,   2017,   2302,   2656,   1419,   5314,   5948,   1214,   4161,   8871,   7348,   4020,    257,  -2343,
+  -1217,  -2011,  -1326,    775,  -1653,  -5500,  -1082,   1499,  -4104,    740,   5760,  -4004, -11805,  -4166,   2883,   6413,
+   8233,   2048,   -329,  -3062,  -4433,  -1697,    -92,   4940,   7865,   6293,   4458,   4235,   8593,   6480,  -4578,  -9301,
+  -3282,   7169,   7962,   -544,  -7953,  -4721,    792,   -828,  -3248,   2489,   8327,   5468,    905,  -1432,    952,    725,
+   1519,   5850,   4135,  -2577,  -8613,  -3479,   4666,   3767,  -1467,  -2155,    417,   2455,   1863,  -2153,  -4597,  -4913,
+  -6244,  -1226,   2320,   1395,   1086,  -1678,   -468,   3922,   6041,    495,   -939,  -1149,  -1772,  -3559,   1891,   7455,
+   4082,  -2028,  -3004,   2719,   5762,   2979,   1131,   -505,   -424,  -3183,   -458,   3602,   1062,   3191,   4968,  -2831,
+  -7338,  -2291,     63,  -2101,  -4179,  -1771,   2469,   1616,  -3345,  -5132,  -2216,  -1469,   1831,   3363,  -1677,  -2436,
+   1157,   4497,   1261,  -3806,  -1882,   2594,  -2188,  -5720,  -5265,  -4145,  -4801,  -2993,   2069,   3642,   2798,  -1723,
+  -4204,   -534,   6963,   7155,   2577,  -4797,  -5548,  -1691,    514,  -1300,  -3860,  -1716,   3179,   4047,   3927,   2353,
+   2149,  -2759,  -7582,  -3097,   4557,   2236,  -4125,  -7848,  -4625,   3289,    769,  -4223,    480,   -830,  -4677,  -3456,
+   -693,    313,  -2501,  -5119,  -3848,  -1813,  -5578,  -9661,  -4593,   2624,   2470,   1812,   4753,   6397,  -1877,  -2622,
+   6278,   5743,   1397,  -4168,  -7138,  -5377,    119,  -5097,  -9649,  -6455,  -1949,  -2167,   3137,   3195,   2748,   2079,
+    926,    783,     97,  -1065,   1932,   3953,   4476,    324,   -736,   1754,   -986,  -5848,  -7009,  -5412,  -3104,  -2970,
+  -1616,  -2152,  -5505,  -6545,  -6765,  -6333,      4,   7453,   4746,   -131,   -129,     86,   2170,   7099,   4336,   -833,
+     88,  -1945,    978,   8022,   8952,  -1094,  -5279,    167,   4874,   7843,   1472,  -6695,  -2831,   2571,   2302,   -742,
+  -3097,  -2020,    539,   1501,   -200,    199,   4313,     55,  -5799,  -2569,   5143,   4234,   1136,   2073,   3184,   2723,
+   6172,   3770,  -1489,    -73,  -1121,    322,   2111,   1803,   3422,   1089,  -4241,  -7020,  -4173,   2301,   8495,   5340,
+    847,   5747,   3549,  -3327,   1707,   7682,   4267,   1903,    813,   2443,    730,  -1376,   1316,    -20,   -658,    821,
+    171,   2907,   3358,    201,  -2346,  -1722,   2664,   8186,   7487,   2580,   2247,   1989,    159,    972,   4013,   7081,
+   6043,    358,    278,   2087,    -58,  -7057,  -5876,   -192,   1800,  -1932,  -3762,  -2240,   -388,   2112,   2477,    579,
+   -384,   6877,  10886,   1897,  -3300,    721,   4808,   3523,   -707,  -1741,  -1200,   4395,   9108,   1539,  -6324,  -4351,
+  -3315,  -3827,  -1840,   -593,  -2164,  -1301,  -1829,  -1633,  -2479,  -1308,   -996,    902,    518,   -899,   2682,   5226,
+   6202,   5627,   4922,   2843,  -1399,   -372,   2318,   1444,    745,     37,  -1395,  -3044,  -4591,  -4955,  -6669,  -7435,
+  -3638,  -1374,  -2250,  -4245,  -7269,  -5604,   1652,   8639,   5086,   3055,  -1884,  -7596,   -937,   5029,   1654,  -1997,
+  -5662,   -512,   4993,   1674,  -2983,  -3074,  -4004,  -3225,   1884,   1893,  -2561,  -5438,  -1041,   1832,  -2126,  -5882,
+  -6322,  -1365,   2515,   1376,  -1478,   -142,   -470,  -4146,  -2369,  -2017,  -4425,  -4386,    190,    364,   3284,   5856,
+   -339,  -4078,  -1720,    696,   2213,   2686,   2898,   1116,  -2885,  -2016,   5764,   3750,  -3306,  -7033,  -7066,  -5178,
+  -4095,  -6470,  -4702,     43,   1658,  -1402,  -3383,  -4077,  -2255,   -543,   1692,   3415,   3394,  -1039,  -2059,  -1456,
+   4322,   8662,   5655,   -296,  -4165,     24,   6562,   5163,    640,  -2529,  -2580,   1390,   3041,    446,  -2567,  -5342,
+  -5177,   1644,   4344,  -1422,   -157,  -2775,  -5461,  -3996,    -94,   3094,    934,  -1427,  -1593,   1055,   5353,   3507,
+   2662,   4484,   2487,  -1485,   -992,   -714,   1151,   3427,   1337,  -8124,  -8514,     18,   3371,   3531,    -88,    458,
+   2512,   3219,   2224,    175,  -2468,   2301,   3831,  -1724,  -4208,   2125,   8310,   3324,   -511,  -3887,  -4512,    764,
+   4613,  -1503,  -8635,  -3814,   4974,   3211,   -374,  -2863,    636,   3568,   2282,   1023,  -2620,  -6298,  -3861,  -1776,
+  -1505,    423,   -540,   -860,    621,   -193,  -1423,   3065,   5075,    198,   2153,   5756,   5197,    767,  -1538,  -3628,
+  -4097,   3780,   5968,   1060,  -3515,   -770,   2847,   1742,   -336,     90,    -35,  -3523,  -2504,  -1284,   1705,   5216,
+   -114,  -4894,   -750,   3555,   1371,    130,  -3652,  -2722,   2253,   2746,  -2783,  -4102,  -4606,  -5570,   -273,   5131,
+   4252,  -1494,  -4742,  -4964,  -1939,   1700,   4531,   2420,    430,   2119,    455,  -2710,    228,   6223,   5253,  -1297,
+   2749,   7113,    701,  -1374,   -779,  -1392,   2381,   5271,    -93,  -5902,  -7223,  -4357,  -2657,  -3506,  -1166,   -890,
+  -2330,   1195,    314,  -3391,  -1527,   2650,   7247,   6429,   2100,    397,   -926,   -487,   2613,   1586,  -2486,  -4771,
+   -258,   6035,   2287,  -2902,    191,   1063,  -4007,  -2691,   4927,   3477,  -4573,  -2457,   3531,   4288,   3650,    674,
+   -434,   -344,  -1681,   1540,   1747,  -3547,  -4527,  -2531,    686,    407,   1031,    838,  -1328,   -568,    383,   1057,
+   5882,   5099,   -788,  -5271,  -1087,   4441,   1023,  -1351,    308,   2160,    360,    912,   2567,   1291,   1515,   1495,
+   1320,  -1014,    535,    760,  -1983,  -1111,   2705,   -802,  -1420,   1242,  -1165,  -3240,  -2766,  -6052,  -4794,   1304,
+   2210,   1304,   -627,  -2979,  -1598,   2948,   7703,   4323,    623,  -2077,   -633,   4251,   1980,   -666,  -1194,   1439,
+   5232,   2974,  -1103,    622,   4933,   4887,   1566,   3308,  -1029,  -4678,  -1639,   1277,  -2226,  -8646,  -7637,   1177,
+   2116,  -3362,  -7979,  -3030,   2172,    427,   1154,   3601,   4252,   1694,  -4223,   -602,   3050,    985,   -144,   1713,
+   4396,   3144,    956,   -734,  -3315,  -1593,  -1621,  -2393,   3787,   5920,  -2085,  -7272, -10565,  -5534,    168,   2430,
+   3787,   5154,    518,  -1826,   -659,    304,   2363,   5468,   1792,  -1749,  -6254,  -8712,  -4758,   1415,   4616,  -3015,
+  -8268,  -5376,  -1143,   3230,   -743,  -2543,    492,   2182,  -1727,  -4682,  -4030,   -642,   2317,   2967,    623,  -4273,
+  -5215,  -3432,  -2251,  -1650,  -1638,   3866,   2806,   -957,   -158,  -1148,    -44,    909,  -2466,  -3007,   -260,   1060,
+  -2483,  -2314,   1665,  -1040,  -3282,  -2725,   -882,  -1588,  -3079,  -2653,  -1827,  -2007,  -2748,  -5566,  -3343,   -789,
+  -2073,   3436,   5383,    324,  -2441,  -2393,    -73,    790,   2394,   1049,  -2681,    680,  -2138,  -1825,    318,  -2772,
+  -1612,   3250,   4492,   1742,   2387,   2534,   -522,  -3537,  -2844,   -532,   -292,   -913,    444,   1504,   1320,  -1251,
+  -3180,  -1869,   1910,   1055,   4766,   8085,   -268,  -2313,   4871,   5143,   2227,   1614,     87,   1465,   2410,   -929,
+    360,   4778,   2117,   -592,  -2071,    333,   3207,   2054,     21,   -382,   3391,   3913,    899,    519,   1213,   3674,
+   3830,    487,  -1863,   4673,   5559,  -1386,  -2726,   -395,  -1273,  -2533,    -48,   4299,   7478,   7048,   2912,   -576,
+    279,    923,   1113,   3806,   5865,   3641,   -974,   -837,   5106,   3564,  -1125,   -390,   1453,  -1037,  -5029,    771,
+   8926,   5469,  -1116,  -1235,   3407,   3264,   5998,   7233,   4069,   3493,   3784,   4843,    770,    827,   1869,   -747,
+  -1650,  -2645,  -1990,  -2703,  -1580,    -14,   -587,  -3452,  -4246,   -498,   -145,  -2598,  -1336,   3779,   5511,   1979,
+    545,   2641,   1746,   1881,    632,    134,    543,   1346,   -801,   -539,    623,  -1206,    479,   2515,  -1429,  -6028,
+  -3783,    100,  -1343,  -3820,  -2425,   -291,   -169,  -1669,  -2968,  -1814,   -569,   1361,   1784,   1517,   -333,   -830,
+   2786,   -498,  -6368,  -3930,   2275,    938,  -1219,  -3224,  -4626,   -983,   3360,   1352,  -4107,  -2829,   2026,   -708,
+  -5687,  -5797,  -1062,   -870,  -3887,  -1584,   -406,   -309,  -1341,  -1943,  -2524,  -3064,   -597,   -665,  -2268,  -1225,
+  -2039,  -2966,  -2899,  -4375,  -3682,    288,   5651,   3639,  -6322,  -7224,  -2673,  -2309,  -3875,  -2637,   -547,   -736,
+    593,  -2147,  -6343,  -3424,   -242,   -339,   -899,     71,     34,   -916,  -2693,  -2595,  -1227,  -3576,  -2837,    818,
+    720,   1322,    120,  -1943,    770,   4393,   3908,    832,  -3926,  -4811,  -2068,   1628,   2087,  -1889,  -3038,  -2128,
+  -2213,   -710,   3323,   3741,   -440,  -2212,   -665,  -2746,  -3262,   -184,   -391,  -2231,  -2961,  -2363,   -975,   -605,
+  -1369,  -1073,   1156,   2799,   3844,   1365,  -3691,  -5673,  -2194,   2986,   4826,   3822,    728,   -590,  -1295,     64,
+   2031,   2747,   3193,   1607,     71,   1151,   2156,   3937,   4646,   4663,   2838,  -1798,  -2589,   -240,   1255,    -83,
+    474,   1374,   3992,   3362,   -950,  -3018,  -1311,    999,   2807,   2042,   -786,  -1400,     80,   1480,    -24,   -453,
+   2220,   3756,   3610,   2674,   -176,    261,    949,  -1489,  -1232,   2514,   2754,   3599,   5058,   4750,   2674,   1444,
+   1270,   -672,  -1547,   1557,   4341,   3386,    552,   -417,   -206,   1027,   2635,   5381,   3825,  -1062,  -2948,    655,
+   2961,    509,  -2710,     -2,   1341,  -1588,  -2475,    889,    493,  -2926,   -256,   3305,   4095,   3734,   1165,    968,
+   3032,   2245,  -1101,    617,   4458,   4205,   2954,   3242,   1652,   -423,   -236,   2504,   3541,    569,   -728,   1875,
+   3161,   -861,  -2128,   1030,   1906,  -1164,  -3718,  -3151,  -3323,  -4021,  -3691,  -2058,    886,   2202,  -2607,  -5039,
+  -1061,   2462,   2250,    523,  -1464,   1452,   4235,   2609,   3338,   4533,   4151,   2350,    515,   1561,   2507,    118,
+  -3562,  -3432,  -1687,  -3302,  -5394,  -5788,  -4426,  -3277,    504,   2265,   -767,  -4006,  -5095,  -4455,  -1254,   2117,
+    430,  -1613,  -1176,  -1304,    467,    128,  -2391,  -1710,  -1554,    100,   3362,   5461,    611,  -3132,  -4099,  -2398,
+   1071,   1800,   -625,  -1934,   -693,   -762,  -3699,  -4996,  -5034,  -5253,  -5639,  -2099,   1846,    176,  -3707,  -4023,
+   -118,   1643,   -381,   -829,   -425,   1649,    150,  -2535,  -1595,  -1368,  -1783,   -189,    232,  -1256,    -32,   -133,
+   -837,    820,    -13,  -3632,  -3910,   -640,    459,    159,    471,  -2623,  -4039,    -66,     82,  -1103,  -2200,  -4208,
+  -3104,  -1385,    183,   2670,   3790,   -811,  -4014,  -1472,   -507,   -224,   -354,  -1226,  -2924,  -3725,  -2157,     68,
+   -415,  -2466,  -2456,   1305,   3863,   2471,   -917,    -59,    564,    536,   1712,    555,   -833,   -517,    -74,    776,
+   1908,   2909,   2702,   1567,    100,  -2020,   -286,   1290,   -184,   -175,   -805,   -170,     32,    -44,   -479,    380,
+   1169,   2595,    916,  -1859,   -803,   2880,   6654,   3580,  -3829,  -3671,   -376,    179,   2155,   2034,    641,    199,
+     59,   2832,   2783,   1155,   1082,    467,   -912,   -152,   -330,   -311,   -491,   -412,   2291,   3478,   1801,   -345,
+   -117,   3484,   6062,   4575,   3172,   3884,   5061,   3764,    852,    471,    313,   1900,   2736,    539,     27,   1343,
+   1028,    108,   -837,  -2564,  -1149,  -1151,   -682,   -727,   -966,  -1436,  -2763,  -1797,    854,   -308,   1306,   4627,
+   3203,   2455,    866,    927,   2612,   3505,   5741,   5423,   3234,   3044,   2846,   1590,    499,   1555,   2728,   3793,
+   1623,  -2981,  -2515,   -156,   -964,  -2489,  -1593,   1346,    586,  -2277,  -1284,   1368,   1584,    877,   -860,   -528,
+    720,    157,   1001,   2264,  -1118,  -2626,   -493,   2273,   1386,  -2394,  -2639,   1837,   4595,   2253,  -1820,  -2986,
+    598,   2552,   1837,   1046,    684,    -48,   -710,   -366,    282,   1209,    462,    -95,   -745,   -829,    309,     42,
+  -1043,  -2321,  -2133,    957,   -219,  -4848,  -4362,  -1170,  -1498,  -2796,  -2152,  -2375,   -596,    251,    500,   -197,
+   -972,    890,   1778,   2103,   1347,   -367,  -1733,  -2744,   -385,   2986,    -34,  -3801,  -4716,  -3655,  -1229,    133,
+   -303,  -1300,  -2661,  -2735,  -2054,  -2283,  -1585,   1651,   2413,  -1029,  -3185,  -1918,   -346,   -176,    267,     29,
+  -1330,  -2781,  -3260,  -2783,  -1778,    -56,    859,   1268,   -961,  -2760,   -564,     64,   -623,  -1201,   -692,   -346,
+   -980,  -2758,  -3559,  -2610,  -2723,  -2065,  -1027,  -1165,   -815,    969,   2525,   1568,   -224,   -744,   2060,   2421,
+  -1739,  -2389,   -614,  -1274,  -2568,  -1440,  -1805,  -1970,   -156,     65,  -2426,  -2582,   -769,    338,   -720,   -573,
+     88,  -1246,  -2308,  -1270,   -607,   1824,   3049,   1626,   -356,   -850,    168,   1892,   1542,   -296,    969,    411,
+  -1369,    387,     90,   -474,   1679,   2494,   -867,  -3073,     -3,   2271,    449,  -1996,  -1889,   -194,    580,   1794,
+   1843,    393,   -636,    638,   1808,   1960,    939,    597,   2231,   3174,   2531,   -834,  -2427,   -419,    966,    527,
+    241,   2213,   2404,   -523,   -997,   1160,    848,    225,   1044,    441,   -479,   -243,   1749,   1807,    553,    257,
+  -1566,  -2303,   1087,   5066,   3874,   1362,    414,   -478,   -296,    507,   1057,   1870,   1546,    -10,   -930,   1179,
+   2875,   2656,   1540,    174,    -39,    578,   1336,   1818,    968,    -92,   -531,    806,    864,    875,   1519,   1584,
+    930,   -781,    411,   3569,   3188,   1073,  -1172,  -1778,  -1271,  -1038,     21,    685,   1396,   1648,    486,    195,
+    747,    957,    610,   -127,   -270,    911,   1733,   1338,    382,    451,    -56,     17,   1195,   2059,    674,   -133,
+   1450,   2825,   1979,  -1294,  -2496,  -1264,  -1384,   -490,   1042,    359,  -1325,   -879,    220,  -1343,  -2080,   -399,
+   1045,   1994,   1390,    433,    855,   1892,    685,  -1927,  -1682,  -2085,  -1894,    761,   1003,  -1289,  -1865,  -1700,
+   -434,   1523,   1213,    266,   -377,    127,   1806,   3143,   1748,   -187,   -426,    401,     12,    722,   -224,  -1477,
+   1084,   1787,  -1375,  -3628,  -3544,  -1305,    474,   -148,  -2434,  -2144,  -1104,  -1273,  -1360,  -2788,  -3355,  -2531,
+  -2752,  -1994,  -1364,   -820,   -294,   -357,   -747,   -228,   1960,   2728,   1992,   1691,   1214,     83,    -83,   -690,
+   -666,   -592,  -2002,  -2380,  -1371,    631,   1583,    -41,  -2438,  -2101,   -512,    660,    161,      5,    517,  -1358,
+  -2545,  -1434,   -657,   -828,  -1827,  -1061,    -89,   -152,  -2195,  -2819,  -1017,   -181,    345,    211,   -181,  -1274,
+  -2400,  -1454,   -450,   -963,  -1587,  -1612,   -782,   -155,   -295,    -71,    289,    779,    510,   1013,   2223,   2240,
+    295,   1058,    784,   -254,    437,    908,    943,   1231,    470,  -2218,  -3311,     -6,   -550,  -2872,  -2500,   -229,
+   1250,    223,  -2628,  -2702,    365,   2203,    -91,  -1624,  -1065,     55,    357,    385,    621,   1674,    595,   -293,
+    383,    281,    930,   1529,    890,  -1329,  -1811,   -868,   -129,    -77,   1065,    316,   -433,    258,    735,   3265,
+   3623,     13,  -1972,  -1149,    430,    916,    772,    118,   -423,    440,   2337,   2681,    473,   -797,   1215,   1207,
+   -762,   -596,   1617,   2594,   1524,   1195,     46,   -999,   -513,   -327,   -778,  -1205,   -438,   1157,   1012,   -402,
+  -1095,  -1102,   -861,    433,    427,    109,    392,    315,   -262,   1002,   1750,    326,   -271,    -92,    380,    996,
+   1353,   1270,   1990,   2046,   1783,    973,   -550,   -100,    924,   1367,    380,     63,   1553,   1425,   -169,  -1417,
+   -979,    658,   2125,   1116,   -790,  -1890,  -1579,    183,   1396,   -354,  -1641,  -1329,   -519,   1324,   1783,    193,
+   -333,   -711,    404,   1338,   1378,    621,   -211,   -561,   -481,    591,   2024,   1742,      2,    -26,    220,    -68,
+   -202,    594,   1216,   1102,   -438,  -1084,    817,   1084,   -947,  -2783,  -2565,   -557,   1344,    386,   -399,    847,
+   2197,   1014,  -1175,  -1712,   -218,   1077,   1770,   1012,     40,   -432,  -1462,  -1063,    229,   -199,     47,    844,
+    672,  -1002,  -2116,  -1818,     81,    349,    323,    765,   -277,  -1228,  -1286,  -1217,   -260,   -306,  -1103,  -1018,
+   1230,   1907,     33,   -181,    676,   1441,    839,    565,   1093,   1663,    952,   -206,    428,    691,   -292,   -685,
+    236,    589,   -584,  -1597,  -1777,  -1799,  -1247,   -572,   -457,   -866,  -1133,   -991,   -605,   -517,    538,    132,
+  -1229,  -1755,  -1102,   -192,    -93,   -289,   -315,     -7,    616,    171,  -1545,   -411,   1118,    471,   -130,   -830,
+    286,    859,   -697,  -1257,   -306,    509,   2394,   2703,    238,   -485,   1380,   1460,    166,   -566,  -1397,  -1111,
+   -942,  -1582,  -3085,  -3660,  -2777,  -1607,  -1090,  -1553,  -1636,   -340,   1240,   1610,    810,   -630,   -647,   1286,
+   1818,   1551,   2037,   1230,   -200,   -240,    380,   1042,    514,   -893,   -912,   -482,  -1698,  -2211,   -394,    788,
+    -48,   -757,   -433,    118,    828,   1763,   2257,    861,  -1215,  -1755,  -1093,   -589,   -575,   -863,   -580,   -643,
+    212,    336,  -1056,  -1435,   -233,   1061,   1455,    518,   -822,   -883,     82,    377,    549,    580,    462,     34,
+   -376,   -487,    275,   1561,   1477,    724,    -59,    388,   1504,   1331,    710,    141,    243,   -208,     26,    546,
+    116,   -473,   -611,   -362,   -170,   -294,   -276,    -79,     79,   -357,    425,   1134,    441,    166,    452,    684,
+    317,     66,    750,    810,   1149,    601,   -688,  -1003,   -194,    -30,   -640,     55,    617,   -315,    202,   1648,
+   1358,   -382,   -493,    -85,   -881,     89,    953,   -318,   -354,    369,    629,    245,   -223,    618,   1234,     30,
+   -279,    597,   2236,   1976,    435,     77,   1160,   2117,   1149,    137,   -189,   -773,   -983,    -71,    509,    -92,
+  -1218,  -1204,    354,      1,  -1408,  -1634,   -464,    -66,    -45,    785,    136,   -858,   -338,   -618,  -1239,   -645,
+     -4,    462,    681,    846,    197,   -135,    750,   1672,   1613,    716,    889,    447,    104,    515,    913,    969,
+    283,   -446,   -227,   -153,   -181,    -45,   -595,  -1802,  -1185,    -32,   -234,   -807,   -682,   -749,   -301,   -240,
+   -442,   -593,    318,    271,    149,     78,   -228,    448,     21,   -886,   -838,  -1111,   -964,   -706,   -625,   -458,
+    420,    572,   -527,  -1232,   -802,   -191,    285,   1060,   1140,    425,   -167,   -410,     17,   -496,   -124,    730,
+    294,   -269,   -723,   -348,    214,   -226,   -824,   -324,    395,     28,   -877,   -881,   -772,     11,   1206,    211,
+  -1406,   -966,    -41,     69,     35,   -727,  -1545,   -828,    160,    396,    650,    277,   -380,  -1294,  -1336,   -256,
+    770,    115,  -1287,   -163,    603,   -180,   -744,    210,    599,    626,    709,    352,     61,   -208,    181,    -84,
+   -518,   -295,    -41,   -185,   -120,    338,    659,     21,   -778,  -1137,    700,   2090,   1035,   -814,  -1130,    145,
+    574,   -230,   -978,   -651,    308,    382,   -641,   -415,     13,   -440,    155,    652,    388,     41,   -407,    142,
+    833,   -150,   -809,   -642,   -132,   -123,   -218,    365,   1123,    437,   -204,     29,    215,    458,    397,    482,
+   1287,   1277,    249,    243,    678,    258,    272,    950,    670,    356,    -59,     39,   -332,  -1274,   -482,   -572,
+   -887,   -307,   -533,   -610,   -148,     79,    165,    268,    487,    298,    187,   1073,    856,     31,   -313,    346,
+    786,   1013,    122,   -602,   -319,    261,    770,    322,   -294,    220,   1106,   1312,    709,     44,    377,    494,
+    315,    281,    138,    381,    343,     22,   -149,   -532,   -918,   -680,   -226,   -103,   -225,   -603,   -499,   -249,
+    743,   1007,   -286,   -988,   -393,    414,   1266,   1093,    519,    453,    793,    703,   -117,   -213,     86,    242,
+    307,    349,    -93,   -626,    437,    836,    -35,   -575,     85,    297,    155,   -262,   -518,   -106,    510,    289,
+    -29,   -588,   -269,    274,    308,   -231,  -1054,    -57,    962,    178,   -528,   -569,    -32,    -47,   -659,   -480,
+    527,    470,    247,    848,    971,    272,    220,    473,    299,    193,    312,   -116,   -317,   -290,   -696,   -261,
+   -392,   -696,   -495,   -864,  -1215,   -768,     51,     85,   -333,   -305,   -452,   -334,    338,    210,   -141,    -62,
+    155,    147,    329,    196,    -80,    199,     99,     20,   -495,   -545,    487,    881,    571,   -529,   -954,   -433,
+   -176,    179,     30,   -426,  -1022,  -1237,   -486,   -181,   -977,  -1360,   -370,    293,    245,    -28,   -760,   -553,
+   -414,   -274,    359,    821,    579,    100,    233,    257,    127,     47,   -210,   -532,   -455,   -273,    -69,   -222,
+   -611,  -1024,  -1229,   -732,      0,   -111,   -214,   -115,    134,    469,    311,     52,    -21,    151,    424,    282,
+   -321,    -89,    141,   -920,  -1123,   -405,     82,     28,   -372,   -463,    132,    349,   -369,   -933,   -403,    330,
+    401,   -194,   -411,      7,    300,     61,   -174,     46,    372,    108,    161,    332,    177,   -105,    -92,    276,
+    342,     31,    -71,    153,    -57,   -581,   -352,    233,    153,    -15,    194,    480,    911,    703,   -327,    105,
+   1197,    816,    -90,   -295,    303,     20,   -397,    255,    487,   -546,   -672,    168,    636,    388,   -315,   -602,
+   -317,   -205,    198,    208,   -208,   -114,    385,    560,    244,    114,    479,    680,    774,    664,    642,    245,
+   -315,    181,    527,    346,    439,    140,    -94,    220,    500,    213,     -6,    -41,   -100,     -3,     43,    198,
+     48,   -271,     31,    366,    770,   1053,     64,   -775,   -314,   -133,     30,    174,    166,    588,    821,    364,
+      0,    -79,     77,    129,    311,    964,    939,    127,   -318,   -253,    142,    273,      0,      0,    261,    277,
+   -163,   -243,    456,    521,   -157,   -733,   -738,   -317,    330,    364,     85,     -1,     44,     94,     43,    -84,
+    -29,     52,    -70,   -295,     99,    202,   -263,   -584,    -65,    208,   -143,     34,    259,    148,     81,     89,
+    117,    130,     43,   -314,   -596,   -339,   -224,   -339,     -6,    134,   -149,   -148,    -83,   -217,    185,    112,
+   -235,   -225,   -104,    173,     57,   -251,     -1,    272,   -190,   -518,   -186,   -210,    -70,   -223,   -513,   -519,
+     43,    533,     60,   -421,   -470,   -353,    -99,    -93,   -342,   -552,   -458,    138,    223,     24,   -225,   -365,
+   -101,    389,    239,    -73,   -391,   -443,   -662,   -580,    -55,    279,    -72,   -600,   -357,    246,    -73,   -463,
+   -288,    200,    536,    364,    -35,   -337,   -235,     62,    -99,   -579,   -410,    -78,    -81,   -173,   -229,   -366,
+   -369,     53,    194,     98,   -200,     77,    663,    539,      5,   -238,    337,    643,    367,    197,    547,    473,
+    200,     65,   -260,   -420,   -613,   -598,   -276,    -89,   -495,   -660,   -385,   -510,   -604,   -316,   -217,   -402,
+   -268,    126,    402,    393,    200,     80,    223,    129,     29,    194,    304,    576,    956,    993,    435,    272,
+    165,    109,   -169,   -409,   -262,    -85,    585,    815,    208,   -353,   -195,    188,    -22,   -361,    -67,    272,
+    -60,   -400,   -138,   -130,   -371,   -198,    159,    254,    -12,    -45,    275,    335,    108,    -20,   -119,    164,
+    345,    298,    356,    640,    514,    224,    185,    462,    271,   -348,   -482,     -5,    127,     22,    -45,   -184,
+   -294,   -306,   -372,   -329,    212,    374,    -39,     15,     84,    327,    394,     16,   -145,   -100,    -41,    409,
+    323,    304,    659,    424,   -118,   -328,   -221,     33,    322,    265,     30,   -219,   -463,   -388,    -32,    -23,
+   -277,   -197,    -29,    -62,    -17,    136,    287,    176,    -45,    297,    458,     76,     -3,    137,    -89,    198,
+    359,     -2,   -239,   -336,     74,    550,    464,   -261,   -303,    -20,     37,     65,    189,    215,     48,   -111,
+   -104,   -151,   -236,   -164,   -106,    -26,   -118,   -305,   -231,   -181,   -173,    268,    552,    349,     50,    -28,
+      7,    135,    121,    -27,   -118,    112,     91,   -159,   -134,     47,    216,     89,   -177,   -441,   -523,   -193,
+    139,     34,   -203,    -89,   -200,   -120,     79,    -60,   -219,    -84,     15,    -42,     59,     69,     79,    117,
+    225,    276,     25,     44,     92,   -255,   -250,    214,    258,   -127,   -258,   -227,   -256,   -247,    -85,    -23,
+   -241,   -465,   -255,   -189,     54,    221,     50,   -306,   -243,    -31,    209,     25,    -52,   -285,   -349,     -1,
+    -86,   -268,   -286,   -333,   -112,    -68,     83,    364,    425,    112,   -216,    -63,    331,    311,     13,   -291,
+   -269,    -10,     90,     52,   -104,   -331,   -102,    178,     38,   -162,    -58,     42,    101,    143,   -303,   -436,
+      4,    241,     10,   -403,   -408,   -139,      7,    -10,   -193,   -278,   -382,   -250,    -29,    217,    343,    292,
+    177,    206,    140,     22,     92,     86,     55,    172,    240,    248,    306,    179,      1,   -139,   -223,    -37,
+     11,    123,    234,     95,   -291,   -409,   -147,   -137,   -200,   -118,     81,     46,     75,     58,    -43,     67,
+    258,    119,    174,    357,    408,    239,    120,    258,    363,    298,    119,    100,     36,   -200,      6,    284,
+     39,   -203,   -118,     -9,    -42,    -74,    130,    161,   -118,   -181,     25,    164,    121,      3,    156,    236,
+    280,    318,    184,    151,    173,    113,     43,    -16,     56,    128,   -110,   -136,    -18,   -142,   -139,     45,
+    101,   -160,   -409,   -267,     23,    134,    254,    309,    142,    194,    437,    292,    145,    227,    217,    -49,
+   -125,     21,     48,    -93,   -116,   -138,   -164,    -95,     51,    125,    165,    216,    210,    163,    -32,   -188,
+   -122,     33,    141,    141,    -28,   -250,   -288,   -315,   -180,    -55,    -67,     45,    206,    206,    108,    -32,
+    -80,    -92,   -119,   -223,   -223,    -47,     -4,    -35,     -4,    115,    161,    106,    -66,    -78,     88,     75,
+     32,   -151,   -222,   -155,   -190,   -182,   -160,   -231,   -184,    164,    241,     48,   -124,   -158,   -164,   -107,
+   -163,   -217,   -129,     10,     39,   -122,    -96,    132,    119,    -53,   -150,    -66,    -79,    -81,    -86,   -169,
+   -122,    -19,    -23,    -30,   -108,      5,    132,    -13,   -246,   -190,   -126,   -135,   -131,   -109,    -51,    -40,
+      4,    -13,    -77,   -109,    -57,    -49,    -43,   -102,   -194,   -224,   -213,    -79,     87,      1,   -115,   -101,
+    -94,    -25,     62,     52,    -50,    -86,     -5,     -5,     -2,     94,    198,    317,    147,    -26,   -100,   -101,
+     11,    105,      3,   -185,   -139,     92,    164,      7,   -194,   -175,    -59,    -17,    -20,   -129,   -107,     36,
+    121,     94,    -14,   -132,   -128,    -23,    121,    252,    135,     -1,     -1,     39,    100,     83,    -32,      0,
+     43,     63,    157,     88,     -2,     52,    105,     87,     15,      4,     -1,    -92,   -134,    -11,     62,    102,
+     83,     83,    113,    136,    174,    182,    130,     79,     10,     85,    150,    129,     88,     20,     42,    150,
+    120,    -26,    -94,   -111,   -105,    -84,   -107,   -114,    -71,     59,    157,    126,    -33,    -64,    126,    188,
+    206,    265,     85,   -113,    -87,      8,     39,    -38,   -110,    -45,     54,     32,     -4,     57,    113,    110,
+     54,     53,    -19,   -109,   -102,    -97,   -119,     -3,    176,    154,    120,    195,    176,    163,    169,    118,
+     48,    -42,   -116,    -43,    -52,   -117,    -90,    -31,    -68,   -146,   -138,    -81,   -106,   -184,   -103,    -11,
+     21,     92,    134,    150,    155,    177,    126,     41,     61,     85,     93,    146,    137,    111,     14,   -119,
+   -174,   -214,   -210,   -140,    -48,     17,    -22,    -13,     99,    141,    175,    259,    224,    159,    155,     94,
+      6,    -15,     -7,     -4,    -10,    -45,    -90,   -100,   -123,   -116,   -110,    -99,    -61,    -29,    -20,    -78,
+   -161,    -78,     23,     27,     33,     30,     51,    127,    135,    166,    130,     38,    -44,   -102,    -93,    -46,
+     30,    105,    109,     48,    -61,    -55,    -24,     17,     17,     -5,     40,     40,     -8,    -33,    -25,     19,
+     65,     36,      3,    -50,   -107,   -116,   -153,   -185,   -121,   -132,   -189,   -117,    -37,    -60,   -115,   -106,
+    -44,     31,     54,     30,     95,    200,    165,     97,    115,    134,     55,    -40,    -97,    -79,    -47,    -51,
+    -88,   -106,    -69,    -13,    -59,   -185,   -242,   -165,   -127,   -164,   -165,   -122,    -72,    -69,    -90,    -34,
+     43,     38,      3,     59,    147,    227,    265,    217,    118,      7,    -48,    -52,    -56,    -48,    -37,    -56,
+   -142,   -239,   -272,   -196,    -84,    -55,    -33,      2,      3,      1,    -49,    -99,    -47,     18,      3,    -22,
+     37,    117,    126,     98,     22,    -47,    -67,    -55,    -86,   -160,   -142,    -54,     -5,     -7,     32,    124,
+    155,     87,     -6,    -84,   -110,    -53,    -16,      2,     48,     42,      6,     -6,     13,    -57,    -95,    -34,
+    -38,    -65,     -9,     24,     72,     78,     56,     57,     87,     74,    -21,    -93,    -64,    -10,     38,     59,
+     76,    114,    112,     50,    -33,    -63,    -10,      6,    -49,   -132,   -146,    -75,    -17,     -4,     -4,     18,
+     40,     55,     97,    131,    128,    115,    133,    144,    106,     20,     37,     88,     59,    -12,    -29,      0,
+     50,     70,     73,     93,    109,     98,    112,     76,      6,      7,     -8,    -69,    -34,     60,     99,     55,
+      3,    -81,   -108,     -6,     70,     79,     99,    108,     86,     71,     76,     19,    -16,     16,     37,     36,
+     37,     15,     27,     34,    -21,    -86,    -75,    -64,    -59,    -74,    -53,      0,     43,     66,     49,     42,
+    103,     97,     66,     83,     17,    -66,    -41,      2,     81,    125,     84,     51,     42,     42,     62,     48,
+      9,    -13,    -63,   -111,    -84,    -54,    -61,    -76,    -56,    -16,    -34,   -104,    -75,     24,     76,     73,
+     18,    -36,    -19,     36,     11,    -70,    -48,     14,    -19,    -76,    -48,    -24,    -46,    -62,    -73,   -101,
+   -114,    -89,    -20,     29,     45,     42,     51,     82,     79,     62,     79,     40,      2,     -9,    -23,    -15,
+    -35,   -106,   -147,   -159,   -152,   -106,    -88,    -61,    -19,     -7,    -11,    -18,    -10,      0,    -28,    -39,
+     -7,     10,    -17,    -51,    -65,    -31,     23,     38,     34,     20,     10,     47,    153,    184,     50,    -78,
+    -68,    -15,      4,    -31,    -83,    -91,    -53,    -46,    -58,    -36,      4,    -33,    -79,    -90,   -112,    -93,
+    -46,     -5,     24,      1,    -62,    -67,    -10,     58,     89,    109,    107,     89,     99,     54,    -33,    -22,
+     34,     35,     33,     37,    -30,    -75,    -42,    -35,    -53,    -47,    -35,    -16,     -5,     36,    106,     73,
+     -6,    -37,    -34,     -3,     19,     23,     -8,    -64,    -66,    -46,    -46,    -49,    -25,      8,    -14,    -61,
+    -36,    -42,    -52,     31,     92,     63,     24,     54,    101,    113,    109,    115,    117,     97,     48,     14,
+    -15,    -25,    -13,    -25,    -45,     -6,     27,     19,    -23,    -64,    -22,     44,     52,     13,    -15,    -30,
+    -45,    -57,    -64,    -40,    -27,    -45,    -50,    -18,      7,    -12,    -19,     21,     83,     96,     24,      2,
+     89,    126,     64,     16,     30,     58,     33,     -5,     -2,     14,      2,    -12,      0,     -5,    -20,     -6,
+    -13,    -37,    -33,     -7,      4,      4,     10,     14,     -3,    -16,      2,     43,     31,      0,     18,     26,
+     15,     28,     38,     18,      0,    -15,    -36,    -25,     -5,      4,     35,     69,     36,    -31,    -57,    -38,
+    -17,      0,     15,     43,     66,     37,      3,     17,     -4,    -17,    -23,    -25,    -20,    -10,     29,     73,
+     71,     18,    -16,     21,     51,     46,     17,    -24,    -50,    -42,    -45,    -86,    -76,    -19,    -13,    -25,
+    -25,     -6,     36,     50,     27,     12,     32,     90,    112,     63,     60,     64,      9,    -14,      4,      2,
+    -30,    -54,    -94,    -99,    -49,    -33,    -41,    -11,     12,     -7,    -33,    -44,    -45,    -18,     32,     73,
+     69,     52,      8,    -23,     -5,     29,     30,     -4,    -22,     -1,     -8,    -27,    -24,    -28,    -36,    -38,
+    -31,     15,     23,     -8,    -30,    -47,    -53,    -56,    -34,    -21,    -54,    -48,     13,     47,     12,    -51,
+    -56,    -17,     -4,    -26,    -36,    -14,     -5,      8,     12,      9,      4,      3,     -3,      0,      4,     -5,
+    -31,    -43,    -21,     23,     50,     35,      2,    -14,    -20,    -14,    -41,    -79,    -78,    -71,    -62,    -59,
+    -51,    -19,     11,     35,     30,     23,     32,      5,    -16,    -25,     -3,     38,     24,    -29,    -53,    -56,
+    -49,    -22,     21,     48,     21,     -6,     13,     34,     39,     31,     24,     12,     10,     41,     48,     17,
+     -2,    -12,    -23,    -27,    -38,    -26,     15,     69,     83,     63,     -3,    -47,    -27,    -24,    -25,     -8,
+      0,      0,      8,     24,     39,     22,      3,     15,     47,     34,     -3,     20,     81,    100,     86,     63,
+     48,     36,     10,    -13,    -51,    -71,    -52,    -22,      4,      5,     -3,      4,     -4,    -10,      3,     17,
+     -1,    -23,    -13,     11,     39,     60,     59,     40,     23,     34,     46,     12,    -22,    -10,      4,     10,
+     17,     41,     22,    -32,    -38,     -7,     36,     62,     38,      3,     20,     24,     -6,    -34,    -39,    -28,
+    -21,    -16,     -2,    -34,    -56,    -41,    -18,      4,      4,    -40,    -69,    -24,     24,     11,    -13,    -26,
+    -33,      0,     44,     41,     10,    -17,    -26,    -19,      0,     15,     -6,    -41,    -38,    -21,      0,     27,
+     47,     42,     25,     -4,    -13,      1,    -10,    -14,    -12,    -18,    -12,      0,      9,    -12,    -42,    -46,
+    -36,    -39,    -31,     -7,     -5,     -3,     20,      3,      0,      5,    -30,    -35,     11,     38,     25,     11,
+     20,      4,    -18,     -9,     -7,    -23,     -6,     12,     13,      2,    -26,    -36,      3,     36,     44,     39,
+     10,     -1,     24,     50,     33,    -20,    -35,    -12,     12,     -6,    -42,    -32,    -10,     -9,     13,     43,
+     25,     -9,    -20,    -13,     -9,    -14,     -7,      2,      8,     19,     17,    -10,      5,     70,     73,     30,
+     -1,    -20,    -15,     -2,     10,     19,     39,     38,     15,      2,     -5,    -16,    -22,    -14,     -5,     -4,
+    -18,    -47,    -56,    -47,    -38,    -32,    -26,    -20,      1,     28,     52,     50,     53,     52,     30,     17,
+     16,      1,    -21,    -36,    -24,     -7,      0,    -11,    -27,    -26,    -17,    -25,    -32,    -18,      1,      4,
+     -7,    -26,    -28,      3,     37,     56,     63,     30,      0,     -5,     -6,      0,     -6,    -34,    -50,    -45,
+    -21,    -12,    -16,    -13,     -7,      0,      8,     -2,    -16,    -13,     -9,    -19,    -25,    -33,    -27,     -1,
+     12,      2,     -6,      2,     22,     21,     -9,    -20,     -2,      2,     -6,     -2,     20,     32,     10,     -4,
+      5,     13,     15,      9,     13,     33,     30,     22,     13,      3,     -5,    -27,    -37,    -19,    -21,    -53,
+    -49,    -23,    -21,    -18,      4,     17,     17,     20,     34,     42,     57,     44,     29,     33,     36,     41,
+     38,      5,     -6,     16,     31,     32,     33,     19,     11,     19,     17,      0,    -17,    -35,    -46,    -38,
+    -17,    -11,    -22,    -21,     -8,     15,     33,     26,     13,      9,      4,      6,     11,     13,     11,     -2,
+    -12,     13,     33,     13,      7,     33,     31,      9,     14,     27,     17,      7,      6,     25,     36,      1,
+    -20,     -5,      3,     -4,     -8,     -8,    -17,    -21,    -19,    -25,    -21,     -2,     18,     22,     11,      0,
+     -7,     -3,      3,     -6,    -21,    -14,     -5,     -7,    -12,     -8,     -8,     -5,      0,      6,     13,     14,
+     11,     17,     21,     15,      4,      0,     -4,    -12,    -14,    -12,     -3,     10,     15,     20,     22,      9,
+    -13,    -25,    -19,     -4,     -7,    -11,    -16,    -26,    -28,    -27,    -35,    -38,    -29,    -28,    -40,    -32,
+    -14,    -11,    -25,    -22,    -10,      0,     10,     16,     21,     43,     61,     41,     15,     10,      4,     -5,
+    -18,    -14,      4,      1,    -21,    -28,    -19,    -25,    -33,    -19,    -10,    -13,    -11,    -10,    -20,    -18,
+     -4,      1,     15,     29,      4,    -26,    -29,    -27,    -33,    -26,    -18,    -16,     -7,      5,     21,     32,
+     30,     20,      9,      4,      2,      0,     -9,    -17,    -21,    -33,    -37,    -25,    -16,    -15,     -6,      6,
+      8,     12,     11,     10,     15,     14,      8,      0,     -7,    -10,    -10,    -11,     -6,      7,     11,      1,
+     -7,     -4,      6,     16,     11,      7,     10,     18,     11,    -11,    -25,    -14,     10,     19,      7,      5,
+      3,     -3,     10,     22,     22,     15,      2,      0,      4,      9,     17,      2,    -23,    -32,    -27,    -13,
+      9,     26,     27,     29,     33,     20,      8,      3,     -7,    -14,    -12,     -5,      1,     12,     18,     13,
+      6,      1,      2,     -4,    -17,    -24,    -25,    -26,    -12,      6,     20,     27,     16,      7,     14,     17,
+     14,     13,     11,      7,     -8,    -19,    -11,     -1,      6,     14,     16,      6,      5,     20,     28,     23,
+      9,     -8,    -17,     -5,     15,     14,     -5,    -18,    -21,    -20,    -10,     -3,      0,      5,      3,     -8,
+     -7,     -3,    -14,    -17,     -7,    -17,    -29,    -15,      0,     -2,     -4,      7,     23,     29,     33,     32,
+     20,     11,      3,     -5,     -2,      0,     -6,     -1,     13,     17,     21,     17,     11,     14,     15,      1,
+     -9,      2,     12,      0,    -21,    -27,    -17,    -17,    -23,    -24,    -25,    -16,     -3,      1,      0,     -9,
+      0,     15,     16,     10,      8,      6,      2,      4,     12,      5,     -6,     -2,      3,      4,      3,     -4,
+     -7,     -2,      3,      7,     21,     19,     -1,     -7,     -2,      1,      6,      2,     -7,     -7,     -2,     -7,
+    -14,    -18,    -10,     -1,      3,      3,     -3,    -11,    -15,    -11,    -10,    -18,    -22,    -15,     -6,    -10,
+    -14,     -1,     18,     21,      9,      1,      9,     10,      0,     -2,      2,      7,      7,     -1,     -3,      5,
+      0,    -16,    -10,      2,      4,      6,      1,     -2,     -2,      6,     10,     -4,    -16,    -16,     -9,     -4,
+    -15,    -27,    -23,    -27,    -32
+};
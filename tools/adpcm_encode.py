@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+#
+# adpcm_encode.py : convert one of the samples/*.h tables to IMA ADPCM
+#
+#    adpcm_encode.py samples/drum_kick.h out/drum_kick_adpcm.h
+#
+# The samples are coded in blocks of ADPCM_BLOCK_SAMPLES, each one a 4
+# byte header (the predictor as a little endian int16, then the step
+# index and a pad byte) followed by two samples per byte, low nibble
+# first. The header holds the decoder state from just before the first
+# sample in the block, so playback can start at any block. This must
+# match adpcm.c.
+#
+import re
+import sys
+import os
+
+ADPCM_BLOCK_SAMPLES = 256
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767]
+
+
+def decode_step(pred, index, nibble):
+    """One step of the decoder, exactly as adpcm.c does it"""
+    step = STEP_TABLE[index]
+    diff = step >> 3
+    if nibble & 1:
+        diff += step >> 2
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 4:
+        diff += step
+    if nibble & 8:
+        diff = -diff
+    pred = max(-32768, min(32767, pred + diff))
+    index = max(0, min(88, index + INDEX_TABLE[nibble & 7]))
+    return pred, index
+
+
+def encode(samples, pred, index):
+    """Code the samples from the given state, choosing whichever nibble
+    lands closest to each sample. Returns the nibbles, the final state and
+    the squared error."""
+    nibbles = []
+    error = 0
+    for s in samples:
+        best = None
+        for n in range(16):
+            p, i = decode_step(pred, index, n)
+            e = (p - s) * (p - s)
+            if best is None or e < best[0]:
+                best = (e, n, p, i)
+        error += best[0]
+        nibbles.append(best[1])
+        pred, index = best[2], best[3]
+    return nibbles, pred, index, error
+
+
+def read_samples(path):
+    text = open(path).read()
+    name = re.search(r'int16_t\s+(\w+)\s*\[\s*\]', text).group(1)
+    body = text[text.index('{') + 1:text.index('}')]
+    return name, [int(v) for v in re.findall(r'-?\d+', body)]
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: adpcm_encode.py <samples/name.h> <output.h>")
+    name, samples = read_samples(sys.argv[1])
+
+    # Pad out to a whole number of blocks with silence
+    n_blocks = (len(samples) + ADPCM_BLOCK_SAMPLES - 1) // ADPCM_BLOCK_SAMPLES
+    padded = samples + [0] * (n_blocks * ADPCM_BLOCK_SAMPLES - len(samples))
+
+    # Drums start hard, so pick the starting step size that codes the
+    # first block best rather than ramping up from the smallest step
+    first = padded[:ADPCM_BLOCK_SAMPLES]
+    start_index = min(range(89), key=lambda i: encode(first, 0, i)[3])
+
+    out = bytearray()
+    pred, index = 0, start_index
+    for b in range(n_blocks):
+        block = padded[b * ADPCM_BLOCK_SAMPLES:(b + 1) * ADPCM_BLOCK_SAMPLES]
+        out += (pred & 0xFFFF).to_bytes(2, 'little') + bytes([index, 0])
+        nibbles, pred, index, _ = encode(block, pred, index)
+        for i in range(0, len(nibbles), 2):
+            out.append(nibbles[i] | (nibbles[i + 1] << 4))
+
+    lines = []
+    for i in range(0, len(out), 16):
+        lines.append('   ' + ', '.join('0x%02x' % v for v in out[i:i + 16]) + ',')
+
+    with open(sys.argv[2], 'w') as f:
+        f.write('// Generated by tools/adpcm_encode.py from %s, do not edit\n'
+                % os.path.basename(sys.argv[1]))
+        f.write('#define %s_adpcm_len %d\n' % (name, len(samples)))
+        # Carry over the metadata from tools/sample_prep.py
+        for line in open(sys.argv[1]):
+            if re.match(r'#define\s+%s_(peak|gain|loop_start|loop_end)\s' % name, line):
+                f.write(line)
+        f.write('const uint8_t %s_adpcm[] = {\n' % name)
+        f.write('\n'.join(lines) + '\n};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,31 @@
+# Generate IMA ADPCM versions of the samples/*.h tables at build time and
+# build the given target to play them instead of the raw samples.
+#
+#    include(tools/adpcm_samples.cmake)
+#    drum_adpcm_samples(<target>)
+#
+find_package(Python3 COMPONENTS Interpreter REQUIRED)
+
+set(DRUM_SAMPLE_NAMES drum_clap drum_hihat drum_kick drum_perc drum_snare)
+set(DRUM_ADPCM_ENCODER ${CMAKE_CURRENT_LIST_DIR}/adpcm_encode.py)
+set(DRUM_SAMPLES_DIR ${CMAKE_CURRENT_LIST_DIR}/../samples)
+
+function(drum_adpcm_samples target)
+    set(outputs)
+    foreach(name ${DRUM_SAMPLE_NAMES})
+        set(out ${CMAKE_CURRENT_BINARY_DIR}/samples/${name}_adpcm.h)
+        add_custom_command(
+                OUTPUT ${out}
+                COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_CURRENT_BINARY_DIR}/samples
+                COMMAND ${Python3_EXECUTABLE} ${DRUM_ADPCM_ENCODER} ${DRUM_SAMPLES_DIR}/${name}.h ${out}
+                DEPENDS ${DRUM_ADPCM_ENCODER} ${DRUM_SAMPLES_DIR}/${name}.h
+                COMMENT "Encoding ${name} as IMA ADPCM"
+                )
+        list(APPEND outputs ${out})
+    endforeach()
+
+    add_custom_target(${target}_adpcm_samples DEPENDS ${outputs})
+    add_dependencies(${target} ${target}_adpcm_samples)
+    target_include_directories(${target} PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+    target_compile_definitions(${target} PRIVATE ADPCM_SAMPLES)
+endfunction()
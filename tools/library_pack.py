@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+#
+# library_pack.py : build a sample library image for external SPI flash
+#
+#    library_pack.py library.bin samples/big_tom.h samples/ride.h ...
+#
+# Each header should have been through sample_prep.py first, for its
+# loop points, peak and gain. The sounds are numbered after the built in
+# ones, in the order given, so with the 5 built in drums the first one
+# here is sound 5 in a song's rows.
+#
+# The image layout is described in drum_engine.h and must match it. It
+# goes at address 0 of the external flash, written with whatever
+# programmer the board has.
+#
+import struct
+import sys
+
+from sample_prep import read_header
+
+LIBRARY_MAGIC = 0x4C44
+LIBRARY_VERSION = 1
+LIBRARY_HEADER_BYTES = 4
+LIBRARY_ENTRY_BYTES = 20
+MAX_SOUNDS = 32 - 5
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit("usage: library_pack.py <library.bin> <samples/name.h> ...")
+    sounds = [read_header(path) for path in sys.argv[2:]]
+    if len(sounds) > MAX_SOUNDS:
+        sys.exit("at most %d sounds fit alongside the built in ones" % MAX_SOUNDS)
+
+    entries, data = b'', b''
+    offset = LIBRARY_HEADER_BYTES + LIBRARY_ENTRY_BYTES * len(sounds)
+    for name, samples, meta in sounds:
+        peak = meta.get('peak', max(abs(v) for v in samples))
+        entries += struct.pack('<IIIIHH', offset + len(data), len(samples),
+                               meta.get('loop_start', 0), meta.get('loop_end', 0),
+                               peak, meta.get('gain', 4096))
+        data += struct.pack('<%dh' % len(samples), *samples)
+
+    with open(sys.argv[1], 'wb') as f:
+        f.write(struct.pack('<HBB', LIBRARY_MAGIC, LIBRARY_VERSION, len(sounds)))
+        f.write(entries + data)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+#
+# sample_prep.py : trim a samples/*.h table and add its metadata
+#
+#    sample_prep.py [--floor-db 60] [--loop START:END] samples/drum_kick.h [out.h]
+#
+# Leading exact silence is dropped, and so is the tail once it stays more
+# than --floor-db below the peak, so the mixer doesn't spend time on
+# frames no one can hear. The header is then written (in place, unless
+# out.h is given) with these ahead of the table:
+#
+#    <name>_len         samples left after trimming
+#    <name>_peak        largest magnitude
+#    <name>_gain        Q12 gain that would bring the peak to -1dBFS
+#    <name>_loop_start  loop points, in samples after trimming, both 0 for
+#    <name>_loop_end    no loop
+#
+# Running it again on its own output changes nothing, and keeps the loop
+# points unless new ones are given. adpcm_encode.py carries the metadata
+# over into the ADPCM headers.
+#
+import argparse
+import re
+
+TARGET_PEAK = 29204     # -1dBFS
+GAIN_ONE = 4096         # Q12
+PER_LINE = 16
+
+
+def read_header(path):
+    text = open(path).read()
+    name = re.search(r'int16_t\s+(\w+)\s*\[\s*\]', text).group(1)
+    body = text[text.index('{') + 1:text.index('}')]
+    samples = [int(v) for v in re.findall(r'-?\d+', body)]
+    meta = dict((k, int(v)) for k, v in re.findall(
+        r'#define\s+%s_(\w+)\s+(-?\d+)' % name, text))
+    return name, samples, meta
+
+
+def trim(samples, floor_db):
+    peak = max(abs(v) for v in samples)
+    floor = peak / 10 ** (floor_db / 20)
+    start = next(i for i, v in enumerate(samples) if v != 0)
+    end = max(i for i, v in enumerate(samples) if abs(v) >= floor) + 1
+    return samples[start:end], start
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--floor-db', type=float, default=60)
+    parser.add_argument('--loop', help='START:END, in samples of the input')
+    parser.add_argument('header')
+    parser.add_argument('output', nargs='?')
+    args = parser.parse_args()
+
+    name, samples, meta = read_header(args.header)
+    trimmed, start = trim(samples, args.floor_db)
+    peak = max(abs(v) for v in trimmed)
+    gain = min(65535, round(TARGET_PEAK * GAIN_ONE / peak))
+
+    loop_start = meta.get('loop_start', 0)
+    loop_end = meta.get('loop_end', 0)
+    if args.loop:
+        loop_start, loop_end = (int(v) - start for v in args.loop.split(':'))
+    if loop_end:
+        loop_end = min(loop_end, len(trimmed))
+        if not 0 <= loop_start < loop_end:
+            parser.error('the loop is outside the trimmed sample')
+
+    lines = []
+    for i in range(0, len(trimmed), PER_LINE):
+        lines.append(''.join('%7d,' % v for v in trimmed[i:i + PER_LINE]))
+
+    with open(args.output or args.header, 'w') as f:
+        f.write('// Prepared by tools/sample_prep.py, trimmed at -%gdB\n' % args.floor_db)
+        f.write('#define %s_len        %d\n' % (name, len(trimmed)))
+        f.write('#define %s_peak       %d\n' % (name, peak))
+        f.write('#define %s_gain       %d\n' % (name, gain))
+        f.write('#define %s_loop_start %d\n' % (name, loop_start))
+        f.write('#define %s_loop_end   %d\n' % (name, loop_end))
+        f.write('const int16_t %s[] = {\n' % name)
+        f.write('\n'.join(lines).rstrip(',') + '\n};\n')
+
+
+if __name__ == '__main__':
+    main()
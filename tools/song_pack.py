@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+#
+# song_pack.py : build a song image for the drum machine's flash banks
+#
+#    song_pack.py songs/demo.txt demo.bin
+#
+# The text form is a line per setting, '#' starts a comment:
+#
+#    tempo 155                  BPM (may be fractional), or leave it out
+#    row <pan> <volume> <sound> [semitones] [decay=ms] [gate=ms] [choke=n]
+#        [lowpass=Hz] [out=n]   one for each of the 6 rows, sound -1 for
+#                               none, optionally retuned (up to +24), with
+#                               a decay half life, a gate time, a choke
+#                               group (rows in a group cut each other off),
+#                               a low-pass filter, or played on another
+#                               I2S output than the first (out=0)
+#    pattern                    followed by one line per row, BAR_LEN (72)
+#                               characters of ' ' or a velocity '1' to '9'
+#    bars 0 0 2 2 1             the pattern for each bar of the loop
+#
+# The image layout is described in drum_engine.h and must match it.
+# Load it into bank n with something like
+#
+#    picotool load -o <0x101F8000 + (n-1)*0x1000> demo.bin
+#
+import struct
+import sys
+
+SONG_MAGIC = 0x4D44
+SONG_VERSION = 5
+N_ROWS = 6
+BAR_LEN = 72
+
+
+def parse(path):
+    tempo, rows, patterns, bars = 0, [], [], []
+    with open(path) as f:
+        lines = [l.rstrip('\n') for l in f]
+
+    i = 0
+    while i < len(lines):
+        words = lines[i].split('#')[0].split()
+        i += 1
+        if not words:
+            continue
+        if words[0] == 'tempo':
+            tempo = round(float(words[1]) * 100)
+        elif words[0] == 'row':
+            opts = dict(w.split('=', 1) for w in words[4:] if '=' in w)
+            plain = [w for w in words[4:] if '=' not in w]
+            semitones = float(plain[0]) if plain else 0.0
+            rate = round(2 ** (semitones / 12) * 0x10000)
+            if not 0 < rate <= 4 * 0x10000:
+                sys.exit("%s:%d: can't retune by %s" % (path, i, plain[0]))
+            rows.append(tuple(int(w) for w in words[1:4]) + (
+                rate, int(opts.get('decay', 0)), int(opts.get('gate', 0)),
+                int(opts.get('choke', 0)), int(opts.get('lowpass', 0)),
+                int(opts.get('out', 0))))
+        elif words[0] == 'bars':
+            bars += [int(w) for w in words[1:]]
+        elif words[0] == 'pattern':
+            grid = [l.ljust(BAR_LEN)[:BAR_LEN] for l in lines[i:i + N_ROWS]]
+            i += N_ROWS
+            patterns.append(grid)
+        else:
+            sys.exit("%s:%d: don't know '%s'" % (path, i, words[0]))
+
+    if len(rows) != N_ROWS:
+        sys.exit("%s: needs %d rows" % (path, N_ROWS))
+    if not patterns or not bars or max(bars) >= len(patterns):
+        sys.exit("%s: needs patterns, and bars that refer to them" % path)
+    return tempo, rows, patterns, bars
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: song_pack.py <song.txt> <song.bin>")
+    tempo, rows, patterns, bars = parse(sys.argv[1])
+
+    out = struct.pack('<HBBBBH', SONG_MAGIC, SONG_VERSION, N_ROWS,
+                      len(patterns), len(bars), tempo)
+    for pan, volume, sound, rate, decay, gate, choke, lowpass, output in rows:
+        out += struct.pack('<BBbIHHBHB', pan, volume, sound, rate, decay, gate,
+                           choke, lowpass, output)
+    out += bytes(bars)
+    for grid in patterns:
+        steps = [(tick, row, int(grid[row][tick]) - 1)
+                 for tick in range(BAR_LEN) for row in range(N_ROWS)
+                 if grid[row][tick] != ' ']
+        out += struct.pack('<H', len(steps))
+        for tick, row, vel in steps:
+            out += struct.pack('<BB', tick, row << 4 | vel)
+
+    with open(sys.argv[2], 'wb') as f:
+        f.write(out)
+
+
+if __name__ == '__main__':
+    main()
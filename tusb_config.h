@@ -0,0 +1,21 @@
+///////////////////////////////////////////////////////////////////////
+// tusb_config.h : TinyUSB set up as a USB MIDI device (see midi_usb.c)
+///////////////////////////////////////////////////////////////////////
+#ifndef _TUSB_CONFIG_H_
+#define _TUSB_CONFIG_H_
+
+#define CFG_TUSB_RHPORT0_MODE   OPT_MODE_DEVICE
+#define CFG_TUSB_OS             OPT_OS_PICO
+
+#define CFG_TUD_ENDPOINT0_SIZE  64
+
+#define CFG_TUD_CDC             0
+#define CFG_TUD_MSC             0
+#define CFG_TUD_HID             0
+#define CFG_TUD_MIDI            1
+#define CFG_TUD_VENDOR          0
+
+#define CFG_TUD_MIDI_RX_BUFSIZE 64
+#define CFG_TUD_MIDI_TX_BUFSIZE 64
+
+#endif
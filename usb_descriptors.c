@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////
+// usb_descriptors.c : USB descriptors for the MIDI device (midi_usb.c)
+///////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "tusb.h"
+
+#define USB_VID 0x2E8A   // Raspberry Pi
+#define USB_PID 0x10DE
+
+static const tusb_desc_device_t desc_device = {
+    .bLength            = sizeof(tusb_desc_device_t),
+    .bDescriptorType    = TUSB_DESC_DEVICE,
+    .bcdUSB             = 0x0200,
+    .bDeviceClass       = 0x00,
+    .bDeviceSubClass    = 0x00,
+    .bDeviceProtocol    = 0x00,
+    .bMaxPacketSize0    = CFG_TUD_ENDPOINT0_SIZE,
+    .idVendor           = USB_VID,
+    .idProduct          = USB_PID,
+    .bcdDevice          = 0x0100,
+    .iManufacturer      = 0x01,
+    .iProduct           = 0x02,
+    .iSerialNumber      = 0x03,
+    .bNumConfigurations = 0x01
+};
+
+const uint8_t *tud_descriptor_device_cb(void) {
+    return (const uint8_t *)&desc_device;
+}
+
+enum { ITF_NUM_MIDI = 0, ITF_NUM_MIDI_STREAMING, ITF_NUM_TOTAL };
+
+#define EPNUM_MIDI_OUT   0x01
+#define EPNUM_MIDI_IN    0x81
+#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + TUD_MIDI_DESC_LEN)
+
+static const uint8_t desc_configuration[] = {
+    TUD_CONFIG_DESCRIPTOR(1, ITF_NUM_TOTAL, 0, CONFIG_TOTAL_LEN, 0x00, 100),
+    TUD_MIDI_DESCRIPTOR(ITF_NUM_MIDI, 0, EPNUM_MIDI_OUT, EPNUM_MIDI_IN, 64)
+};
+
+const uint8_t *tud_descriptor_configuration_cb(uint8_t index) {
+    (void)index;
+    return desc_configuration;
+}
+
+static const char *string_desc[] = {
+    NULL,              // 0: language, handled below
+    "Mike Field",      // 1: Manufacturer
+    "Pico Drummer",    // 2: Product
+    "0001",            // 3: Serial
+};
+
+static uint16_t desc_str[32];
+
+const uint16_t *tud_descriptor_string_cb(uint8_t index, uint16_t langid) {
+    (void)langid;
+    int len;
+
+    if(index == 0) {
+       desc_str[1] = 0x0409;   // English
+       len = 1;
+    } else {
+       if(index >= sizeof(string_desc)/sizeof(string_desc[0]))
+          return NULL;
+       const char *str = string_desc[index];
+       len = strlen(str);
+       if(len > 31)
+          len = 31;
+       for(int i = 0; i < len; i++)
+          desc_str[1+i] = str[i];
+    }
+
+    // First word is the length in bytes and the descriptor type
+    desc_str[0] = (TUSB_DESC_STRING << 8) | (2*len + 2);
+    return desc_str;
+}